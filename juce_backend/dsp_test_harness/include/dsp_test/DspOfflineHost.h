@@ -442,7 +442,7 @@ public:
     );
 
 private:
-    // Cross-correlation for alignment
+    // FFT cross-correlation for alignment
     static int findLag(
         const float* a,
         const float* b,
@@ -0,0 +1,81 @@
+/*
+  ==============================================================================
+
+    RealFft.h
+    Radix-2 real FFT for offline analysis in the DSP test harness.
+
+    Features:
+    - Real input of length N computed as an N/2-point complex FFT plus a
+      split (real-packing) pass, giving the N/2 + 1 non-negative bins
+    - Twiddle and bit-reversal tables built once per size
+    - Shared, immutable instances per size (forSize) so worker threads can
+      transform concurrently without locking
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <complex>
+#include <memory>
+#include <vector>
+
+namespace DspTest {
+
+/**
+ * @brief Power-of-two real FFT with cached twiddles
+ *
+ * All transform methods are const and work in caller-provided buffers,
+ * so one instance may be shared between threads.
+ */
+class RealFft
+{
+public:
+    /**
+     * @brief Build tables for a transform of the given size
+     *
+     * @param size  Number of real samples (power of two, >= 2)
+     */
+    explicit RealFft(int size);
+
+    /**
+     * @brief Shared instance for a size, created on first use
+     */
+    static std::shared_ptr<const RealFft> forSize(int size);
+
+    /**
+     * @brief Smallest power of two >= n (minimum 2)
+     */
+    static int nextPowerOfTwo(int n);
+
+    int getSize() const { return size_; }
+    int getNumBins() const { return half_ + 1; }
+
+    /**
+     * @brief Forward transform
+     *
+     * @param input     size real samples
+     * @param spectrum  size / 2 + 1 bins (unnormalised, bin k = sum x[n] e^{-2 pi i k n / N})
+     */
+    void forward(const double* input, std::complex<double>* spectrum) const;
+
+    /**
+     * @brief Inverse transform, scaled so that inverse(forward(x)) == x
+     *
+     * @param spectrum  size / 2 + 1 bins of a real signal
+     * @param output    size real samples
+     */
+    void inverse(const std::complex<double>* spectrum, double* output) const;
+
+private:
+    // In-place complex FFT of length half_
+    void transformComplex(std::complex<double>* data, bool inverse) const;
+
+    int size_ = 0;                               // N (real samples)
+    int half_ = 0;                               // M = N / 2 (complex points)
+    std::vector<std::complex<double>> twiddles_; // e^{-2 pi i k / M}, k < M / 2
+    std::vector<std::complex<double>> split_;    // e^{-2 pi i k / N}, k <= M
+    std::vector<int> bitReverse_;                // Permutation for length M
+};
+
+} // namespace DspTest
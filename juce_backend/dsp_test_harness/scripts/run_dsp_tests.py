@@ -11,10 +11,12 @@ Usage:
 """
 
 import argparse
+import io
 import json
 import os
 import subprocess
 import sys
+from concurrent.futures import ThreadPoolExecutor
 import numpy as np
 import wave
 from dataclasses import dataclass
@@ -135,29 +137,22 @@ def snr_db(a: np.ndarray, b: np.ndarray) -> float:
 
 
 def xcorr_align(a: np.ndarray, b: np.ndarray, max_lag: int = 2048) -> int:
-    """Find alignment offset using cross-correlation."""
-    a0 = a[:, 0]
-    b0 = b[:, 0]
-    best_lag = 0
-    best = -1e30
-
-    for lag in range(-max_lag, max_lag + 1):
-        if lag < 0:
-            aa = a0[-lag:]
-            bb = b0[:len(aa)]
-        else:
-            aa = a0[:len(a0) - lag]
-            bb = b0[lag:lag + len(aa)]
+    """Find alignment offset using FFT cross-correlation."""
+    a0 = a[:, 0].astype(np.float64)
+    b0 = b[:, 0].astype(np.float64)
 
-        if len(aa) < 256:
-            continue
+    # Lags need at least 256 overlapping samples
+    max_lag = min(max_lag, len(a0) - 256, len(b0) - 256)
+    if max_lag < 0:
+        return 0
 
-        s = float(np.dot(aa, bb))
-        if s > best:
-            best = s
-            best_lag = lag
+    # corr[lag] = sum a[i] * b[i + lag]; padding to len + max_lag avoids wrap-around
+    nfft = 1 << int(np.ceil(np.log2(max(len(a0), len(b0)) + max_lag)))
+    corr = np.fft.irfft(np.conj(np.fft.rfft(a0, nfft)) * np.fft.rfft(b0, nfft), nfft)
 
-    return best_lag
+    lags = np.arange(-max_lag, max_lag + 1)
+    # argmax returns the first maximum, matching the direct scan order
+    return int(lags[int(np.argmax(corr[lags]))])
 
 
 def apply_lag(x: np.ndarray, lag: int) -> np.ndarray:
@@ -268,6 +263,7 @@ def run_test(
     instrument: str,
     test_name: str,
     output_dir: str,
+    log=sys.stdout,
 ) -> Tuple[np.ndarray, int, AudioMetrics, bool]:
     """Run a single test and return audio, SR, metrics, and success."""
     os.makedirs(output_dir, exist_ok=True)
@@ -275,12 +271,12 @@ def run_test(
 
     # Run test host binary
     cmd = [bin_path, "--instrument", instrument, "--test", test_name, "--output", out_wav]
-    print(f"Running: {' '.join(cmd)}")
+    print(f"Running: {' '.join(cmd)}", file=log)
 
     result = subprocess.run(cmd, capture_output=True, text=True)
 
     if result.returncode != 0:
-        print(f"STDERR: {result.stderr}")
+        print(f"STDERR: {result.stderr}", file=log)
         raise RuntimeError(f"Test failed with code {result.returncode}")
 
     # Read output
@@ -308,6 +304,69 @@ def run_test(
     return audio, sr, metrics, ok
 
 
+def analyse_test(args, test_name: str, golden_dir: Path, out_dir: Path, log=sys.stdout) -> Dict:
+    """Run one test, print its metrics and compare against the golden file."""
+    print(f"\n{'='*60}", file=log)
+    print(f"Test: {test_name}", file=log)
+    print(f"{'='*60}", file=log)
+
+    try:
+        audio, sr, metrics, ok = run_test(
+            args.bin,
+            args.instrument,
+            test_name,
+            str(out_dir),
+            log,
+        )
+
+        # Print metrics
+        print(f"\nMetrics:", file=log)
+        print(f"  RMS:        {metrics.rms:.6f}", file=log)
+        print(f"  Peak:       {metrics.peak:.6f}", file=log)
+        print(f"  DC Offset:  {metrics.dc_offset:.6f}", file=log)
+        print(f"  NaN Count:  {metrics.nan_count}", file=log)
+        print(f"  Inf Count:  {metrics.inf_count}", file=log)
+        print(f"  Clipped:    {metrics.clipped_samples}", file=log)
+        print(f"  ZCR/s:      {metrics.zero_crossings_per_sec:.2f}", file=log)
+        print(f"  FFT Peak:   {metrics.fft_peak_hz:.1f} Hz @ {metrics.fft_peak_db:.1f} dB", file=log)
+
+        # Golden comparison
+        golden = None
+        golden_path = golden_dir / f"{test_name}.wav"
+
+        if args.update_golden:
+            # Update golden
+            golden_path.parent.mkdir(parents=True, exist_ok=True)
+            write_wav(str(golden_path), audio, sr)
+            print(f"\nGolden updated: {golden_path}", file=log)
+            golden_result = None
+        elif golden_path.exists():
+            # Compare to golden
+            g_audio, _ = read_wav(str(golden_path))
+            golden_result = compare_to_golden(audio, g_audio)
+            print(f"\nGolden comparison:", file=log)
+            print(f"  {golden_result.details}", file=log)
+            ok = ok and golden_result.pass
+        else:
+            print(f"\nNo golden file found (use --update-golden to create)", file=log)
+            golden_result = None
+
+        return {
+            "test": test_name,
+            "pass": ok,
+            "metrics": metrics.to_dict(),
+            "golden": golden_result.to_dict() if golden_result else None,
+        }
+
+    except Exception as e:
+        print(f"\nERROR: {e}", file=log)
+        return {
+            "test": test_name,
+            "pass": False,
+            "error": str(e),
+        }
+
+
 def main():
     parser = argparse.ArgumentParser(
         description="DSP Audio Test Runner - Headless testing for InstrumentDSP"
@@ -319,6 +378,7 @@ def main():
     parser.add_argument("--update-golden", action="store_true", help="Update golden files")
     parser.add_argument("--test", help="Run specific test only")
     parser.add_argument("--verbose", "-v", action="store_true", help="Verbose output")
+    parser.add_argument("--jobs", "-j", type=int, default=0, help="Parallel tests (default: CPU count)")
 
     args = parser.parse_args()
 
@@ -330,67 +390,21 @@ def main():
     # Determine which tests to run
     tests_to_run = [args.test] if args.test else [t[0] for t in TESTS]
 
-    results = []
+    def run_one(test_name: str) -> Tuple[str, Dict]:
+        """Render and analyse one test, capturing its report."""
+        log = io.StringIO()
+        result = analyse_test(args, test_name, golden_dir, out_dir, log)
+        return log.getvalue(), result
+
+    # Each test renders in its own process; analysis (numpy) releases the GIL
+    jobs = max(1, args.jobs or os.cpu_count() or 1)
+    with ThreadPoolExecutor(max_workers=jobs) as pool:
+        outcomes = list(pool.map(run_one, tests_to_run))
 
-    for test_name in tests_to_run:
-        print(f"\n{'='*60}")
-        print(f"Test: {test_name}")
-        print(f"{'='*60}")
-
-        try:
-            audio, sr, metrics, ok = run_test(
-                args.bin,
-                args.instrument,
-                test_name,
-                str(out_dir),
-            )
-
-            # Print metrics
-            print(f"\nMetrics:")
-            print(f"  RMS:        {metrics.rms:.6f}")
-            print(f"  Peak:       {metrics.peak:.6f}")
-            print(f"  DC Offset:  {metrics.dc_offset:.6f}")
-            print(f"  NaN Count:  {metrics.nan_count}")
-            print(f"  Inf Count:  {metrics.inf_count}")
-            print(f"  Clipped:    {metrics.clipped_samples}")
-            print(f"  ZCR/s:      {metrics.zero_crossings_per_sec:.2f}")
-            print(f"  FFT Peak:   {metrics.fft_peak_hz:.1f} Hz @ {metrics.fft_peak_db:.1f} dB")
-
-            # Golden comparison
-            golden = None
-            golden_path = golden_dir / f"{test_name}.wav"
-
-            if args.update_golden:
-                # Update golden
-                golden_path.parent.mkdir(parents=True, exist_ok=True)
-                write_wav(str(golden_path), audio, sr)
-                print(f"\nGolden updated: {golden_path}")
-                golden_result = None
-            elif golden_path.exists():
-                # Compare to golden
-                g_audio, _ = read_wav(str(golden_path))
-                golden_result = compare_to_golden(audio, g_audio)
-                print(f"\nGolden comparison:")
-                print(f"  {golden_result.details}")
-                ok = ok and golden_result.pass
-            else:
-                print(f"\nNo golden file found (use --update-golden to create)")
-                golden_result = None
-
-            results.append({
-                "test": test_name,
-                "pass": ok,
-                "metrics": metrics.to_dict(),
-                "golden": golden_result.to_dict() if golden_result else None,
-            })
-
-        except Exception as e:
-            print(f"\nERROR: {e}")
-            results.append({
-                "test": test_name,
-                "pass": False,
-                "error": str(e),
-            })
+    results = []
+    for log, result in outcomes:
+        print(log, end="")
+        results.append(result)
 
     # Summary
     print(f"\n{'='*60}")
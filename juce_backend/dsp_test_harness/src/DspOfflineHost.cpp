@@ -8,6 +8,7 @@
 */
 
 #include "dsp_test/DspOfflineHost.h"
+#include "dsp_test/RealFft.h"
 #include <cstring>
 #include <cmath>
 #include <cstdio>
@@ -149,30 +150,18 @@ double DspOfflineHost::computeFftPeak(
         windowed[i] = audio[i] * win;
     }
 
-    // Real FFT (naive implementation for portability)
-    // For production, use FFTW or Apple vDSP
-    int nfreq = nfft / 2 + 1;
-    std::vector<std::complex<double>> fft(nfreq);
-
-    // DFT for positive frequencies only
-    for (int k = 0; k < nfreq; ++k)
-    {
-        std::complex<double> sum(0.0, 0.0);
-        for (int n = 0; n < nfft; ++n)
-        {
-            double phase = -2.0 * M_PI * k * n / nfft;
-            std::complex<double> twiddle(cos(phase), sin(phase));
-            sum += twiddle * std::complex<double>(windowed[n], 0.0);
-        }
-        fft[k] = sum;
-    }
+    // Real FFT (shared instance per size, tables built once)
+    auto fft = RealFft::forSize(nfft);
+    int nfreq = fft->getNumBins();
+    std::vector<std::complex<double>> spectrum(nfreq);
+    fft->forward(windowed.data(), spectrum.data());
 
     // Find peak magnitude
     double maxMag = 0.0;
     int maxK = 0;
     for (int k = 1; k < nfreq; ++k)  // Skip DC
     {
-        double mag = std::abs(fft[k]);
+        double mag = std::abs(spectrum[k]);
         if (mag > maxMag)
         {
             maxMag = mag;
@@ -638,28 +627,40 @@ int GoldenComparator::findLag(
     int frames,
     int maxLag)
 {
-    // Use channel 0 for alignment
+    // Lags with no overlap are never candidates
+    maxLag = std::min(maxLag, frames - 1);
+    if (maxLag < 0)
+        return 0;
+
+    // corr[lag] = sum a[i] * b[i + lag], via IFFT(conj(A) * B). Zero padding to
+    // frames + maxLag keeps the circular wrap-around out of the searched lags.
+    auto fft = RealFft::forSize(RealFft::nextPowerOfTwo(frames + maxLag));
+    const int nfft = fft->getSize();
+    const int nfreq = fft->getNumBins();
+
+    std::vector<double> padded(nfft, 0.0);
+    std::vector<std::complex<double>> specA(nfreq), specB(nfreq);
+
+    std::copy(a, a + frames, padded.begin());
+    fft->forward(padded.data(), specA.data());
+
+    std::copy(b, b + frames, padded.begin());
+    fft->forward(padded.data(), specB.data());
+
+    for (int k = 0; k < nfreq; ++k)
+        specB[k] *= std::conj(specA[k]);
+
+    fft->inverse(specB.data(), padded.data());
+
+    // Same scan order as the direct search: first maximum wins
     int bestLag = 0;
     double bestCorr = -1e30;
 
     for (int lag = -maxLag; lag <= maxLag; ++lag)
     {
-        double corr = 0.0;
-        int count = 0;
-
-        for (int i = 0; i < frames; ++i)
-        {
-            int idxA = i;
-            int idxB = i + lag;
-
-            if (idxB < 0 || idxB >= frames)
-                continue;
-
-            corr += double(a[idxA]) * double(b[idxB]);
-            count++;
-        }
+        double corr = padded[lag < 0 ? nfft + lag : lag];
 
-        if (count > 0 && corr > bestCorr)
+        if (corr > bestCorr)
         {
             bestCorr = corr;
             bestLag = lag;
@@ -0,0 +1,157 @@
+/*
+  ==============================================================================
+
+    RealFft.cpp
+    Implementation of the harness real FFT
+
+  ==============================================================================
+*/
+
+#include "dsp_test/RealFft.h"
+#include <cassert>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace DspTest {
+
+RealFft::RealFft(int size)
+    : size_(size), half_(size / 2)
+{
+    assert(size >= 2 && (size & (size - 1)) == 0);
+
+    const double twoPi = 2.0 * M_PI;
+
+    twiddles_.resize(half_ / 2);
+    for (int k = 0; k < half_ / 2; ++k)
+        twiddles_[k] = std::polar(1.0, -twoPi * k / half_);
+
+    split_.resize(half_ + 1);
+    for (int k = 0; k <= half_; ++k)
+        split_[k] = std::polar(1.0, -twoPi * k / size_);
+
+    int bits = 0;
+    while ((1 << bits) < half_)
+        ++bits;
+
+    bitReverse_.resize(half_);
+    for (int i = 0; i < half_; ++i)
+    {
+        int r = 0;
+        for (int b = 0; b < bits; ++b)
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        bitReverse_[i] = r;
+    }
+}
+
+std::shared_ptr<const RealFft> RealFft::forSize(int size)
+{
+    static std::mutex cacheMutex;
+    static std::map<int, std::shared_ptr<const RealFft>> cache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto& entry = cache[size];
+    if (!entry)
+        entry = std::make_shared<const RealFft>(size);
+    return entry;
+}
+
+int RealFft::nextPowerOfTwo(int n)
+{
+    int size = 2;
+    while (size < n)
+        size <<= 1;
+    return size;
+}
+
+void RealFft::transformComplex(std::complex<double>* data, bool inverse) const
+{
+    for (int i = 0; i < half_; ++i)
+    {
+        const int j = bitReverse_[i];
+        if (i < j)
+            std::swap(data[i], data[j]);
+    }
+
+    for (int len = 2; len <= half_; len <<= 1)
+    {
+        const int halfLen = len / 2;
+        const int step = half_ / len;
+
+        for (int start = 0; start < half_; start += len)
+        {
+            for (int j = 0; j < halfLen; ++j)
+            {
+                const std::complex<double> w = inverse ? std::conj(twiddles_[j * step])
+                                                       : twiddles_[j * step];
+                const std::complex<double> u = data[start + j];
+                const std::complex<double> v = data[start + j + halfLen] * w;
+                data[start + j] = u + v;
+                data[start + j + halfLen] = u - v;
+            }
+        }
+    }
+}
+
+void RealFft::forward(const double* input, std::complex<double>* spectrum) const
+{
+    // Pack even/odd samples as one complex sequence of half the length
+    for (int n = 0; n < half_; ++n)
+        spectrum[n] = std::complex<double>(input[2 * n], input[2 * n + 1]);
+
+    transformComplex(spectrum, false);
+
+    // Split: X[k] = E[k] + W^k O[k], with E/O the spectra of the even/odd samples
+    const std::complex<double> z0 = spectrum[0];
+    spectrum[0] = std::complex<double>(z0.real() + z0.imag(), 0.0);
+    spectrum[half_] = std::complex<double>(z0.real() - z0.imag(), 0.0);
+
+    const std::complex<double> minusHalfI(0.0, -0.5);
+
+    for (int k = 1; k <= half_ / 2; ++k)
+    {
+        const int j = half_ - k;
+        const std::complex<double> a = spectrum[k];
+        const std::complex<double> b = spectrum[j];
+
+        const std::complex<double> evenK = 0.5 * (a + std::conj(b));
+        const std::complex<double> oddK = minusHalfI * (a - std::conj(b));
+        const std::complex<double> evenJ = 0.5 * (b + std::conj(a));
+        const std::complex<double> oddJ = minusHalfI * (b - std::conj(a));
+
+        spectrum[k] = evenK + split_[k] * oddK;
+        spectrum[j] = evenJ + split_[j] * oddJ;
+    }
+}
+
+void RealFft::inverse(const std::complex<double>* spectrum, double* output) const
+{
+    // Output doubles as the packed complex sequence (re = even, im = odd samples)
+    auto* packed = reinterpret_cast<std::complex<double>*>(output);
+    const std::complex<double> i(0.0, 1.0);
+
+    for (int k = 0; k <= half_ / 2; ++k)
+    {
+        const int j = half_ - k;
+
+        const std::complex<double> evenK = 0.5 * (spectrum[k] + std::conj(spectrum[j]));
+        const std::complex<double> oddK = 0.5 * (spectrum[k] - std::conj(spectrum[j])) * std::conj(split_[k]);
+        packed[k] = evenK + i * oddK;
+
+        if (j != k && j < half_)
+        {
+            const std::complex<double> evenJ = 0.5 * (spectrum[j] + std::conj(spectrum[k]));
+            const std::complex<double> oddJ = 0.5 * (spectrum[j] - std::conj(spectrum[k])) * std::conj(split_[j]);
+            packed[j] = evenJ + i * oddJ;
+        }
+    }
+
+    transformComplex(packed, true);
+
+    const double scale = 1.0 / half_;
+    for (int n = 0; n < size_; ++n)
+        output[n] *= scale;
+}
+
+} // namespace DspTest
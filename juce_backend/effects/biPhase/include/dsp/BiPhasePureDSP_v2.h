@@ -14,6 +14,8 @@
     - Feedback: 0.0 to 0.98 (regenerative resonance)
     - Shape: Sine or Square LFO wave
     - Control-rate updates for efficiency
+    - Sweep coefficients from a precomputed table (no pow/tan per sample)
+    - Routing resolved per block; A/B cascades share SIMD lanes
     - Zero heap allocation in audio thread
     - Deterministic execution
 
@@ -24,7 +26,15 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <algorithm>
+#include <utility>
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+#elif defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+#endif
 
 namespace DSP {
 
@@ -884,6 +894,130 @@ private:
     float coeff = 0.999f;  // Default: very slow smoothing
 };
 
+//==============================================================================
+// All-Pass Sweep Table (Exponential Sweep -> Coefficient)
+//==============================================================================
+
+// Full sweep range of each phasor; sweep bias selects a sub-range of it
+constexpr float kSweepMinFreq = 200.0f;
+constexpr float kSweepMaxFreq = 5000.0f;
+
+/**
+ * Sub-range of the sweep table used by one phasor
+ *
+ * A biased range [min * r^start, min * r^(start + span)] with r = max/min
+ * is the same exponential curve as the full range, just entered at
+ * `start`, so bias never needs its own pow().
+ */
+struct SweepRange
+{
+    float start = 0.0f;   // Table position at modSignal = -1
+    float span = 1.0f;    // Table distance from modSignal = -1 to +1
+};
+
+/**
+ * All-pass coefficient across the full sweep, precomputed in prepare()
+ *
+ * Entry k holds a = -tan(PI * f / fs) for f = minFreq * (maxFreq/minFreq)^(k/N).
+ * Reading it back with linear interpolation replaces the per-sample pow()
+ * and tan() with a multiply-add; the error is below 3e-6 at 44.1 kHz and
+ * shrinks at higher sample rates.
+ */
+class AllPassSweepTable
+{
+public:
+    static constexpr int kSize = 512;
+
+    void prepare(double sampleRate, float minFreq, float maxFreq)
+    {
+        // Keep the top of the sweep below Nyquist so tan() stays finite
+        const double maxStableFreq = 0.49 * sampleRate;
+
+        for (int i = 0; i <= kSize; ++i)
+        {
+            double position = static_cast<double>(i) / kSize;
+            double freq = std::min(minFreq * std::pow(static_cast<double>(maxFreq) / minFreq, position), maxStableFreq);
+            coefficients_[i] = static_cast<float>(-std::tan(M_PI * freq / sampleRate));
+        }
+
+        // Guard entry so position 1.0 interpolates without a bounds check
+        coefficients_[kSize + 1] = coefficients_[kSize];
+    }
+
+    // position: 0.0 (minFreq) to 1.0 (maxFreq); clamped to the table
+    inline float lookup(float position) const
+    {
+        float scaled = std::clamp(position, 0.0f, 1.0f) * static_cast<float>(kSize);
+        int index = static_cast<int>(scaled);
+        float frac = scaled - static_cast<float>(index);
+        return coefficients_[index] + frac * (coefficients_[index + 1] - coefficients_[index]);
+    }
+
+    // Coefficient for an LFO value (-1..1) swept across `range`
+    inline float coefficient(const SweepRange& range, float modSignal) const
+    {
+        return lookup(range.start + (modSignal + 1.0f) * 0.5f * range.span);
+    }
+
+private:
+    std::array<float, kSize + 2> coefficients_ {};
+};
+
+//==============================================================================
+// Phasor Lanes (Phasor A and B Side by Side)
+//==============================================================================
+
+// Phasor A in lane 0, phasor B in lane 1; state is stored as [A, B] pairs
+#if defined(__ARM_NEON) || defined(__aarch64__)
+
+struct PhasorLanes
+{
+    using Vec = float32x2_t;
+
+    static Vec load(const float* p) { return vld1_f32(p); }
+    static void store(float* p, Vec v) { vst1_f32(p, v); }
+    static Vec make(float a, float b) { return vset_lane_f32(b, vdup_n_f32(a), 1); }
+    static Vec add(Vec x, Vec y) { return vadd_f32(x, y); }
+    static Vec sub(Vec x, Vec y) { return vsub_f32(x, y); }
+    static Vec mul(Vec x, Vec y) { return vmul_f32(x, y); }
+    static float laneA(Vec v) { return vget_lane_f32(v, 0); }
+    static float laneB(Vec v) { return vget_lane_f32(v, 1); }
+};
+
+#elif defined(__SSE__) || defined(_M_X64)
+
+struct PhasorLanes
+{
+    using Vec = __m128;  // Upper two lanes unused
+
+    static Vec load(const float* p) { return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p)); }
+    static void store(float* p, Vec v) { _mm_storel_pi(reinterpret_cast<__m64*>(p), v); }
+    static Vec make(float a, float b) { return _mm_setr_ps(a, b, 0.0f, 0.0f); }
+    static Vec add(Vec x, Vec y) { return _mm_add_ps(x, y); }
+    static Vec sub(Vec x, Vec y) { return _mm_sub_ps(x, y); }
+    static Vec mul(Vec x, Vec y) { return _mm_mul_ps(x, y); }
+    static float laneA(Vec v) { return _mm_cvtss_f32(v); }
+    static float laneB(Vec v) { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+};
+
+#else
+
+struct PhasorLanes
+{
+    struct Vec { float a, b; };
+
+    static Vec load(const float* p) { return { p[0], p[1] }; }
+    static void store(float* p, Vec v) { p[0] = v.a; p[1] = v.b; }
+    static Vec make(float a, float b) { return { a, b }; }
+    static Vec add(Vec x, Vec y) { return { x.a + y.a, x.b + y.b }; }
+    static Vec sub(Vec x, Vec y) { return { x.a - y.a, x.b - y.b }; }
+    static Vec mul(Vec x, Vec y) { return { x.a * y.a, x.b * y.b }; }
+    static float laneA(Vec v) { return v.a; }
+    static float laneB(Vec v) { return v.b; }
+};
+
+#endif
+
 //==============================================================================
 // Dual Phaser Core (Two Independent 6-Stage Phasers)
 //==============================================================================
@@ -893,17 +1027,71 @@ class DualPhaserCore
 public:
     DualPhaserCore() = default;
 
+    // Build the sweep table for this sample rate (not real-time safe)
+    void prepare(double sampleRate)
+    {
+        sweepTable_.prepare(sampleRate, kSweepMinFreq, kSweepMaxFreq);
+    }
+
     void reset()
     {
-        phaserA.reset();
-        phaserB.reset();
+        inputState_.fill(0.0f);
+        outputState_.fill(0.0f);
     }
 
     //==========================================================================
     // FEATURE 2: Stage Count Control - Set stage count for each phasor
     //==========================================================================
-    void setStageCountA(StageCount count) { phaserA.setStageCount(count); }
-    void setStageCountB(StageCount count) { phaserB.setStageCount(count); }
+    void setStageCountA(StageCount count) { stagesA_ = stagesFor(count); }
+    void setStageCountB(StageCount count) { stagesB_ = stagesFor(count); }
+
+    const AllPassSweepTable& getSweepTable() const { return sweepTable_; }
+
+    //==========================================================================
+    // Coefficient-Driven Kernels (used by BiPhaseDSP's block loop)
+    //==========================================================================
+
+    // Both phasors at once (parallel/independent routing): the stages they
+    // have in common run as two SIMD lanes, any extra stages run scalar
+    inline void processPair(float& a, float& b, float coeffA, float coeffB)
+    {
+        using Lanes = PhasorLanes;
+
+        const int sharedStages = std::min(stagesA_, stagesB_);
+        const Lanes::Vec coeff = Lanes::make(coeffA, coeffB);
+        Lanes::Vec x = Lanes::make(a, b);
+
+        for (int stage = 0; stage < sharedStages; ++stage)
+        {
+            float* x1 = &inputState_[static_cast<size_t>(stage) * 2];
+            float* y1 = &outputState_[static_cast<size_t>(stage) * 2];
+
+            // y[n] = (x[n-1] + a * y[n-1]) - a * x[n]
+            Lanes::Vec y = Lanes::sub(Lanes::add(Lanes::load(x1), Lanes::mul(coeff, Lanes::load(y1))),
+                                      Lanes::mul(coeff, x));
+            Lanes::store(x1, x);
+            Lanes::store(y1, y);
+            x = y;
+        }
+
+        a = processStages(0, sharedStages, stagesA_, Lanes::laneA(x), coeffA);
+        b = processStages(1, sharedStages, stagesB_, Lanes::laneB(x), coeffB);
+    }
+
+    // Phasor A alone (series routing feeds its output into phasor B)
+    inline float processAWithCoefficient(float input, float coeff)
+    {
+        return processStages(0, 0, stagesA_, input, coeff);
+    }
+
+    inline float processBWithCoefficient(float input, float coeff)
+    {
+        return processStages(1, 0, stagesB_, input, coeff);
+    }
+
+    //==========================================================================
+    // Frequency-Driven API (exact pow/tan per call)
+    //==========================================================================
 
     // Process both phasers with independent modulation
     // Returns: {outputA, outputB}
@@ -915,8 +1103,9 @@ public:
         float outA = inputA;
         float outB = inputB;
 
-        phaserA.processStereo(outA, outA, modA, minFreq, maxFreq, sampleRate);
-        phaserB.processStereo(outB, outB, modB, minFreq, maxFreq, sampleRate);
+        processPair(outA, outB,
+                    exactCoefficient(modA, minFreq, maxFreq, sampleRate),
+                    exactCoefficient(modB, minFreq, maxFreq, sampleRate));
 
         return {outA, outB};
     }
@@ -924,22 +1113,62 @@ public:
     // Process phaser A only
     inline float processA(float input, float mod, float minFreq, float maxFreq, double sampleRate)
     {
-        float out = input;
-        phaserA.processStereo(out, out, mod, minFreq, maxFreq, sampleRate);
-        return out;
+        return processAWithCoefficient(input, exactCoefficient(mod, minFreq, maxFreq, sampleRate));
     }
 
     // Process phaser B only (takes phaser A output as input for series mode)
     inline float processB(float input, float mod, float minFreq, float maxFreq, double sampleRate)
     {
-        float out = input;
-        phaserB.processStereo(out, out, mod, minFreq, maxFreq, sampleRate);
-        return out;
+        return processBWithCoefficient(input, exactCoefficient(mod, minFreq, maxFreq, sampleRate));
     }
 
 private:
-    PhaserStage phaserA;
-    PhaserStage phaserB;
+    static constexpr int kMaxStages = 8;
+
+    static int stagesFor(StageCount count)
+    {
+        switch (count)
+        {
+            case StageCount::Four: return 4;
+            case StageCount::Six: return 6;
+            case StageCount::Eight: return 8;
+            default: return 6;
+        }
+    }
+
+    static float exactCoefficient(float modSignal, float minFreq, float maxFreq, double sampleRate)
+    {
+        float t = (modSignal + 1.0f) * 0.5f;
+        float freq = minFreq * std::pow(maxFreq / minFreq, t);
+        return -std::tan(static_cast<float>(M_PI * freq / sampleRate));
+    }
+
+    // Stages [first, last) of one phasor's cascade, scalar
+    inline float processStages(int lane, int first, int last, float x, float coeff)
+    {
+        for (int stage = first; stage < last; ++stage)
+        {
+            float& x1 = inputState_[static_cast<size_t>(stage) * 2 + static_cast<size_t>(lane)];
+            float& y1 = outputState_[static_cast<size_t>(stage) * 2 + static_cast<size_t>(lane)];
+
+            // Only the final multiply-subtract waits on the previous stage
+            float y = (x1 + coeff * y1) - coeff * x;
+            x1 = x;
+            y1 = y;
+            x = y;
+        }
+
+        return x;
+    }
+
+    AllPassSweepTable sweepTable_;
+
+    // All-pass state as [A, B] pairs per stage, so both lanes load together
+    alignas(16) std::array<float, kMaxStages * 2> inputState_ {};   // x[n-1]
+    alignas(16) std::array<float, kMaxStages * 2> outputState_ {};  // y[n-1]
+
+    int stagesA_ = 6;
+    int stagesB_ = 6;
 };
 
 //==============================================================================
@@ -1000,6 +1229,9 @@ public:
         // Feature 8: Prepare analog drift generator
         driftGenerator_.prepare(sampleRate);
 
+        // Sweep coefficient table for this sample rate
+        dualPhaser_.prepare(sampleRate);
+
         // Reset state
         reset();
     }
@@ -1206,31 +1438,8 @@ public:
     // Processing (Stereo)
     //==========================================================================
 
-    void processStereo(float* left, float* right, int numSamples)
-    {
-        for (int i = 0; i < numSamples; ++i)
-        {
-            // Control-rate update (checked every sample, but updates at interval)
-            if (++controlCounter_ >= policy_.controlIntervalSamples)
-            {
-                updateControlRateDual();  // Use dual-phasor version with all new features
-                controlCounter_ = 0;
-            }
-
-            // Get input samples
-            float inA = left[i];
-            float inB = right[i];
-
-            // Process based on routing mode
-            auto [outA, outB] = (parameters_.routingMode == RoutingMode::InA) ? processParallel(inA, inB, i) :
-                              (parameters_.routingMode == RoutingMode::OutA) ? processSeries(inA, inB, i) :
-                              processIndependent(inA, inB, i);
-
-            // Output
-            left[i] = outA;
-            right[i] = outB;
-        }
-    }
+    // Routing is resolved once per block; see processBlock() in the .cpp
+    void processStereo(float* left, float* right, int numSamples);
 
 private:
     //==========================================================================
@@ -1264,14 +1473,14 @@ private:
     // Phase 2: Routing Mode Processors
     //==========================================================================
 
-    // Parallel mode: Both phasors process same input
-    std::pair<float, float> processParallel(float inA, float inB, int sample);
-
-    // Series mode: A -> B (12-stage cascade)
-    std::pair<float, float> processSeries(float inA, float inB, int sample);
+    // One specialised loop per routing mode:
+    // - InA (parallel) and InB (independent): A and B side by side
+    // - OutA (series): A -> B (12-stage cascade)
+    template <RoutingMode Mode>
+    void processBlock(float* left, float* right, int numSamples);
 
-    // Independent mode: Separate inputs
-    std::pair<float, float> processIndependent(float inA, float inB, int sample);
+    // Table sub-range for a sweep bias setting
+    static SweepRange sweepRangeFor(const SweepBiasParams& bias);
 
     // Get LFO value for Phasor A (based on source selection)
     float getLFOA(int sample);
@@ -132,223 +132,159 @@ Policy system prevents unstable configurations:
 //==============================================================================
 
 /*
- These routing mode implementations are moved out-of-line to keep the
- header clean and improve maintainability. While they are called in the
- audio processing loop, the routing logic is not performance-critical
- compared to the all-pass filter processing itself.
+ The routing mode is fixed for the duration of a block, so processStereo()
+ picks one specialised loop per block instead of testing the mode per
+ sample. Everything else that cannot change inside a block (sweep bias
+ ranges, signed feedback amounts, smoothed depths) is also resolved before
+ the loop; per sample only the LFOs, envelope followers and all-pass
+ cascades run.
 
  The routing modes define how the two phasors interact:
  - Parallel: Both process same input (stereo output)
  - Series: Cascaded processing (12-stage phaser)
  - Independent: Separate processing paths
-*/
 
-std::pair<float, float> BiPhaseDSP::processParallel(float inA, float inB, int sample)
-{
-    // Get LFO values for each phasor
-    float lfoA = getLFOA(sample);
-    float lfoB = getLFOB(sample);
+ Parallel and independent both feed left into A and right into B, so they
+ share a loop that runs the two cascades as SIMD lanes. Series must finish
+ A before B can start, so its cascades run one after the other.
 
-    // Get current depth values from smoothers
-    float depthA = depthSmoother_.getCurrent();
-    float depthB = depthSmootherB_.getCurrent();
+ Sweep bias: a biased range [200 * 25^(c - w/2), 200 * 25^(c + w/2)],
+ clamped to 200-5000 Hz, is a sub-range of the full exponential sweep, so
+ it maps to a start/span in the shared coefficient table. As before,
+ parallel/independent sweep both phasors over phasor A's range.
+*/
 
-    //==========================================================================
-    // FEATURE 5: Envelope Follower - Apply envelope modulation to depth
-    //==========================================================================
-    if (parameters_.envelopeA.enabled)
-    {
-        float envA = envelopeFollowerA_.processSample(inA);
-        if (parameters_.envelopeA.toDepth)
-        {
-            depthA = depthA * (1.0f - parameters_.envelopeA.amount) + envA * parameters_.envelopeA.amount;
-        }
-    }
-    if (parameters_.envelopeB.enabled)
+void BiPhaseDSP::processStereo(float* left, float* right, int numSamples)
+{
+    switch (parameters_.routingMode)
     {
-        float envB = envelopeFollowerB_.processSample(inB);
-        if (parameters_.envelopeB.toDepth)
-        {
-            depthB = depthB * (1.0f - parameters_.envelopeB.amount) + envB * parameters_.envelopeB.amount;
-        }
-    }
-
-    //==========================================================================
-    // FEATURE 6: Center Frequency Bias - Calculate biased frequency range
-    //==========================================================================
-    auto getBiasedFreqRange = [](const SweepBiasParams& bias, float minFreq, float maxFreq) {
-        float biasedMin = minFreq * std::pow(maxFreq / minFreq, bias.center - bias.width * 0.5f);
-        float biasedMax = minFreq * std::pow(maxFreq / minFreq, bias.center + bias.width * 0.5f);
-        return std::make_pair(std::max(biasedMin, minFreq), std::min(biasedMax, maxFreq));
-    };
-
-    auto [minFreqA, maxFreqA] = getBiasedFreqRange(parameters_.sweepBiasA, 200.0f, 5000.0f);
-    auto [minFreqB, maxFreqB] = getBiasedFreqRange(parameters_.sweepBiasB, 200.0f, 5000.0f);
-
-    // Process both phasors with same input
-    // In parallel mode, both phasors receive identical input
-    auto [outA, outB] = dualPhaser_.process(inA, inB,
-                                            lfoA * depthA,
-                                            lfoB * depthB,
-                                            minFreqA, maxFreqA, sampleRate_);
-
-    //==========================================================================
-    // FEATURE 3: Feedback Polarity - Apply polarity multiplier
-    //==========================================================================
-    float polarityA = (parameters_.feedbackPolarityA == FeedbackPolarity::Positive) ? 1.0f : -1.0f;
-    float polarityB = (parameters_.feedbackPolarityB == FeedbackPolarity::Positive) ? 1.0f : -1.0f;
-
-    // Apply independent feedback to each phasor
-    float fbA = feedbackSmoother_.getCurrent();
-    float fbB = feedbackSmootherB_.getCurrent();
+        case RoutingMode::InA:
+            processBlock<RoutingMode::InA>(left, right, numSamples);
+            break;
 
-    // Feedback: add feedback to phaser output
-    // outA is the phaser output, we add feedback to it
-    outA = outA + feedbackStateA_ * fbA * polarityA;
-    feedbackStateA_ = outA;
+        case RoutingMode::OutA:
+            processBlock<RoutingMode::OutA>(left, right, numSamples);
+            break;
 
-    outB = outB + feedbackStateB_ * fbB * polarityB;
-    feedbackStateB_ = outB;
+        case RoutingMode::InB:
+            processBlock<RoutingMode::InB>(left, right, numSamples);
+            break;
+    }
+}
 
-    // Return both phasor outputs (stereo)
-    return {outA, outB};
+SweepRange BiPhaseDSP::sweepRangeFor(const SweepBiasParams& bias)
+{
+    float start = std::max(bias.center - bias.width * 0.5f, 0.0f);
+    float end = std::min(bias.center + bias.width * 0.5f, 1.0f);
+    return {start, end - start};
 }
 
-std::pair<float, float> BiPhaseDSP::processSeries(float inA, float inB, int sample)
+template <RoutingMode Mode>
+void BiPhaseDSP::processBlock(float* left, float* right, int numSamples)
 {
-    // Get LFO values for each phasor
-    float lfoA = getLFOA(sample);
-    float lfoB = getLFOB(sample);
+    constexpr bool series = (Mode == RoutingMode::OutA);
 
-    float depthA = depthSmoother_.getCurrent();
-    float depthB = depthSmootherB_.getCurrent();
+    const AllPassSweepTable& sweepTable = dualPhaser_.getSweepTable();
 
     //==========================================================================
-    // FEATURE 5: Envelope Follower
+    // FEATURE 6: Center Frequency Bias - table sub-range per phasor
     //==========================================================================
-    if (parameters_.envelopeA.enabled)
-    {
-        float envA = envelopeFollowerA_.processSample(inA);
-        if (parameters_.envelopeA.toDepth)
-        {
-            depthA = depthA * (1.0f - parameters_.envelopeA.amount) + envA * parameters_.envelopeA.amount;
-        }
-    }
-    if (parameters_.envelopeB.enabled)
-    {
-        float envB = envelopeFollowerB_.processSample(inA);
-        if (parameters_.envelopeB.toDepth)
-        {
-            depthB = depthB * (1.0f - parameters_.envelopeB.amount) + envB * parameters_.envelopeB.amount;
-        }
-    }
+    const SweepRange rangeA = sweepRangeFor(parameters_.sweepBiasA);
+    const SweepRange rangeB = series ? sweepRangeFor(parameters_.sweepBiasB) : rangeA;
 
     //==========================================================================
-    // FEATURE 6: Center Frequency Bias
+    // FEATURE 3: Feedback Polarity - fold the sign into the amount
     //==========================================================================
-    auto getBiasedFreqRange = [](const SweepBiasParams& bias, float minFreq, float maxFreq) {
-        float biasedMin = minFreq * std::pow(maxFreq / minFreq, bias.center - bias.width * 0.5f);
-        float biasedMax = minFreq * std::pow(maxFreq / minFreq, bias.center + bias.width * 0.5f);
-        return std::make_pair(std::max(biasedMin, minFreq), std::min(biasedMax, maxFreq));
-    };
-
-    auto [minFreqA, maxFreqA] = getBiasedFreqRange(parameters_.sweepBiasA, 200.0f, 5000.0f);
-    auto [minFreqB, maxFreqB] = getBiasedFreqRange(parameters_.sweepBiasB, 200.0f, 5000.0f);
+    const float feedbackA = feedbackSmoother_.getCurrent()
+        * ((parameters_.feedbackPolarityA == FeedbackPolarity::Positive) ? 1.0f : -1.0f);
+    const float feedbackB = feedbackSmootherB_.getCurrent()
+        * ((parameters_.feedbackPolarityB == FeedbackPolarity::Positive) ? 1.0f : -1.0f);
 
-    //==========================================================================
-    // FEATURE 3: Feedback Polarity
-    //==========================================================================
-    float polarityA = (parameters_.feedbackPolarityA == FeedbackPolarity::Positive) ? 1.0f : -1.0f;
-    float polarityB = (parameters_.feedbackPolarityB == FeedbackPolarity::Positive) ? 1.0f : -1.0f;
+    const float baseDepthA = depthSmoother_.getCurrent();
+    const float baseDepthB = depthSmootherB_.getCurrent();
 
-    // Process Phasor A first
-    float outA = dualPhaser_.processA(inA, lfoA * depthA, minFreqA, maxFreqA, sampleRate_);
+    const EnvelopeFollowerParams& envelopeA = parameters_.envelopeA;
+    const EnvelopeFollowerParams& envelopeB = parameters_.envelopeB;
 
-    // Apply feedback A
-    float fbA = feedbackSmoother_.getCurrent();
-    outA = outA + feedbackStateA_ * fbA * polarityA;
-    feedbackStateA_ = outA;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // Control-rate update (checked every sample, but updates at interval)
+        if (++controlCounter_ >= policy_.controlIntervalSamples)
+        {
+            updateControlRateDual();  // Use dual-phasor version with all new features
+            controlCounter_ = 0;
+        }
 
-    // Process Phasor B (gets Phasor A output as input)
-    // This creates the classic 12-stage Bi-Phase cascade
-    float outB = dualPhaser_.processB(outA, lfoB * depthB, minFreqB, maxFreqB, sampleRate_);
+        // Get input samples
+        float inA = left[i];
+        float inB = right[i];
 
-    // Apply feedback B
-    float fbB = feedbackSmootherB_.getCurrent();
-    outB = outB + feedbackStateB_ * fbB * polarityB;
-    feedbackStateB_ = outB;
+        // Get LFO values for each phasor
+        float lfoA = getLFOA(i);
+        float lfoB = getLFOB(i);
 
-    // In series mode, both channels get the cascaded output
-    // This preserves the mono-compatible 12-stage phaser sound
-    return {outA, outB};
-}
+        //======================================================================
+        // FEATURE 5: Envelope Follower - Apply envelope modulation to depth
+        //======================================================================
+        float depthA = baseDepthA;
+        float depthB = baseDepthB;
 
-std::pair<float, float> BiPhaseDSP::processIndependent(float inA, float inB, int sample)
-{
-    // Get LFO values for each phasor
-    float lfoA = getLFOA(sample);
-    float lfoB = getLFOB(sample);
-
-    float depthA = depthSmoother_.getCurrent();
-    float depthB = depthSmootherB_.getCurrent();
-
-    //==========================================================================
-    // FEATURE 5: Envelope Follower
-    //==========================================================================
-    if (parameters_.envelopeA.enabled)
-    {
-        float envA = envelopeFollowerA_.processSample(inA);
-        if (parameters_.envelopeA.toDepth)
+        if (envelopeA.enabled)
         {
-            depthA = depthA * (1.0f - parameters_.envelopeA.amount) + envA * parameters_.envelopeA.amount;
+            float envA = envelopeFollowerA_.processSample(inA);
+            if (envelopeA.toDepth)
+            {
+                depthA = depthA * (1.0f - envelopeA.amount) + envA * envelopeA.amount;
+            }
         }
-    }
-    if (parameters_.envelopeB.enabled)
-    {
-        float envB = envelopeFollowerB_.processSample(inB);
-        if (parameters_.envelopeB.toDepth)
+        if (envelopeB.enabled)
         {
-            depthB = depthB * (1.0f - parameters_.envelopeB.amount) + envB * parameters_.envelopeB.amount;
+            // Series: phasor B follows the same input as phasor A
+            float envB = envelopeFollowerB_.processSample(series ? inA : inB);
+            if (envelopeB.toDepth)
+            {
+                depthB = depthB * (1.0f - envelopeB.amount) + envB * envelopeB.amount;
+            }
         }
-    }
 
-    //==========================================================================
-    // FEATURE 6: Center Frequency Bias
-    //==========================================================================
-    auto getBiasedFreqRange = [](const SweepBiasParams& bias, float minFreq, float maxFreq) {
-        float biasedMin = minFreq * std::pow(maxFreq / minFreq, bias.center - bias.width * 0.5f);
-        float biasedMax = minFreq * std::pow(maxFreq / minFreq, bias.center + bias.width * 0.5f);
-        return std::make_pair(std::max(biasedMin, minFreq), std::min(biasedMax, maxFreq));
-    };
-
-    auto [minFreqA, maxFreqA] = getBiasedFreqRange(parameters_.sweepBiasA, 200.0f, 5000.0f);
-    auto [minFreqB, maxFreqB] = getBiasedFreqRange(parameters_.sweepBiasB, 200.0f, 5000.0f);
-
-    //==========================================================================
-    // FEATURE 3: Feedback Polarity
-    //==========================================================================
-    float polarityA = (parameters_.feedbackPolarityA == FeedbackPolarity::Positive) ? 1.0f : -1.0f;
-    float polarityB = (parameters_.feedbackPolarityB == FeedbackPolarity::Positive) ? 1.0f : -1.0f;
+        float coeffA = sweepTable.coefficient(rangeA, lfoA * depthA);
+        float coeffB = sweepTable.coefficient(rangeB, lfoB * depthB);
 
-    // Process each phasor with its own input
-    // In independent mode, inputs can be different sources
-    auto [outA, outB] = dualPhaser_.process(inA, inB,
-                                            lfoA * depthA,
-                                            lfoB * depthB,
-                                            minFreqA, maxFreqA, sampleRate_);
+        float outA;
+        float outB;
 
-    // Apply independent feedback to each phasor
-    float fbA = feedbackSmoother_.getCurrent();
-    float fbB = feedbackSmootherB_.getCurrent();
+        if constexpr (series)
+        {
+            // Process Phasor A first
+            outA = dualPhaser_.processAWithCoefficient(inA, coeffA);
+            outA = outA + feedbackStateA_ * feedbackA;
+            feedbackStateA_ = outA;
+
+            // Phasor B gets Phasor A output as input
+            // This creates the classic 12-stage Bi-Phase cascade
+            outB = dualPhaser_.processBWithCoefficient(outA, coeffB);
+            outB = outB + feedbackStateB_ * feedbackB;
+            feedbackStateB_ = outB;
+        }
+        else
+        {
+            // Each phasor processes its own input, both in one pass
+            outA = inA;
+            outB = inB;
+            dualPhaser_.processPair(outA, outB, coeffA, coeffB);
 
-    outA = outA + feedbackStateA_ * fbA * polarityA;
-    feedbackStateA_ = outA;
+            // Apply independent feedback to each phasor
+            outA = outA + feedbackStateA_ * feedbackA;
+            feedbackStateA_ = outA;
 
-    outB = outB + feedbackStateB_ * fbB * polarityB;
-    feedbackStateB_ = outB;
+            outB = outB + feedbackStateB_ * feedbackB;
+            feedbackStateB_ = outB;
+        }
 
-    // Return independent outputs
-    return {outA, outB};
+        // Output
+        left[i] = outA;
+        right[i] = outB;
+    }
 }
 
 //==============================================================================
@@ -600,37 +536,31 @@ void BiPhaseDSP::updateControlRateDual()
 /*
  Methods intentionally kept inline in header for performance:
 
- - AllPassStage::processStereo()
-   Called 12 times per sample (6 stages × 2 phasors)
-   Critical path: must be as fast as possible
+ - DualPhaserCore::processPair() / process{A,B}WithCoefficient()
+   The all-pass cascades: up to 16 first-order stages per sample.
+   processPair() runs A and B as two SIMD lanes (SSE / NEON).
 
- - LFOGenerator::processSample()
-   Called 4 times per sample (2 LFOs × 2 sources)
-   Trigonometric operations: needs to be tight
-
- - PhaserStage::processStereo()
-   Called 2 times per sample (2 phasors)
-   Contains the all-pass cascade loop
+ - AllPassSweepTable::coefficient()
+   Replaces pow() + tan() per phasor per sample with a table read.
 
- - ParameterSmoother::processSample()
-   Called 6 times per sample (3 smoothers × 2 phasors)
-   Simple arithmetic: inline for zero overhead
-
- - DualPhaserCore::process methods
-   Called every sample, tight loops
+ - LFOGenerator::processSample()
+   Called 2 times per sample (one per phasor)
 
- Methods moved to this .cpp file:
+ Methods in this .cpp file:
 
- - Routing mode implementations (processParallel, processSeries, processIndependent)
-   Called per-sample but complex logic: readability > marginal performance gain
+ - processStereo() / processBlock<Mode>()
+   The sample loop, specialised per routing mode so the mode test and all
+   block-constant parameters stay out of the loop
 
  - LFO source selection (getLFOA, getLFOB)
-   Called per-sample but simple branching: negligible overhead
+   Called per-sample but simple branching; same translation unit as the
+   loop, so they inline
 
  - updateControlRateDual()
    Called at control rate (~1 kHz): not performance-critical
 
- This balance maintains performance while improving code maintainability.
+ AllPassStage / PhaserStage remain as the exact (pow/tan per call) stereo
+ reference and for the legacy single-phaser state.
 */
 
 } // namespace DSP
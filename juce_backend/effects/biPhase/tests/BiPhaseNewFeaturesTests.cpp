@@ -1461,6 +1461,107 @@ TEST_F(BiPhaseNewFeaturesTest, BackwardCompatibility_OriginalParameters)
     EXPECT_GT(calculateSignalPower(left), 0.0f);
 }
 
+//==============================================================================
+// BLOCK PROCESSING: Sweep Table and Routing Kernels
+//==============================================================================
+
+TEST_F(BiPhaseNewFeaturesTest, SweepTable_MatchesExactCoefficient)
+{
+    // Table lookup should track -tan(PI * f / fs) across the whole sweep
+    for (double sampleRate : {44100.0, 96000.0})
+    {
+        AllPassSweepTable table;
+        table.prepare(sampleRate, kSweepMinFreq, kSweepMaxFreq);
+
+        for (int i = 0; i <= 1000; ++i)
+        {
+            float position = static_cast<float>(i) / 1000.0f;
+            double freq = kSweepMinFreq * std::pow(static_cast<double>(kSweepMaxFreq) / kSweepMinFreq, position);
+            float exact = static_cast<float>(-std::tan(M_PI * freq / sampleRate));
+
+            EXPECT_NEAR(table.lookup(position), exact, 3e-6f)
+                << "position " << position << " at " << sampleRate << " Hz";
+        }
+
+        // Out-of-range positions clamp to the sweep ends
+        EXPECT_EQ(table.lookup(-0.5f), table.lookup(0.0f));
+        EXPECT_EQ(table.lookup(1.5f), table.lookup(1.0f));
+    }
+}
+
+TEST_F(BiPhaseNewFeaturesTest, DualPhaserCore_PairMatchesSeparateCascades)
+{
+    // SIMD pair path must equal running A and B on their own, including
+    // when the phasors have different stage counts
+    DualPhaserCore paired;
+    DualPhaserCore separate;
+    paired.prepare(sampleRate_);
+    separate.prepare(sampleRate_);
+
+    paired.setStageCountA(StageCount::Eight);
+    paired.setStageCountB(StageCount::Four);
+    separate.setStageCountA(StageCount::Eight);
+    separate.setStageCountB(StageCount::Four);
+
+    auto inputA = generateNoise(2048, 7);
+    auto inputB = generateTestTone(330.0f, sampleRate_, 2048);
+
+    for (size_t i = 0; i < inputA.size(); ++i)
+    {
+        float coeffA = -0.05f - 0.25f * static_cast<float>(i % 97) / 97.0f;
+        float coeffB = -0.30f + 0.20f * static_cast<float>(i % 61) / 61.0f;
+
+        float a = inputA[i];
+        float b = inputB[i];
+        paired.processPair(a, b, coeffA, coeffB);
+
+        EXPECT_FLOAT_EQ(a, separate.processAWithCoefficient(inputA[i], coeffA));
+        EXPECT_FLOAT_EQ(b, separate.processBWithCoefficient(inputB[i], coeffB));
+    }
+}
+
+TEST_F(BiPhaseNewFeaturesTest, BlockProcessing_IndependentOfBlockSize)
+{
+    // Per-block hoisting must not change the output: one large block and
+    // many odd-sized blocks give identical results in every routing mode
+    for (RoutingMode mode : {RoutingMode::InA, RoutingMode::OutA, RoutingMode::InB})
+    {
+        auto makeDSP = [this, mode]() {
+            BiPhaseDSP dsp;
+            dsp.setRoutingMode(mode);
+            dsp.setRate(4.0f);
+            dsp.setDepth(0.8f);
+            dsp.setFeedback(0.5f);
+            dsp.setSweepCenterB(0.3f);
+            dsp.setFeedbackPolarityB(FeedbackPolarity::Negative);
+            dsp.prepare(sampleRate_, 4096);
+            return dsp;
+        };
+
+        auto left = generateNoise(4096, 3);
+        auto right = generateTestTone(220.0f, sampleRate_, 4096);
+
+        auto wholeLeft = left, wholeRight = right;
+        auto splitLeft = left, splitRight = right;
+
+        BiPhaseDSP whole = makeDSP();
+        whole.processStereo(wholeLeft.data(), wholeRight.data(), 4096);
+
+        BiPhaseDSP split = makeDSP();
+        for (int offset = 0, block = 1; offset < 4096; offset += block, block = block % 97 + 13)
+        {
+            int n = std::min(block, 4096 - offset);
+            split.processStereo(splitLeft.data() + offset, splitRight.data() + offset, n);
+        }
+
+        for (size_t i = 0; i < 4096; ++i)
+        {
+            ASSERT_EQ(wholeLeft[i], splitLeft[i]) << "mode " << static_cast<int>(mode) << " sample " << i;
+            ASSERT_EQ(wholeRight[i], splitRight[i]) << "mode " << static_cast<int>(mode) << " sample " << i;
+        }
+    }
+}
+
 //==============================================================================
 // Main function
 //==============================================================================
@@ -1,8 +1,24 @@
 #include "dynamics/DynamicsEffectsChain.h"
+#include "dynamics/ChunkedProcessing.h"
 
 namespace schill {
 namespace dynamics {
 
+namespace {
+
+float sumOfSquares(const juce::AudioBuffer<float>& buffer) {
+    float sum = 0.0f;
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+        const float* channelData = buffer.getReadPointer(ch);
+        for (int i = 0; i < buffer.getNumSamples(); ++i) {
+            sum += channelData[i] * channelData[i];
+        }
+    }
+    return sum;
+}
+
+} // namespace
+
 //==============================================================================
 // ChainSlot Implementation
 //==============================================================================
@@ -24,9 +40,7 @@ ChainSlot::ChainSlot(int slotIndex, const SlotConfig& config) :
 
     // Initialize buffers
     dryBuffer.setSize(2, 512);
-    wetBuffer.setSize(2, 512);
     dryBuffer.clear();
-    wetBuffer.clear();
 
     // Initialize stats
     resetStats();
@@ -46,7 +60,6 @@ void ChainSlot::reset() {
     }
 
     dryBuffer.clear();
-    wetBuffer.clear();
 
     // Reset smoothed parameters
     smoothedWetDryMix.setCurrentAndTargetValue(currentConfig.wetDryMix * 0.01f);
@@ -57,16 +70,16 @@ void ChainSlot::reset() {
     crossfadeProgress = 0.0f;
     previousConfig.reset();
 
+    blocksUntilStats = 0;
     resetStats();
 }
 
 void ChainSlot::prepareToPlay(double newSampleRate, int newSamplesPerBlock) {
     sampleRate = newSampleRate;
-    samplesPerBlock = newSamplesPerBlock;
+    samplesPerBlock = juce::jmax(1, newSamplesPerBlock);
 
     // Update buffer sizes
     dryBuffer.setSize(2, samplesPerBlock);
-    wetBuffer.setSize(2, samplesPerBlock);
 
     // Update smoothed parameters sample rates
     smoothedWetDryMix.reset(sampleRate, 0.01f);
@@ -89,10 +102,7 @@ void ChainSlot::prepareToPlay(double newSampleRate, int newSamplesPerBlock) {
 }
 
 void ChainSlot::processBlock(juce::AudioBuffer<float>& buffer) {
-    const int numChannels = buffer.getNumChannels();
-    const int numSamples = buffer.getNumSamples();
-
-    if (numSamples == 0) {
+    if (buffer.getNumSamples() == 0) {
         return;
     }
 
@@ -101,31 +111,61 @@ void ChainSlot::processBlock(juce::AudioBuffer<float>& buffer) {
         updateCrossfade();
     }
 
+    // The dry scratch holds one prepared block, so longer host blocks are split
+    forEachChunk(buffer, dryBuffer.getNumSamples(), [this](juce::AudioBuffer<float>& chunk) {
+        processChunk(chunk);
+    });
+
+    // Update solo/mute states
+    updateSoloMuteStates();
+}
+
+void ChainSlot::processChunk(juce::AudioBuffer<float>& buffer) {
+    const int numSamples = buffer.getNumSamples();
+
+    // Only sampled blocks pay for level metering and timing
+    const bool measureBlock = --blocksUntilStats <= 0;
+    const float inputSumSquares = measureBlock ? sumOfSquares(buffer) : 0.0f;
+    const juce::int64 startTicks = measureBlock ? juce::Time::getHighResolutionTicks() : 0;
+
+    const bool effectActive = currentBypassMode == BypassMode::Normal || currentBypassMode == BypassMode::Solo;
+    const bool mixDry = effectActive && needsDryCopy();
+
     // Store dry signal for wet/dry mixing
-    if (currentConfig.wetDryMix < 100.0f) {
-        dryBuffer.makeCopyOf(buffer);
+    if (mixDry) {
+        const int numDryChannels = juce::jmin(buffer.getNumChannels(), dryBuffer.getNumChannels());
+        for (int ch = 0; ch < numDryChannels; ++ch) {
+            dryBuffer.copyFrom(ch, 0, buffer, ch, 0, numSamples);
+        }
     }
 
     // Handle bypass modes
     applyBypassMode(buffer);
 
     // Process effect if not bypassed or in solo mode
-    if (currentBypassMode == BypassMode::Normal || currentBypassMode == BypassMode::Solo) {
+    if (effectActive) {
         processEffect(buffer);
     }
 
     // Apply wet/dry mixing
-    processWetDryMix(buffer);
+    if (mixDry) {
+        processWetDryMix(buffer);
+    }
 
-    // Apply output gain
-    float outputGainLinear = smoothedOutputGain.getNextValue();
-    buffer.applyGain(outputGainLinear);
-
-    // Update solo/mute states
-    updateSoloMuteStates();
+    // Apply output gain (per-sample ramp while smoothing, skipped at unity)
+    smoothedOutputGain.applyGain(buffer, numSamples);
 
     // Update statistics
-    updateStats(buffer, buffer);
+    if (measureBlock) {
+        blocksUntilStats = statsDecimation.load(std::memory_order_relaxed);
+        const double elapsedSeconds = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - startTicks);
+        updateStats(inputSumSquares, buffer, elapsedSeconds);
+    }
+}
+
+bool ChainSlot::needsDryCopy() const {
+    return smoothedWetDryMix.isSmoothing() || smoothedWetDryMix.getTargetValue() < 1.0f;
 }
 
 void ChainSlot::processSidechain(const juce::AudioBuffer<float>& sidechainBuffer) {
@@ -138,16 +178,15 @@ void ChainSlot::processSidechain(const juce::AudioBuffer<float>& sidechainBuffer
 }
 
 void ChainSlot::processStereo(juce::AudioBuffer<float>& leftBuffer, juce::AudioBuffer<float>& rightBuffer) {
-    // Combine buffers for processing
-    juce::AudioBuffer<float> stereoBuffer(2, leftBuffer.getNumSamples());
-    stereoBuffer.copyFrom(0, 0, leftBuffer, 0, 0, leftBuffer.getNumSamples());
-    stereoBuffer.copyFrom(1, 0, rightBuffer, 0, 0, rightBuffer.getNumSamples());
+    processStereo(leftBuffer.getWritePointer(0), rightBuffer.getWritePointer(0),
+                  juce::jmin(leftBuffer.getNumSamples(), rightBuffer.getNumSamples()));
+}
 
+void ChainSlot::processStereo(float* left, float* right, int numSamples) {
+    // Process the caller's channels in place through a referencing buffer
+    float* channels[] = { left, right };
+    juce::AudioBuffer<float> stereoBuffer(channels, 2, numSamples);
     processBlock(stereoBuffer);
-
-    // Copy back to individual buffers
-    leftBuffer.copyFrom(0, 0, stereoBuffer, 0, 0, leftBuffer.getNumSamples());
-    rightBuffer.copyFrom(0, 0, stereoBuffer, 1, 0, rightBuffer.getNumSamples());
 }
 
 void ChainSlot::setConfig(const SlotConfig& config) {
@@ -214,13 +253,16 @@ LimiterConfig ChainSlot::getLimiterConfig() const {
 }
 
 ChainSlot::SlotStats ChainSlot::getStats() const {
-    return stats;
+    return publishedStats.read();
 }
 
 void ChainSlot::resetStats() {
-    stats = SlotStats{};
+    publishedStats.publish(SlotStats{}, true);
     statsResetTime = juce::Time::getCurrentTime();
-    samplesProcessed = 0;
+}
+
+void ChainSlot::setStatsDecimation(int blocks) {
+    statsDecimation.store(juce::jmax(1, blocks), std::memory_order_relaxed);
 }
 
 void ChainSlot::setSoloGroup(int group) {
@@ -309,22 +351,33 @@ void ChainSlot::processEffect(juce::AudioBuffer<float>& buffer) {
 }
 
 void ChainSlot::processWetDryMix(juce::AudioBuffer<float>& buffer) {
-    if (currentConfig.wetDryMix >= 100.0f || dryBuffer.getNumSamples() != buffer.getNumSamples()) {
-        return; // No wet/dry mixing needed
-    }
+    // Mixes in place against the dry copy taken in processChunk; channels past
+    // the stereo dry scratch stay fully wet
+    const int numChannels = juce::jmin(buffer.getNumChannels(), dryBuffer.getNumChannels());
+    const int numSamples = buffer.getNumSamples();
 
-    float wetAmount = smoothedWetDryMix.getNextValue();
-    float dryAmount = 1.0f - wetAmount;
+    if (!smoothedWetDryMix.isSmoothing()) {
+        const float wetAmount = smoothedWetDryMix.getTargetValue();
 
-    const int numChannels = buffer.getNumChannels();
-    const int numSamples = buffer.getNumSamples();
+        for (int ch = 0; ch < numChannels; ++ch) {
+            float* wetData = buffer.getWritePointer(ch);
+            const float* dryData = dryBuffer.getReadPointer(ch);
 
-    for (int ch = 0; ch < numChannels; ++ch) {
-        float* wetData = buffer.getWritePointer(ch);
-        const float* dryData = dryBuffer.getReadPointer(ch);
+            for (int i = 0; i < numSamples; ++i) {
+                wetData[i] = dryData[i] + wetAmount * (wetData[i] - dryData[i]);
+            }
+        }
+        return;
+    }
 
-        for (int i = 0; i < numSamples; ++i) {
-            wetData[i] = wetData[i] * wetAmount + dryData[i] * dryAmount;
+    float* const* wetData = buffer.getArrayOfWritePointers();
+    const float* const* dryData = dryBuffer.getArrayOfReadPointers();
+
+    for (int i = 0; i < numSamples; ++i) {
+        const float wetAmount = smoothedWetDryMix.getNextValue();
+
+        for (int ch = 0; ch < numChannels; ++ch) {
+            wetData[ch][i] = dryData[ch][i] + wetAmount * (wetData[ch][i] - dryData[ch][i]);
         }
     }
 }
@@ -465,49 +518,30 @@ void ChainSlot::processSidechainForEffect(juce::AudioBuffer<float>& buffer) {
     // This method could apply sidechain filtering if needed
 }
 
-void ChainSlot::updateStats(const juce::AudioBuffer<float>& input, const juce::AudioBuffer<float>& output) {
-    if (samplesProcessed % 1024 == 0) { // Update stats periodically
-        // Calculate RMS levels
-        float inputRMS = 0.0f;
-        float outputRMS = 0.0f;
-        int totalSamples = 0;
+void ChainSlot::updateStats(float inputSumSquares, const juce::AudioBuffer<float>& output, double elapsedSeconds) {
+    SlotStats newStats{};
 
-        for (int ch = 0; ch < input.getNumChannels(); ++ch) {
-            const float* inChannel = input.getReadPointer(ch);
-            const float* outChannel = output.getReadPointer(ch);
+    // Calculate RMS levels
+    const int totalSamples = output.getNumChannels() * output.getNumSamples();
+    if (totalSamples > 0) {
+        const float inputRMS = std::sqrt(inputSumSquares / totalSamples);
+        const float outputRMS = std::sqrt(sumOfSquares(output) / totalSamples);
 
-            for (int i = 0; i < input.getNumSamples(); ++i) {
-                inputRMS += inChannel[i] * inChannel[i];
-                outputRMS += outChannel[i] * outChannel[i];
-            }
-            totalSamples += input.getNumSamples();
-        }
+        newStats.inputLevel = juce::Decibels::gainToDecibels(inputRMS + 1e-8f);
+        newStats.outputLevel = juce::Decibels::gainToDecibels(outputRMS + 1e-8f);
+    }
 
-        if (totalSamples > 0) {
-            inputRMS = std::sqrt(inputRMS / totalSamples);
-            outputRMS = std::sqrt(outputRMS / totalSamples);
+    newStats.wetDryMix = currentConfig.wetDryMix;
+    newStats.outputGain = currentConfig.outputGain;
+    newStats.latency = 0.0f; // Would be calculated from actual processing
+    newStats.isActive = currentConfig.enabled && (currentBypassMode == BypassMode::Normal || currentBypassMode == BypassMode::Solo);
+    newStats.hasSidechainInput = false; // Would be tracked from actual sidechain routing
 
-            stats.inputLevel = juce::Decibels::gainToDecibels(inputRMS + 1e-8f);
-            stats.outputLevel = juce::Decibels::gainToDecibels(outputRMS + 1e-8f);
-        }
+    // Processing time of the measured block as a fraction of its duration
+    const double blockSeconds = output.getNumSamples() / sampleRate;
+    newStats.cpuUsage = blockSeconds > 0.0 ? static_cast<float>(elapsedSeconds / blockSeconds) : 0.0f;
 
-        stats.wetDryMix = currentConfig.wetDryMix;
-        stats.outputGain = currentConfig.outputGain;
-        stats.latency = 0.0f; // Would be calculated from actual processing
-        stats.isActive = currentConfig.enabled && (currentBypassMode == BypassMode::Normal || currentBypassMode == BypassMode::Solo);
-        stats.hasSidechainInput = false; // Would be tracked from actual sidechain routing
-
-        // Estimate CPU usage (simplified)
-        static auto lastUpdateTime = juce::Time::getCurrentTime();
-        auto now = juce::Time::getCurrentTime();
-        double timeDiff = now.toMilliseconds() - lastUpdateTime.toMilliseconds();
-        if (timeDiff > 0) {
-            stats.cpuUsage = (input.getNumSamples() / sampleRate) / (timeDiff / 1000.0);
-        }
-        lastUpdateTime = now;
-    }
-
-    samplesProcessed += input.getNumSamples();
+    publishedStats.publish(newStats, false);
 }
 
 void ChainSlot::analyzeAudio(const juce::AudioBuffer<float>& buffer) {
@@ -597,23 +631,27 @@ void DynamicsEffectsChain::reset() {
     masterOutputGain = 0.0f;
     smoothedMasterGain.setCurrentAndTargetValue(juce::Decibels::decibelsToGain(masterOutputGain));
 
-    // Reset sidechain routing
+    // Reset sidechain routing; buffers stay allocated for their sources
     sidechainRouting.clear();
-    sidechainBuffers.clear();
+    for (auto& pair : sidechainBuffers) {
+        pair.second.clear();
+    }
 
     // Reset statistics
-    totalSamplesProcessed = 0;
-    statsResetTime = juce::Time::getCurrentTime();
-    stats = ChainStats{};
+    blocksUntilStats = 0;
+    resetStats();
 }
 
 void DynamicsEffectsChain::prepareToPlay(double newSampleRate, int newSamplesPerBlock) {
     sampleRate = newSampleRate;
-    samplesPerBlock = newSamplesPerBlock;
+    samplesPerBlock = juce::jmax(1, newSamplesPerBlock);
 
     // Update buffer sizes
     parallelBuffer.setSize(2, samplesPerBlock);
     dryBuffer.setSize(2, samplesPerBlock);
+    for (auto& pair : sidechainBuffers) {
+        pair.second.setSize(2, samplesPerBlock);
+    }
 
     // Update smoothed parameters
     smoothedMasterGain.reset(sampleRate, 0.1f);
@@ -643,17 +681,30 @@ void DynamicsEffectsChain::prepareToPlay(double newSampleRate, int newSamplesPer
 }
 
 void DynamicsEffectsChain::processBlock(juce::AudioBuffer<float>& buffer) {
+    if (buffer.getNumSamples() == 0 || slots.empty()) {
+        return;
+    }
+
+    // Scratch buffers hold one prepared block, so longer host blocks are split
+    forEachChunk(buffer, dryBuffer.getNumSamples(), [this](juce::AudioBuffer<float>& chunk) {
+        processChunk(chunk);
+    });
+}
+
+void DynamicsEffectsChain::processChunk(juce::AudioBuffer<float>& buffer) {
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
 
-    if (numSamples == 0 || slots.empty()) {
-        return;
-    }
+    // Only sampled blocks pay for level metering and timing
+    const bool measureBlock = --blocksUntilStats <= 0;
+    const float inputSumSquares = measureBlock ? sumOfSquares(buffer) : 0.0f;
+    const juce::int64 startTicks = measureBlock ? juce::Time::getHighResolutionTicks() : 0;
 
     // Store original buffer for parallel processing if needed
     if (parallelMode) {
-        dryBuffer.makeCopyOf(buffer);
-        parallelBuffer.makeCopyOf(buffer);
+        for (int ch = 0; ch < juce::jmin(numChannels, dryBuffer.getNumChannels()); ++ch) {
+            dryBuffer.copyFrom(ch, 0, buffer, ch, 0, numSamples);
+        }
     }
 
     // Apply sidechain routing first
@@ -685,20 +736,25 @@ void DynamicsEffectsChain::processBlock(juce::AudioBuffer<float>& buffer) {
     }
 
     // Update statistics
-    updateStats(buffer, buffer);
+    totalSamplesProcessed += static_cast<uint64_t>(numSamples);
+    if (measureBlock) {
+        blocksUntilStats = statsDecimation.load(std::memory_order_relaxed);
+        const double elapsedSeconds = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - startTicks);
+        updateStats(inputSumSquares, buffer, elapsedSeconds);
+    }
 }
 
 void DynamicsEffectsChain::processStereo(juce::AudioBuffer<float>& leftBuffer, juce::AudioBuffer<float>& rightBuffer) {
-    // Combine buffers for processing
-    juce::AudioBuffer<float> stereoBuffer(2, leftBuffer.getNumSamples());
-    stereoBuffer.copyFrom(0, 0, leftBuffer, 0, 0, leftBuffer.getNumSamples());
-    stereoBuffer.copyFrom(1, 0, rightBuffer, 0, 0, rightBuffer.getNumSamples());
+    processStereo(leftBuffer.getWritePointer(0), rightBuffer.getWritePointer(0),
+                  juce::jmin(leftBuffer.getNumSamples(), rightBuffer.getNumSamples()));
+}
 
+void DynamicsEffectsChain::processStereo(float* left, float* right, int numSamples) {
+    // Process the caller's channels in place through a referencing buffer
+    float* channels[] = { left, right };
+    juce::AudioBuffer<float> stereoBuffer(channels, 2, numSamples);
     processBlock(stereoBuffer);
-
-    // Copy back to individual buffers
-    leftBuffer.copyFrom(0, 0, stereoBuffer, 0, 0, leftBuffer.getNumSamples());
-    rightBuffer.copyFrom(0, 0, stereoBuffer, 1, 0, rightBuffer.getNumSamples());
 }
 
 void DynamicsEffectsChain::processMultichannel(juce::AudioBuffer<float>& buffer, int numChannels) {
@@ -754,6 +810,7 @@ int DynamicsEffectsChain::addSlot(const SlotConfig& config) {
     auto slot = std::make_unique<ChainSlot>(slotIndex, config);
     slot->initialize();
     slot->prepareToPlay(sampleRate, samplesPerBlock);
+    slot->setStatsDecimation(getStatsDecimation());
     slots.push_back(std::move(slot));
     return slotIndex;
 }
@@ -782,6 +839,7 @@ bool DynamicsEffectsChain::insertSlot(int slotIndex, const SlotConfig& config) {
     auto slot = std::make_unique<ChainSlot>(slotIndex, config);
     slot->initialize();
     slot->prepareToPlay(sampleRate, samplesPerBlock);
+    slot->setStatsDecimation(getStatsDecimation());
 
     slots.insert(slots.begin() + slotIndex, std::move(slot));
 
@@ -855,10 +913,16 @@ void DynamicsEffectsChain::enableMidSideProcessing(bool enabled) {
 
 void DynamicsEffectsChain::registerSidechainSource(const std::string& name, std::function<void(juce::AudioBuffer<float>&)> callback) {
     sidechainSources[name] = callback;
+
+    // Allocate the source's buffer here rather than on the audio thread
+    auto& sidechainBuffer = sidechainBuffers[name];
+    sidechainBuffer.setSize(2, samplesPerBlock);
+    sidechainBuffer.clear();
 }
 
 void DynamicsEffectsChain::unregisterSidechainSource(const std::string& name) {
     sidechainSources.erase(name);
+    sidechainBuffers.erase(name);
 }
 
 std::vector<std::string> DynamicsEffectsChain::getAvailableSidechainSources() const {
@@ -920,15 +984,49 @@ void DynamicsEffectsChain::enableLoudnessNormalization(bool enabled) {
 }
 
 DynamicsEffectsChain::ChainStats DynamicsEffectsChain::getStats() const {
-    return stats;
+    const ChainLevels levels = publishedLevels.read();
+
+    ChainStats result{};
+    result.inputLevel = levels.inputLevel;
+    result.outputLevel = levels.outputLevel;
+    result.totalCPUUsage = levels.totalCPUUsage;
+    result.totalSamplesProcessed = levels.totalSamplesProcessed;
+    result.lastUpdate = juce::Time(levels.lastUpdateMs);
+    result.isProcessing = levels.isProcessing;
+
+    // Aggregate slot statistics
+    result.totalEffects = static_cast<int>(slots.size());
+    result.slotStats.reserve(slots.size());
+
+    for (const auto& slot : slots) {
+        const auto slotStats = slot->getStats();
+        result.slotStats.push_back(slotStats);
+
+        if (slot->isEnabled()) {
+            result.activeEffects++;
+            result.totalGainReduction += slotStats.outputGain - slotStats.inputLevel;
+        } else {
+            result.bypassedEffects++;
+        }
+
+        result.totalLatency += slotStats.latency;
+    }
+
+    return result;
 }
 
 void DynamicsEffectsChain::resetStats() {
-    stats = ChainStats{};
-    totalSamplesProcessed = 0;
+    publishedLevels.publish(ChainLevels{}, true);
     statsResetTime = juce::Time::getCurrentTime();
 }
 
+void DynamicsEffectsChain::setStatsDecimation(int blocks) {
+    statsDecimation.store(juce::jmax(1, blocks), std::memory_order_relaxed);
+    for (auto& slot : slots) {
+        slot->setStatsDecimation(blocks);
+    }
+}
+
 void DynamicsEffectsChain::updateStats() {
     calculateChainStatistics();
 }
@@ -1211,15 +1309,16 @@ void DynamicsEffectsChain::setUIState(const UIState& state) {
 }
 
 void DynamicsEffectsChain::processSeriesMode(juce::AudioBuffer<float>& buffer) {
-    juce::AudioBuffer<float> currentBuffer = buffer;
+    const bool soloActive = anySlotSoloed();
 
+    // Each slot processes the block in place
     for (auto& slot : slots) {
         if (!slot->isEnabled()) {
             continue;
         }
 
         // Handle solo/mute logic
-        if (anySlotSoloed() && !slot->isSolo()) {
+        if (soloActive && !slot->isSolo()) {
             continue; // Skip non-solo slots when any slot is soloed
         }
 
@@ -1227,12 +1326,19 @@ void DynamicsEffectsChain::processSeriesMode(juce::AudioBuffer<float>& buffer) {
             continue; // Skip muted slots
         }
 
-        slot->processBlock(currentBuffer);
+        slot->processBlock(buffer);
     }
 }
 
 void DynamicsEffectsChain::processParallelMode(juce::AudioBuffer<float>& buffer) {
-    std::vector<juce::AudioBuffer<float>> slotBuffers;
+    // dryBuffer holds this block's input; each slot runs on a copy of it in
+    // parallelBuffer and its output is summed into the caller's buffer
+    const int numChannels = juce::jmin(buffer.getNumChannels(), parallelBuffer.getNumChannels());
+    const int numSamples = buffer.getNumSamples();
+    const bool soloActive = anySlotSoloed();
+
+    juce::AudioBuffer<float> slotBuffer(parallelBuffer.getArrayOfWritePointers(), numChannels, numSamples);
+    int numMixed = 0;
 
     // Process each enabled slot independently
     for (auto& slot : slots) {
@@ -1240,7 +1346,7 @@ void DynamicsEffectsChain::processParallelMode(juce::AudioBuffer<float>& buffer)
             continue;
         }
 
-        if (anySlotSoloed() && !slot->isSolo()) {
+        if (soloActive && !slot->isSolo()) {
             continue;
         }
 
@@ -1248,22 +1354,25 @@ void DynamicsEffectsChain::processParallelMode(juce::AudioBuffer<float>& buffer)
             continue;
         }
 
-        juce::AudioBuffer<float> slotBuffer = buffer;
+        for (int ch = 0; ch < numChannels; ++ch) {
+            slotBuffer.copyFrom(ch, 0, dryBuffer, ch, 0, numSamples);
+        }
+
         slot->processBlock(slotBuffer);
-        slotBuffers.push_back(slotBuffer);
-    }
 
-    // Mix all slot outputs
-    if (!slotBuffers.empty()) {
-        buffer.clear();
-        float mixGain = 1.0f / slotBuffers.size(); // Equal power mixing
-
-        for (const auto& slotBuffer : slotBuffers) {
-            buffer.addFrom(0, 0, slotBuffer, 0, 0, buffer.getNumSamples(), mixGain);
-            if (buffer.getNumChannels() > 1) {
-                buffer.addFrom(1, 0, slotBuffer, 1, 0, buffer.getNumSamples(), mixGain);
+        for (int ch = 0; ch < numChannels; ++ch) {
+            if (numMixed == 0) {
+                buffer.copyFrom(ch, 0, slotBuffer, ch, 0, numSamples);
+            } else {
+                buffer.addFrom(ch, 0, slotBuffer, ch, 0, numSamples);
             }
         }
+        ++numMixed;
+    }
+
+    // Mix all slot outputs
+    if (numMixed > 1) {
+        buffer.applyGain(0, numSamples, 1.0f / numMixed);
     }
 }
 
@@ -1272,27 +1381,22 @@ void DynamicsEffectsChain::processMidSideMode(juce::AudioBuffer<float>& buffer)
         return;
     }
 
-    // Encode to Mid/Side
-    juce::AudioBuffer<float> msBuffer(2, buffer.getNumSamples());
+    // Encode to Mid/Side into the parallel scratch, which is free by now
+    const int numSamples = buffer.getNumSamples();
+    juce::AudioBuffer<float> msBuffer(parallelBuffer.getArrayOfWritePointers(), 2, numSamples);
     msEncoder->processBlock(buffer, msBuffer);
 
-    // Process Mid and Side channels separately
+    // Process Mid and Side channels separately, in place as mono views
+    juce::AudioBuffer<float> midBuffer(msBuffer.getArrayOfWritePointers(), 1, numSamples);
+    juce::AudioBuffer<float> sideBuffer(msBuffer.getArrayOfWritePointers() + 1, 1, numSamples);
+
     for (auto& slot : slots) {
         if (!slot->isEnabled()) {
             continue;
         }
 
-        // Process Mid channel
-        juce::AudioBuffer<float> midBuffer(1, buffer.getNumSamples());
-        midBuffer.copyFrom(0, 0, msBuffer, 0, 0, buffer.getNumSamples());
         slot->processBlock(midBuffer);
-        msBuffer.copyFrom(0, 0, midBuffer, 0, 0, buffer.getNumSamples());
-
-        // Process Side channel
-        juce::AudioBuffer<float> sideBuffer(1, buffer.getNumSamples());
-        sideBuffer.copyFrom(0, 0, msBuffer, 1, 0, buffer.getNumSamples());
         slot->processBlock(sideBuffer);
-        msBuffer.copyFrom(1, 0, sideBuffer, 0, 0, buffer.getNumSamples());
     }
 
     // Decode back to Left/Right
@@ -1312,13 +1416,12 @@ void DynamicsEffectsChain::processSidechainRouting(juce::AudioBuffer<float>& buf
 }
 
 void DynamicsEffectsChain::updateSidechainBuffers() {
+    // Sources render straight into the buffers allocated when they registered
     for (auto& pair : sidechainSources) {
-        const std::string& name = pair.first;
-        auto& callback = pair.second;
-
-        juce::AudioBuffer<float> sidechainBuffer(2, samplesPerBlock);
-        callback(sidechainBuffer);
-        sidechainBuffers[name] = sidechainBuffer;
+        auto found = sidechainBuffers.find(pair.first);
+        if (found != sidechainBuffers.end()) {
+            pair.second(found->second);
+        }
     }
 }
 
@@ -1339,8 +1442,8 @@ void DynamicsEffectsChain::routeSidechainToSlots() {
 }
 
 void DynamicsEffectsChain::applyMasterOutput(juce::AudioBuffer<float>& buffer) {
-    float gainLinear = smoothedMasterGain.getNextValue();
-    buffer.applyGain(gainLinear);
+    // Per-sample ramp while smoothing, skipped at unity
+    smoothedMasterGain.applyGain(buffer, buffer.getNumSamples());
 }
 
 void DynamicsEffectsChain::updateSoloMuteStates() {
@@ -1362,49 +1465,27 @@ void DynamicsEffectsChain::applySoloMuteToBuffer(juce::AudioBuffer<float>& buffe
     // Solo/mute is applied during slot processing
 }
 
-void DynamicsEffectsChain::updateStats(const juce::AudioBuffer<float>& input, const juce::AudioBuffer<float>& output) {
-    if (totalSamplesProcessed % 1024 == 0) { // Update stats periodically
-        // Calculate chain-level statistics
-        stats.inputLevel = calculateRMSLevel(input);
-        stats.outputLevel = calculateRMSLevel(output);
-
-        // Aggregate slot statistics
-        stats.totalGainReduction = 0.0f;
-        stats.totalLatency = 0.0f;
-        stats.activeEffects = 0;
-        stats.bypassedEffects = 0;
-        stats.totalEffects = static_cast<int>(slots.size());
-        stats.slotStats.clear();
-
-        for (const auto& slot : slots) {
-            auto slotStats = slot->getStats();
-            stats.slotStats.push_back(slotStats);
-
-            if (slot->isEnabled()) {
-                stats.activeEffects++;
-                stats.totalGainReduction += slotStats.outputGain - slotStats.inputLevel;
-            } else {
-                stats.bypassedEffects++;
-            }
+void DynamicsEffectsChain::updateStats(float inputSumSquares, const juce::AudioBuffer<float>& output, double elapsedSeconds) {
+    ChainLevels levels;
 
-            stats.totalLatency += slotStats.latency;
-        }
-
-        // Calculate total CPU usage (simplified)
-        static auto lastUpdateTime = juce::Time::getCurrentTime();
-        auto now = juce::Time::getCurrentTime();
-        double timeDiff = now.toMilliseconds() - lastUpdateTime.toMilliseconds();
-        if (timeDiff > 0) {
-            stats.totalCPUUsage = static_cast<int>((input.getNumSamples() / sampleRate) / (timeDiff / 1000.0));
-        }
-        lastUpdateTime = now;
+    // Calculate chain-level statistics; slot aggregates are added by getStats()
+    const int totalSamples = output.getNumChannels() * output.getNumSamples();
+    if (totalSamples > 0) {
+        levels.inputLevel = juce::Decibels::gainToDecibels(std::sqrt(inputSumSquares / totalSamples) + 1e-8f);
+    }
+    levels.outputLevel = calculateRMSLevel(output);
 
-        stats.totalSamplesProcessed = totalSamplesProcessed;
-        stats.lastUpdate = juce::Time::getCurrentTime();
-        stats.isProcessing = true;
+    // Processing time of the measured block as a percentage of its duration
+    const double blockSeconds = output.getNumSamples() / sampleRate;
+    if (blockSeconds > 0.0) {
+        levels.totalCPUUsage = static_cast<int>(100.0 * elapsedSeconds / blockSeconds);
     }
 
-    totalSamplesProcessed += input.getNumSamples();
+    levels.totalSamplesProcessed = static_cast<double>(totalSamplesProcessed);
+    levels.lastUpdateMs = juce::Time::currentTimeMillis();
+    levels.isProcessing = true;
+
+    publishedLevels.publish(levels, false);
 }
 
 void DynamicsEffectsChain::analyzeFrequencyContent(const juce::AudioBuffer<float>& buffer) {
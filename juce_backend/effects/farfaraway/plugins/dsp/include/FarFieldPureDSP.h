@@ -11,9 +11,15 @@
     - Distance-based attenuation (inverse square law)
     - High-frequency air absorption
     - Stereo width narrowing with distance
-    - Doppler effect from source velocity
+    - Doppler effect from a variable propagation delay
     - Near-to-far crossfading
 
+    Performance notes:
+    - Distance coefficients are computed once per block and smoothed per
+      sample, so the sample loop has no cos/divide
+    - FarFieldScene renders many moving sources per block with their state
+      in SoA form, four sources per SIMD vector
+
   ==============================================================================
 */
 
@@ -22,9 +28,28 @@
 #include <cmath>
 #include <algorithm>
 #include <cstdint>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+#elif defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+#endif
 
 namespace farfield {
 
+//==============================================================================
+// Constants
+//==============================================================================
+
+constexpr float kSpeedOfSound = 343.0f;          // m/s at 20°C
+constexpr float kMaxDopplerDistance_m = 500.0f;  // FarField delay line reach (maxDistance_m upper bound)
+constexpr float kSmoothingTime_s = 0.05f;        // Coefficient smoothing time constant
+
+// Largest propagation delay change per sample (pitch ratio 0.5-1.5), so a
+// jump in distance glides instead of playing backwards
+constexpr float kMaxDelaySlew = 0.5f;
+
 //==============================================================================
 // DSP Parameters Structure
 //==============================================================================
@@ -38,7 +63,7 @@ struct FarFieldParams {
     float level;             // Output level (0-2)
     float nearFade_m;        // Near fade start (0-20m)
     float farFade_m;         // Far fade end (1-100m)
-    float sourceVelocity;    // Source velocity (-80 to +80 m/s)
+    float sourceVelocity;    // Source velocity (-80 to +80 m/s, positive = approaching)
     float dopplerAmount;     // Doppler effect amount (0-1)
 
     FarFieldParams()
@@ -55,6 +80,344 @@ struct FarFieldParams {
     {}
 };
 
+//==============================================================================
+// Block Coefficients
+//==============================================================================
+
+struct FarFieldCoefficients {
+    float gain;       // Inverse-square distance gain with output level folded in
+    float fade;       // Near-to-far crossfade (0 = near, 1 = far)
+    float airAlpha;   // Air absorption lowpass coefficient
+    float maxDelta;   // Transient softening slew limit
+    float width;      // Side gain after distance narrowing
+};
+
+inline FarFieldCoefficients computeCoefficients(const FarFieldParams& params, double sampleRate)
+{
+    FarFieldCoefficients coeffs;
+
+    // Inverse square law with minimum distance: gain = 1 / (1 + 0.01 d^2)
+    float effectiveDistance = std::max(params.distance_m, 1.0f);
+    coeffs.gain = params.level / (1.0f + 0.01f * effectiveDistance * effectiveDistance);
+
+    // Smooth near-to-far crossfade using cosine
+    float distanceRatio = (effectiveDistance - params.nearFade_m) /
+                         std::max(0.1f, params.farFade_m - params.nearFade_m);
+    distanceRatio = std::clamp(distanceRatio, 0.0f, 1.0f);
+    coeffs.fade = 0.5f * (1.0f - std::cos(distanceRatio * 3.14159265f));
+
+    // Air absorbs high frequencies more than low frequencies (max 50%)
+    float cutoff = 20000.0f * (1.0f - params.airAmount * 0.5f);
+    float rc = 1.0f / (2.0f * 3.14159265f * cutoff);
+    float dt = 1.0f / static_cast<float>(sampleRate);
+    coeffs.airAlpha = dt / (rc + dt);
+
+    // Soften transients by limiting rate of change (0.1 to 1.0)
+    coeffs.maxDelta = 1.0f - params.soften * 0.9f;
+
+    // Width decreases with distance
+    coeffs.width = params.width * (1.0f - 0.5f * coeffs.fade);
+
+    return coeffs;
+}
+
+//==============================================================================
+// Doppler Path
+//==============================================================================
+
+// Distance sound travels from a source, which sets its propagation delay.
+// sourceVelocity moves the source along the path from wherever distance_m
+// last put it; setting a new distance_m re-anchors it. A source that
+// approaches shortens the delay and is heard pitched up, and vice versa.
+struct DopplerPath {
+    float anchor_m = -1.0f;
+    float travel_m = 0.0f;
+
+    void reset()
+    {
+        anchor_m = -1.0f;
+        travel_m = 0.0f;
+    }
+
+    // Path length at the start and end of a block lasting blockSeconds
+    void advance(const FarFieldParams& params, float blockSeconds, float reach_m,
+                 float& start_m, float& end_m)
+    {
+        if (params.distance_m != anchor_m)
+        {
+            anchor_m = params.distance_m;
+            travel_m = 0.0f;
+        }
+
+        float limit = std::max(0.0f, std::min(params.maxDistance_m, reach_m));
+        start_m = std::clamp(params.distance_m + travel_m, 0.0f, limit);
+        end_m = std::clamp(start_m - params.sourceVelocity * blockSeconds, 0.0f, limit);
+        travel_m = end_m - params.distance_m;
+    }
+};
+
+//==============================================================================
+// SIMD Lanes (one source per lane)
+//==============================================================================
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+
+struct SourceLanes
+{
+    using Vec = float32x4_t;
+    static constexpr int kWidth = 4;
+
+    static Vec load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Vec v) { vst1q_f32(p, v); }
+    static Vec broadcast(float x) { return vdupq_n_f32(x); }
+    static Vec add(Vec x, Vec y) { return vaddq_f32(x, y); }
+    static Vec sub(Vec x, Vec y) { return vsubq_f32(x, y); }
+    static Vec mul(Vec x, Vec y) { return vmulq_f32(x, y); }
+    static Vec min(Vec x, Vec y) { return vminq_f32(x, y); }
+    static Vec max(Vec x, Vec y) { return vmaxq_f32(x, y); }
+};
+
+#elif defined(__SSE__) || defined(_M_X64)
+
+struct SourceLanes
+{
+    using Vec = __m128;
+    static constexpr int kWidth = 4;
+
+    static Vec load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+    static Vec broadcast(float x) { return _mm_set1_ps(x); }
+    static Vec add(Vec x, Vec y) { return _mm_add_ps(x, y); }
+    static Vec sub(Vec x, Vec y) { return _mm_sub_ps(x, y); }
+    static Vec mul(Vec x, Vec y) { return _mm_mul_ps(x, y); }
+    static Vec min(Vec x, Vec y) { return _mm_min_ps(x, y); }
+    static Vec max(Vec x, Vec y) { return _mm_max_ps(x, y); }
+};
+
+#else
+
+struct SourceLanes
+{
+    struct Vec { float v[4]; };
+    static constexpr int kWidth = 4;
+
+    template <typename Op>
+    static Vec map(Vec x, Vec y, Op op) { return { { op(x.v[0], y.v[0]), op(x.v[1], y.v[1]), op(x.v[2], y.v[2]), op(x.v[3], y.v[3]) } }; }
+
+    static Vec load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+    static void store(float* p, Vec v) { std::copy(v.v, v.v + 4, p); }
+    static Vec broadcast(float x) { return { { x, x, x, x } }; }
+    static Vec add(Vec x, Vec y) { return map(x, y, [](float a, float b) { return a + b; }); }
+    static Vec sub(Vec x, Vec y) { return map(x, y, [](float a, float b) { return a - b; }); }
+    static Vec mul(Vec x, Vec y) { return map(x, y, [](float a, float b) { return a * b; }); }
+    static Vec min(Vec x, Vec y) { return map(x, y, [](float a, float b) { return std::min(a, b); }); }
+    static Vec max(Vec x, Vec y) { return map(x, y, [](float a, float b) { return std::max(a, b); }); }
+};
+
+#endif
+
+struct SingleLane
+{
+    using Vec = float;
+    static constexpr int kWidth = 1;
+
+    static Vec load(const float* p) { return *p; }
+    static void store(float* p, Vec v) { *p = v; }
+    static Vec broadcast(float x) { return x; }
+    static Vec add(Vec x, Vec y) { return x + y; }
+    static Vec sub(Vec x, Vec y) { return x - y; }
+    static Vec mul(Vec x, Vec y) { return x * y; }
+    static Vec min(Vec x, Vec y) { return std::min(x, y); }
+    static Vec max(Vec x, Vec y) { return std::max(x, y); }
+};
+
+//==============================================================================
+// Far Field Kernel (shared by FarField and FarFieldScene)
+//==============================================================================
+
+// Per-source state lives in SoA form: field f of source s is at
+// state[f * stride + s]. The delay line of a group of sources stores one
+// frame per sample as [left lanes..., right lanes...].
+struct FarFieldKernel
+{
+    enum StateField {
+        kGain, kFade, kAirAlpha, kMaxDelta, kWidth,     // Smoothed coefficients
+        kGainTarget, kFadeTarget, kAirAlphaTarget, kMaxDeltaTarget, kWidthTarget,
+        kDelay,                                         // Smoothed propagation delay (samples)
+        kDelayTarget, kDelayStep,                       // Delay ramp across the block
+        kLastLeftIn, kLastRightIn,
+        kNumStateFields
+    };
+
+    // Delay line length able to hold maxDistance_m of propagation delay
+    static int delayFramesFor(double sampleRate, float maxDistance_m)
+    {
+        return static_cast<int>(std::ceil(maxDistance_m / kSpeedOfSound * sampleRate)) + 3;
+    }
+
+    static float reachFor(double sampleRate, int delayFrames)
+    {
+        return static_cast<float>((delayFrames - 3) * kSpeedOfSound / sampleRate);
+    }
+
+    static float smoothingFor(double sampleRate)
+    {
+        return 1.0f - static_cast<float>(std::exp(-1.0 / (kSmoothingTime_s * sampleRate)));
+    }
+
+    // Set one source's block targets (scalar, once per block)
+    static void beginBlock(float* lane, int stride, const FarFieldParams& params, DopplerPath& path,
+                           double sampleRate, int numSamples, float reach_m, bool snap)
+    {
+        const FarFieldCoefficients coeffs = computeCoefficients(params, sampleRate);
+        lane[kGainTarget * stride] = coeffs.gain;
+        lane[kFadeTarget * stride] = coeffs.fade;
+        lane[kAirAlphaTarget * stride] = coeffs.airAlpha;
+        lane[kMaxDeltaTarget * stride] = coeffs.maxDelta;
+        lane[kWidthTarget * stride] = coeffs.width;
+
+        float start_m, end_m;
+        path.advance(params, static_cast<float>(numSamples / sampleRate), reach_m, start_m, end_m);
+
+        const float samplesPerMetre = std::clamp(params.dopplerAmount, 0.0f, 1.0f) *
+                                      static_cast<float>(sampleRate) / kSpeedOfSound;
+        lane[kDelayTarget * stride] = start_m * samplesPerMetre;
+        lane[kDelayStep * stride] = (end_m - start_m) * samplesPerMetre / static_cast<float>(numSamples);
+
+        if (snap)
+        {
+            for (int f = kGain; f <= kWidth; ++f)
+                lane[f * stride] = lane[(f + kGainTarget) * stride];
+            lane[kDelay * stride] = lane[kDelayTarget * stride];
+        }
+    }
+
+    // Render Lanes::kWidth sources for one block. Input is lane-interleaved
+    // (sample i of lane l at in[i * kWidth + l]); the lanes are summed into
+    // the stereo output, or added to it when accumulate is set.
+    template <typename Lanes>
+    static void render(float* state, int stride,
+                       const float* inLeft, const float* inRight,
+                       float* delayLine, int delayFrames, int writeIndex,
+                       float* outLeft, float* outRight, bool accumulate,
+                       int numSamples, float smoothing)
+    {
+        using Vec = typename Lanes::Vec;
+        constexpr int W = Lanes::kWidth;
+
+        auto field = [state, stride](int f) { return state + f * stride; };
+
+        Vec gain = Lanes::load(field(kGain));
+        Vec fade = Lanes::load(field(kFade));
+        Vec airAlpha = Lanes::load(field(kAirAlpha));
+        Vec maxDelta = Lanes::load(field(kMaxDelta));
+        Vec width = Lanes::load(field(kWidth));
+        Vec delay = Lanes::load(field(kDelay));
+        Vec delayTarget = Lanes::load(field(kDelayTarget));
+        Vec lastLeft = Lanes::load(field(kLastLeftIn));
+        Vec lastRight = Lanes::load(field(kLastRightIn));
+
+        const Vec gainTarget = Lanes::load(field(kGainTarget));
+        const Vec fadeTarget = Lanes::load(field(kFadeTarget));
+        const Vec airAlphaTarget = Lanes::load(field(kAirAlphaTarget));
+        const Vec maxDeltaTarget = Lanes::load(field(kMaxDeltaTarget));
+        const Vec widthTarget = Lanes::load(field(kWidthTarget));
+        const Vec delayStep = Lanes::load(field(kDelayStep));
+
+        const Vec k = Lanes::broadcast(smoothing);
+        const Vec half = Lanes::broadcast(0.5f);
+        const Vec zero = Lanes::broadcast(0.0f);
+        const Vec slewUp = Lanes::broadcast(kMaxDelaySlew);
+        const Vec slewDown = Lanes::broadcast(-kMaxDelaySlew);
+
+        float delays[W];
+        int write = writeIndex;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const Vec leftIn = Lanes::load(inLeft + i * W);
+            const Vec rightIn = Lanes::load(inRight + i * W);
+
+            // 1. Smooth block coefficients toward their targets
+            gain = Lanes::add(gain, Lanes::mul(k, Lanes::sub(gainTarget, gain)));
+            fade = Lanes::add(fade, Lanes::mul(k, Lanes::sub(fadeTarget, fade)));
+            airAlpha = Lanes::add(airAlpha, Lanes::mul(k, Lanes::sub(airAlphaTarget, airAlpha)));
+            maxDelta = Lanes::add(maxDelta, Lanes::mul(k, Lanes::sub(maxDeltaTarget, maxDelta)));
+            width = Lanes::add(width, Lanes::mul(k, Lanes::sub(widthTarget, width)));
+
+            delayTarget = Lanes::add(delayTarget, delayStep);
+            Vec delayChange = Lanes::mul(k, Lanes::sub(delayTarget, delay));
+            delay = Lanes::add(delay, Lanes::min(Lanes::max(delayChange, slewDown), slewUp));
+
+            // 2. Air absorption lowpass, blended in with distance
+            Vec leftAir = Lanes::add(lastLeft, Lanes::mul(airAlpha, Lanes::sub(leftIn, lastLeft)));
+            Vec rightAir = Lanes::add(lastRight, Lanes::mul(airAlpha, Lanes::sub(rightIn, lastRight)));
+            Vec leftProcessed = Lanes::add(leftIn, Lanes::mul(Lanes::sub(leftAir, leftIn), fade));
+            Vec rightProcessed = Lanes::add(rightIn, Lanes::mul(Lanes::sub(rightAir, rightIn), fade));
+
+            // 3. Transient softening
+            const Vec minDelta = Lanes::sub(zero, maxDelta);
+            Vec leftSoftened = Lanes::add(lastLeft, Lanes::min(Lanes::max(Lanes::sub(leftProcessed, lastLeft), minDelta), maxDelta));
+            Vec rightSoftened = Lanes::add(lastRight, Lanes::min(Lanes::max(Lanes::sub(rightProcessed, lastRight), minDelta), maxDelta));
+
+            // 4. Distance gain and output level
+            Vec leftGained = Lanes::mul(leftSoftened, gain);
+            Vec rightGained = Lanes::mul(rightSoftened, gain);
+
+            // 5. Stereo width narrowing
+            Vec mid = Lanes::mul(Lanes::add(leftGained, rightGained), half);
+            Vec side = Lanes::mul(Lanes::mul(Lanes::sub(leftGained, rightGained), half), width);
+
+            lastLeft = leftIn;
+            lastRight = rightIn;
+
+            // 6. Doppler: write into the delay line, read back at the
+            //    propagation delay with linear interpolation
+            float* frame = delayLine + write * 2 * W;
+            Lanes::store(frame, Lanes::add(mid, side));
+            Lanes::store(frame + W, Lanes::sub(mid, side));
+            Lanes::store(delays, delay);
+
+            float sumLeft = 0.0f;
+            float sumRight = 0.0f;
+
+            for (int lane = 0; lane < W; ++lane)
+            {
+                const int whole = static_cast<int>(delays[lane]);
+                const float frac = delays[lane] - static_cast<float>(whole);
+
+                int newer = write - whole;
+                if (newer < 0)
+                    newer += delayFrames;
+                int older = newer - 1;
+                if (older < 0)
+                    older += delayFrames;
+
+                const float* a = delayLine + newer * 2 * W + lane;
+                const float* b = delayLine + older * 2 * W + lane;
+                sumLeft += a[0] + frac * (b[0] - a[0]);
+                sumRight += a[W] + frac * (b[W] - a[W]);
+            }
+
+            if (++write == delayFrames)
+                write = 0;
+
+            outLeft[i] = accumulate ? outLeft[i] + sumLeft : sumLeft;
+            outRight[i] = accumulate ? outRight[i] + sumRight : sumRight;
+        }
+
+        Lanes::store(field(kGain), gain);
+        Lanes::store(field(kFade), fade);
+        Lanes::store(field(kAirAlpha), airAlpha);
+        Lanes::store(field(kMaxDelta), maxDelta);
+        Lanes::store(field(kWidth), width);
+        Lanes::store(field(kDelay), delay);
+        Lanes::store(field(kDelayTarget), delayTarget);
+        Lanes::store(field(kLastLeftIn), lastLeft);
+        Lanes::store(field(kLastRightIn), lastRight);
+    }
+};
+
 //==============================================================================
 // Far Field DSP Engine
 //==============================================================================
@@ -63,31 +426,37 @@ class FarField {
 public:
     FarField()
         : sampleRate(48000.0)
-        , lastLeftIn(0.0f)
-        , lastRightIn(0.0f)
-        , lastLeftOut(0.0f)
-        , lastRightOut(0.0f)
-        , dopplerPhase(0.0f)
+        , smoothing(FarFieldKernel::smoothingFor(48000.0))
+        , reach_m(0.0f)
+        , delayFrames(0)
+        , writeIndex(0)
+        , snapCoefficients(true)
     {
+        reset();
     }
 
     //==========================================================================
     // Initialization
     //==========================================================================
 
+    // Allocates the Doppler delay line (not real-time safe)
     void prepare(double newSampleRate, int /*maxSamplesPerBlock*/)
     {
         sampleRate = newSampleRate;
+        smoothing = FarFieldKernel::smoothingFor(sampleRate);
+        delayFrames = FarFieldKernel::delayFramesFor(sampleRate, kMaxDopplerDistance_m);
+        reach_m = FarFieldKernel::reachFor(sampleRate, delayFrames);
+        delayLine.assign(static_cast<size_t>(delayFrames) * 2, 0.0f);
         reset();
     }
 
     void reset()
     {
-        lastLeftIn = 0.0f;
-        lastRightIn = 0.0f;
-        lastLeftOut = 0.0f;
-        lastRightOut = 0.0f;
-        dopplerPhase = 0.0f;
+        std::fill(std::begin(state), std::end(state), 0.0f);
+        std::fill(delayLine.begin(), delayLine.end(), 0.0f);
+        dopplerPath.reset();
+        writeIndex = 0;
+        snapCoefficients = true;
     }
 
     //==========================================================================
@@ -109,147 +478,205 @@ public:
     // Processing
     //==========================================================================
 
+    // Parameters take effect per call, smoothed across the block. Does
+    // nothing until prepare() has been called.
     void processStereo(float* left, float* right, int numSamples)
     {
-        for (int i = 0; i < numSamples; ++i)
-        {
-            // Process stereo sample
-            float leftIn = left[i];
-            float rightIn = right[i];
+        if (numSamples <= 0 || delayLine.empty())
+            return;
 
-            processSample(leftIn, rightIn, left[i], right[i]);
-        }
+        FarFieldKernel::beginBlock(state, 1, params, dopplerPath, sampleRate,
+                                   numSamples, reach_m, snapCoefficients);
+        snapCoefficients = false;
+
+        FarFieldKernel::render<SingleLane>(state, 1, left, right,
+                                           delayLine.data(), delayFrames, writeIndex,
+                                           left, right, false, numSamples, smoothing);
+
+        writeIndex = (writeIndex + numSamples) % delayFrames;
     }
 
 private:
     //==========================================================================
-    // Sample Processing
+    // Member Variables
     //==========================================================================
 
-    void processSample(float leftIn, float rightIn, float& leftOut, float& rightOut)
-    {
-        // 1. Calculate distance-based gain (inverse square law with minimum distance)
-        float minDistance = 1.0f;
-        float effectiveDistance = std::max(params.distance_m, minDistance);
-
-        // Inverse square law: gain = 1 / (1 + distance^2)
-        float distanceGain = 1.0f / (1.0f + 0.01f * effectiveDistance * effectiveDistance);
-
-        // 2. Calculate near-to-far crossfade
-        float distanceRatio = (effectiveDistance - params.nearFade_m) /
-                             std::max(0.1f, params.farFade_m - params.nearFade_m);
-        distanceRatio = std::clamp(distanceRatio, 0.0f, 1.0f);
-
-        // Smooth crossfade using cosine
-        float fadeFactor = 0.5f * (1.0f - std::cos(distanceRatio * 3.14159265f));
-
-        // 3. Apply high-frequency air absorption
-        float leftAir = applyAirAbsorption(leftIn, lastLeftIn);
-        float rightAir = applyAirAbsorption(rightIn, lastRightIn);
-
-        // Blend dry and air-absorbed signal based on distance
-        float leftProcessed = leftIn + (leftAir - leftIn) * fadeFactor;
-        float rightProcessed = rightIn + (rightAir - rightIn) * fadeFactor;
-
-        // 4. Apply transient softening
-        float leftSoftened = applySoften(leftProcessed, lastLeftIn);
-        float rightSoftened = applySoften(rightProcessed, lastRightIn);
-
-        // 5. Apply distance gain
-        float leftGained = leftSoftened * distanceGain;
-        float rightGained = rightSoftened * distanceGain;
-
-        // 6. Apply stereo width narrowing with distance
-        float mid = (leftGained + rightGained) * 0.5f;
-        float side = (leftGained - rightGained) * 0.5f;
-
-        // Width decreases with distance
-        float widthFactor = params.width * (1.0f - 0.5f * fadeFactor);
-        float leftWide = mid + side * widthFactor;
-        float rightWide = mid - side * widthFactor;
-
-        // 7. Apply Doppler effect (pitch shift based on source velocity)
-        float leftDoppler = applyDoppler(leftWide);
-        float rightDoppler = applyDoppler(rightWide);
-
-        // 8. Apply output level
-        leftOut = leftDoppler * params.level;
-        rightOut = rightDoppler * params.level;
-
-        // Update state
-        lastLeftIn = leftIn;
-        lastRightIn = rightIn;
-        lastLeftOut = leftOut;
-        lastRightOut = rightOut;
-    }
+    double sampleRate;
+    FarFieldParams params;
+
+    float state[FarFieldKernel::kNumStateFields];
+    float smoothing;
+    float reach_m;
+
+    // Doppler delay line, one stereo frame per sample
+    std::vector<float> delayLine;
+    int delayFrames;
+    int writeIndex;
+    DopplerPath dopplerPath;
+
+    bool snapCoefficients;
+};
+
+//==============================================================================
+// Far Field Scene (batch rendering of many moving sources)
+//==============================================================================
+
+// Renders a fixed set of sources through the far field chain and mixes
+// them to one stereo bus. Sources are processed four to a SIMD vector with
+// all per-sample state in SoA arrays; only the delay line reads are scalar.
+// Move a source by updating its distance_m every block, with
+// sourceVelocity filling in the motion between updates.
+class FarFieldScene {
+public:
+    FarFieldScene() = default;
 
     //==========================================================================
-    // Air Absorption (LPF)
+    // Initialization
     //==========================================================================
 
-    float applyAirAbsorption(float input, float lastInput)
+    // Allocates all state and delay lines (not real-time safe). Each source
+    // can be up to maxDopplerDistance_m away before its delay saturates.
+    void prepare(double newSampleRate, int maxSamplesPerBlock, int numSources,
+                 float maxDopplerDistance_m = 100.0f)
+    {
+        sampleRate = newSampleRate;
+        maxBlockSize = std::max(1, maxSamplesPerBlock);
+        sourceCount = std::max(0, numSources);
+        groupCount = (sourceCount + kLanes - 1) / kLanes;
+        stride = groupCount * kLanes;
+
+        smoothing = FarFieldKernel::smoothingFor(sampleRate);
+        delayFrames = FarFieldKernel::delayFramesFor(sampleRate, maxDopplerDistance_m);
+        reach_m = FarFieldKernel::reachFor(sampleRate, delayFrames);
+
+        params.assign(static_cast<size_t>(sourceCount), FarFieldParams());
+        paths.assign(static_cast<size_t>(sourceCount), DopplerPath());
+        state.assign(static_cast<size_t>(FarFieldKernel::kNumStateFields) * stride, 0.0f);
+        delayLines.assign(static_cast<size_t>(groupCount) * delayFrames * 2 * kLanes, 0.0f);
+        tileLeft.assign(static_cast<size_t>(maxBlockSize) * kLanes, 0.0f);
+        tileRight.assign(static_cast<size_t>(maxBlockSize) * kLanes, 0.0f);
+
+        reset();
+    }
+
+    void reset()
     {
-        // Air absorbs high frequencies more than low frequencies
-        // Implement as simple lowpass filter
-        float amount = params.airAmount * 0.5f; // Max 50% absorption
-        float cutoff = 20000.0f * (1.0f - amount);
-        float rc = 1.0f / (2.0f * 3.14159265f * cutoff);
-        float dt = 1.0f / static_cast<float>(sampleRate);
-        float alpha = dt / (rc + dt);
-
-        return lastInput + alpha * (input - lastInput);
+        std::fill(state.begin(), state.end(), 0.0f);
+        std::fill(delayLines.begin(), delayLines.end(), 0.0f);
+        for (auto& path : paths)
+            path.reset();
+        writeIndex = 0;
+        snapCoefficients = true;
     }
 
     //==========================================================================
-    // Transient Softening
+    // Sources
     //==========================================================================
 
-    float applySoften(float input, float lastInput)
+    int getNumSources() const { return sourceCount; }
+
+    FarFieldParams& getSourceParams(int index) { return params[static_cast<size_t>(index)]; }
+    const FarFieldParams& getSourceParams(int index) const { return params[static_cast<size_t>(index)]; }
+
+    void setSourceParams(int index, const FarFieldParams& newParams) { params[static_cast<size_t>(index)] = newParams; }
+
+    void setSourceMotion(int index, float distance_m, float velocity)
     {
-        // Soften transients by limiting rate of change
-        float maxDelta = 1.0f - params.soften * 0.9f; // 0.1 to 1.0
-        float delta = input - lastInput;
-        float clampedDelta = std::clamp(delta, -maxDelta, maxDelta);
-        return lastInput + clampedDelta;
+        params[static_cast<size_t>(index)].distance_m = distance_m;
+        params[static_cast<size_t>(index)].sourceVelocity = velocity;
     }
 
     //==========================================================================
-    // Doppler Effect
+    // Processing
     //==========================================================================
 
-    float applyDoppler(float input)
+    // Render every source into the stereo bus (overwritten). sourceLeft and
+    // sourceRight hold one buffer per source; pass the same buffer twice for
+    // a mono source, or nullptr for a silent one (its tail still plays out).
+    void process(const float* const* sourceLeft, const float* const* sourceRight,
+                 float* outLeft, float* outRight, int numSamples)
     {
-        if (params.dopplerAmount < 0.01f)
-            return input;
-
-        // Doppler shift frequency
-        float speedOfSound = 343.0f; // m/s at 20°C
-        float dopplerShift = 1.0f + (params.sourceVelocity / speedOfSound);
-        dopplerShift = 1.0f + (dopplerShift - 1.0f) * params.dopplerAmount;
-
-        // Simple delay-based Doppler implementation
-        float delaySamples = dopplerShift * 10.0f; // Max 10 samples delay
-        dopplerPhase += delaySamples;
-        if (dopplerPhase >= 10.0f)
-            dopplerPhase -= 10.0f;
-
-        // For simplicity, we'll just modulate the input slightly
-        // A full implementation would use a variable delay line
-        float modulation = std::sin(dopplerPhase * 0.1f) * 0.01f * params.dopplerAmount;
-        return input * (1.0f + modulation);
+        if (sourceCount == 0)
+        {
+            std::fill(outLeft, outLeft + numSamples, 0.0f);
+            std::fill(outRight, outRight + numSamples, 0.0f);
+            return;
+        }
+
+        for (int start = 0; start < numSamples; start += maxBlockSize)
+        {
+            const int blockSize = std::min(maxBlockSize, numSamples - start);
+
+            for (int s = 0; s < sourceCount; ++s)
+                FarFieldKernel::beginBlock(state.data() + s, stride, params[static_cast<size_t>(s)],
+                                           paths[static_cast<size_t>(s)], sampleRate,
+                                           blockSize, reach_m, snapCoefficients);
+            snapCoefficients = false;
+
+            for (int group = 0; group < groupCount; ++group)
+            {
+                const int firstSource = group * kLanes;
+
+                for (int lane = 0; lane < kLanes; ++lane)
+                {
+                    const int s = firstSource + lane;
+                    const float* srcLeft = s < sourceCount ? sourceLeft[s] : nullptr;
+                    const float* srcRight = s < sourceCount ? sourceRight[s] : nullptr;
+                    gatherLane(tileLeft.data(), lane, srcLeft, start, blockSize);
+                    gatherLane(tileRight.data(), lane, srcRight, start, blockSize);
+                }
+
+                FarFieldKernel::render<SourceLanes>(state.data() + firstSource, stride,
+                                                    tileLeft.data(), tileRight.data(),
+                                                    delayLines.data() + static_cast<size_t>(group) * delayFrames * 2 * kLanes,
+                                                    delayFrames, writeIndex,
+                                                    outLeft + start, outRight + start,
+                                                    group > 0, blockSize, smoothing);
+            }
+
+            writeIndex = (writeIndex + blockSize) % delayFrames;
+        }
     }
 
-    //==========================================================================
-    // Member Variables
-    //==========================================================================
+private:
+    static constexpr int kLanes = SourceLanes::kWidth;
 
-    double sampleRate;
-    FarFieldParams params;
+    static void gatherLane(float* tile, int lane, const float* source, int start, int numSamples)
+    {
+        if (source == nullptr)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                tile[i * kLanes + lane] = 0.0f;
+            return;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+            tile[i * kLanes + lane] = source[start + i];
+    }
+
+    double sampleRate = 48000.0;
+    int maxBlockSize = 1;
+    int sourceCount = 0;
+    int groupCount = 0;
+    int stride = 0;
+
+    float smoothing = 0.0f;
+    float reach_m = 0.0f;
+
+    std::vector<FarFieldParams> params;
+    std::vector<DopplerPath> paths;
+    std::vector<float> state;        // SoA: FarFieldKernel::StateField x stride
+
+    // One delay line per group of four sources
+    std::vector<float> delayLines;
+    int delayFrames = 0;
+    int writeIndex = 0;
+
+    // Block input transposed to lane-interleaved order
+    std::vector<float> tileLeft;
+    std::vector<float> tileRight;
 
-    // State variables
-    float lastLeftIn, lastRightIn;
-    float lastLeftOut, lastRightOut;
-    float dopplerPhase;
+    bool snapCoefficients = true;
 };
 
 //==============================================================================
@@ -155,17 +155,34 @@ private:
     // DSP Components
     //==========================================================================
 
-    // Early reflections based on ground surface and source height
-    void processEarlyReflections(const float* input, float* output, int numSamples);
+    static constexpr int numChannels = 2;
+    static constexpr int numDiffuseDelays = 4;
+
+    // Processing coefficients derived from the parameters; these are what
+    // glide per sample, so no transcendental work happens while smoothing
+    struct Coefficients {
+        float earlyDelay = 0.0f;        // Ground reflection delay (samples)
+        float spreadOffset = 0.0f;      // Roughness spread tap offset (samples)
+        float reflectionGain = 0.0f;
+        float tailFeedback[numDiffuseDelays] = {};
+        float tailDamping = 0.0f;       // In-loop lowpass pole
+        float airAlpha = 0.0f;
+        bool airEnabled = false;
+        float horizonDelay = 0.0f;      // Horizon echo delay (samples)
+        float echoGain = 0.0f;
+        float wet = 0.0f;
+        float dry = 0.0f;
+    };
 
-    // Diffuse tail with vegetation absorption
-    void processDiffuseTail(const float* input, float* output, int numSamples);
+    // Advance every coefficient one sample toward its target; returns false
+    // once all of them have arrived
+    bool advanceSmoothing();
 
-    // Horizon echo for large-space simulation
-    void processHorizonEcho(const float* input, float* output, int numSamples);
+    Coefficients computeCoefficients(const MonumentReverbParams& params) const;
 
-    // Air absorption EQ
-    void processAirAbsorption(float* samples, int numSamples);
+    // Run all stages over interleaved stereo frames (outputRight may be null)
+    void processFrames(const float* inputLeft, const float* inputRight,
+                       float* outputLeft, float* outputRight, int numSamples);
 
     // Ground reflection characteristics
     struct GroundCharacteristics {
@@ -183,49 +200,41 @@ private:
 
     double sampleRate_ = 44100.0;
     MonumentReverbParams currentParams_;
-    MonumentReverbParams smoothedParams_;
+    Coefficients coefficients_;
+    Coefficients targetCoefficients_;
+    bool smoothing_ = false;
+    bool primed_ = false;       // First block after prepare/reset jumps to target
+
+    // All delay lines hold interleaved left/right frames, so both channels
+    // share one index and run through the same vector operations
 
-    // Early reflection delay lines
+    // Early reflection delay line
     std::vector<float> earlyDelayLine_;
-    int earlyDelaySize_ = 0;
+    int earlyDelaySize_ = 0;    // Frames
     int earlyWriteIndex_ = 0;
 
     // Diffuse tail network
     struct DelayNetwork {
         std::vector<float> delayLine;
+        int size = 0;           // Frames
         int writeIndex = 0;
-        float feedbackGain = 0.0f;
-        float damping = 0.0f;
+        int readOffset = 0;     // Diffusion tap (frames behind the write index)
+        float loopSeconds = 0.0f;
+        float lowpass[numChannels] = {};
     };
 
-    static constexpr int numDiffuseDelays = 4;
     DelayNetwork diffuseDelays_[numDiffuseDelays];
 
     // Horizon echo
     std::vector<float> horizonDelayLine_;
-    int horizonDelaySize_ = 0;
+    int horizonDelaySize_ = 0;  // Frames
     int horizonWriteIndex_ = 0;
 
-    // Air absorption filter (simple first-order lowpass)
-    float airFilterState_ = 0.0f;
-
-    // Temporary buffers
-    std::vector<float> tempBuffer_;
-    std::vector<float> earlyBuffer_;
-    std::vector<float> diffuseBuffer_;
-    std::vector<float> horizonBuffer_;
+    // Air absorption filter (simple first-order lowpass per channel)
+    float airFilterState_[numChannels] = {};
 
     // Smoothing coefficients
     float smoothingCoefficient_ = 0.0f;
-
-    //==========================================================================
-    // Utility Functions
-    //==========================================================================
-
-    float linearInterpolate(const float* buffer, int bufferSize, float position) const;
-    void processDelayLine(std::vector<float>& delayLine, int& writeIndex,
-                         int delaySize, const float* input, float* output,
-                         int numSamples, float feedbackGain, float damping);
 };
 
 //==============================================================================
@@ -235,7 +244,6 @@ private:
 inline MonumentReverbPureDSP::MonumentReverbPureDSP() {
     // Initialize with default parameters
     currentParams_ = MonumentReverbParams();
-    smoothedParams_ = currentParams_;
 }
 
 inline MonumentReverbPureDSP::~MonumentReverbPureDSP() {
@@ -245,54 +253,47 @@ inline MonumentReverbPureDSP::~MonumentReverbPureDSP() {
 inline void MonumentReverbPureDSP::prepare(double sampleRate, int maxSamplesPerBlock) {
     sampleRate_ = sampleRate;
 
-    // Calculate smoothing coefficient (50ms smoothing time)
+    // Calculate smoothing coefficient (50ms smoothing time, applied per sample)
     float smoothingTime = 0.05f;
     smoothingCoefficient_ = 1.0f - std::exp(-1.0f / (smoothingTime * sampleRate_));
 
     // Allocate early reflection delay line (up to 100ms)
     int maxEarlyDelay = static_cast<int>(0.1f * sampleRate_);
     earlyDelaySize_ = maxEarlyDelay + maxSamplesPerBlock;
-    earlyDelayLine_.resize(earlyDelaySize_, 0.0f);
-    earlyWriteIndex_ = 0;
+    earlyDelayLine_.assign(earlyDelaySize_ * numChannels, 0.0f);
 
     // Allocate diffuse delay lines (varying lengths for diffusion)
     float baseDelay = 0.05f; // 50ms base
     for (int i = 0; i < numDiffuseDelays; ++i) {
+        auto& delayNet = diffuseDelays_[i];
         float delayTime = baseDelay * (1.0f + i * 0.25f); // 50ms, 62.5ms, 75ms, 87.5ms
-        int delaySize = static_cast<int>(delayTime * sampleRate_) + maxSamplesPerBlock;
-        diffuseDelays_[i].delayLine.resize(delaySize, 0.0f);
-        diffuseDelays_[i].writeIndex = 0;
+        delayNet.size = static_cast<int>(delayTime * sampleRate_) + maxSamplesPerBlock;
+        delayNet.delayLine.assign(delayNet.size * numChannels, 0.0f);
+        delayNet.readOffset = std::min(static_cast<int>(sampleRate_ * 0.01f * (i + 1)), delayNet.size - 1);
+        delayNet.loopSeconds = static_cast<float>(delayNet.size / sampleRate_);
     }
 
     // Allocate horizon echo delay line (up to 500ms)
     int maxHorizonDelay = static_cast<int>(0.5f * sampleRate_);
     horizonDelaySize_ = maxHorizonDelay + maxSamplesPerBlock;
-    horizonDelayLine_.resize(horizonDelaySize_, 0.0f);
-    horizonWriteIndex_ = 0;
+    horizonDelayLine_.assign(horizonDelaySize_ * numChannels, 0.0f);
 
-    // Allocate temporary buffers
-    tempBuffer_.resize(maxSamplesPerBlock, 0.0f);
-    earlyBuffer_.resize(maxSamplesPerBlock, 0.0f);
-    diffuseBuffer_.resize(maxSamplesPerBlock, 0.0f);
-    horizonBuffer_.resize(maxSamplesPerBlock, 0.0f);
+    reset();
 }
 
 inline void MonumentReverbPureDSP::reset() {
     std::fill(earlyDelayLine_.begin(), earlyDelayLine_.end(), 0.0f);
     for (int i = 0; i < numDiffuseDelays; ++i) {
-        std::fill(diffuseDelays_[i].delayLine.begin(), diffuseDelays_[i].delayLine.end(), 0.0f);
+        auto& delayNet = diffuseDelays_[i];
+        std::fill(delayNet.delayLine.begin(), delayNet.delayLine.end(), 0.0f);
+        std::fill(std::begin(delayNet.lowpass), std::end(delayNet.lowpass), 0.0f);
+        delayNet.writeIndex = 0;
     }
     std::fill(horizonDelayLine_.begin(), horizonDelayLine_.end(), 0.0f);
-    airFilterState_ = 0.0f;
+    std::fill(std::begin(airFilterState_), std::end(airFilterState_), 0.0f);
     earlyWriteIndex_ = 0;
     horizonWriteIndex_ = 0;
-}
-
-inline float MonumentReverbPureDSP::linearInterpolate(const float* buffer, int bufferSize, float position) const {
-    int index1 = static_cast<int>(position);
-    int index2 = (index1 + 1) % bufferSize;
-    float frac = position - index1;
-    return buffer[index1] * (1.0f - frac) + buffer[index2] * frac;
+    primed_ = false;
 }
 
 } // namespace monument
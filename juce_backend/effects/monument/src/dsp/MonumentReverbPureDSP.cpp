@@ -9,6 +9,12 @@
 #include "MonumentReverbPureDSP.h"
 #include <cstring>
 
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+#elif defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+#endif
+
 namespace schill {
 namespace monument {
 
@@ -89,140 +95,232 @@ inline float smoothParameter(float current, float target, float coeff) {
     return current + coeff * (target - current);
 }
 
-//==============================================================================
-// Processing Functions
-//==============================================================================
+inline bool smoothTowards(float& current, float target, float coeff) {
+    current = smoothParameter(current, target, coeff);
+    if (std::abs(target - current) <= 1.0e-5f * (1.0f + std::abs(target))) {
+        current = target;
+        return false;
+    }
+    return true;
+}
 
-void MonumentReverbPureDSP::processEarlyReflections(
-    const float* input, float* output, int numSamples) {
+bool MonumentReverbPureDSP::advanceSmoothing() {
+    auto& c = coefficients_;
+    const auto& t = targetCoefficients_;
+    const float k = smoothingCoefficient_;
 
-    // Get ground characteristics
-    auto ground = getGroundCharacteristics(static_cast<SurfaceType>(currentParams_.surface));
+    bool moving = false;
+    moving |= smoothTowards(c.earlyDelay, t.earlyDelay, k);
+    moving |= smoothTowards(c.spreadOffset, t.spreadOffset, k);
+    moving |= smoothTowards(c.reflectionGain, t.reflectionGain, k);
+    for (int i = 0; i < numDiffuseDelays; ++i) {
+        moving |= smoothTowards(c.tailFeedback[i], t.tailFeedback[i], k);
+    }
+    moving |= smoothTowards(c.tailDamping, t.tailDamping, k);
+    moving |= smoothTowards(c.airAlpha, t.airAlpha, k);
+    moving |= smoothTowards(c.horizonDelay, t.horizonDelay, k);
+    moving |= smoothTowards(c.echoGain, t.echoGain, k);
+    moving |= smoothTowards(c.wet, t.wet, k);
+    moving |= smoothTowards(c.dry, t.dry, k);
+    return moving;
+}
 
-    // Calculate delay based on source height (higher = longer delay)
-    float heightDelay = currentParams_.height * 0.001f; // 1ms per meter
-    int delaySamples = static_cast<int>(heightDelay * sampleRate_);
+MonumentReverbPureDSP::Coefficients
+MonumentReverbPureDSP::computeCoefficients(const MonumentReverbParams& params) const {
+    Coefficients c;
 
-    // Combine with roughness for spread
-    float spread = ground.roughnessFactor * currentParams_.roughness;
-    float reflectionGain = ground.reflectivity * currentParams_.hardness;
+    // Early reflections: delay from source height (1ms per meter), spread from roughness
+    auto ground = getGroundCharacteristics(static_cast<SurfaceType>(params.surface));
+    c.earlyDelay = std::min(static_cast<float>(params.height * 0.001f * sampleRate_),
+                            static_cast<float>(earlyDelaySize_ - 1));
+    c.spreadOffset = ground.roughnessFactor * params.roughness * 10.0f;
+    c.reflectionGain = ground.reflectivity * params.hardness;
 
-    for (int i = 0; i < numSamples; ++i) {
-        // Write input to delay line
-        earlyDelayLine_[earlyWriteIndex_] = input[i];
+    // Diffuse tail: each loop loses exp(-loop / decay), vegetation absorbs more
+    float vegetationAbsorption = params.density * 0.5f;
+    float decay = std::max(params.tailDecay * params.scale, 1.0e-3f);
+    for (int i = 0; i < numDiffuseDelays; ++i) {
+        c.tailFeedback[i] = std::exp(-diffuseDelays_[i].loopSeconds / decay) * (1.0f - vegetationAbsorption);
+    }
 
-        // Read with delay
-        int readIndex = (earlyWriteIndex_ - delaySamples + earlyDelaySize_) % earlyDelaySize_;
-        float delayed = earlyDelayLine_[readIndex];
+    // Ground wetness affects damping
+    c.tailDamping = 0.3f + params.groundWetness * 0.4f;
 
-        // Add spread using interpolation
-        float readPos = readIndex + spread * 10.0f;
-        if (readPos >= earlyDelaySize_) readPos -= earlyDelaySize_;
-        float spreadSample = linearInterpolate(earlyDelayLine_.data(), earlyDelaySize_, readPos);
+    // Air absorption: first-order lowpass, 1kHz to 10kHz
+    float cutoff = 1000.0f + params.air * 9000.0f;
+    float rc = 1.0f / (2.0f * 3.14159f * cutoff);
+    float dt = 1.0f / sampleRate_;
+    c.airAlpha = dt / (rc + dt);
+    c.airEnabled = params.air > 0.01f;
 
-        // Combine direct and reflected
-        output[i] = input[i] * (1.0f - reflectionGain) + spreadSample * reflectionGain;
+    // Horizon echo: delay and gain from distance (simulated by scale)
+    c.horizonDelay = std::min(static_cast<float>(params.horizonDelay * params.scale * sampleRate_),
+                              static_cast<float>(horizonDelaySize_ - 1));
+    c.echoGain = 0.3f * (2.0f - params.scale);
 
-        // Advance write index
-        earlyWriteIndex_ = (earlyWriteIndex_ + 1) % earlyDelaySize_;
-    }
+    c.wet = params.wet;
+    c.dry = params.dry;
+    return c;
 }
 
-void MonumentReverbPureDSP::processDiffuseTail(
-    const float* input, float* output, int numSamples) {
+//==============================================================================
+// Stereo Frame Operations
+//==============================================================================
 
-    // Vegetation affects absorption and diffusion
-    float vegetationAbsorption = currentParams_.density * 0.5f;
-    float vegetationDiffusion = currentParams_.density * 0.3f;
+namespace {
+
+// Left/right pair as one vector; delay lines store interleaved frames
+#if defined(__ARM_NEON) || defined(__aarch64__)
+
+struct StereoLanes {
+    using Vec = float32x2_t;
+
+    static Vec load(const float* p) { return vld1_f32(p); }
+    static void store(float* p, Vec v) { vst1_f32(p, v); }
+    static Vec make(float left, float right) { return vset_lane_f32(right, vdup_n_f32(left), 1); }
+    static Vec broadcast(float x) { return vdup_n_f32(x); }
+    static Vec add(Vec a, Vec b) { return vadd_f32(a, b); }
+    static Vec sub(Vec a, Vec b) { return vsub_f32(a, b); }
+    static Vec mul(Vec a, Vec b) { return vmul_f32(a, b); }
+    static float left(Vec v) { return vget_lane_f32(v, 0); }
+    static float right(Vec v) { return vget_lane_f32(v, 1); }
+};
+
+#elif defined(__SSE__) || defined(_M_X64)
+
+struct StereoLanes {
+    using Vec = __m128;  // Upper two lanes unused
+
+    static Vec load(const float* p) { return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p)); }
+    static void store(float* p, Vec v) { _mm_storel_pi(reinterpret_cast<__m64*>(p), v); }
+    static Vec make(float left, float right) { return _mm_setr_ps(left, right, 0.0f, 0.0f); }
+    static Vec broadcast(float x) { return _mm_set1_ps(x); }
+    static Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+    static Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    static float left(Vec v) { return _mm_cvtss_f32(v); }
+    static float right(Vec v) { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+};
+
+#else
+
+struct StereoLanes {
+    struct Vec { float l, r; };
+
+    static Vec load(const float* p) { return { p[0], p[1] }; }
+    static void store(float* p, Vec v) { p[0] = v.l; p[1] = v.r; }
+    static Vec make(float left, float right) { return { left, right }; }
+    static Vec broadcast(float x) { return { x, x }; }
+    static Vec add(Vec a, Vec b) { return { a.l + b.l, a.r + b.r }; }
+    static Vec sub(Vec a, Vec b) { return { a.l - b.l, a.r - b.r }; }
+    static Vec mul(Vec a, Vec b) { return { a.l * b.l, a.r * b.r }; }
+    static float left(Vec v) { return v.l; }
+    static float right(Vec v) { return v.r; }
+};
+
+#endif
+
+} // namespace
 
-    // Tail decay based on ground wetness and vegetation
-    float decay = currentParams_.tailDecay * currentParams_.scale;
-    float feedback = std::exp(-1.0f / (decay * sampleRate_));
-    feedback *= (1.0f - vegetationAbsorption);
+//==============================================================================
+// Processing Functions
+//==============================================================================
 
-    // Ground wetness affects damping
-    float damping = 0.3f + currentParams_.groundWetness * 0.4f;
+void MonumentReverbPureDSP::processFrames(
+    const float* inputLeft, const float* inputRight,
+    float* outputLeft, float* outputRight, int numSamples) {
 
-    // Process through delay network
-    std::fill(output, output + numSamples, 0.0f);
+    using L = StereoLanes;
 
-    for (int i = 0; i < numDiffuseDelays; ++i) {
-        auto& delayNet = diffuseDelays_[i];
+    const bool tailEnabled = currentParams_.tailEnabled > 0.5f;
+    const bool horizonEnabled = currentParams_.horizonEnabled > 0.5f;
+    const L::Vec diffuseScale = L::broadcast(1.0f / numDiffuseDelays);
 
-        // Vary feedback slightly for each delay
-        float delayFeedback = feedback * (1.0f + i * 0.05f);
+    float* early = earlyDelayLine_.data();
+    float* horizon = horizonDelayLine_.data();
+    L::Vec airState = L::load(airFilterState_);
 
-        for (int j = 0; j < numSamples; ++j) {
-            // Write input + feedback
-            float inputSample = input[j];
-            float delayed = delayNet.delayLine[delayNet.writeIndex];
-            float feedbackSample = delayed * delayFeedback;
+    for (int i = 0; i < numSamples; ++i) {
+        if (smoothing_)
+            smoothing_ = advanceSmoothing();
+        const Coefficients& c = coefficients_;
 
-            // Apply damping
-            float dampState = delayNet.delayLine[delayNet.writeIndex];
-            dampState = dampState * damping + inputSample * (1.0f - damping);
-            delayNet.delayLine[delayNet.writeIndex] = dampState + feedbackSample;
+        const L::Vec input = L::make(inputLeft[i], inputRight[i]);
+        L::Vec wet = L::broadcast(0.0f);
 
-            // Read with offset for diffusion
-            int readIndex = (delayNet.writeIndex -
-                static_cast<int>(sampleRate_ * 0.01f * (i + 1)) +
-                static_cast<int>(delayNet.delayLine.size())) %
-                static_cast<int>(delayNet.delayLine.size());
+        if (tailEnabled) {
+            // Early reflections: write input, read the roughness-spread tap
+            L::store(early + 2 * earlyWriteIndex_, input);
 
-            float outSample = delayNet.delayLine[readIndex];
+            int readIndex = earlyWriteIndex_ - static_cast<int>(c.earlyDelay);
+            if (readIndex < 0) readIndex += earlyDelaySize_;
 
-            // Add to output
-            output[j] += outSample / numDiffuseDelays;
+            float readPos = readIndex + c.spreadOffset;
+            if (readPos >= earlyDelaySize_) readPos -= earlyDelaySize_;
 
-            // Advance write index
-            delayNet.writeIndex = (delayNet.writeIndex + 1) %
-                static_cast<int>(delayNet.delayLine.size());
-        }
-    }
-}
+            const int index1 = static_cast<int>(readPos);
+            const int index2 = (index1 + 1 == earlyDelaySize_) ? 0 : index1 + 1;
+            const float frac = readPos - index1;
 
-void MonumentReverbPureDSP::processHorizonEcho(
-    const float* input, float* output, int numSamples) {
+            const L::Vec spread = L::add(L::mul(L::load(early + 2 * index1), L::broadcast(1.0f - frac)),
+                                         L::mul(L::load(early + 2 * index2), L::broadcast(frac)));
+            const L::Vec reflected = L::add(L::mul(input, L::broadcast(1.0f - c.reflectionGain)),
+                                            L::mul(spread, L::broadcast(c.reflectionGain)));
 
-    if (currentParams_.horizonEnabled < 0.5f) {
-        std::copy(input, input + numSamples, output);
-        return;
-    }
+            if (++earlyWriteIndex_ == earlyDelaySize_) earlyWriteIndex_ = 0;
 
-    // Calculate delay time
-    float delayTime = currentParams_.horizonDelay * currentParams_.scale;
-    int delaySamples = static_cast<int>(delayTime * sampleRate_);
+            // Diffuse tail: damped feedback loops, averaged
+            const L::Vec pole = L::broadcast(c.tailDamping);
+            const L::Vec inputGain = L::mul(reflected, L::broadcast(1.0f - c.tailDamping));
+            L::Vec tail = L::broadcast(0.0f);
 
-    // Echo gain based on distance (simulated by scale)
-    float echoGain = 0.3f * (2.0f - currentParams_.scale);
+            for (int d = 0; d < numDiffuseDelays; ++d) {
+                auto& delayNet = diffuseDelays_[d];
+                float* line = delayNet.delayLine.data();
 
-    for (int i = 0; i < numSamples; ++i) {
-        // Write input to delay line
-        horizonDelayLine_[horizonWriteIndex_] = input[i];
+                const L::Vec delayed = L::load(line + 2 * delayNet.writeIndex);
+                L::Vec lowpass = L::load(delayNet.lowpass);
+                lowpass = L::add(delayed, L::mul(pole, L::sub(lowpass, delayed)));
+                L::store(delayNet.lowpass, lowpass);
 
-        // Read delayed sample
-        int readIndex = (horizonWriteIndex_ - delaySamples + horizonDelaySize_) % horizonDelaySize_;
-        float delayed = horizonDelayLine_[readIndex];
+                L::store(line + 2 * delayNet.writeIndex,
+                         L::add(inputGain, L::mul(lowpass, L::broadcast(c.tailFeedback[d]))));
 
-        // Mix input and echo
-        output[i] = input[i] + delayed * echoGain;
+                int tapIndex = delayNet.writeIndex - delayNet.readOffset;
+                if (tapIndex < 0) tapIndex += delayNet.size;
+                tail = L::add(tail, L::load(line + 2 * tapIndex));
 
-        // Advance write index
-        horizonWriteIndex_ = (horizonWriteIndex_ + 1) % horizonDelaySize_;
-    }
-}
+                if (++delayNet.writeIndex == delayNet.size) delayNet.writeIndex = 0;
+            }
 
-void MonumentReverbPureDSP::processAirAbsorption(float* samples, int numSamples) {
-    // Simple first-order lowpass to simulate air absorption
-    float cutoff = 1000.0f + currentParams_.air * 9000.0f; // 1kHz to 10kHz
-    float rc = 1.0f / (2.0f * 3.14159f * cutoff);
-    float dt = 1.0f / sampleRate_;
-    float alpha = dt / (rc + dt);
+            wet = L::mul(tail, diffuseScale);
 
-    for (int i = 0; i < numSamples; ++i) {
-        airFilterState_ = airFilterState_ + alpha * (samples[i] - airFilterState_);
-        samples[i] = airFilterState_;
+            // Air absorption
+            if (c.airEnabled) {
+                airState = L::add(airState, L::mul(L::broadcast(c.airAlpha), L::sub(wet, airState)));
+                wet = airState;
+            }
+        }
+
+        // Horizon echo
+        if (horizonEnabled) {
+            L::store(horizon + 2 * horizonWriteIndex_, wet);
+
+            int readIndex = horizonWriteIndex_ - static_cast<int>(c.horizonDelay);
+            if (readIndex < 0) readIndex += horizonDelaySize_;
+            wet = L::add(wet, L::mul(L::load(horizon + 2 * readIndex), L::broadcast(c.echoGain)));
+
+            if (++horizonWriteIndex_ == horizonDelaySize_) horizonWriteIndex_ = 0;
+        }
+
+        // Mix wet and dry
+        const L::Vec output = L::add(L::mul(input, L::broadcast(c.dry)), L::mul(wet, L::broadcast(c.wet)));
+        outputLeft[i] = L::left(output);
+        if (outputRight != nullptr)
+            outputRight[i] = L::right(output);
     }
+
+    L::store(airFilterState_, airState);
 }
 
 //==============================================================================
@@ -237,63 +335,28 @@ void MonumentReverbPureDSP::processBlock(
     int numSamples,
     const MonumentReverbParams& params) {
 
-    // Smooth parameters
-    smoothedParams_.wet = smoothParameter(smoothedParams_.wet, params.wet, smoothingCoefficient_);
-    smoothedParams_.dry = smoothParameter(smoothedParams_.dry, params.dry, smoothingCoefficient_);
-    smoothedParams_.scale = smoothParameter(smoothedParams_.scale, params.scale, smoothingCoefficient_);
-    smoothedParams_.air = smoothParameter(smoothedParams_.air, params.air, smoothingCoefficient_);
-    smoothedParams_.hardness = smoothParameter(smoothedParams_.hardness, params.hardness, smoothingCoefficient_);
-    smoothedParams_.roughness = smoothParameter(smoothedParams_.roughness, params.roughness, smoothingCoefficient_);
-    smoothedParams_.groundWetness = smoothParameter(smoothedParams_.groundWetness, params.groundWetness, smoothingCoefficient_);
-    smoothedParams_.height = smoothParameter(smoothedParams_.height, params.height, smoothingCoefficient_);
-    smoothedParams_.density = smoothParameter(smoothedParams_.density, params.density, smoothingCoefficient_);
-    smoothedParams_.jitter = smoothParameter(smoothedParams_.jitter, params.jitter, smoothingCoefficient_);
-    smoothedParams_.horizonDelay = smoothParameter(smoothedParams_.horizonDelay, params.horizonDelay, smoothingCoefficient_);
-    smoothedParams_.tailDecay = smoothParameter(smoothedParams_.tailDecay, params.tailDecay, smoothingCoefficient_);
-
-    // Update integer parameters
-    smoothedParams_.surface = params.surface;
-    smoothedParams_.horizonEnabled = params.horizonEnabled;
-    smoothedParams_.tailEnabled = params.tailEnabled;
-
-    currentParams_ = smoothedParams_;
-
-    // Process stereo (use left channel for mono processing)
-    int numChannelsToProcess = std::min(numInputChannels, 2);
-    int outputChannelsToProcess = std::min(numOutputChannels, 2);
-
-    for (int ch = 0; ch < outputChannelsToProcess; ++ch) {
-        const float* input = (ch < numInputChannels) ? inputChannels[ch] : inputChannels[0];
-        float* output = outputChannels[ch];
-
-        // Copy dry signal
-        std::copy(input, input + numSamples, tempBuffer_.data());
-
-        // Process through reverb stages
-        if (currentParams_.tailEnabled > 0.5f) {
-            processEarlyReflections(tempBuffer_.data(), earlyBuffer_.data(), numSamples);
-            processDiffuseTail(earlyBuffer_.data(), diffuseBuffer_.data(), numSamples);
-
-            // Apply air absorption
-            if (currentParams_.air > 0.01f) {
-                processAirAbsorption(diffuseBuffer_.data(), numSamples);
-            }
-        } else {
-            std::fill(diffuseBuffer_.begin(), diffuseBuffer_.begin() + numSamples, 0.0f);
-        }
-
-        // Process horizon echo
-        if (currentParams_.horizonEnabled > 0.5f) {
-            processHorizonEcho(diffuseBuffer_.data(), horizonBuffer_.data(), numSamples);
-        } else {
-            std::copy(diffuseBuffer_.data(), diffuseBuffer_.data() + numSamples, horizonBuffer_.data());
-        }
+    if (numInputChannels <= 0 || numOutputChannels <= 0 || numSamples <= 0)
+        return;
 
-        // Mix wet and dry
-        for (int i = 0; i < numSamples; ++i) {
-            output[i] = input[i] * currentParams_.dry + horizonBuffer_[i] * currentParams_.wet;
-        }
+    // Switches apply per block; everything else glides per sample
+    if (!primed_) {
+        currentParams_ = params;
+        coefficients_ = targetCoefficients_ = computeCoefficients(params);
+        smoothing_ = false;
+        primed_ = true;
+    } else if (std::memcmp(&params, &currentParams_, sizeof(MonumentReverbParams)) != 0) {
+        currentParams_ = params;
+        targetCoefficients_ = computeCoefficients(params);
+        coefficients_.airEnabled = targetCoefficients_.airEnabled;
+        smoothing_ = true;
     }
+
+    // Mono input feeds both channels; only the first two outputs are written
+    const float* inputLeft = inputChannels[0];
+    const float* inputRight = (numInputChannels > 1) ? inputChannels[1] : inputChannels[0];
+    float* outputRight = (numOutputChannels > 1) ? outputChannels[1] : nullptr;
+
+    processFrames(inputLeft, inputRight, outputChannels[0], outputRight, numSamples);
 }
 
 void MonumentReverbPureDSP::setParameters(const MonumentReverbParams& params) {
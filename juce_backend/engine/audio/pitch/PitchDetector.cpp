@@ -36,6 +36,9 @@ bool PitchDetector::initialize(double newSampleRate, int newBufferSize) {
     // Allocate buffers
     differenceBuffer.realloc(maxLag);
     windowBuffer.realloc(bufferSize);
+    autocorrBuffer.realloc(maxLag);
+    analysisCapacity = 0;
+    ensureAnalysisCapacity(bufferSize);
 
     // IMPROVED: Use Blackman-Harris window for better low-frequency resolution
     for (int i = 0; i < bufferSize; ++i) {
@@ -65,8 +68,7 @@ void PitchDetector::processBlock(juce::AudioBuffer<float>& buffer) {
     const int numSamples = buffer.getNumSamples();
 
     // Create mono buffer for analysis
-    juce::HeapBlock<float> monoBuffer;
-    monoBuffer.realloc(numSamples);
+    ensureAnalysisCapacity(numSamples);
 
     if (numChannels == 1) {
         juce::FloatVectorOperations::copy(monoBuffer, buffer.getReadPointer(0), numSamples);
@@ -148,21 +150,50 @@ void PitchDetector::processBlock(juce::AudioBuffer<float>& buffer) {
     lastProcessingTime = static_cast<double>(duration.count()) / 1000.0;
 }
 
-// IMPROVED: Enhanced autocorrelation with better peak detection
-std::pair<double, double> PitchDetector::enhancedAutocorrelation(const float* buffer, int bufferSize) const {
-    juce::HeapBlock<double> autocorr;
-    autocorr.realloc(maxLag);
+void PitchDetector::ensureAnalysisCapacity(int numSamples) {
+    if (numSamples <= analysisCapacity) {
+        return;
+    }
 
-    // Calculate autocorrelation
-    for (int lag = 0; lag < maxLag; ++lag) {
-        double sum = 0.0;
-        const int maxIndex = bufferSize - lag;
+    monoBuffer.realloc(numSamples);
 
-        for (int i = 0; i < maxIndex; ++i) {
-            sum += static_cast<double>(buffer[i]) * static_cast<double>(buffer[i + lag]);
-        }
+    int order = 1;
+    while ((1 << order) < numSamples + maxLag) {
+        ++order;
+    }
 
-        autocorr[lag] = sum;
+    autocorrelationFft = std::make_unique<juce::dsp::FFT>(order);
+    fftBuffer.realloc(2 * (1 << order));
+    analysisCapacity = numSamples;
+}
+
+// Enhanced autocorrelation with better peak detection.
+// r(lag) is computed as IFFT(|FFT(x)|^2) over a zero-padded transform of at
+// least bufferSize + maxLag points: O(N log N) instead of O(N * maxLag).
+std::pair<double, double> PitchDetector::enhancedAutocorrelation(const float* buffer, int bufferSize) {
+    const int fftSize = autocorrelationFft->getSize();
+
+    juce::FloatVectorOperations::copy(fftBuffer, buffer, bufferSize);
+    juce::FloatVectorOperations::clear(fftBuffer + bufferSize, 2 * fftSize - bufferSize);
+
+    autocorrelationFft->performRealOnlyForwardTransform(fftBuffer);
+
+    for (int k = 0; k < fftSize; ++k) {
+        const float re = fftBuffer[2 * k];
+        const float im = fftBuffer[2 * k + 1];
+        fftBuffer[2 * k] = re * re + im * im;
+        fftBuffer[2 * k + 1] = 0.0f;
+    }
+
+    autocorrelationFft->performRealOnlyInverseTransform(fftBuffer);
+
+    double* autocorr = autocorrBuffer;
+    const int numLags = std::min(maxLag, bufferSize);
+    for (int lag = 0; lag < numLags; ++lag) {
+        autocorr[lag] = static_cast<double>(fftBuffer[lag]);
+    }
+    for (int lag = numLags; lag < maxLag; ++lag) {
+        autocorr[lag] = 0.0;
     }
 
     // Normalize and enhance peak detection
@@ -276,10 +307,9 @@ std::pair<double, double> PitchDetector::zeroCrossingPitchDetection(const float*
 }
 
 // IMPROVED: AMDF (Average Magnitude Difference Function) for low frequencies
-std::pair<double, double> PitchDetector::amdfPitchDetection(const float* buffer, int bufferSize) const {
+std::pair<double, double> PitchDetector::amdfPitchDetection(const float* buffer, int bufferSize) {
     int maxLagAMDF = std::min(maxLag, bufferSize / 2);
-    juce::HeapBlock<double> amdf;
-    amdf.realloc(maxLagAMDF);
+    double* amdf = differenceBuffer;
 
     // Calculate AMDF
     for (int lag = 0; lag < maxLagAMDF; ++lag) {
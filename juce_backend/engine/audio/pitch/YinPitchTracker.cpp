@@ -0,0 +1,220 @@
+// YinPitchTracker - streaming FFT-based YIN for real-time pitch tracking
+
+#include "../../../include/audio/YinPitchTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+bool YinPitchTracker::prepare(double newSampleRate, int numChannels, const Config& newConfig) {
+    if (newSampleRate <= 0.0 || numChannels <= 0 || newConfig.minFrequency <= 0.0 ||
+        newConfig.maxFrequency <= newConfig.minFrequency || newConfig.hopSize <= 0) {
+        return false;
+    }
+
+    sampleRate = newSampleRate;
+    config = newConfig;
+
+    minLag = std::max(2, static_cast<int>(std::floor(sampleRate / config.maxFrequency)));
+    maxLag = static_cast<int>(std::ceil(sampleRate / config.minFrequency)) + 1;
+
+    // Window must hold the integration window (W) plus the longest lag
+    int order = 1;
+    while ((1 << order) < std::max(config.windowSize, 2 * maxLag + 2))
+        ++order;
+
+    windowSize = 1 << order;
+    integrationSize = windowSize / 2;
+    maxLag = std::min(maxLag, integrationSize - 2);
+
+    fft = std::make_unique<juce::dsp::FFT>(order);
+    frameBuffer.assign(static_cast<size_t>(windowSize), 0.0f);
+    fftWindow.assign(static_cast<size_t>(windowSize) * 2, 0.0f);
+    fftHead.assign(static_cast<size_t>(windowSize) * 2, 0.0f);
+    difference.assign(static_cast<size_t>(integrationSize), 0.0f);
+
+    channels.assign(static_cast<size_t>(numChannels), ChannelState{});
+    for (auto& state : channels) {
+        state.history.assign(static_cast<size_t>(windowSize), 0.0f);
+        state.stats.latencyMs = 1000.0 * getLatencySamples() / sampleRate;
+    }
+
+    prepared = true;
+    return true;
+}
+
+void YinPitchTracker::reset() {
+    for (auto& state : channels) {
+        std::fill(state.history.begin(), state.history.end(), 0.0f);
+        state.writeIndex = 0;
+        state.samplesSinceAnalysis = 0;
+        state.samplesSeen = 0;
+        state.latest = PitchTrackerFrame{};
+        state.stats.lastFrameMicros = 0.0;
+        state.stats.cpuLoad = 0.0;
+        state.stats.framesAnalysed = 0;
+    }
+}
+
+void YinPitchTracker::processBlock(const juce::AudioBuffer<float>& buffer) {
+    const int numChannels = std::min(buffer.getNumChannels(), getNumChannels());
+    for (int ch = 0; ch < numChannels; ++ch) {
+        process(ch, buffer.getReadPointer(ch), buffer.getNumSamples());
+    }
+}
+
+void YinPitchTracker::process(int channel, const float* samples, int numSamples) {
+    if (!prepared || channel < 0 || channel >= getNumChannels() || samples == nullptr)
+        return;
+
+    auto& state = channels[static_cast<size_t>(channel)];
+    int consumed = 0;
+
+    while (consumed < numSamples) {
+        // Copy up to the next hop boundary (and ring wrap) in one go
+        const int untilHop = config.hopSize - state.samplesSinceAnalysis;
+        const int untilWrap = windowSize - state.writeIndex;
+        const int count = std::min({ numSamples - consumed, untilHop, untilWrap });
+
+        std::copy(samples + consumed, samples + consumed + count,
+                  state.history.begin() + state.writeIndex);
+
+        consumed += count;
+        state.writeIndex = (state.writeIndex + count) & (windowSize - 1);
+        state.samplesSinceAnalysis += count;
+        state.samplesSeen += count;
+
+        if (state.samplesSinceAnalysis == config.hopSize) {
+            state.samplesSinceAnalysis = 0;
+            if (state.samplesSeen >= windowSize)
+                analyse(state);
+        }
+    }
+}
+
+void YinPitchTracker::analyse(ChannelState& state) {
+    const auto start = std::chrono::steady_clock::now();
+
+    // Linearise the ring, oldest sample first
+    const auto split = state.history.begin() + state.writeIndex;
+    std::copy(split, state.history.end(), frameBuffer.begin());
+    std::copy(state.history.begin(), split,
+              frameBuffer.begin() + (state.history.end() - split));
+
+    double confidence = 0.0;
+    const double period = estimatePeriod(frameBuffer.data(), confidence);
+
+    PitchTrackerFrame frame;
+    frame.samplePosition = state.samplesSeen;
+
+    if (period > 0.0) {
+        frame.frequency = sampleRate / period;
+        frame.confidence = confidence;
+        frame.isPitched = true;
+
+        const double midi = 69.0 + 12.0 * std::log2(frame.frequency / 440.0);
+        frame.midiNote = static_cast<int>(std::lround(midi));
+        frame.centsError = 100.0 * (midi - frame.midiNote);
+    }
+
+    state.latest = frame;
+
+    const double micros = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+    const double hopMicros = 1.0e6 * config.hopSize / sampleRate;
+
+    state.stats.lastFrameMicros = micros;
+    state.stats.cpuLoad = state.stats.framesAnalysed == 0
+        ? micros / hopMicros
+        : 0.9 * state.stats.cpuLoad + 0.1 * (micros / hopMicros);
+    ++state.stats.framesAnalysed;
+}
+
+double YinPitchTracker::estimatePeriod(const float* frame, double& confidence) {
+    const int N = windowSize;
+    const int W = integrationSize;
+
+    // r(tau) = sum_{j<W} x[j] x[j+tau] via FFT: conj(FFT(head)) * FFT(frame)
+    std::copy(frame, frame + N, fftWindow.begin());
+    std::fill(fftWindow.begin() + N, fftWindow.end(), 0.0f);
+    std::copy(frame, frame + W, fftHead.begin());
+    std::fill(fftHead.begin() + W, fftHead.end(), 0.0f);
+
+    fft->performRealOnlyForwardTransform(fftWindow.data());
+    fft->performRealOnlyForwardTransform(fftHead.data());
+
+    for (int k = 0; k < N; ++k) {
+        const float ar = fftHead[2 * k], ai = fftHead[2 * k + 1];
+        const float br = fftWindow[2 * k], bi = fftWindow[2 * k + 1];
+        fftWindow[2 * k] = ar * br + ai * bi;
+        fftWindow[2 * k + 1] = ar * bi - ai * br;
+    }
+
+    fft->performRealOnlyInverseTransform(fftWindow.data());
+    const float* r = fftWindow.data();
+
+    // d(tau) = E(0) + E(tau) - 2 r(tau), with E(tau) the energy of x[tau, tau+W)
+    double headEnergy = 0.0;
+    for (int j = 0; j < W; ++j)
+        headEnergy += static_cast<double>(frame[j]) * frame[j];
+
+    if (headEnergy < 1.0e-10) {
+        confidence = 0.0;
+        return 0.0;
+    }
+
+    double lagEnergy = headEnergy;
+    double runningSum = 0.0;
+    difference[0] = 1.0f;
+
+    for (int tau = 1; tau <= maxLag; ++tau) {
+        lagEnergy += static_cast<double>(frame[tau + W - 1]) * frame[tau + W - 1]
+                   - static_cast<double>(frame[tau - 1]) * frame[tau - 1];
+
+        const double d = std::max(0.0, headEnergy + lagEnergy - 2.0 * r[tau]);
+        runningSum += d;
+
+        // Cumulative mean normalised difference
+        difference[tau] = runningSum > 0.0 ? static_cast<float>(d * tau / runningSum) : 1.0f;
+    }
+
+    // Absolute threshold: first dip below threshold, walked to its local minimum
+    int bestTau = -1;
+    for (int tau = minLag; tau <= maxLag; ++tau) {
+        if (difference[tau] < config.threshold) {
+            while (tau + 1 <= maxLag && difference[tau + 1] < difference[tau])
+                ++tau;
+            bestTau = tau;
+            break;
+        }
+    }
+
+    if (bestTau < 0) {
+        confidence = 0.0;
+        return 0.0;
+    }
+
+    double refined = static_cast<double>(bestTau);
+    if (bestTau > minLag && bestTau < maxLag) {
+        const double y1 = difference[bestTau - 1];
+        const double y2 = difference[bestTau];
+        const double y3 = difference[bestTau + 1];
+        const double denom = y1 - 2.0 * y2 + y3;
+        if (std::abs(denom) > 1.0e-12)
+            refined += 0.5 * (y1 - y3) / denom;
+    }
+
+    confidence = std::clamp(1.0 - static_cast<double>(difference[bestTau]), 0.0, 1.0);
+    return refined;
+}
+
+PitchTrackerFrame YinPitchTracker::getLatestFrame(int channel) const {
+    if (channel < 0 || channel >= getNumChannels())
+        return {};
+    return channels[static_cast<size_t>(channel)].latest;
+}
+
+PitchTrackerChannelStats YinPitchTracker::getChannelStats(int channel) const {
+    if (channel < 0 || channel >= getNumChannels())
+        return {};
+    return channels[static_cast<size_t>(channel)].stats;
+}
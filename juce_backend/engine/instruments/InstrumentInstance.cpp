@@ -3,6 +3,7 @@
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 
 namespace SchillingerEcosystem::Instrument {
 
@@ -99,17 +100,37 @@ void InstrumentInstance::controlChange(int controller, float value, int channel)
 
 void InstrumentInstance::setParameterSmooth(const juce::String& address, float targetValue, double timeMs)
 {
-    std::lock_guard<std::mutex> lock(smoothingMutex);
+    const int parameterIndex = resolveParameterIndex(address);
 
-    auto& target = smoothingTargets[address];
-    target.address = address;
-    target.targetValue = targetValue;
-    target.smoothingTime = timeMs;
-    target.currentTime = 0.0;
-    target.isActive = true;
+    // Instruments without indexed parameters, or a full ramp queue, jump straight to the target
+    if (parameterIndex < 0 || !postParameterRamp(parameterIndex, targetValue, timeMs))
+        setParameterValue(address, targetValue);
+}
+
+bool InstrumentInstance::postParameterRamp(int parameterIndex, float targetValue, double timeMs)
+{
+    if (parameterIndex < 0)
+        return false;
+
+    const juce::SpinLock::ScopedLockType producerLock(rampProducerLock);
+
+    int start1, size1, start2, size2;
+    rampQueue.prepareToWrite(1, start1, size1, start2, size2);
 
-    // Get current value as starting point
-    target.currentValue = getParameterValue(address);
+    if (size1 == 0)
+    {
+        droppedRampCount.fetch_add(1);
+        return false;
+    }
+
+    rampCommands[(size_t) start1] = { parameterIndex, targetValue, timeMs };
+    rampQueue.finishedWrite(1);
+    return true;
+}
+
+void InstrumentInstance::setParameterRampResolution(int samplesPerStep)
+{
+    rampResolution.store(juce::jmax(1, samplesPerStep));
 }
 
 std::unordered_map<juce::String, float> InstrumentInstance::getAllParameterValues() const
@@ -191,40 +212,131 @@ bool InstrumentInstance::validateState() const
 // PROTECTED IMPLEMENTATION
 //==============================================================================
 
-void InstrumentInstance::updateParameterSmoothing(double deltaTime)
+void InstrumentInstance::prepareParameterRamps(double sampleRate)
+{
+    if (sampleRate > 0.0)
+        rampSampleRate = sampleRate;
+}
+
+void InstrumentInstance::adoptPendingParameterRamps()
 {
-    std::lock_guard<std::mutex> lock(smoothingMutex);
+    int start1, size1, start2, size2;
+    rampQueue.prepareToRead(rampQueue.getNumReady(), start1, size1, start2, size2);
 
-    for (auto& [address, target] : smoothingTargets)
+    const int numCommands = size1 + size2;
+    for (int i = 0; i < numCommands; ++i)
     {
-        if (!target.isActive)
-            continue;
+        const auto& command = rampCommands[(size_t) (i < size1 ? start1 + i : start2 + i - size1)];
 
-        target.currentTime += deltaTime;
+        // A new ramp on a parameter that is already moving continues from where it is
+        ParameterRamp* ramp = nullptr;
+        float startValue = 0.0f;
+        for (int r = 0; r < numActiveRamps; ++r)
+        {
+            if (activeRamps[(size_t) r].parameterIndex == command.parameterIndex)
+            {
+                ramp = &activeRamps[(size_t) r];
+                startValue = ramp->getValueAt(ramp->elapsedSamples);
+                break;
+            }
+        }
 
-        if (target.currentTime >= target.smoothingTime)
+        if (ramp == nullptr)
         {
-            // Smoothing complete
-            setParameterValue(address, target.targetValue);
-            target.isActive = false;
+            if (numActiveRamps == maxParameterRamps)
+            {
+                // Pool exhausted: jump rather than lose the change
+                setParameterValueByIndex(command.parameterIndex, command.targetValue);
+                droppedRampCount.fetch_add(1);
+                continue;
+            }
+
+            ramp = &activeRamps[(size_t) numActiveRamps++];
+            startValue = getParameterValueByIndex(command.parameterIndex);
         }
-        else
+
+        ramp->parameterIndex = command.parameterIndex;
+        ramp->startValue = startValue;
+        ramp->targetValue = command.targetValue;
+        ramp->totalSamples = juce::jmax(0, juce::roundToInt(command.timeMs * 0.001 * rampSampleRate));
+        ramp->elapsedSamples = 0;
+    }
+
+    rampQueue.finishedRead(numCommands);
+    activeRampCount.store(numActiveRamps, std::memory_order_relaxed);
+}
+
+int InstrumentInstance::getParameterRampStep(int samplesRemaining) const
+{
+    if (numActiveRamps == 0)
+        return samplesRemaining;
+
+    return juce::jmin(samplesRemaining, rampResolution.load(std::memory_order_relaxed));
+}
+
+void InstrumentInstance::applyParameterRamps(int numSamples)
+{
+    for (int r = 0; r < numActiveRamps;)
+    {
+        auto& ramp = activeRamps[(size_t) r];
+
+        if (ramp.elapsedSamples >= ramp.totalSamples)
         {
-            // Interpolate value
-            float smoothValue = smoothParameterValue(target, deltaTime);
-            setParameterValue(address, smoothValue);
-            target.currentValue = smoothValue;
+            // Finished: land exactly on the target and release the slot
+            setParameterValueByIndex(ramp.parameterIndex, ramp.targetValue);
+            ramp = activeRamps[(size_t) --numActiveRamps];
+            continue;
         }
+
+        setParameterValueByIndex(ramp.parameterIndex, ramp.getValueAt(ramp.elapsedSamples));
+        ramp.elapsedSamples += numSamples;
+        ++r;
     }
 
-    // Remove inactive targets
-    for (auto it = smoothingTargets.begin(); it != smoothingTargets.end();)
+    activeRampCount.store(numActiveRamps, std::memory_order_relaxed);
+}
+
+bool InstrumentInstance::fillParameterRamp(int parameterIndex, float* destination, int numSamples) const
+{
+    for (int r = 0; r < numActiveRamps; ++r)
     {
-        if (!it->second.isActive)
-            it = smoothingTargets.erase(it);
-        else
-            ++it;
+        const auto& ramp = activeRamps[(size_t) r];
+        if (ramp.parameterIndex != parameterIndex)
+            continue;
+
+        // Per-sample values for instruments that take sample-accurate parameters;
+        // the decay term is advanced by multiplication instead of one exp per sample
+        const int remaining = juce::jlimit(0, numSamples, ramp.totalSamples - ramp.elapsedSamples);
+        if (remaining > 0)
+        {
+            const float step = std::exp(-3.0f / (float) ramp.totalSamples);
+            const float scale = (ramp.targetValue - ramp.startValue) / (1.0f - std::exp(-3.0f));
+            float decay = std::exp(-3.0f * (float) ramp.elapsedSamples / (float) ramp.totalSamples);
+
+            for (int i = 0; i < remaining; ++i)
+            {
+                destination[i] = ramp.startValue + scale * (1.0f - decay);
+                decay *= step;
+            }
+        }
+
+        std::fill(destination + remaining, destination + numSamples, ramp.targetValue);
+        return true;
     }
+
+    return false;
+}
+
+float InstrumentInstance::ParameterRamp::getValueAt(int samplePosition) const
+{
+    if (samplePosition >= totalSamples)
+        return targetValue;
+
+    // Exponential approach 1 - e^(-3p), normalised so the ramp ends exactly on the target
+    const float progress = (float) samplePosition / (float) totalSamples;
+    const float shaped = (1.0f - std::exp(-3.0f * progress)) / (1.0f - std::exp(-3.0f));
+
+    return startValue + (targetValue - startValue) * shaped;
 }
 
 void InstrumentInstance::addMidiMessage(juce::MidiBuffer& buffer, const juce::MidiMessage& message)
@@ -252,20 +364,6 @@ float InstrumentInstance::linearInterpolate(float start, float end, float positi
     return start + (end - start) * position;
 }
 
-float InstrumentInstance::smoothParameterValue(const SmoothingTarget& target, double deltaTime) const
-{
-    if (target.smoothingTime <= 0.0)
-        return target.targetValue;
-
-    float progress = (float)(target.currentTime / target.smoothingTime);
-    progress = juce::jlimit(0.0f, 1.0f, progress);
-
-    // Use exponential smoothing for more natural parameter changes
-    float smoothedProgress = 1.0f - std::exp(-3.0f * progress);
-
-    return linearInterpolate(target.currentValue, target.targetValue, smoothedProgress);
-}
-
 //==============================================================================
 // PluginInstrumentInstance Implementation
 //==============================================================================
@@ -295,6 +393,9 @@ bool PluginInstrumentInstance::initialize(double sampleRate, int bufferSize)
     try
     {
         plugin->prepareToPlay(sampleRate, bufferSize);
+        prepareParameterRamps(sampleRate);
+        subBlockMidi.ensureSize(4096);
+        rampedMidiOutput.ensureSize(4096);
         initialized.store(true);
 
         juce::Logger::writeToLog("Initialized plugin: " + plugin->getName());
@@ -312,6 +413,7 @@ void PluginInstrumentInstance::prepareToPlay(double sampleRate, int samplesPerBl
     if (plugin)
     {
         plugin->prepareToPlay(sampleRate, samplesPerBlock);
+        prepareParameterRamps(sampleRate);
     }
 }
 
@@ -335,12 +437,14 @@ void PluginInstrumentInstance::processBlock(juce::AudioBuffer<float>& buffer, ju
 
     try
     {
-        // Update parameter smoothing
-        double deltaTime = buffer.getNumSamples() / plugin->getSampleRate();
-        updateParameterSmoothing(deltaTime);
+        // Ramps posted since the last block start here; with none running the
+        // plugin sees the whole block as before
+        adoptPendingParameterRamps();
 
-        // Process audio through plugin
-        plugin->processBlock(buffer, midiMessages);
+        if (hasActiveParameterRamps())
+            processWithParameterRamps(buffer, midiMessages);
+        else
+            plugin->processBlock(buffer, midiMessages);
 
         // Update performance stats
         auto endTime = std::chrono::high_resolution_clock::now();
@@ -360,6 +464,41 @@ void PluginInstrumentInstance::processBlock(juce::AudioBuffer<float>& buffer, ju
     }
 }
 
+void PluginInstrumentInstance::processWithParameterRamps(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    // Split the block so ramped parameters update every rampResolution samples.
+    // Sub-buffers alias the host buffer and the MIDI buffers keep their
+    // capacity, so nothing here allocates.
+    const int numSamples = buffer.getNumSamples();
+    rampedMidiOutput.clear();
+
+    for (int position = 0; position < numSamples;)
+    {
+        const int step = getParameterRampStep(numSamples - position);
+        applyParameterRamps(step);
+
+        juce::AudioBuffer<float> subBuffer(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), position, step);
+
+        subBlockMidi.clear();
+        for (auto it = midiMessages.findNextSamplePosition(position); it != midiMessages.cend(); ++it)
+        {
+            const auto metadata = *it;
+            if (metadata.samplePosition >= position + step)
+                break;
+            subBlockMidi.addEvent(metadata.data, metadata.numBytes, metadata.samplePosition - position);
+        }
+
+        plugin->processBlock(subBuffer, subBlockMidi);
+
+        for (const auto metadata : subBlockMidi)
+            rampedMidiOutput.addEvent(metadata.data, metadata.numBytes, metadata.samplePosition + position);
+
+        position += step;
+    }
+
+    midiMessages.swapWith(rampedMidiOutput);
+}
+
 int PluginInstrumentInstance::getLatencySamples() const
 {
     return plugin ? plugin->getLatencySamples() : 0;
@@ -444,6 +583,25 @@ void PluginInstrumentInstance::setParameterValue(const juce::String& address, fl
     }
 }
 
+int PluginInstrumentInstance::resolveParameterIndex(const juce::String& address) const
+{
+    return plugin ? getParameterIndex(address) : -1;
+}
+
+float PluginInstrumentInstance::getParameterValueByIndex(int parameterIndex) const
+{
+    if (plugin && parameterIndex >= 0 && parameterIndex < plugin->getNumParameters())
+        return plugin->getParameter(parameterIndex);
+
+    return 0.0f;
+}
+
+void PluginInstrumentInstance::setParameterValueByIndex(int parameterIndex, float value)
+{
+    if (plugin && parameterIndex >= 0 && parameterIndex < plugin->getNumParameters())
+        plugin->setParameter(parameterIndex, juce::jlimit(0.0f, 1.0f, value));
+}
+
 juce::MemoryBlock PluginInstrumentInstance::getStateInformation() const
 {
     juce::MemoryBlock data;
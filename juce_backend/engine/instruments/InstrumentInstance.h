@@ -3,11 +3,11 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include <array>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include <atomic>
-#include <mutex>
 
 namespace SchillingerEcosystem::Instrument {
 
@@ -190,6 +190,40 @@ public:
      */
     virtual void setParameterSmooth(const juce::String& address, float targetValue, double timeMs);
 
+    /**
+     * Resolve a parameter address to the index used by the ramp queue
+     * @param address Parameter address
+     * @return Parameter index, or -1 if the instrument has no indexed parameters
+     */
+    virtual int resolveParameterIndex(const juce::String& /*address*/) const { return -1; }
+
+    /**
+     * Get/set a parameter by pre-resolved index. The setter is called from the
+     * audio thread while ramps are rendered, so it must not lock or allocate.
+     */
+    virtual float getParameterValueByIndex(int /*parameterIndex*/) const { return 0.0f; }
+    virtual void setParameterValueByIndex(int /*parameterIndex*/, float /*value*/) {}
+
+    /**
+     * Post a smoothed ramp for a pre-resolved parameter index (any thread).
+     * Resolve the index once with resolveParameterIndex() and reuse it for
+     * dense automation; this never blocks the audio thread.
+     * @return false if the ramp queue is full
+     */
+    bool postParameterRamp(int parameterIndex, float targetValue, double timeMs);
+
+    /**
+     * Samples between parameter updates while a ramp is running (1 = per-sample)
+     */
+    void setParameterRampResolution(int samplesPerStep);
+    int getParameterRampResolution() const { return rampResolution.load(); }
+
+    /**
+     * Number of ramps currently being rendered / ramps dropped on a full queue or pool
+     */
+    int getNumActiveParameterRamps() const { return activeRampCount.load(); }
+    int getNumDroppedParameterRamps() const { return droppedRampCount.load(); }
+
     /**
      * Get all current parameter values as a map
      */
@@ -355,28 +389,55 @@ protected:
     mutable std::atomic<int> bufferUnderrunCount{0};
     mutable std::atomic<int> midiMessageCount{0};
 
-    // Parameter smoothing
-    struct SmoothingTarget
+    // Parameter smoothing: producers post RampCommands through a lock-free
+    // FIFO, the audio thread adopts them into a fixed pool of ParameterRamps
+    static constexpr int rampQueueCapacity = 256;
+    static constexpr int maxParameterRamps = 64;
+    static constexpr int defaultRampResolution = 32;
+
+    struct RampCommand
+    {
+        int parameterIndex = -1;
+        float targetValue = 0.0f;
+        double timeMs = 0.0;
+    };
+
+    struct ParameterRamp
     {
-        juce::String address;
-        float currentValue = 0.0f;
+        int parameterIndex = -1;
+        float startValue = 0.0f;
         float targetValue = 0.0f;
-        double smoothingTime = 0.0;
-        double currentTime = 0.0;
-        bool isActive = false;
+        int totalSamples = 0;
+        int elapsedSamples = 0;
+
+        float getValueAt(int samplePosition) const;
     };
 
-    mutable std::unordered_map<juce::String, SmoothingTarget> smoothingTargets;
-    mutable std::mutex smoothingMutex;
+    juce::AbstractFifo rampQueue{rampQueueCapacity};
+    std::array<RampCommand, rampQueueCapacity> rampCommands;
+    juce::SpinLock rampProducerLock;    // Serialises producers only, never taken on the audio thread
+
+    std::array<ParameterRamp, maxParameterRamps> activeRamps;
+    int numActiveRamps = 0;              // Audio thread only
+    double rampSampleRate = 44100.0;
+    std::atomic<int> rampResolution{defaultRampResolution};
+    std::atomic<int> activeRampCount{0};
+    std::atomic<int> droppedRampCount{0};
+
+    // Audio-thread ramp rendering
+    void prepareParameterRamps(double sampleRate);
+    void adoptPendingParameterRamps();
+    bool hasActiveParameterRamps() const { return numActiveRamps > 0; }
+    int getParameterRampStep(int samplesRemaining) const;
+    void applyParameterRamps(int numSamples);
+    bool fillParameterRamp(int parameterIndex, float* destination, int numSamples) const;
 
     // Internal processing helpers
-    void updateParameterSmoothing(double deltaTime);
     void addMidiMessage(juce::MidiBuffer& buffer, const juce::MidiMessage& message);
     void updatePerformanceStats(double processingTimeMs, int voicesActive, int midiMessages);
 
     // Utility functions
     float linearInterpolate(float start, float end, float position) const;
-    float smoothParameterValue(const SmoothingTarget& target, double deltaTime) const;
 
 private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(InstrumentInstance)
@@ -408,6 +469,9 @@ public:
     const ParameterInfo* getParameterInfo(const juce::String& address) const override;
     float getParameterValue(const juce::String& address) const override;
     void setParameterValue(const juce::String& address, float value) override;
+    int resolveParameterIndex(const juce::String& address) const override;
+    float getParameterValueByIndex(int parameterIndex) const override;
+    void setParameterValueByIndex(int parameterIndex, float value) override;
 
     juce::MemoryBlock getStateInformation() const override;
     void setStateInformation(const void* data, int sizeInBytes) override;
@@ -432,6 +496,12 @@ private:
     std::unordered_map<int, juce::String> parameterIndexToAddress;
     mutable std::unordered_map<juce::String, int> addressToParameterIndex;
 
+    // Per-sub-block MIDI while ramps split the block; sized in prepareToPlay
+    juce::MidiBuffer subBlockMidi;
+    juce::MidiBuffer rampedMidiOutput;
+
+    void processWithParameterRamps(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages);
+
     void buildParameterMaps();
     int getParameterIndex(const juce::String& address) const;
     juce::String getParameterAddress(int index) const;
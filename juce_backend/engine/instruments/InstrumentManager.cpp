@@ -862,8 +862,20 @@ bool AIAgentInterface::setParameter(const juce::String& address, float value)
 bool AIAgentInterface::setParameterSmooth(const juce::String& address,
                                                               float value, double timeMs)
 {
-    // TODO: Implement smooth parameter interpolation
-    return setParameter(address, value);
+    std::lock_guard<std::mutex> lock(controlMutex);
+
+    bool success = false;
+    auto instances = manager.getActiveInstances();
+    for (auto* instance : instances)
+    {
+        if (instance->getIdentifier() == instrumentIdentifier)
+        {
+            instance->setParameterSmooth(address, value, timeMs);
+            success = true;
+        }
+    }
+
+    return success;
 }
 
 void AIAgentInterface::noteOn(int midiNote, float velocity, int channel)
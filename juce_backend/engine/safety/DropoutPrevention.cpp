@@ -64,9 +64,7 @@ bool DropoutPrevention::initialize(const PreventionConfig &config) {
   // Set initial thread priority
   setAudioThreadPriority(config.threadPriority);
 
-  // Reserve space for history
-  bufferState_.levelHistory.reserve(bufferState_.maxHistorySize);
-  bufferState_.timestamps.reserve(bufferState_.maxHistorySize);
+  // Reserve space for history (level history rings are fixed-size)
   dropoutHistory_.reserve(1000);
 
   initialized_.store(true);
@@ -91,6 +89,7 @@ void DropoutPrevention::shutdown()
 
     // Cleanup sample rate converter
     cleanupSampleRateConverter();
+    flushDeferredLog();
 
     // Clear all data
     bufferState_.levelHistory.clear();
@@ -514,12 +513,11 @@ bool DropoutPrevention::enableSampleRateConversion(double inputRate,
   }
 
   cleanupSampleRateConverter();
-  srcEnabled_.store(false);
   return true;
 }
 
 bool DropoutPrevention::isSampleRateConversionEnabled() const {
-  return srcEnabled_.load();
+  return activeResampler_.load() != nullptr;
 }
 
 double DropoutPrevention::getInputSampleRate() const {
@@ -530,42 +528,97 @@ double DropoutPrevention::getOutputSampleRate() const {
   return outputSampleRate_.load();
 }
 
-void DropoutPrevention::processSampleRateConversion(const float* input, float* output, int numSamples)
+int DropoutPrevention::getSampleRateConversionLatency() const {
+  const std::lock_guard<std::mutex> lock(srcMutex_);
+  return srcResampler_ != nullptr ? srcResampler_->getLatencyInputSamples() : 0;
+}
+
+int DropoutPrevention::processSampleRateConversion(const float* input, float* output, int numSamples)
+{
+  // Flag the call before loading the converter: a concurrent swap then either
+  // sees this call in flight or this call picks up the new converter
+  srcCallActive_.store(true);
+  const uint64_t version = publishedResamplerVersion_.load();
+  PolyphaseResampler* const resampler = activeResampler_.load();
+
+  const int written = performSRC(resampler, input, output, numSamples);
+
+  // Anything retired at or before this version is no longer in use
+  acknowledgedResamplerVersion_.store(version, std::memory_order_release);
+  srcCallActive_.store(false, std::memory_order_release);
+  return written;
+}
+
+int DropoutPrevention::performSRC(PolyphaseResampler* resampler, const float* input, float* output, int numSamples)
 {
   // SECURITY FIX: Add comprehensive parameter validation to prevent buffer overflow
   constexpr int MAX_SAFE_SAMPLES = 32768;  // Maximum safe input sample count
   constexpr double MAX_SAFE_RATIO = 8.0;    // Maximum safe conversion ratio
 
-  if (!srcEnabled_.load() || (input == nullptr) || (output == nullptr)) {
+  if ((resampler == nullptr) || (input == nullptr) || (output == nullptr)) {
     if ((input != nullptr) && (output != nullptr) && numSamples > 0 && numSamples <= MAX_SAFE_SAMPLES) {
       // SECURITY FIX: Bounds checking before copy operation
       int safeCopyLength = std::min(numSamples, MAX_SAFE_SAMPLES);
       std::copy(input, input + safeCopyLength, output);
+      return safeCopyLength;
     }
-    return;
+    return 0;
   }
 
   // SECURITY FIX: Validate sample count and conversion ratio
+  // (audio thread: problems are queued for flushDeferredLog(), never logged here)
   if (numSamples <= 0 || numSamples > MAX_SAFE_SAMPLES) {
-    juce::Logger::writeToLog("DropoutPrevention::processSampleRateConversion - Invalid sample count: " + juce::String(numSamples));
-    return;
+    logDeferred("processSampleRateConversion - Invalid sample count", numSamples);
+    return 0;
   }
 
   // Validate conversion ratio is safe
   double const ratio = outputSampleRate_.load() / inputSampleRate_.load();
   if (ratio <= 0.0 || ratio > MAX_SAFE_RATIO) {
-    juce::Logger::writeToLog("DropoutPrevention::processSampleRateConversion - Unsafe conversion ratio: " + juce::String(ratio));
-    return;
+    logDeferred("processSampleRateConversion - Unsafe conversion ratio", ratio);
+    return 0;
   }
 
   // Calculate expected output size and validate it's safe
   int expectedOutputSamples = static_cast<int>(numSamples * ratio);
   if (expectedOutputSamples <= 0 || expectedOutputSamples > MAX_SAFE_SAMPLES * MAX_SAFE_RATIO) {
-    juce::Logger::writeToLog("DropoutPrevention::processSampleRateConversion - Unsafe output size: " + juce::String(expectedOutputSamples));
+    logDeferred("processSampleRateConversion - Unsafe output size", expectedOutputSamples);
+    return 0;
+  }
+
+  return resampler->process(input, numSamples, output, resampler->getMaxOutputSamples(numSamples));
+}
+
+void DropoutPrevention::flushDeferredLog()
+{
+  int start1, size1, start2, size2;
+  deferredLog_.prepareToRead(deferredLog_.getNumReady(), start1, size1, start2, size2);
+
+  const int numEntries = size1 + size2;
+  for (int i = 0; i < numEntries; ++i) {
+    const auto& entry = deferredLogEntries_[(size_t) (i < size1 ? start1 + i : start2 + i - size1)];
+    juce::Logger::writeToLog("DropoutPrevention::" + juce::String(entry.message) + ": " + juce::String(entry.value));
+  }
+
+  deferredLog_.finishedRead(numEntries);
+
+  if (const uint64_t dropped = droppedLogEntries_.exchange(0); dropped > 0) {
+    juce::Logger::writeToLog("DropoutPrevention - " + juce::String((juce::int64) dropped) + " log messages dropped");
+  }
+}
+
+void DropoutPrevention::logDeferred(const char* message, double value) noexcept
+{
+  int start1, size1, start2, size2;
+  deferredLog_.prepareToWrite(1, start1, size1, start2, size2);
+
+  if (size1 == 0) {
+    droppedLogEntries_.fetch_add(1);
     return;
   }
 
-  performSRC(input, output, numSamples);
+  deferredLogEntries_[(size_t) start1] = { message, value };
+  deferredLog_.finishedWrite(1);
 }
 
 //==============================================================================
@@ -637,14 +690,17 @@ DropoutPrevention::Statistics DropoutPrevention::getStatistics() const {
   // Calculate average buffer level
   if (!bufferState_.levelHistory.empty()) {
     double sum = 0.0;
-    for (double const level : bufferState_.levelHistory) {
+    double minLevel = bufferState_.levelHistory[0];
+    double maxLevel = bufferState_.levelHistory[0];
+    for (size_t i = 0; i < bufferState_.levelHistory.size(); ++i) {
+      double const level = bufferState_.levelHistory[i];
       sum += level;
+      minLevel = std::min(minLevel, level);
+      maxLevel = std::max(maxLevel, level);
     }
     stats.averageBufferLevel = sum / bufferState_.levelHistory.size();
-    stats.minBufferLevel = *std::min_element(bufferState_.levelHistory.begin(),
-                                             bufferState_.levelHistory.end());
-    stats.maxBufferLevel = *std::max_element(bufferState_.levelHistory.begin(),
-                                             bufferState_.levelHistory.end());
+    stats.minBufferLevel = minLevel;
+    stats.maxBufferLevel = maxLevel;
   }
 
   stats.bufferUnderruns = bufferState_.underruns.load();
@@ -700,7 +756,7 @@ juce::String DropoutPrevention::generatePerformanceReport() const {
   report << "\n";
   report << "Real-time Priority Enabled: "
          << (priorityBoosted_.load() ? "Yes" : "No") << "\n";
-  report << "Sample Rate Conversion: " << (srcEnabled_.load() ? "Yes" : "No")
+  report << "Sample Rate Conversion: " << (isSampleRateConversionEnabled() ? "Yes" : "No")
          << "\n";
 
   return report;
@@ -717,7 +773,7 @@ DropoutPrevention::DiagnosticInfo DropoutPrevention::getDiagnosticInfo() const {
   info.systemStabilityScore =
       info.systemStable ? 1.0 : dropoutProbability_.load();
   info.realTimePriorityActive = priorityBoosted_.load();
-  info.sampleRateConversionActive = srcEnabled_.load();
+  info.sampleRateConversionActive = isSampleRateConversionEnabled();
   info.currentLatencyMs =
       (static_cast<double>(bufferState_.currentSize.load()) /
        outputSampleRate_.load()) *
@@ -773,17 +829,10 @@ void DropoutPrevention::updateBufferLevel(int inputSamples, int outputSamples, i
         bufferState_.overruns.fetch_add(1);
     }
 
-    // Update history
+    // Update history (rings drop the oldest entry once full)
     auto now = std::chrono::steady_clock::now();
-    bufferState_.levelHistory.push_back((newInputLevel + newOutputLevel) * 0.5);
-    bufferState_.timestamps.push_back(now);
-
-    // Limit history size
-    if (bufferState_.levelHistory.size() > bufferState_.maxHistorySize)
-    {
-        bufferState_.levelHistory.erase(bufferState_.levelHistory.begin());
-        bufferState_.timestamps.erase(bufferState_.timestamps.begin());
-    }
+    bufferState_.levelHistory.push((newInputLevel + newOutputLevel) * 0.5);
+    bufferState_.timestamps.push(now);
 }
 
 void DropoutPrevention::analyzeBufferTrends()
@@ -921,71 +970,85 @@ bool DropoutPrevention::detectPhaseInversion(const float *const *audioData,
 
 bool DropoutPrevention::initializeSampleRateConverter()
 {
-  if (srcEnabled_.load()) {
-    return true; // Already initialized
-  }
-
   // SECURITY FIX: Validate input parameters and calculate safe buffer sizes
-  constexpr int BASE_BUFFER_SIZE = 4096;  // Conservative base buffer size
+  constexpr int MAX_SAFE_SAMPLES = 32768; // Matches processSampleRateConversion
   constexpr double MAX_SAFE_RATIO = 8.0;  // Maximum safe conversion ratio
-  constexpr int MAX_SAFE_OUTPUT_SIZE = BASE_BUFFER_SIZE * 4;  // Maximum safe output size
 
   try {
-    srcInterpolator_ = std::make_unique<juce::LagrangeInterpolator>();
-
     double const ratio = outputSampleRate_.load() / inputSampleRate_.load();
 
     // SECURITY FIX: Validate conversion ratio is safe
     if (ratio <= 0.0 || ratio > MAX_SAFE_RATIO) {
       juce::Logger::writeToLog("DropoutPrevention::initializeSampleRateConverter - Unsafe conversion ratio: " + juce::String(ratio));
+      cleanupSampleRateConverter();
       return false;
     }
 
-    // SECURITY FIX: Calculate safe output buffer size with bounds checking
-    int const maxOutputSize = static_cast<int>(BASE_BUFFER_SIZE * ratio);
-    int const safeOutputSize = std::min(maxOutputSize, MAX_SAFE_OUTPUT_SIZE);
-
-    // Validate calculated size is reasonable
-    if (safeOutputSize <= 0 || safeOutputSize > MAX_SAFE_OUTPUT_SIZE) {
-      juce::Logger::writeToLog("DropoutPrevention::initializeSampleRateConverter - Invalid buffer size: " + juce::String(safeOutputSize));
+    // Filter bank and input history are allocated here, never on the audio
+    // thread; the running converter stays live until the swap
+    auto resampler = std::make_unique<PolyphaseResampler>();
+    if (!resampler->prepare(inputSampleRate_.load(), outputSampleRate_.load(),
+                            MAX_SAFE_SAMPLES, config_.resamplerQuality)) {
+      juce::Logger::writeToLog("DropoutPrevention::initializeSampleRateConverter - Unsupported conversion ratio: " + juce::String(ratio));
+      cleanupSampleRateConverter();
       return false;
     }
 
-    srcBuffer_ = std::make_unique<juce::AudioBuffer<float>>(2, safeOutputSize);
-    srcEnabled_.store(true);
+    juce::Logger::writeToLog("DropoutPrevention::initializeSampleRateConverter - Initialized with "
+                             + juce::String(resampler->getNumTaps()) + " taps, latency "
+                             + juce::String(resampler->getLatencyInputSamples()) + " samples");
 
-    juce::Logger::writeToLog("DropoutPrevention::initializeSampleRateConverter - Initialized safely with buffer size: " + juce::String(safeOutputSize));
+    publishSampleRateConverter(std::move(resampler));
     return true;
   }
   catch (const std::exception& e) {
     juce::Logger::writeToLog("DropoutPrevention::initializeSampleRateConverter - Exception: " + juce::String(e.what()));
-    return false;
   }
   catch (...) {
     juce::Logger::writeToLog("DropoutPrevention::initializeSampleRateConverter - Unknown exception occurred");
-    return false;
   }
+
+  // A converter prepared for the previous rates must not keep running
+  cleanupSampleRateConverter();
+  return false;
 }
 
 void DropoutPrevention::cleanupSampleRateConverter()
 {
-    srcEnabled_.store(false);
-    srcInterpolator_ = nullptr;
-    srcBuffer_.reset();
+    publishSampleRateConverter(nullptr);
 }
 
-void DropoutPrevention::performSRC(const float* input, float* output, int numSamples)
+void DropoutPrevention::publishSampleRateConverter(std::unique_ptr<PolyphaseResampler> resampler)
 {
-    if (!srcInterpolator_ || !srcBuffer_)
-    {
-        std::copy(input, input + numSamples, output);
-        return;
-    }
+    const std::lock_guard<std::mutex> lock(srcMutex_);
 
-    double const ratio = outputSampleRate_.load() / inputSampleRate_.load();
-    int const outputSamples = static_cast<int>(numSamples * ratio);
+    const uint64_t version = nextResamplerVersion_++;
+    activeResampler_.store(resampler.get());
+    publishedResamplerVersion_.store(version);
+
+    if (srcResampler_ != nullptr)
+        retiredResamplers_.push_back({ version, std::move(srcResampler_) });
+    srcResampler_ = std::move(resampler);
 
-    srcInterpolator_->process(ratio, input, output, outputSamples);
+    releaseRetiredResamplers();
+}
+
+void DropoutPrevention::releaseRetiredResamplers()
+{
+    if (retiredResamplers_.empty())
+        return;
+
+    // Read after the swap: with no call in flight the next one loads the new
+    // converter; otherwise wait for a call that started after the swap to finish
+    const bool idle = !srcCallActive_.load();
+    const uint64_t acknowledged = acknowledgedResamplerVersion_.load(std::memory_order_acquire);
+
+    retiredResamplers_.erase(std::remove_if(retiredResamplers_.begin(), retiredResamplers_.end(),
+                                            [&](const RetiredResampler& retired)
+                                            {
+                                                return idle || acknowledged >= retired.version;
+                                            }),
+                             retiredResamplers_.end());
 }
 
 double DropoutPrevention::calculateDropoutProbability() const {
@@ -1052,19 +1115,10 @@ void DropoutPrevention::updatePredictionModel()
         (bufferState_.inputLevel.load() + bufferState_.outputLevel.load()) *
         0.5;
 
-    predictionModel_.bufferLevels.push_back(currentLevel);
-    predictionModel_.times.push_back(
+    predictionModel_.bufferLevels.push(currentLevel);
+    predictionModel_.times.push(
         std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime_).count());
-    predictionModel_.dropoutOccurred.push_back(isNearUnderrun() || isNearOverrun());
-
-    // Limit model size
-    size_t const maxSize = 1000;
-    if (predictionModel_.bufferLevels.size() > maxSize)
-    {
-        predictionModel_.bufferLevels.erase(predictionModel_.bufferLevels.begin());
-        predictionModel_.times.erase(predictionModel_.times.begin());
-        predictionModel_.dropoutOccurred.erase(predictionModel_.dropoutOccurred.begin());
-    }
+    predictionModel_.dropoutOccurred.push(isNearUnderrun() || isNearOverrun());
 }
 
 //==============================================================================
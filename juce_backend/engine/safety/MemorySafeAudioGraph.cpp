@@ -37,6 +37,7 @@ MemorySafeAudioNode::MemorySafeAudioNode(std::string nodeId,
         inputBuffer_->clear();
         outputBuffer_->clear();
         scratchBuffer_->clear();
+        refreshChannelPointers();
 
         // Set state to ready
         currentState_.store(NodeState::Ready);
@@ -94,6 +95,7 @@ bool MemorySafeAudioNode::initialize() {
             inputBuffer_->clear();
             outputBuffer_->clear();
             scratchBuffer_->clear();
+            refreshChannelPointers();
 
         } catch (const std::exception& e) {
             currentState_.store(NodeState::Error);
@@ -152,33 +154,26 @@ bool MemorySafeAudioNode::processAudio(const float* const* inputAudio,
 
     // Use RAII for processing lock management
     struct ProcessingLockGuard {
-        std::atomic<bool>& isProcessing;
-        std::atomic<uint32_t>& processingCount;
-        ProcessingLockGuard(std::atomic<bool>& proc, std::atomic<uint32_t>& count)
-            : isProcessing(proc), processingCount(count) {
-            isProcessing.store(true);
-            processingCount.fetch_add(1);
+        MemorySafeAudioNode& node;
+        explicit ProcessingLockGuard(MemorySafeAudioNode& n) : node(n) {
+            node.processingCount_.fetch_add(1, std::memory_order_relaxed);
         }
         ~ProcessingLockGuard() {
-            isProcessing.store(false);
-            processingCount.fetch_sub(1);
+            node.processingCount_.fetch_sub(1, std::memory_order_relaxed);
+            node.releaseProcessingLock();
         }
-    } lockGuard(isProcessing_, processingCount_);
+    } lockGuard(*this);
 
+    // Failures on the audio thread only flip the node into the Error state;
+    // validateGraphIntegrity reports them from a non-realtime thread
     try {
         bool success = processInternal(inputAudio, numInputChannels, numSamples,
                                     outputAudio, numOutputChannels);
 
-        totalSamplesProcessed_.fetch_add(numSamples);
+        totalSamplesProcessed_.fetch_add(numSamples, std::memory_order_relaxed);
         return success;
 
-    } catch (const std::exception& e) {
-        juce::Logger::writeToLog("ERROR: Exception during processing in node " + nodeId_ + ": " + e.what());
-        currentState_.store(NodeState::Error);
-        return false;
-
     } catch (...) {
-        juce::Logger::writeToLog("ERROR: Unknown exception during processing in node " + nodeId_);
         currentState_.store(NodeState::Error);
         return false;
     }
@@ -204,7 +199,7 @@ bool MemorySafeAudioNode::processInternal(const float* const* inputAudio,
         int channelsToCopy = std::min(numInputChannels, inputBuffer_->getNumChannels());
         for (int ch = 0; ch < channelsToCopy; ++ch) {
             if (inputAudio[ch]) {
-                inputBuffer_->copyFrom(ch, 0, inputAudio[ch], 0, numSamples);
+                inputBuffer_->copyFrom(ch, 0, inputAudio[ch], numSamples);
             }
         }
     }
@@ -212,29 +207,20 @@ bool MemorySafeAudioNode::processInternal(const float* const* inputAudio,
     // Apply processing callback if set
     if (processCallback_) {
         try {
-            // Prepare input channel pointers
-            std::vector<const float*> inputChannels(inputBuffer_->getNumChannels());
-            for (int ch = 0; ch < inputBuffer_->getNumChannels(); ++ch) {
-                inputChannels[ch] = inputBuffer_->getReadPointer(ch);
-            }
+            // Call user callback with the preassigned channel pointers
+            processCallback_(inputChannelPtrs_.data(), static_cast<int>(inputChannelPtrs_.size()), numSamples,
+                           outputChannelPtrs_.data(), static_cast<int>(outputChannelPtrs_.size()));
 
-            // Prepare output channel pointers
-            std::vector<float*> outputChannels(outputBuffer_->getNumChannels());
-            for (int ch = 0; ch < outputBuffer_->getNumChannels(); ++ch) {
-                outputChannels[ch] = outputBuffer_->getWritePointer(ch);
-            }
-
-            // Call user callback
-            processCallback_(inputChannels.data(), inputChannels.size(), numSamples,
-                           outputChannels.data(), outputChannels.size());
-
-        } catch (const std::exception& e) {
-            juce::Logger::writeToLog("ERROR: Processing callback failed in node " + nodeId_ + ": " + e.what());
+        } catch (const std::exception&) {
             return false;
         }
     } else {
         // Default behavior: copy input to output
-        *outputBuffer_ = *inputBuffer_;
+        const int channelsToCopy = std::min(inputBuffer_->getNumChannels(), outputBuffer_->getNumChannels());
+        for (int ch = 0; ch < channelsToCopy; ++ch) {
+            juce::FloatVectorOperations::copy(outputChannelPtrs_[static_cast<size_t>(ch)],
+                                              inputChannelPtrs_[static_cast<size_t>(ch)], numSamples);
+        }
     }
 
     // Copy to output if provided
@@ -386,6 +372,7 @@ bool MemorySafeAudioNode::resizeBuffers(int newBufferSize) {
         inputBuffer_ = std::move(newInputBuffer);
         outputBuffer_ = std::move(newOutputBuffer);
         scratchBuffer_ = std::move(newScratchBuffer);
+        refreshChannelPointers();
 
         return true;
 
@@ -432,6 +419,7 @@ bool MemorySafeAudioNode::setChannelCount(int newNumChannels) {
         inputBuffer_ = std::move(newInputBuffer);
         outputBuffer_ = std::move(newOutputBuffer);
         scratchBuffer_ = std::move(newScratchBuffer);
+        refreshChannelPointers();
 
         return true;
 
@@ -494,15 +482,35 @@ void MemorySafeAudioNode::setCreatorContext(const std::string& context) {
 #endif
 
 bool MemorySafeAudioNode::tryAcquireProcessingLock() {
+    bool expected = false;
+    if (!isProcessing_.compare_exchange_strong(expected, true)) {
+        return false; // Already processing
+    }
+
+    // Re-check after claiming the flag: shutdown() sets the state before it
+    // waits on isProcessing_, so one of the two always sees the other
     if (currentState_.load() != NodeState::Ready) {
+        releaseProcessingLock();
         return false;
     }
 
-    if (isProcessing_.load()) {
-        return false; // Already processing
+    return true; // Ready to process
+}
+
+void MemorySafeAudioNode::releaseProcessingLock() {
+    isProcessing_.store(false);
+}
+
+void MemorySafeAudioNode::refreshChannelPointers() {
+    inputChannelPtrs_.resize(static_cast<size_t>(inputBuffer_->getNumChannels()));
+    for (int ch = 0; ch < inputBuffer_->getNumChannels(); ++ch) {
+        inputChannelPtrs_[static_cast<size_t>(ch)] = inputBuffer_->getReadPointer(ch);
     }
 
-    return true; // Ready to process
+    outputChannelPtrs_.resize(static_cast<size_t>(outputBuffer_->getNumChannels()));
+    for (int ch = 0; ch < outputBuffer_->getNumChannels(); ++ch) {
+        outputChannelPtrs_[static_cast<size_t>(ch)] = outputBuffer_->getWritePointer(ch);
+    }
 }
 
 void MemorySafeAudioNode::cleanupConnections() {
@@ -527,6 +535,10 @@ void MemorySafeAudioNode::updateLastAccessTime() {
 // MemorySafeAudioGraph Implementation
 
 MemorySafeAudioGraph::MemorySafeAudioGraph() {
+    for (auto& epoch : processorEpochs_) {
+        epoch.store(quiescentEpoch);
+    }
+
     #ifdef DEBUG
     creatorContext_ = "MemorySafeAudioGraph constructor";
     #endif
@@ -535,6 +547,11 @@ MemorySafeAudioGraph::MemorySafeAudioGraph() {
 MemorySafeAudioGraph::~MemorySafeAudioGraph() {
     requestShutdown();
     clear();
+
+    // clear() has already waited for the audio thread, so nothing can still
+    // hold the active or retired plans
+    delete activePlan_.exchange(nullptr);
+    retiredPlans_.clear();
 }
 
 bool MemorySafeAudioGraph::addNode(NodePtr node) {
@@ -542,83 +559,96 @@ bool MemorySafeAudioGraph::addNode(NodePtr node) {
         return false;
     }
 
-    std::unique_lock<std::shared_mutex> lock(nodesMutex_);
-
     std::string nodeId = node->getId();
 
-    // Check if node already exists
-    if (nodes_.find(nodeId) != nodes_.end()) {
-        juce::Logger::writeToLog("WARNING: Node " + nodeId + " already exists in graph");
-        return false;
-    }
+    {
+        std::unique_lock<std::shared_mutex> lock(nodesMutex_);
 
-    try {
-        // Add node to map
-        nodes_[nodeId] = std::move(node);
+        // Check if node already exists
+        if (nodes_.find(nodeId) != nodes_.end()) {
+            juce::Logger::writeToLog("WARNING: Node " + nodeId + " already exists in graph");
+            return false;
+        }
+
+        try {
+            // Add node to map, remembering insertion order for the plan
+            nodes_[nodeId] = SharedNodePtr(std::move(node));
+            insertionOrder_.push_back(nodeId);
 
-        // Mark processing order as dirty
-        processingOrderDirty_ = true;
+        } catch (const std::exception& e) {
+            nodes_.erase(nodeId);
+            juce::Logger::writeToLog("ERROR: Failed to add node " + nodeId + " to graph: " + e.what());
+            return false;
+        }
 
         #ifdef DEBUG
         lastNodeModification_.store(std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::steady_clock::now().time_since_epoch()).count());
         #endif
+    }
 
-        juce::Logger::writeToLog("Added node " + nodeId + " to audio graph");
-        return true;
+    rebuildExecutionPlan();
 
-    } catch (const std::exception& e) {
-        juce::Logger::writeToLog("ERROR: Failed to add node " + nodeId + " to graph: " + e.what());
-        return false;
-    }
+    juce::Logger::writeToLog("Added node " + nodeId + " to audio graph");
+    return true;
 }
 
 bool MemorySafeAudioGraph::removeNode(const std::string& nodeId) {
-    std::unique_lock<std::shared_mutex> nodesLock(nodesMutex_);
+    SharedNodePtr node;
 
-    auto nodeIt = nodes_.find(nodeId);
-    if (nodeIt == nodes_.end()) {
-        return false; // Node not found
-    }
+    {
+        std::unique_lock<std::shared_mutex> nodesLock(nodesMutex_);
 
-    auto& node = nodeIt->second;
-    if (!node) {
+        auto nodeIt = nodes_.find(nodeId);
+        if (nodeIt == nodes_.end()) {
+            return false; // Node not found
+        }
+
+        // Take ownership out of the map; the node stays alive until the
+        // audio thread can no longer reach it through the old plan
+        node = std::move(nodeIt->second);
         nodes_.erase(nodeIt);
-        return false;
-    }
+        insertionOrder_.erase(std::remove(insertionOrder_.begin(), insertionOrder_.end(), nodeId),
+                              insertionOrder_.end());
 
-    // Wait for any processing to complete
-    while (node->isProcessing()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    }
+        if (!node) {
+            return false;
+        }
 
-    // Remove node from connections
-    {
+        // Remove node from connections
         std::unique_lock<std::shared_mutex> connectionsLock(connectionsMutex_);
         connections_.erase(nodeId);
 
-        // Remove from other nodes' connections
-        for (auto& [id, weakNode] : connections_) {
-            if (auto sharedNode = weakNode.lock()) {
-                sharedNode->disconnectOutput(nodeId);
-                sharedNode->disconnectInput(nodeId);
+        for (auto it = connections_.begin(); it != connections_.end();) {
+            auto sourceNode = it->second.lock();
+
+            if (!sourceNode || sourceNode->getId() == nodeId) {
+                auto destIt = nodes_.find(it->first);
+                if (destIt != nodes_.end() && destIt->second) {
+                    destIt->second->disconnectInput(nodeId);
+                }
+                it = connections_.erase(it);
+                continue;
             }
-        }
-    }
 
-    // Shutdown the node safely
-    node->shutdown();
+            // Remove from other nodes' connections
+            sourceNode->disconnectOutput(nodeId);
+            sourceNode->disconnectInput(nodeId);
+            ++it;
+        }
 
-    // Remove node from map (RAII handles cleanup)
-    nodes_.erase(nodeIt);
+        #ifdef DEBUG
+        lastNodeModification_.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+        #endif
+    }
 
-    // Mark processing order as dirty
-    processingOrderDirty_ = true;
+    // Publish a plan without the node, then wait until every audio thread has
+    // finished any block that started with the old plan
+    synchronizeWithAudioThread(rebuildExecutionPlan());
 
-    #ifdef DEBUG
-    lastNodeModification_.store(std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()).count());
-    #endif
+    // Shutdown the node safely (RAII handles cleanup when node goes out of scope)
+    node->shutdown();
 
     juce::Logger::writeToLog("Removed node " + nodeId + " from audio graph");
     return true;
@@ -630,7 +660,7 @@ std::future<bool> MemorySafeAudioGraph::removeNodeAsync(const std::string& nodeI
     });
 }
 
-std::weak_ptr<MemorySafeAudioNode> MemorySafeAudioGraph::getNode(const std::string& nodeId) {
+std::weak_ptr<MemorySafeAudioNode> MemorySafeAudioGraph::getNode(const std::string& nodeId) const {
     std::shared_lock<std::shared_mutex> lock(nodesMutex_);
 
     auto it = nodes_.find(nodeId);
@@ -648,16 +678,7 @@ bool MemorySafeAudioGraph::hasNode(const std::string& nodeId) const {
 
 std::vector<std::string> MemorySafeAudioGraph::getNodeIds() const {
     std::shared_lock<std::shared_mutex> lock(nodesMutex_);
-    std::vector<std::string> ids;
-
-    ids.reserve(nodes_.size());
-    for (const auto& [nodeId, node] : nodes_) {
-        if (node) {
-            ids.push_back(nodeId);
-        }
-    }
-
-    return ids;
+    return insertionOrder_;
 }
 
 size_t MemorySafeAudioGraph::getNodeCount() const {
@@ -674,66 +695,85 @@ bool MemorySafeAudioGraph::processAudio(const float* const* inputAudio,
         return false;
     }
 
-    // Set processing state
-    isGraphProcessing_.store(true);
     activeProcessingCount_.fetch_add(1);
 
     // RAII for processing state management
     struct GraphProcessingGuard {
-        std::atomic<bool>& isProcessing;
         std::atomic<uint32_t>& activeCount;
-        GraphProcessingGuard(std::atomic<bool>& proc, std::atomic<uint32_t>& count)
-            : isProcessing(proc), activeCount(count) {}
+        std::atomic<uint64_t>* epochSlot = nullptr;
+        explicit GraphProcessingGuard(std::atomic<uint32_t>& count) : activeCount(count) {}
         ~GraphProcessingGuard() {
-            isProcessing.store(false);
+            if (epochSlot != nullptr) {
+                epochSlot->store(quiescentEpoch, std::memory_order_release);
+            }
             activeCount.fetch_sub(1);
         }
-    } processingGuard(isGraphProcessing_, activeProcessingCount_);
+    } processingGuard(activeProcessingCount_);
+
+    // Announce the epoch we are reading in before loading the plan, so a
+    // writer that swaps the plan after this point waits for us
+    const uint64_t epoch = globalEpoch_.load(std::memory_order_acquire);
+    for (auto& slot : processorEpochs_) {
+        uint64_t expected = quiescentEpoch;
+        if (slot.compare_exchange_strong(expected, epoch)) {
+            processingGuard.epochSlot = &slot;
+            break;
+        }
+    }
 
-    totalProcessCalls_.fetch_add(1);
+    if (processingGuard.epochSlot == nullptr) {
+        totalErrors_.fetch_add(1, std::memory_order_relaxed);
+        return false; // More concurrent callers than epoch slots
+    }
 
-    try {
-        // Get processing order
-        auto processingOrder = getProcessingOrderSnapshot();
+    totalProcessCalls_.fetch_add(1, std::memory_order_relaxed);
 
-        // Process nodes in order
-        for (const std::string& nodeId : processingOrder) {
-            if (shutdownRequested_.load()) {
-                break;
-            }
+    const ExecutionPlan* plan = activePlan_.load();
+    if (plan == nullptr) {
+        return true;
+    }
 
-            if (!validateNodeForProcessing(nodeId)) {
-                continue;
-            }
+    const ExecutionPlan::Step* steps = plan->steps.data();
+    const size_t numSteps = plan->steps.size();
 
-            auto weakNode = getNode(nodeId);
-            auto node = weakNode.lock();
-            if (!node) {
-                continue; // Node was removed during processing
-            }
+    // Process nodes in plan order
+    for (size_t i = 0; i < numSteps; ++i) {
+        if (shutdownRequested_.load(std::memory_order_relaxed)) {
+            break;
+        }
 
-            // Process node
-            bool success = node->processAudio(inputAudio, numInputChannels, numSamples,
-                                            outputAudio, numOutputChannels);
+        const auto& step = steps[i];
+        if (!step.node->isReady()) {
+            continue;
+        }
 
-            if (!success) {
-                totalErrors_.fetch_add(1);
-                juce::Logger::writeToLog("WARNING: Node " + nodeId + " failed processing");
+        const float* const* nodeInput = inputAudio;
+        int nodeInputChannels = numInputChannels;
+
+        if (step.sourceIndex >= 0) {
+            const MemorySafeAudioNode* source = steps[step.sourceIndex].node;
+
+            // A source with shorter buffers than this block cannot be read
+            if (numSamples <= source->getBufferSize()) {
+                nodeInput = source->getOutputChannelPointers();
+                nodeInputChannels = source->getChannelCount();
+            } else {
+                nodeInput = nullptr;
+                nodeInputChannels = 0;
             }
         }
 
-        return true;
-
-    } catch (const std::exception& e) {
-        totalErrors_.fetch_add(1);
-        juce::Logger::writeToLog("ERROR: Exception during graph processing: " + e.what());
-        return false;
+        float* const* nodeOutput = step.writesGraphOutput ? outputAudio : nullptr;
+        const int nodeOutputChannels = step.writesGraphOutput ? numOutputChannels : 0;
 
-    } catch (...) {
-        totalErrors_.fetch_add(1);
-        juce::Logger::writeToLog("ERROR: Unknown exception during graph processing");
-        return false;
+        // Process node
+        if (!step.node->processAudio(nodeInput, nodeInputChannels, numSamples,
+                                     nodeOutput, nodeOutputChannels)) {
+            totalErrors_.fetch_add(1, std::memory_order_relaxed);
+        }
     }
+
+    return true;
 }
 
 bool MemorySafeAudioGraph::connectNodes(const std::string& sourceNodeId,
@@ -764,8 +804,7 @@ bool MemorySafeAudioGraph::connectNodes(const std::string& sourceNodeId,
         connections_[destinationNodeId] = sourceWeak;
     }
 
-    // Mark processing order as dirty
-    processingOrderDirty_ = true;
+    rebuildExecutionPlan();
 
     juce::Logger::writeToLog("Connected " + sourceNodeId + " -> " + destinationNodeId);
     return true;
@@ -799,8 +838,7 @@ bool MemorySafeAudioGraph::disconnectNodes(const std::string& sourceNodeId,
         }
     }
 
-    // Mark processing order as dirty
-    processingOrderDirty_ = true;
+    rebuildExecutionPlan();
 
     juce::Logger::writeToLog("Disconnected " + sourceNodeId + " -> " + destinationNodeId);
     return true;
@@ -817,6 +855,36 @@ std::vector<std::string> MemorySafeAudioGraph::getNodeConnections(const std::str
     return node->getConnectedOutputIds();
 }
 
+bool MemorySafeAudioGraph::setGraphBufferSize(int newBufferSize) {
+    if (newBufferSize <= 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> planLock(planMutex_);
+
+    // Park the audio thread on an empty plan so no node reads a buffer that
+    // is being reallocated, then recompile once every node has been resized
+    synchronizeWithAudioThread(publishExecutionPlan(std::make_unique<ExecutionPlan>()));
+
+    bool success = true;
+    {
+        std::shared_lock<std::shared_mutex> nodesLock(nodesMutex_);
+        for (auto& [nodeId, node] : nodes_) {
+            if (node && !node->resizeBuffers(newBufferSize)) {
+                juce::Logger::writeToLog("ERROR: Failed to resize buffers for node " + nodeId);
+                success = false;
+            }
+        }
+    }
+
+    publishExecutionPlan(compileExecutionPlan());
+    return success;
+}
+
+void MemorySafeAudioGraph::optimizeProcessingOrder() {
+    rebuildExecutionPlan();
+}
+
 bool MemorySafeAudioGraph::validateGraphIntegrity() const {
     std::shared_lock<std::shared_mutex> nodesLock(nodesMutex_);
 
@@ -846,13 +914,15 @@ MemorySafeAudioGraph::GraphStats MemorySafeAudioGraph::getStats() const {
     std::shared_lock<std::shared_mutex> nodesLock(nodesMutex_);
     std::shared_lock<std::shared_mutex> connectionsLock(connectionsMutex_);
 
+    const uint32_t activeCount = activeProcessingCount_.load();
+
     return {
         nodes_.size(),
         connections_.size(),
         totalProcessCalls_.load(),
         totalErrors_.load(),
-        isGraphProcessing_.load(),
-        activeProcessingCount_.load()
+        activeCount > 0,
+        activeCount
     };
 }
 
@@ -861,62 +931,180 @@ void MemorySafeAudioGraph::clear() {
     requestShutdown();
 
     // Wait for processing to complete
-    while (isGraphProcessing_.load()) {
+    while (activeProcessingCount_.load() > 0) {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 
-    std::unique_lock<std::shared_mutex> nodesLock(nodesMutex_);
-    std::unique_lock<std::shared_mutex> connectionsLock(connectionsMutex_);
+    NodeMap removedNodes;
+    {
+        std::unique_lock<std::shared_mutex> nodesLock(nodesMutex_);
+        std::unique_lock<std::shared_mutex> connectionsLock(connectionsMutex_);
+
+        // Clear all containers; nodes stay alive until the plan is replaced
+        removedNodes.swap(nodes_);
+        insertionOrder_.clear();
+        connections_.clear();
+    }
+
+    // A late processAudio call may have passed the shutdown check; make sure
+    // it has left the old plan before the nodes go away
+    synchronizeWithAudioThread(rebuildExecutionPlan());
 
     // Shutdown all nodes safely
-    for (auto& [nodeId, node] : nodes_) {
+    for (auto& [nodeId, node] : removedNodes) {
         if (node) {
             node->shutdown();
         }
     }
 
-    // Clear all containers (RAII handles cleanup)
-    nodes_.clear();
-    connections_.clear();
-    processingOrder_.clear();
-
     juce::Logger::writeToLog("Audio graph cleared");
 }
 
-void MemorySafeAudioGraph::updateProcessingOrder() {
-    std::unique_lock<std::mutex> lock(processingOrderMutex_);
+std::unique_ptr<MemorySafeAudioGraph::ExecutionPlan> MemorySafeAudioGraph::compileExecutionPlan() const {
+    auto plan = std::make_unique<ExecutionPlan>();
 
-    processingOrder_.clear();
+    std::shared_lock<std::shared_mutex> nodesLock(nodesMutex_);
+    std::shared_lock<std::shared_mutex> connectionsLock(connectionsMutex_);
 
-    // Get all node IDs
-    auto nodeIds = getNodeIds();
+    // Index nodes by insertion order
+    std::vector<MemorySafeAudioNode*> nodes;
+    std::unordered_map<std::string, int> indexOf;
+    nodes.reserve(insertionOrder_.size());
+    indexOf.reserve(insertionOrder_.size());
+
+    for (const auto& nodeId : insertionOrder_) {
+        auto it = nodes_.find(nodeId);
+        if (it != nodes_.end() && it->second) {
+            indexOf.emplace(nodeId, static_cast<int>(nodes.size()));
+            nodes.push_back(it->second.get());
+        }
+    }
 
-    // Simple topological sort
-    // For now, just use the order they were added
-    // A real implementation would do proper dependency resolution
-    processingOrder_ = nodeIds;
+    const int numNodes = static_cast<int>(nodes.size());
+    std::vector<int> sourceOf(numNodes, -1);
+    std::vector<int> pendingInputs(numNodes, 0);
+    std::vector<std::vector<int>> dependents(numNodes);
 
-    processingOrderDirty_ = false;
+    for (const auto& [destinationId, weakSource] : connections_) {
+        auto source = weakSource.lock();
+        if (!source) {
+            continue;
+        }
+
+        auto destIt = indexOf.find(destinationId);
+        auto sourceIt = indexOf.find(source->getId());
+        if (destIt == indexOf.end() || sourceIt == indexOf.end()) {
+            continue;
+        }
+
+        sourceOf[destIt->second] = sourceIt->second;
+        dependents[sourceIt->second].push_back(destIt->second);
+        ++pendingInputs[destIt->second];
+    }
+
+    // Kahn's algorithm; ties resolved by insertion order
+    std::vector<int> order;
+    order.reserve(numNodes);
+
+    for (int i = 0; i < numNodes; ++i) {
+        if (pendingInputs[i] == 0) {
+            order.push_back(i);
+        }
+    }
+
+    for (size_t head = 0; head < order.size(); ++head) {
+        auto& next = dependents[order[head]];
+        std::sort(next.begin(), next.end());
+
+        for (int dependent : next) {
+            if (--pendingInputs[dependent] == 0) {
+                order.push_back(dependent);
+            }
+        }
+    }
+
+    // Nodes on (or behind) a feedback cycle run last in insertion order and
+    // read their source's output from the previous block
+    for (int i = 0; i < numNodes; ++i) {
+        if (pendingInputs[i] > 0) {
+            order.push_back(i);
+        }
+    }
+
+    std::vector<int> stepOf(numNodes, -1);
+    for (int step = 0; step < numNodes; ++step) {
+        stepOf[order[step]] = step;
+    }
+
+    plan->steps.resize(numNodes);
+    plan->processingOrder.reserve(numNodes);
+
+    for (int step = 0; step < numNodes; ++step) {
+        const int index = order[step];
+        auto& planStep = plan->steps[step];
+
+        planStep.node = nodes[index];
+        planStep.sourceIndex = sourceOf[index] >= 0 ? stepOf[sourceOf[index]] : -1;
+        planStep.writesGraphOutput = dependents[index].empty();
+
+        plan->processingOrder.push_back(nodes[index]->getId());
+    }
+
+    return plan;
 }
 
-std::vector<std::string> MemorySafeAudioGraph::getProcessingOrderSnapshot() const {
-    std::shared_lock<std::mutex> lock(processingOrderMutex_);
+uint64_t MemorySafeAudioGraph::rebuildExecutionPlan() {
+    std::lock_guard<std::mutex> lock(planMutex_);
+    return publishExecutionPlan(compileExecutionPlan());
+}
+
+uint64_t MemorySafeAudioGraph::publishExecutionPlan(std::unique_ptr<ExecutionPlan> plan) {
+    ExecutionPlan* previous = activePlan_.exchange(plan.release());
+    const uint64_t epoch = globalEpoch_.fetch_add(1) + 1;
 
-    if (processingOrderDirty_) {
-        // Need to update processing order
-        lock.unlock();
-        const_cast<MemorySafeAudioGraph*>(this)->updateProcessingOrder();
-        lock.lock();
+    if (previous != nullptr) {
+        previous->retiredAtEpoch = epoch;
+        retiredPlans_.emplace_back(previous);
     }
 
-    return processingOrder_;
+    reclaimRetiredPlans();
+    return epoch;
 }
 
-bool MemorySafeAudioGraph::validateNodeForProcessing(const std::string& nodeId) {
-    auto weakNode = getNode(nodeId);
-    auto node = weakNode.lock();
+bool MemorySafeAudioGraph::hasAudioThreadPassedEpoch(uint64_t epoch) const noexcept {
+    for (const auto& slot : processorEpochs_) {
+        const uint64_t readerEpoch = slot.load();
+        if (readerEpoch != quiescentEpoch && readerEpoch < epoch) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void MemorySafeAudioGraph::synchronizeWithAudioThread(uint64_t epoch) const {
+    while (!hasAudioThreadPassedEpoch(epoch)) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+void MemorySafeAudioGraph::reclaimRetiredPlans() {
+    retiredPlans_.erase(
+        std::remove_if(retiredPlans_.begin(), retiredPlans_.end(),
+            [this](const std::unique_ptr<ExecutionPlan>& retired) {
+                return hasAudioThreadPassedEpoch(retired->retiredAtEpoch);
+            }),
+        retiredPlans_.end());
+}
+
+std::vector<std::string> MemorySafeAudioGraph::getProcessingOrderSnapshot() const {
+    std::lock_guard<std::mutex> lock(planMutex_);
+
+    if (const ExecutionPlan* plan = activePlan_.load()) {
+        return plan->processingOrder;
+    }
 
-    return node && node->isReady();
+    return {};
 }
 
 #ifdef DEBUG
@@ -1046,7 +1234,7 @@ ScopedAudioGraphManager::ScopedAudioGraphManager()
         graph_ = std::make_unique<MemorySafeAudioGraph>();
         initialized_ = true;
     } catch (const std::exception& e) {
-        juce::Logger::writeToLog("ERROR: Failed to create scoped audio graph: " + e.what());
+        juce::Logger::writeToLog("ERROR: Failed to create scoped audio graph: " + std::string(e.what()));
         graph_.reset();
         initialized_ = false;
     }
@@ -1072,7 +1260,7 @@ void ScopedAudioGraphManager::reset() {
         graph_ = std::make_unique<MemorySafeAudioGraph>();
         initialized_ = true;
     } catch (const std::exception& e) {
-        juce::Logger::writeToLog("ERROR: Failed to reset scoped audio graph: " + e.what());
+        juce::Logger::writeToLog("ERROR: Failed to reset scoped audio graph: " + std::string(e.what()));
         graph_.reset();
         initialized_ = false;
     }
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <vector>
+#include <array>
 #include <atomic>
 #include <mutex>
 #include <shared_mutex>
@@ -75,6 +76,11 @@ private:
     std::unique_ptr<juce::AudioBuffer<float>> outputBuffer_;
     std::unique_ptr<juce::AudioBuffer<float>> scratchBuffer_;
 
+    // Channel pointer arrays handed to the process callback, rebuilt whenever
+    // the buffers are reallocated so processing never allocates
+    std::vector<const float*> inputChannelPtrs_;
+    std::vector<float*> outputChannelPtrs_;
+
     // Processing state
     std::atomic<bool> isProcessing_{false};
     std::atomic<uint32_t> processingCount_{0};
@@ -180,6 +186,13 @@ public:
      */
     void setProcessCallback(ProcessCallback callback);
 
+    /**
+     * Output buffer channels from the most recent processAudio call
+     * Used by the graph to feed downstream nodes without copying through
+     * the caller's buffers. Valid until the buffers are resized.
+     */
+    const float* const* getOutputChannelPointers() const noexcept { return outputChannelPtrs_.data(); }
+
     //==============================================================================
     // Memory-safe connection management
 
@@ -323,6 +336,11 @@ private:
      */
     void updateLastAccessTime();
 
+    /**
+     * Rebuild the cached channel pointer arrays after buffer reallocation
+     */
+    void refreshChannelPointers();
+
     /**
      * Process audio with internal buffers
      */
@@ -343,31 +361,66 @@ private:
  * - Atomic state management
  * - Exception-safe operations
  * - Comprehensive error handling
+ *
+ * Graph edits compile an immutable execution plan on the calling thread and
+ * publish it with a single atomic swap. processAudio only walks the current
+ * plan: no locks, string lookups, reference counting or allocation. Replaced
+ * plans (and removed nodes) are released only after every audio thread has
+ * moved past the epoch in which they were swapped out.
  */
 class MemorySafeAudioGraph {
 public:
     using NodePtr = std::unique_ptr<MemorySafeAudioNode>;
-    using NodeMap = std::unordered_map<std::string, NodePtr>;
+    using SharedNodePtr = std::shared_ptr<MemorySafeAudioNode>;
+    using NodeMap = std::unordered_map<std::string, SharedNodePtr>;
     using WeakNodeMap = std::unordered_map<std::string, std::weak_ptr<MemorySafeAudioNode>>;
 
+    /** Maximum number of threads that may run processAudio at the same time */
+    static constexpr int maxConcurrentProcessors = 8;
+
 private:
-    // Node storage with unique ownership
+    /**
+     * Immutable execution plan compiled on the message thread
+     *
+     * Steps are in topological order (connected sources first); each step
+     * refers to its source by index into the same vector, so the audio
+     * thread walks the graph without string lookups or reference counting.
+     * Nodes referenced here are kept alive by the graph until every audio
+     * thread has left the epoch in which the plan was replaced.
+     */
+    struct ExecutionPlan {
+        struct Step {
+            MemorySafeAudioNode* node = nullptr;
+            int sourceIndex = -1;       // Step feeding this node, -1 = graph input
+            bool writesGraphOutput = true;
+        };
+
+        std::vector<Step> steps;
+        std::vector<std::string> processingOrder;
+        uint64_t retiredAtEpoch = 0;
+    };
+
+    static constexpr uint64_t quiescentEpoch = ~uint64_t{0};
+
+    // Node storage; shared ownership so getNode can hand out weak references
     NodeMap nodes_;
+    std::vector<std::string> insertionOrder_;
     mutable std::shared_mutex nodesMutex_;
 
     // Processing state
-    std::atomic<bool> isGraphProcessing_{false};
     std::atomic<uint32_t> activeProcessingCount_{0};
     std::atomic<bool> shutdownRequested_{false};
 
-    // Graph structure with safe references
+    // Graph structure with safe references (destination -> source)
     WeakNodeMap connections_;
     mutable std::shared_mutex connectionsMutex_;
 
-    // Processing order and optimization
-    std::vector<std::string> processingOrder_;
-    mutable std::mutex processingOrderMutex_;
-    bool processingOrderDirty_{true};
+    // Published plan and epoch-based reclamation of replaced plans
+    std::atomic<ExecutionPlan*> activePlan_{nullptr};
+    std::atomic<uint64_t> globalEpoch_{1};
+    std::array<std::atomic<uint64_t>, maxConcurrentProcessors> processorEpochs_;
+    std::vector<std::unique_ptr<ExecutionPlan>> retiredPlans_;
+    mutable std::mutex planMutex_;
 
     // Statistics and monitoring
     std::atomic<uint64_t> totalProcessCalls_{0};
@@ -430,7 +483,7 @@ public:
     /**
      * Get a weak reference to a node (safe for external access)
      */
-    std::weak_ptr<MemorySafeAudioNode> getNode(const std::string& nodeId);
+    std::weak_ptr<MemorySafeAudioNode> getNode(const std::string& nodeId) const;
 
     /**
      * Check if node exists in graph
@@ -452,7 +505,9 @@ public:
 
     /**
      * Process the entire audio graph safely
-     * Handles node removal and state changes atomically
+     * Handles node removal and state changes atomically. Nodes with a
+     * connected source read that node's output; unconnected nodes read the
+     * graph input, and nodes without downstream connections write the output.
      *
      * @param inputAudio Input audio buffers
      * @param numInputChannels Number of input channels
@@ -470,7 +525,7 @@ public:
     /**
      * Check if graph is currently processing
      */
-    bool isProcessing() const noexcept { return isGraphProcessing_.load(); }
+    bool isProcessing() const noexcept { return activeProcessingCount_.load() > 0; }
 
     /**
      * Request graph shutdown
@@ -576,19 +631,41 @@ private:
     // Memory-safe internal operations
 
     /**
-     * Update processing order based on connections
+     * Compile the current nodes and connections into a new execution plan
+     * Takes the node and connection locks; never call with either held.
      */
-    void updateProcessingOrder();
+    std::unique_ptr<ExecutionPlan> compileExecutionPlan() const;
 
     /**
-     * Get processing order snapshot
+     * Compile and publish a new plan
+     * @return Epoch after which the previous plan is no longer referenced
      */
-    std::vector<std::string> getProcessingOrderSnapshot() const;
+    uint64_t rebuildExecutionPlan();
+
+    /**
+     * Swap in a new plan and retire the old one (planMutex_ must be held)
+     */
+    uint64_t publishExecutionPlan(std::unique_ptr<ExecutionPlan> plan);
 
     /**
-     * Validate node before processing
+     * True once no audio thread is still inside an epoch before the given one
      */
-    bool validateNodeForProcessing(const std::string& nodeId);
+    bool hasAudioThreadPassedEpoch(uint64_t epoch) const noexcept;
+
+    /**
+     * Block until every audio thread has left epochs before the given one
+     */
+    void synchronizeWithAudioThread(uint64_t epoch) const;
+
+    /**
+     * Free retired plans no audio thread can still see (planMutex_ must be held)
+     */
+    void reclaimRetiredPlans();
+
+    /**
+     * Get processing order snapshot
+     */
+    std::vector<std::string> getProcessingOrderSnapshot() const;
 
     /**
      * Cleanup disconnected nodes safely
@@ -1,21 +1,48 @@
 #pragma once
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <memory>
 #include "BaseAnalyzer.h"
 
 /**
- * Core DSP Analysis component for real-time spectral analysis
- * Provides FFT-based spectral analysis with comprehensive descriptors
- * Optimized for real-time audio processing applications
+ * Core DSP Analysis component for spectral analysis
+ * Streams audio of any length through an overlapped STFT at one or more
+ * frame sizes, emitting per-frame descriptors and keeping running
+ * aggregates. Windowing and magnitude computation are vectorised and the
+ * band-to-bin maps are precomputed per resolution.
  */
 class CoreDSPAnalyzer : public BaseAnalyzer {
 public:
+    static constexpr int kNumBands = 10;
+
+    // Spectral descriptors of one STFT frame
+    struct FrameDescriptors {
+        double time = 0.0;              // Frame centre in seconds since the first sample
+        float spectralCentroid = 0.0f;
+        float spectralFlux = 0.0f;
+        float spectralFlatness = 0.0f;
+        float spectralRolloff = 0.0f;
+        std::array<float, kNumBands> bandEnergies{};
+    };
+
+    // Mean and peak of every descriptor over all frames analysed so far
+    struct AggregateDescriptors {
+        int64_t numFrames = 0;
+        FrameDescriptors mean;
+        FrameDescriptors peak;
+    };
+
+    // Called for every frame, with the index of the resolution it came from
+    using FrameCallback = std::function<void(int resolution, const FrameDescriptors& frame)>;
+
     CoreDSPAnalyzer();
     ~CoreDSPAnalyzer() override;
 
-    // BaseAnalyzer interface implementation
+    // BaseAnalyzer interface implementation (one resolution, frame = bufferSize, 50% overlap)
     bool initialize(double sampleRate, int bufferSize) override;
     void processBlock(juce::AudioBuffer<float>& buffer) override;
     juce::String getResultsAsJson() const override;
@@ -23,35 +50,73 @@ public:
     void reset() override;
     juce::String getAnalysisType() const override;
 
+    /**
+     * Initialize with several STFT resolutions analysed side by side
+     * @param frameSizes Power-of-two frame sizes; the first is the primary one
+     * @param overlap Frames per frame length (hop = frameSize / overlap)
+     */
+    bool initialize(double sampleRate, const std::vector<int>& frameSizes, int overlap = 2);
+
+    /** Stream planar audio (mixed to mono); any number of samples per call */
+    void process(const float* const* channels, int numChannels, int numSamples);
+
+    void setFrameCallback(FrameCallback callback) { frameCallback = std::move(callback); }
+
+    int getNumResolutions() const { return static_cast<int>(resolutions.size()); }
+    int getFrameSize(int resolution) const { return resolutions[static_cast<size_t>(resolution)].frameSize; }
+    int getHopSize(int resolution) const { return resolutions[static_cast<size_t>(resolution)].hopSize; }
+    const FrameDescriptors& getLatestFrame(int resolution = 0) const { return resolutions[static_cast<size_t>(resolution)].latest; }
+    const AggregateDescriptors& getAggregate(int resolution = 0) const { return resolutions[static_cast<size_t>(resolution)].aggregate; }
+
+    /**
+     * Analyse audio files, one analyzer per file, spread over numThreads
+     * worker threads. Returns each file's getResultsAsJson(), or an empty
+     * string where the file could not be read.
+     */
+    static juce::StringArray analyzeFiles(const juce::Array<juce::File>& files,
+                                          const std::vector<int>& frameSizes,
+                                          int numThreads);
+
 private:
-    // Spectral analysis results structure
-    struct SpectralResults {
-        float spectralCentroid = 0.0f;
-        float spectralFlux = 0.0f;
-        float spectralFlatness = 0.0f;
-        float spectralRolloff = 0.0f;
-        std::vector<float> bandEnergies;
+    // One STFT resolution with its own FFT, window and band map
+    struct Resolution {
+        int frameSize = 0;
+        int hopSize = 0;
+        int numBins = 0;
+        int samplesUntilFrame = 0;
+        bool hasPreviousFrame = false;
+
+        std::unique_ptr<juce::dsp::FFT> fft;
+        std::vector<float> window;
+        std::vector<float> fftData;
+        std::vector<float> power;
+        std::vector<float> magnitude;
+        std::vector<float> previousMagnitude;
+        std::array<int, kNumBands + 1> bandEdges{};
+
+        FrameDescriptors latest;
+        AggregateDescriptors aggregate;
+        std::array<double, 4 + kNumBands> sums{};   // Running sums behind aggregate.mean
     };
 
     // Core processing methods
-    void calculateSpectralDescriptors();
-    void generateWindowFunction();
-
-    // JUCE DSP components
-    std::unique_ptr<juce::dsp::FFT> fft;
+    void analyzeFrame(Resolution& resolution);
+    void calculateSpectralDescriptors(Resolution& resolution);
+    void accumulate(Resolution& resolution);
 
     // Processing buffers and state
     double sampleRate = 44100.0;
     int bufferSize = 512;
-    int fftOrder = 10; // For 512 samples
+    int numInputChannels = 0;
     bool initialized = false;
 
-    std::vector<float> fftData;
-    std::vector<float> magnitudeSpectrum;
-    std::vector<float> windowFunction;
-    std::vector<float> frequencyBins;
-    std::vector<float> previousMagnitudeSpectrum;
+    std::vector<Resolution> resolutions;
+
+    // Mono input history, long enough for the largest frame
+    std::vector<float> history;
+    int historyMask = 0;
+    int historyWrite = 0;
+    int64_t samplesProcessed = 0;
 
-    // Latest analysis results
-    SpectralResults lastResults;
-};
\ No newline at end of file
+    FrameCallback frameCallback;
+};
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "PolyphaseResampler.h"
+#include <array>
 #include <memory>
 #include <atomic>
 #include <vector>
@@ -100,6 +102,7 @@ public:
         bool enableAutoRecovery = true;        // Enable automatic recovery
         double dropoutThreshold = 0.95;        // Dropout detection threshold
         int glitchDetectionWindow = 10;        // Window for glitch detection (samples)
+        PolyphaseResampler::Quality resamplerQuality = PolyphaseResampler::Quality::High; // SRC quality vs latency
     };
 
     //==============================================================================
@@ -146,11 +149,27 @@ public:
 
     //==============================================================================
     // Sample rate conversion and compatibility
+
+    /**
+     * Safe to call while audio runs: the new converter is prepared here and
+     * swapped in for the next processSampleRateConversion call.
+     */
     bool enableSampleRateConversion(double inputRate, double outputRate);
     bool isSampleRateConversionEnabled() const;
     double getInputSampleRate() const;
     double getOutputSampleRate() const;
-    void processSampleRateConversion(const float* input, float* output, int numSamples);
+    int getSampleRateConversionLatency() const; // In input samples
+
+    /**
+     * Resample one block on the audio thread. Output lags input by the
+     * converter latency, so the count varies slightly from block to block;
+     * output must hold numSamples * outputRate / inputRate + 2 samples.
+     * @return Number of samples written to output
+     */
+    int processSampleRateConversion(const float* input, float* output, int numSamples);
+
+    /** Write messages queued by the audio thread to juce::Logger (call off the audio thread) */
+    void flushDeferredLog();
 
     //==============================================================================
     // Dropout event management
@@ -220,6 +239,28 @@ public:
 
 private:
     //==============================================================================
+    // Fixed-capacity history, oldest entry first; push overwrites the oldest when full
+    template <typename T, size_t Capacity>
+    struct HistoryRing
+    {
+        void push(const T& value) noexcept
+        {
+            items[head] = value;
+            head = (head + 1) % Capacity;
+            if (count < Capacity)
+                ++count;
+        }
+
+        const T& operator[](size_t index) const noexcept { return items[(head + Capacity - count + index) % Capacity]; }
+        size_t size() const noexcept { return count; }
+        bool empty() const noexcept { return count == 0; }
+        void clear() noexcept { head = count = 0; }
+
+        std::array<T, Capacity> items{};
+        size_t head = 0;
+        size_t count = 0;
+    };
+
     // Internal buffer management
     struct BufferState
     {
@@ -229,9 +270,9 @@ private:
         std::atomic<int> targetSize{512};
         std::atomic<uint64_t> underruns{0};
         std::atomic<uint64_t> overruns{0};
-        std::vector<double> levelHistory;
-        std::vector<std::chrono::steady_clock::time_point> timestamps;
-        size_t maxHistorySize = 1000;
+        static constexpr size_t maxHistorySize = 1000;
+        HistoryRing<double, maxHistorySize> levelHistory;
+        HistoryRing<std::chrono::steady_clock::time_point, maxHistorySize> timestamps;
     };
 
     //==============================================================================
@@ -252,7 +293,9 @@ private:
     // Sample rate conversion
     bool initializeSampleRateConverter();
     void cleanupSampleRateConverter();
-    void performSRC(const float* input, float* output, int numSamples);
+    void publishSampleRateConverter(std::unique_ptr<PolyphaseResampler> resampler);
+    void releaseRetiredResamplers();
+    int performSRC(PolyphaseResampler* resampler, const float* input, float* output, int numSamples);
 
     // Thread management
     bool setThreadPriority();
@@ -276,12 +319,40 @@ private:
     std::atomic<DropoutLevel> lastDropoutLevel_{DropoutLevel::None};
     mutable std::mutex dropoutHistoryMutex_;
 
-    // Sample rate conversion
-    std::atomic<bool> srcEnabled_{false};
+    // Sample rate conversion: converters are prepared off the audio thread and
+    // published by pointer swap; a replaced one is freed once the audio thread
+    // has acknowledged the swap, or no call is in flight
+    struct RetiredResampler
+    {
+        uint64_t version = 0;
+        std::unique_ptr<PolyphaseResampler> resampler;
+    };
+
     std::atomic<double> inputSampleRate_{44100.0};
     std::atomic<double> outputSampleRate_{44100.0};
-    std::unique_ptr<juce::AudioBuffer<float>> srcBuffer_;
-    std::unique_ptr<juce::LagrangeInterpolator> srcInterpolator_;
+    std::unique_ptr<PolyphaseResampler> srcResampler_;          // Published converter, owned by the control side
+    std::vector<RetiredResampler> retiredResamplers_;
+    uint64_t nextResamplerVersion_ = 1;
+    mutable std::mutex srcMutex_;                               // Control side only, never taken on the audio thread
+
+    std::atomic<PolyphaseResampler*> activeResampler_{nullptr}; // What the audio thread runs; null when SRC is off
+    std::atomic<uint64_t> publishedResamplerVersion_{0};
+    std::atomic<uint64_t> acknowledgedResamplerVersion_{0};
+    std::atomic<bool> srcCallActive_{false};
+
+    // Audio-thread diagnostics, formatted and logged later by flushDeferredLog()
+    struct DeferredLogEntry
+    {
+        const char* message = nullptr;         // String literal
+        double value = 0.0;
+    };
+
+    static constexpr int deferredLogCapacity = 64;
+    juce::AbstractFifo deferredLog_{deferredLogCapacity};
+    std::array<DeferredLogEntry, deferredLogCapacity> deferredLogEntries_;
+    std::atomic<uint64_t> droppedLogEntries_{0};
+
+    void logDeferred(const char* message, double value) noexcept;
 
     // Thread management
     std::atomic<ThreadPriority> currentPriority_{ThreadPriority::Normal};
@@ -297,10 +368,11 @@ private:
     // Prediction model
     struct PredictionModel
     {
-        std::vector<double> bufferLevels;
-        std::vector<double> cpuUsages;
-        std::vector<double> times;
-        std::vector<bool> dropoutOccurred;
+        static constexpr size_t maxSize = 1000;
+        HistoryRing<double, maxSize> bufferLevels;
+        HistoryRing<double, maxSize> cpuUsages;
+        HistoryRing<double, maxSize> times;
+        HistoryRing<bool, maxSize> dropoutOccurred;
         double threshold = 0.3;
         double timeWindow = 5.0; // seconds
     };
@@ -1,8 +1,10 @@
 #pragma once
+#include <memory>
 #include <utility>
 #include <vector>
 #include <juce_core/juce_core.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
 #include "BaseAnalyzer.h"
 
 /**
@@ -75,9 +77,12 @@ private:
     double calculateSignalQuality(const float* buffer, int size) const;
 
     // Enhanced pitch detection methods
-    std::pair<double, double> enhancedAutocorrelation(const float* buffer, int bufferSize) const;
+    std::pair<double, double> enhancedAutocorrelation(const float* buffer, int bufferSize);
     std::pair<double, double> zeroCrossingPitchDetection(const float* buffer, int bufferSize) const;
-    std::pair<double, double> amdfPitchDetection(const float* buffer, int bufferSize) const;
+    std::pair<double, double> amdfPitchDetection(const float* buffer, int bufferSize);
+
+    // Grow analysis buffers for blocks longer than the prepared size
+    void ensureAnalysisCapacity(int numSamples);
 
     // Configuration parameters
     double sampleRate = 44100.0;
@@ -96,6 +101,15 @@ private:
     juce::HeapBlock<float> windowBuffer;
     int maxLag = 0;
 
+    // Preallocated analysis buffers (sized in initialize, grown only for longer blocks)
+    juce::HeapBlock<float> monoBuffer;
+    int analysisCapacity = 0;
+
+    // FFT autocorrelation: size >= block + maxLag so the circular result has no wrap
+    std::unique_ptr<juce::dsp::FFT> autocorrelationFft;
+    juce::HeapBlock<float> fftBuffer;
+    juce::HeapBlock<double> autocorrBuffer;
+
     // Performance tracking
     double lastProcessingTime = 0.0;
 };
\ No newline at end of file
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+#elif defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+#endif
+
+namespace SchillingerEcosystem {
+namespace Audio {
+
+/**
+ * Streaming band-limited resampler for device sample-rate mismatches.
+ *
+ * A Kaiser-windowed sinc is tabulated at kNumPhases fractional offsets when
+ * the converter is prepared; each output sample is a dot product of the
+ * input neighbourhood with the two nearest phases, blended linearly. When
+ * downsampling, the kernel is widened so its cutoff tracks the output
+ * Nyquist frequency.
+ *
+ * prepare() allocates; reset() and process() do not, and take a bounded
+ * amount of work per call, so they are safe on the audio thread.
+ */
+class PolyphaseResampler
+{
+public:
+    // Quality / latency trade-off: longer kernels alias less but add delay
+    enum class Quality
+    {
+        Low,      // 16 taps, ~55 dB stopband, 8 samples latency
+        Medium,   // 32 taps, ~75 dB stopband, 16 samples latency
+        High      // 64 taps, ~95 dB stopband, 32 samples latency
+    };
+
+    static constexpr int kNumPhases = 256;
+    static constexpr double kMaxRatio = 8.0;   // Largest supported out/in (or in/out) rate ratio
+
+    PolyphaseResampler() = default;
+
+    /**
+     * Design the filter bank and allocate the input history.
+     * @param maxInputSamples Largest number of input samples per process() call
+     * @return false if a rate is not positive or the ratio is out of range
+     */
+    bool prepare(double inputRate, double outputRate, int maxInputSamples, Quality newQuality = Quality::High)
+    {
+        if (inputRate <= 0.0 || outputRate <= 0.0 || maxInputSamples <= 0)
+            return false;
+
+        const double ratio = outputRate / inputRate;
+        if (ratio > kMaxRatio || ratio < 1.0 / kMaxRatio)
+            return false;
+
+        quality = newQuality;
+        step = inputRate / outputRate;
+        stepWhole = static_cast<int>(step);
+        stepFraction = step - stepWhole;
+
+        // Widen the kernel when downsampling so the cutoff follows the output rate
+        const double bandwidth = std::min(1.0, ratio);
+        numTaps = roundUpToLanes(static_cast<int>(std::ceil(getBaseTaps(quality) / bandwidth)));
+        halfTaps = numTaps / 2;
+
+        const double cutoff = 0.5 * getPassband(quality) * bandwidth;   // Cycles per input sample
+        const double beta = getKaiserBeta(quality);
+        const double windowNorm = 1.0 / besselI0(beta);
+
+        // One extra phase so phase p + 1 always exists for the blend
+        phases.assign(static_cast<size_t>((kNumPhases + 1) * numTaps), 0.0f);
+        for (int p = 0; p <= kNumPhases; ++p)
+        {
+            const double fraction = static_cast<double>(p) / kNumPhases;
+            float* row = phases.data() + p * numTaps;
+            double sum = 0.0;
+
+            for (int k = 0; k < numTaps; ++k)
+            {
+                // Distance from the output instant to input sample (n - halfTaps + 1 + k)
+                const double distance = fraction + (halfTaps - 1 - k);
+                const double x = distance / halfTaps;
+                const double window = std::abs(x) < 1.0 ? besselI0(beta * std::sqrt(1.0 - x * x)) * windowNorm : 0.0;
+                const double value = 2.0 * cutoff * sinc(2.0 * cutoff * distance) * window;
+                row[k] = static_cast<float>(value);
+                sum += value;
+            }
+
+            // Unity gain at DC for every phase
+            if (sum != 0.0)
+                for (int k = 0; k < numTaps; ++k)
+                    row[k] = static_cast<float>(row[k] / sum);
+        }
+
+        history.assign(static_cast<size_t>(numTaps + maxInputSamples), 0.0f);
+        prepared = true;
+        reset();
+        return true;
+    }
+
+    /** Clear the input history; the next output lines up with the next input sample */
+    void reset() noexcept
+    {
+        if (!prepared)
+            return;
+
+        std::fill(history.begin(), history.end(), 0.0f);
+        buffered = halfTaps - 1;
+        readIndex = halfTaps - 1;
+        fraction = 0.0;
+    }
+
+    /**
+     * Resample one block. Output lags input by getLatencyInputSamples(), so
+     * the number of samples produced varies from call to call.
+     * @param maxOutputSamples Capacity of output; getMaxOutputSamples(numInputSamples) always suffices
+     * @return Number of output samples written
+     */
+    int process(const float* input, int numInputSamples, float* output, int maxOutputSamples) noexcept
+    {
+        if (!prepared)
+            return 0;
+
+        int produced = 0;
+        while (numInputSamples > 0)
+        {
+            const int chunk = std::min(numInputSamples, static_cast<int>(history.size()) - buffered);
+            if (chunk <= 0)
+                break;   // Output was too small to drain the history; drop the rest
+
+            std::memcpy(history.data() + buffered, input, sizeof(float) * static_cast<size_t>(chunk));
+            buffered += chunk;
+            input += chunk;
+            numInputSamples -= chunk;
+
+            produced += render(output + produced, maxOutputSamples - produced);
+        }
+
+        return produced;
+    }
+
+    /** Upper bound on the samples one process() call can produce */
+    int getMaxOutputSamples(int numInputSamples) const noexcept
+    {
+        return static_cast<int>(std::ceil(numInputSamples / step)) + 1;
+    }
+
+    /** Delay before an input sample affects the output, in input samples */
+    int getLatencyInputSamples() const noexcept { return halfTaps; }
+
+    int getNumTaps() const noexcept { return numTaps; }
+    Quality getQuality() const noexcept { return quality; }
+    bool isPrepared() const noexcept { return prepared; }
+
+private:
+    //==============================================================================
+    // Four taps at a time; the scalar struct keeps other targets building
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    struct Lanes
+    {
+        using Vec = float32x4_t;
+        static Vec zero() { return vdupq_n_f32(0.0f); }
+        static Vec load(const float* p) { return vld1q_f32(p); }
+        static Vec mulAdd(Vec acc, Vec x, Vec y) { return vmlaq_f32(acc, x, y); }
+        static float sum(Vec v)
+        {
+            const float32x2_t pairs = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+            return vget_lane_f32(vpadd_f32(pairs, pairs), 0);
+        }
+    };
+#elif defined(__SSE__) || defined(_M_X64)
+    struct Lanes
+    {
+        using Vec = __m128;
+        static Vec zero() { return _mm_setzero_ps(); }
+        static Vec load(const float* p) { return _mm_loadu_ps(p); }
+        static Vec mulAdd(Vec acc, Vec x, Vec y) { return _mm_add_ps(acc, _mm_mul_ps(x, y)); }
+        static float sum(Vec v)
+        {
+            const Vec pairs = _mm_add_ps(v, _mm_movehl_ps(v, v));
+            return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+    };
+#else
+    struct Lanes
+    {
+        struct Vec { float v[4]; };
+        static Vec zero() { return { { 0.0f, 0.0f, 0.0f, 0.0f } }; }
+        static Vec load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+        static Vec mulAdd(Vec acc, Vec x, Vec y)
+        {
+            for (int i = 0; i < 4; ++i)
+                acc.v[i] += x.v[i] * y.v[i];
+            return acc;
+        }
+        static float sum(Vec v) { return (v.v[0] + v.v[1]) + (v.v[2] + v.v[3]); }
+    };
+#endif
+
+    // Produce every output whose kernel is fully inside the history, then discard consumed input
+    int render(float* output, int maxOutputSamples) noexcept
+    {
+        int produced = 0;
+        while (produced < maxOutputSamples)
+        {
+            const int n = readIndex;
+            if (n + halfTaps >= buffered)
+                break;
+
+            const double phase = fraction * kNumPhases;
+            const int p = static_cast<int>(phase);
+            const float blend = static_cast<float>(phase - p);
+
+            const float* x = history.data() + (n - halfTaps + 1);
+            const float* h0 = phases.data() + p * numTaps;
+            const float* h1 = h0 + numTaps;
+
+            Lanes::Vec acc0 = Lanes::zero();
+            Lanes::Vec acc1 = Lanes::zero();
+            for (int k = 0; k < numTaps; k += 4)
+            {
+                const auto samples = Lanes::load(x + k);
+                acc0 = Lanes::mulAdd(acc0, samples, Lanes::load(h0 + k));
+                acc1 = Lanes::mulAdd(acc1, samples, Lanes::load(h1 + k));
+            }
+
+            const float y0 = Lanes::sum(acc0);
+            output[produced++] = y0 + blend * (Lanes::sum(acc1) - y0);
+
+            // Whole and fractional parts advance separately, so rounding never
+            // depends on where the history was last shifted
+            readIndex += stepWhole;
+            fraction += stepFraction;
+            if (fraction >= 1.0)
+            {
+                fraction -= 1.0;
+                ++readIndex;
+            }
+        }
+
+        // Keep the halfTaps - 1 samples before the next output instant
+        const int consumed = std::min(readIndex - (halfTaps - 1), buffered);
+        if (consumed > 0)
+        {
+            std::memmove(history.data(), history.data() + consumed, sizeof(float) * static_cast<size_t>(buffered - consumed));
+            buffered -= consumed;
+            readIndex -= consumed;
+        }
+
+        return produced;
+    }
+
+    static int getBaseTaps(Quality q) { return q == Quality::Low ? 16 : (q == Quality::Medium ? 32 : 64); }
+    static double getKaiserBeta(Quality q) { return q == Quality::Low ? 5.0 : (q == Quality::Medium ? 7.0 : 9.0); }
+    static double getPassband(Quality q) { return q == Quality::Low ? 0.80 : (q == Quality::Medium ? 0.90 : 0.95); }
+    static int roundUpToLanes(int taps) { return (taps + 7) & ~7; }   // Even halves of whole vectors
+
+    static double sinc(double x)
+    {
+        if (std::abs(x) < 1.0e-12)
+            return 1.0;
+        const double px = 3.14159265358979323846 * x;
+        return std::sin(px) / px;
+    }
+
+    // Zeroth-order modified Bessel function of the first kind (power series)
+    static double besselI0(double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+        const double halfSquared = 0.25 * x * x;
+        for (int k = 1; k < 50 && term > 1.0e-12 * sum; ++k)
+        {
+            term *= halfSquared / (static_cast<double>(k) * k);
+            sum += term;
+        }
+        return sum;
+    }
+
+    //==============================================================================
+    Quality quality = Quality::High;
+    bool prepared = false;
+
+    double step = 1.0;          // Input samples per output sample
+    int stepWhole = 1;
+    double stepFraction = 0.0;
+    int numTaps = 0;
+    int halfTaps = 0;
+
+    std::vector<float> phases;  // (kNumPhases + 1) rows of numTaps coefficients
+    std::vector<float> history; // Unconsumed input, oldest first
+    int buffered = 0;
+    int readIndex = 0;          // History sample at or before the next output instant
+    double fraction = 0.0;      // Offset of the next output instant past readIndex, [0, 1)
+};
+
+} // namespace Audio
+} // namespace SchillingerEcosystem
@@ -0,0 +1,106 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <juce_core/juce_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+
+/**
+ * Per-channel pitch estimate produced by YinPitchTracker
+ */
+struct PitchTrackerFrame {
+    double frequency = 0.0;        // Detected fundamental in Hz (0 if unpitched)
+    double confidence = 0.0;       // 1 - CMNDF minimum (0.0 to 1.0)
+    bool isPitched = false;        // Whether a clear period was found
+    int midiNote = -1;             // Nearest MIDI note (-1 if unpitched)
+    double centsError = 0.0;       // Deviation from nearest MIDI note in cents
+    int64_t samplePosition = 0;    // Channel sample index at the end of the analysed window
+};
+
+/**
+ * Per-channel latency and CPU statistics
+ */
+struct PitchTrackerChannelStats {
+    double latencyMs = 0.0;        // Analysis window + hop, worst-case onset-to-estimate delay
+    double lastFrameMicros = 0.0;  // Wall time of the most recent analysis frame
+    double cpuLoad = 0.0;          // Analysis time / audio time (smoothed)
+    int64_t framesAnalysed = 0;
+};
+
+/**
+ * Streaming FFT-based YIN pitch tracker
+ *
+ * Real-time replacement for time-domain autocorrelation pitch detection,
+ * intended for guitar-to-MIDI tracking on every input channel:
+ * - YIN difference function computed via FFT cross-correlation plus a running
+ *   energy sum: O(N log N) per frame instead of O(N * maxLag)
+ * - Cumulative mean normalised difference with absolute threshold and
+ *   parabolic refinement
+ * - Sliding analysis: each channel keeps a ring of the last window, and a new
+ *   estimate is produced every hop samples
+ * - All buffers allocated in prepare(); process() never allocates or locks
+ */
+class YinPitchTracker {
+public:
+    struct Config {
+        double minFrequency = 70.0;    // Below drop-D guitar low string
+        double maxFrequency = 1500.0;  // Above 24th fret high E
+        double threshold = 0.15;       // YIN absolute threshold
+        int hopSize = 256;             // Samples between estimates
+        int windowSize = 0;            // 0 = smallest power of two covering 2 * maxLag
+    };
+
+    YinPitchTracker() = default;
+
+    // Allocate everything; call from a non-real-time thread
+    bool prepare(double sampleRate, int numChannels, const Config& config);
+    bool prepare(double sampleRate, int numChannels) { return prepare(sampleRate, numChannels, Config{}); }
+    void reset();
+    bool isPrepared() const { return prepared; }
+
+    // Real-time safe: feed samples for one channel, analysing every hop
+    void process(int channel, const float* samples, int numSamples);
+
+    // Real-time safe: feed every channel of a buffer
+    void processBlock(const juce::AudioBuffer<float>& buffer);
+
+    PitchTrackerFrame getLatestFrame(int channel) const;
+    PitchTrackerChannelStats getChannelStats(int channel) const;
+
+    int getWindowSize() const { return windowSize; }
+    int getHopSize() const { return config.hopSize; }
+    int getLatencySamples() const { return windowSize + config.hopSize; }
+    int getNumChannels() const { return static_cast<int>(channels.size()); }
+
+private:
+    struct ChannelState {
+        std::vector<float> history;    // Ring of the last windowSize samples
+        int writeIndex = 0;
+        int samplesSinceAnalysis = 0;
+        int64_t samplesSeen = 0;
+        PitchTrackerFrame latest;
+        PitchTrackerChannelStats stats;
+    };
+
+    void analyse(ChannelState& state);
+    double estimatePeriod(const float* frame, double& confidence);
+
+    double sampleRate = 44100.0;
+    Config config;
+    bool prepared = false;
+
+    int windowSize = 0;                // N: analysed samples per frame
+    int integrationSize = 0;           // W = N / 2
+    int minLag = 0;
+    int maxLag = 0;
+
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float> frameBuffer;    // Linearised window
+    std::vector<float> fftWindow;      // 2N: transform of the full frame
+    std::vector<float> fftHead;        // 2N: transform of the zero-padded first W samples
+    std::vector<float> difference;     // d(tau), then d'(tau)
+
+    std::vector<ChannelState> channels;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(YinPitchTracker)
+};
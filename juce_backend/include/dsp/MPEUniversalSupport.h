@@ -24,8 +24,9 @@
 
 #include <juce_core/juce_core.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cstdint>
 #include <vector>
-#include <map>
 #include <memory>
 
 //==============================================================================
@@ -209,7 +210,7 @@ private:
         int valueLSB = 0;
     };
 
-    std::map<int, RPNState> rpnStates;
+    std::array<RPNState, 16> rpnStates;
 
     //==============================================================================
     // RPN numbers for MPE
@@ -235,11 +236,20 @@ private:
 /**
  * MPE Note Tracker
  *
- * Tracks per-note MPE state for all active notes
+ * Tracks per-note MPE state for all active notes.
+ *
+ * Notes live in a fixed array of slots handed out from a free list, so the
+ * tracker never allocates and never moves a note once it is created.
+ * A (channel, note) table finds a note's slot in O(1), and per-channel
+ * lists let pitch bend, pressure and timbre messages touch only the notes
+ * on their own channel. Note-ons beyond kMaxNotes are ignored.
  */
 class MPENoteTracker
 {
 public:
+    static constexpr int kMaxNotes = 128;
+    static constexpr int kNumChannels = 16;
+
     MPENoteTracker();
     ~MPENoteTracker() = default;
 
@@ -253,8 +263,11 @@ public:
     /** Get state for a note */
     const MPENoteState* getNoteState(int noteNumber, int midiChannel) const;
 
-    /** Get all active note states */
-    const std::vector<MPENoteState>& getActiveNotes() const { return activeNotes; }
+    /** Number of active notes */
+    int getNumActiveNotes() const { return numActiveNotes; }
+
+    /** Get active note state by index (0 to getNumActiveNotes() - 1, unordered) */
+    const MPENoteState& getActiveNote(int index) const { return notes[activeSlots[index]]; }
 
     /** Remove a note (when note off) */
     void removeNote(int noteNumber, int midiChannel);
@@ -271,9 +284,36 @@ public:
     void updateSmoothing(double sampleRate, int samplesPerBlock);
 
 private:
-    std::vector<MPENoteState> activeNotes;
+    static constexpr int16_t kNoSlot = -1;
+
+    // Slot storage
+    std::array<MPENoteState, kMaxNotes> notes;
+    std::array<int16_t, kMaxNotes> freeSlots;
+    int numFreeSlots = 0;
+
+    // Dense list of used slots for iteration (swap-removed)
+    std::array<int16_t, kMaxNotes> activeSlots;
+    std::array<int16_t, kMaxNotes> activePosition;
+    int numActiveNotes = 0;
+
+    // Per-channel doubly linked lists of used slots
+    std::array<int16_t, kMaxNotes> nextOnChannel;
+    std::array<int16_t, kMaxNotes> prevOnChannel;
+    std::array<int16_t, kNumChannels> channelHead;
+
+    // (channel - 1, note) -> slot
+    std::array<std::array<int16_t, 128>, kNumChannels> slotLookup;
+
     MPEGestureMapping gestureMapping;
 
+    static bool isValidKey(int noteNumber, int midiChannel)
+    {
+        return noteNumber >= 0 && noteNumber < 128 && midiChannel >= 1 && midiChannel <= kNumChannels;
+    }
+
+    template <typename Function>
+    void forEachNoteOnChannel(int midiChannel, Function&& function);
+
     MPENoteState* findOrCreateNoteState(int noteNumber, int midiChannel);
     MPENoteState* findNoteState(int noteNumber, int midiChannel);
     const MPENoteState* findNoteState(int noteNumber, int midiChannel) const;
@@ -364,7 +404,7 @@ inline void MPEZoneDetector::reset()
     upperZone.lowerChannel = 0;
     upperZone.upperChannel = 0;
 
-    rpnStates.clear();
+    rpnStates.fill(RPNState());
 }
 
 inline void MPEZoneDetector::processMIDI(const juce::MidiMessage& msg)
@@ -373,14 +413,10 @@ inline void MPEZoneDetector::processMIDI(const juce::MidiMessage& msg)
         return;
 
     int channel = msg.getChannel() - 1; // 0-indexed
+    if (channel < 0 || channel >= static_cast<int>(rpnStates.size()))
+        return;
 
-    // Initialize RPN state for this channel if needed
-    if (rpnStates.find(channel) == rpnStates.end())
-    {
-        rpnStates[channel] = RPNState();
-    }
-
-    auto& state = rpnStates[channel];
+    auto& state = rpnStates[static_cast<size_t>(channel)];
 
     // Process CC messages for RPN
     if (msg.isController())
@@ -501,7 +537,19 @@ inline MPENoteTracker::MPENoteTracker()
 
 inline void MPENoteTracker::reset()
 {
-    activeNotes.clear();
+    for (auto& channelSlots : slotLookup)
+        channelSlots.fill(kNoSlot);
+
+    channelHead.fill(kNoSlot);
+    nextOnChannel.fill(kNoSlot);
+    prevOnChannel.fill(kNoSlot);
+
+    // Hand out low slots first
+    numFreeSlots = kMaxNotes;
+    for (int i = 0; i < kMaxNotes; ++i)
+        freeSlots[static_cast<size_t>(i)] = static_cast<int16_t>(kMaxNotes - 1 - i);
+
+    numActiveNotes = 0;
 }
 
 inline void MPENoteTracker::processMIDI(const juce::MidiMessage& msg,
@@ -537,21 +585,44 @@ inline const MPENoteState* MPENoteTracker::getNoteState(int noteNumber,
 
 inline void MPENoteTracker::removeNote(int noteNumber, int midiChannel)
 {
-    auto it = std::remove_if(activeNotes.begin(), activeNotes.end(),
-        [&](const MPENoteState& state) {
-            return state.midiNote == noteNumber && state.midiChannel == midiChannel;
-        });
+    if (!isValidKey(noteNumber, midiChannel))
+        return;
+
+    const int channelIndex = midiChannel - 1;
+    int16_t& lookup = slotLookup[static_cast<size_t>(channelIndex)][static_cast<size_t>(noteNumber)];
+    const int16_t slot = lookup;
+    if (slot == kNoSlot)
+        return;
+
+    lookup = kNoSlot;
+    notes[slot].isActive = false;
+
+    // Unlink from the channel list
+    const int16_t prev = prevOnChannel[slot];
+    const int16_t next = nextOnChannel[slot];
+    if (prev != kNoSlot)
+        nextOnChannel[prev] = next;
+    else
+        channelHead[static_cast<size_t>(channelIndex)] = next;
+    if (next != kNoSlot)
+        prevOnChannel[next] = prev;
 
-    activeNotes.erase(it, activeNotes.end());
+    // Swap-remove from the dense list
+    const int16_t position = activePosition[slot];
+    const int16_t last = activeSlots[static_cast<size_t>(--numActiveNotes)];
+    activeSlots[position] = last;
+    activePosition[last] = position;
+
+    freeSlots[static_cast<size_t>(numFreeSlots++)] = slot;
 }
 
 inline void MPENoteTracker::updateSmoothing(double sampleRate, int samplesPerBlock)
 {
     float smoothingTime = gestureMapping.pressureSmoothing;
-    float timePerSample = 1.0f / static_cast<float>(sampleRate);
 
-    for (auto& note : activeNotes)
+    for (int i = 0; i < numActiveNotes; ++i)
     {
+        auto& note = notes[activeSlots[static_cast<size_t>(i)]];
         note.smoothValues(smoothingTime, sampleRate);
         note.updateGestures(gestureMapping);
     }
@@ -559,50 +630,69 @@ inline void MPENoteTracker::updateSmoothing(double sampleRate, int samplesPerBlo
     juce::ignoreUnused(samplesPerBlock);
 }
 
+template <typename Function>
+inline void MPENoteTracker::forEachNoteOnChannel(int midiChannel, Function&& function)
+{
+    if (midiChannel < 1 || midiChannel > kNumChannels)
+        return;
+
+    for (int16_t slot = channelHead[static_cast<size_t>(midiChannel - 1)]; slot != kNoSlot; slot = nextOnChannel[slot])
+        function(notes[slot]);
+}
+
 inline MPENoteState* MPENoteTracker::findOrCreateNoteState(int noteNumber,
                                                            int midiChannel)
 {
+    if (!isValidKey(noteNumber, midiChannel))
+        return nullptr;
+
     auto* existing = findNoteState(noteNumber, midiChannel);
     if (existing)
         return existing;
 
-    activeNotes.push_back(MPENoteState());
-    auto& note = activeNotes.back();
+    if (numFreeSlots == 0)
+        return nullptr;
 
+    const int channelIndex = midiChannel - 1;
+    const int16_t slot = freeSlots[static_cast<size_t>(--numFreeSlots)];
+    slotLookup[static_cast<size_t>(channelIndex)][static_cast<size_t>(noteNumber)] = slot;
+
+    // Link at the head of the channel list
+    const int16_t head = channelHead[static_cast<size_t>(channelIndex)];
+    prevOnChannel[slot] = kNoSlot;
+    nextOnChannel[slot] = head;
+    if (head != kNoSlot)
+        prevOnChannel[head] = slot;
+    channelHead[static_cast<size_t>(channelIndex)] = slot;
+
+    activePosition[slot] = static_cast<int16_t>(numActiveNotes);
+    activeSlots[static_cast<size_t>(numActiveNotes++)] = slot;
+
+    auto& note = notes[slot];
+    note = MPENoteState();
     note.midiNote = noteNumber;
     note.midiChannel = midiChannel;
-    note.velocity = 0.0f;
-    note.pitchBend = 0.0f;
-    note.pressure = 0.0f;
-    note.timbre = 0.0f;
-    note.smoothedPitchBend = 0.0f;
-    note.smoothedPressure = 0.0f;
-    note.smoothedTimbre = 0.0f;
     note.isActive = true;
-    note.voiceId = -1;
-    note.startTime = 0.0;
 
     return &note;
 }
 
 inline MPENoteState* MPENoteTracker::findNoteState(int noteNumber, int midiChannel)
 {
-    for (auto& note : activeNotes)
-    {
-        if (note.midiNote == noteNumber && note.midiChannel == midiChannel)
-            return &note;
-    }
-    return nullptr;
+    if (!isValidKey(noteNumber, midiChannel))
+        return nullptr;
+
+    const int16_t slot = slotLookup[static_cast<size_t>(midiChannel - 1)][static_cast<size_t>(noteNumber)];
+    return slot != kNoSlot ? &notes[slot] : nullptr;
 }
 
 inline const MPENoteState* MPENoteTracker::findNoteState(int noteNumber, int midiChannel) const
 {
-    for (const auto& note : activeNotes)
-    {
-        if (note.midiNote == noteNumber && note.midiChannel == midiChannel)
-            return &note;
-    }
-    return nullptr;
+    if (!isValidKey(noteNumber, midiChannel))
+        return nullptr;
+
+    const int16_t slot = slotLookup[static_cast<size_t>(midiChannel - 1)][static_cast<size_t>(noteNumber)];
+    return slot != kNoSlot ? &notes[slot] : nullptr;
 }
 
 inline void MPENoteTracker::processNoteOn(const juce::MidiMessage& msg)
@@ -612,6 +702,9 @@ inline void MPENoteTracker::processNoteOn(const juce::MidiMessage& msg)
     float velocity = msg.getVelocity() / 127.0f;
 
     auto* noteState = findOrCreateNoteState(note, channel);
+    if (noteState == nullptr)
+        return; // All slots in use
+
     noteState->velocity = velocity;
     noteState->isActive = true;
 }
@@ -623,33 +716,23 @@ inline void MPENoteTracker::processNoteOff(const juce::MidiMessage& msg)
 
 inline void MPENoteTracker::processPitchBend(const juce::MidiMessage& msg)
 {
-    int channel = msg.getChannel();
     int pitchBendValue = msg.getPitchWheelValue();
     float normalizedPitchBend = (pitchBendValue - 8192) / 8192.0f;
 
     // Update all notes on this channel
-    for (auto& note : activeNotes)
-    {
-        if (note.midiChannel == channel)
-        {
-            note.pitchBend = normalizedPitchBend;
-        }
-    }
+    forEachNoteOnChannel(msg.getChannel(), [normalizedPitchBend](MPENoteState& note) {
+        note.pitchBend = normalizedPitchBend;
+    });
 }
 
 inline void MPENoteTracker::processChannelPressure(const juce::MidiMessage& msg)
 {
-    int channel = msg.getChannel();
     float pressure = msg.getChannelPressureValue() / 127.0f;
 
     // Update all notes on this channel
-    for (auto& note : activeNotes)
-    {
-        if (note.midiChannel == channel)
-        {
-            note.pressure = pressure;
-        }
-    }
+    forEachNoteOnChannel(msg.getChannel(), [pressure](MPENoteState& note) {
+        note.pressure = pressure;
+    });
 }
 
 inline void MPENoteTracker::processController(const juce::MidiMessage& msg)
@@ -657,16 +740,11 @@ inline void MPENoteTracker::processController(const juce::MidiMessage& msg)
     // CC 74 is timbre in MPE spec
     if (msg.getControllerNumber() == 74)
     {
-        int channel = msg.getChannel();
         float timbre = msg.getControllerValue() / 127.0f;
 
-        for (auto& note : activeNotes)
-        {
-            if (note.midiChannel == channel)
-            {
-                note.timbre = timbre;
-            }
-        }
+        forEachNoteOnChannel(msg.getChannel(), [timbre](MPENoteState& note) {
+            note.timbre = timbre;
+        });
     }
 }
 
@@ -18,6 +18,11 @@
    - Scala Files: Load .scl files (4000+ scales available)
    - Custom: User-defined interval ratios
 
+   Real-time use:
+   - Each tuning is compiled once into a 128-note frequency table
+   - MicrotonalTuningManager publishes new tables to the audio thread
+     wait-free, so retuning never blocks note-on or pitch-bend handling
+
   ==============================================================================
 */
 
@@ -28,6 +33,11 @@
 #include <string>
 #include <map>
 #include <cmath>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
 
 //==============================================================================
 /**
@@ -97,6 +107,41 @@ struct MicrotonalTuning
     float ratioToCents(float ratio) const;
 };
 
+//==============================================================================
+/**
+ * Precomputed frequencies for one tuning
+ *
+ * Compiled from MicrotonalTuning::midiToFrequency once per tuning change, so
+ * note-on and pitch-bend lookups need no std::pow or TuningSystem switch.
+ * Fractional pitches interpolate geometrically between neighbouring notes,
+ * which is exact for equal temperaments.
+ */
+struct MicrotonalFrequencyTable
+{
+    static constexpr int numNotes = 128;
+
+    std::array<float, numNotes> frequency {};      // Hz per MIDI note
+    std::array<float, numNotes> log2Frequency {};  // log2(Hz) per MIDI note
+    std::array<float, numNotes> log2Step {};       // log2(f[n + 1] / f[n]), 0 for the top note
+
+    //==============================================================================
+    /** Rebuild from a tuning (allocation-free, but not real-time cheap: 128 evaluations) */
+    void compile(const MicrotonalTuning& tuning);
+
+    /** Frequency for a MIDI note (clamped to 0-127) */
+    float getFrequency(int midiNote) const noexcept;
+
+    /** Frequency for a fractional pitch, e.g. note + per-note pitch bend in scale steps */
+    float getFrequency(float midiPitch) const noexcept;
+
+    /** log2(Hz) for a fractional pitch */
+    float getLog2Frequency(float midiPitch) const noexcept;
+
+private:
+    // 2^x, ~2e-7 relative error (Chebyshev fit of 2^f on [0, 1) plus exponent scaling)
+    static float fastExp2(float x) noexcept;
+};
+
 //==============================================================================
 /**
  * Scala file loader
@@ -197,6 +242,14 @@ public:
     /** Get current tuning */
     const MicrotonalTuning& getTuning() const { return currentTuning; }
 
+    /**
+     * Frequency table for the current tuning (audio thread only)
+     *
+     * Picks up the most recently published table. The reference stays valid
+     * until the next call from the same thread. Wait-free.
+     */
+    const MicrotonalFrequencyTable& getFrequencyTable() noexcept;
+
     //==============================================================================
     // Quick access to common tunings
 
@@ -239,6 +292,19 @@ public:
 private:
     MicrotonalTuning currentTuning;
 
+    //==============================================================================
+    // Table publication: a triple buffer. The writer (setTuning, serialised by
+    // writerLock) and the audio thread each own one slot and trade through
+    // middleSlot, so a retune never waits on, or invalidates, the reader's table.
+    static constexpr uint8_t slotIndexMask = 0x3;
+    static constexpr uint8_t slotFreshBit = 0x4;
+
+    std::array<MicrotonalFrequencyTable, 3> tableSlots;
+    std::atomic<uint8_t> middleSlot { 1 };
+    uint8_t writerSlot = 0;                  // Guarded by writerLock
+    uint8_t readerSlot = 2;                  // Audio thread only
+    std::mutex writerLock;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MicrotonalTuningManager)
 };
@@ -294,6 +360,76 @@ inline float MicrotonalTuning::midiToFrequency(int midiNote) const
     }
 }
 
+//==============================================================================
+// MicrotonalFrequencyTable
+//==============================================================================
+
+inline void MicrotonalFrequencyTable::compile(const MicrotonalTuning& tuning)
+{
+    for (int note = 0; note < numNotes; ++note)
+    {
+        frequency[note] = tuning.midiToFrequency(note);
+        log2Frequency[note] = std::log2(frequency[note]);
+    }
+
+    for (int note = 0; note < numNotes - 1; ++note)
+        log2Step[note] = log2Frequency[note + 1] - log2Frequency[note];
+
+    log2Step[numNotes - 1] = 0.0f;
+}
+
+inline float MicrotonalFrequencyTable::getFrequency(int midiNote) const noexcept
+{
+    return frequency[static_cast<size_t>(juce::jlimit(0, numNotes - 1, midiNote))];
+}
+
+inline float MicrotonalFrequencyTable::getFrequency(float midiPitch) const noexcept
+{
+    if (!(midiPitch > 0.0f))                      // Also catches NaN
+        return frequency[0];
+
+    if (midiPitch >= static_cast<float>(numNotes - 1))
+        return frequency[numNotes - 1];
+
+    const int note = static_cast<int>(midiPitch);
+    const float fraction = midiPitch - static_cast<float>(note);
+
+    if (fraction == 0.0f)
+        return frequency[note];
+
+    return frequency[note] * fastExp2(fraction * log2Step[note]);
+}
+
+inline float MicrotonalFrequencyTable::getLog2Frequency(float midiPitch) const noexcept
+{
+    if (!(midiPitch > 0.0f))
+        return log2Frequency[0];
+
+    if (midiPitch >= static_cast<float>(numNotes - 1))
+        return log2Frequency[numNotes - 1];
+
+    const int note = static_cast<int>(midiPitch);
+    return log2Frequency[note] + (midiPitch - static_cast<float>(note)) * log2Step[note];
+}
+
+inline float MicrotonalFrequencyTable::fastExp2(float x) noexcept
+{
+    const float whole = std::floor(x);
+    const float f = x - whole;
+
+    // p(0) == 1 exactly, so zero-width steps return the note frequency unchanged
+    const float p = 1.0f + f * (0.69315449f + f * (0.240141818f
+                  + f * (0.0558603371f + f * (0.00894959042f + f * 0.00189375406f))));
+
+    // Scale by 2^whole through the exponent bits (normal range only)
+    const int exponent = juce::jlimit(-126, 127, static_cast<int>(whole));
+    const uint32_t bits = static_cast<uint32_t>(exponent + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+
+    return p * scale;
+}
+
 inline juce::String MicrotonalTuning::getName() const
 {
     switch (system)
@@ -357,16 +493,35 @@ inline float MicrotonalTuning::ratioToCents(float ratio) const
 inline MicrotonalTuningManager::MicrotonalTuningManager()
 {
     currentTuning = ScalaFileLoader::get12TET().toMicrotonalTuning();
+
+    for (auto& table : tableSlots)
+        table.compile(currentTuning);
 }
 
 inline void MicrotonalTuningManager::setTuning(const MicrotonalTuning& tuning)
 {
     if (tuning.isValid())
     {
+        std::lock_guard<std::mutex> lock(writerLock);
         currentTuning = tuning;
+
+        // Compile off the audio thread, then hand the slot over in one exchange
+        tableSlots[writerSlot].compile(currentTuning);
+        writerSlot = middleSlot.exchange(static_cast<uint8_t>(writerSlot | slotFreshBit),
+                                         std::memory_order_acq_rel) & slotIndexMask;
     }
 }
 
+inline const MicrotonalFrequencyTable& MicrotonalTuningManager::getFrequencyTable() noexcept
+{
+    if (middleSlot.load(std::memory_order_relaxed) & slotFreshBit)
+    {
+        readerSlot = middleSlot.exchange(readerSlot, std::memory_order_acq_rel) & slotIndexMask;
+    }
+
+    return tableSlots[readerSlot];
+}
+
 inline bool MicrotonalTuningManager::loadScalaFile(const juce::File& scalaFile)
 {
     try
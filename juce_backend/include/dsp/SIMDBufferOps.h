@@ -6,11 +6,14 @@
     Author: Bret Bouchard
 
     SIMD-optimized buffer operations for audio DSP
-    - AVX256 for 8x parallel float processing
-    - SSE4.1 fallback for 4x parallel processing
+    - AVX-512 for 16x parallel float processing
+    - AVX2/FMA and AVX for 8x parallel float processing
+    - SSE2 for 4x parallel processing
     - ARM NEON for 4x parallel float processing (Apple Silicon, iOS, tvOS)
     - Scalar fallback for compatibility
-    - CPU feature detection at runtime
+    - CPU feature detection at runtime: on x86 every tier is compiled into
+      the binary and the widest one the CPU supports is selected once, so a
+      portable baseline build still runs AVX2/AVX-512 code where available
 
   ==============================================================================
 */
@@ -19,22 +22,41 @@
 #define SIMDBUFFEROPS_H_INCLUDED
 
 #include <cstring>
+#include <cstdint>
+#include <cstdio>
 #include <algorithm>
 #include <cmath>
 
-// Platform-specific SIMD includes
-#if defined(__AVX__)
-    #include <immintrin.h>  // AVX
-#elif defined(__SSE4_1__)
-    #include <smmintrin.h>  // SSE4.1
-#elif defined(__SSE2__)
-    #include <emmintrin.h>  // SSE2
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define SIMDBUFFEROPS_X86 1
+    #include <immintrin.h>  // All x86 tiers; each is enabled per function below
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>  // __cpuid, _xgetbv
+    #endif
 #endif
 
 #if defined(__ARM_NEON) || defined(__aarch64__)
+    #define SIMDBUFFEROPS_NEON 1
     #include <arm_neon.h>  // ARM NEON
 #endif
 
+// Compile the enclosed functions for an instruction set the build flags may
+// not enable. MSVC accepts every intrinsic without flags, so needs nothing.
+#if defined(SIMDBUFFEROPS_X86) && defined(__clang__)
+    #define SIMDBUFFEROPS_PRAGMA(x) _Pragma(#x)
+    #define SIMDBUFFEROPS_BEGIN_TARGET(isa) \
+        SIMDBUFFEROPS_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+    #define SIMDBUFFEROPS_END_TARGET() SIMDBUFFEROPS_PRAGMA(clang attribute pop)
+#elif defined(SIMDBUFFEROPS_X86) && defined(__GNUC__)
+    #define SIMDBUFFEROPS_PRAGMA(x) _Pragma(#x)
+    #define SIMDBUFFEROPS_BEGIN_TARGET(isa) \
+        SIMDBUFFEROPS_PRAGMA(GCC push_options) SIMDBUFFEROPS_PRAGMA(GCC target(isa))
+    #define SIMDBUFFEROPS_END_TARGET() SIMDBUFFEROPS_PRAGMA(GCC pop_options)
+#else
+    #define SIMDBUFFEROPS_BEGIN_TARGET(isa)
+    #define SIMDBUFFEROPS_END_TARGET()
+#endif
+
 namespace DSP {
 namespace SIMDBufferOps {
 
@@ -43,32 +65,18 @@ namespace SIMDBufferOps {
 //==============================================================================
 
 /**
- * @brief Check CPU SIMD support at runtime
+ * @brief SIMD instruction-set tiers
  */
 enum class SIMDLevel {
     Scalar,  // No SIMD
     SSE2,    // 128-bit, 4 floats
-    SSE4_1,  // 128-bit with enhanced instructions
+    SSE4_1,  // 128-bit with enhanced instructions (no dedicated kernels; runs SSE2)
     AVX,     // 256-bit, 8 floats
-    AVX2,    // 256-bit with enhanced instructions (not currently used)
-    NEON     // 128-bit ARM NEON, 4 floats (Apple Silicon, iOS, tvOS)
+    AVX2,    // 256-bit with FMA
+    NEON,    // 128-bit ARM NEON, 4 floats (Apple Silicon, iOS, tvOS)
+    AVX512   // 512-bit AVX-512F, 16 floats
 };
 
-inline SIMDLevel detectSIMDLevel()
-{
-    #if defined(__ARM_NEON) || defined(__aarch64__)
-        return SIMDLevel::NEON;
-    #elif defined(__AVX__)
-        return SIMDLevel::AVX;
-    #elif defined(__SSE4_1__)
-        return SIMDLevel::SSE4_1;
-    #elif defined(__SSE2__)
-        return SIMDLevel::SSE2;
-    #else
-        return SIMDLevel::Scalar;
-    #endif
-}
-
 inline const char* getSIMDLevelName(SIMDLevel level)
 {
     switch (level)
@@ -77,471 +85,584 @@ inline const char* getSIMDLevelName(SIMDLevel level)
         case SIMDLevel::SSE2: return "SSE2";
         case SIMDLevel::SSE4_1: return "SSE4.1";
         case SIMDLevel::AVX: return "AVX";
-        case SIMDLevel::AVX2: return "AVX2";
+        case SIMDLevel::AVX2: return "AVX2/FMA";
         case SIMDLevel::NEON: return "NEON";
+        case SIMDLevel::AVX512: return "AVX-512";
         default: return "Unknown";
     }
 }
 
-//==============================================================================
-// Buffer Clearing Operations
-//==============================================================================
-
 /**
- * @brief Clear buffer to zeros using fastest available SIMD
- *
- * AVX: 8 floats at once (~8x speedup)
- * NEON/SSE: 4 floats at once (~4x speedup)
- * Scalar: Fallback
+ * @brief Does this CPU (and OS, for the wide register state) support a tier?
  */
-inline void clearBuffer(float* buffer, int numSamples)
+inline bool isSIMDLevelSupported(SIMDLevel level)
 {
-    #if defined(__ARM_NEON) || defined(__aarch64__)
+    switch (level)
+    {
+        case SIMDLevel::Scalar:
+            return true;
+
+        case SIMDLevel::NEON:
+            #if defined(SIMDBUFFEROPS_NEON)
+                return true;
+            #else
+                return false;
+            #endif
+
+        default:
+            break;
+    }
 
-        // NEON implementation: 4 floats at once
-        int simdEnd = numSamples - 3;
-        int i = 0;
+    #if defined(SIMDBUFFEROPS_X86) && defined(_MSC_VER) && !defined(__clang__)
 
-        float32x4_t zero = vdupq_n_f32(0.0f);
+        int info[4] = {};
+        __cpuid(info, 0);
+        const int maxLeaf = info[0];
 
-        // Process 4 floats at a time
-        for (; i <= simdEnd; i += 4)
-        {
-            vst1q_f32(buffer + i, zero);
-        }
+        __cpuid(info, 1);
+        const bool sse2 = (info[3] & (1 << 26)) != 0;
+        const bool sse41 = (info[2] & (1 << 19)) != 0;
+        const bool fma = (info[2] & (1 << 12)) != 0;
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avxCpu = (info[2] & (1 << 28)) != 0;
 
-        // Handle remaining samples
-        for (; i < numSamples; ++i)
-        {
-            buffer[i] = 0.0f;
-        }
-
-    #elif defined(__AVX__)
-
-        // AVX implementation: 8 floats at once
-        int simdEnd = numSamples - 7;
-        int i = 0;
+        const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+        const bool avxOs = (xcr0 & 0x6) == 0x6;      // XMM and YMM state
+        const bool avx512Os = (xcr0 & 0xE6) == 0xE6; // plus opmask and ZMM state
 
-        // Process 8 floats at a time
-        for (; i <= simdEnd; i += 8)
+        bool avx2 = false;
+        bool avx512f = false;
+        if (maxLeaf >= 7)
         {
-            _mm256_store_ps(buffer + i, _mm256_setzero_ps());
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+            avx512f = (info[1] & (1 << 16)) != 0;
         }
 
-        // Handle remaining samples
-        for (; i < numSamples; ++i)
+        switch (level)
         {
-            buffer[i] = 0.0f;
+            case SIMDLevel::SSE2: return sse2;
+            case SIMDLevel::SSE4_1: return sse41;
+            case SIMDLevel::AVX: return avxCpu && avxOs;
+            case SIMDLevel::AVX2: return avxCpu && avxOs && avx2 && fma;
+            case SIMDLevel::AVX512: return avx512f && avx512Os;
+            default: return false;
         }
 
-    #elif defined(__SSE4_1__) || defined(__SSE2__)
-
-        // SSE implementation: 4 floats at once
-        int simdEnd = numSamples - 3;
-        int i = 0;
-
-        // Process 4 floats at a time
-        for (; i <= simdEnd; i += 4)
-        {
-            _mm_store_ps(buffer + i, _mm_setzero_ps());
-        }
+    #elif defined(SIMDBUFFEROPS_X86)
 
-        // Handle remaining samples
-        for (; i < numSamples; ++i)
+        // libgcc/compiler-rt also check that the OS saves the wide registers
+        __builtin_cpu_init();
+        switch (level)
         {
-            buffer[i] = 0.0f;
+            case SIMDLevel::SSE2: return __builtin_cpu_supports("sse2");
+            case SIMDLevel::SSE4_1: return __builtin_cpu_supports("sse4.1");
+            case SIMDLevel::AVX: return __builtin_cpu_supports("avx");
+            case SIMDLevel::AVX2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            case SIMDLevel::AVX512: return __builtin_cpu_supports("avx512f");
+            default: return false;
         }
 
     #else
 
-        // Scalar fallback
-        std::memset(buffer, 0, sizeof(float) * numSamples);
+        return false;
 
     #endif
 }
 
-/**
- * @brief Clear multiple buffers (stereo, surround, etc.)
- */
-inline void clearBuffers(float** buffers, int numChannels, int numSamples)
-{
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        clearBuffer(buffers[ch], numSamples);
-    }
-}
-
 //==============================================================================
-// Buffer Copying Operations
+// Kernel Table
 //==============================================================================
 
 /**
- * @brief Copy buffer using SIMD
+ * @brief One instruction-set tier's buffer kernels
+ *
+ * The free functions below call through the active table; use getKernels()
+ * directly to run or compare a specific tier.
  */
-inline void copyBuffer(float* dest, const float* src, int numSamples)
+struct Kernels
 {
-    #if defined(__ARM_NEON) || defined(__aarch64__)
-
-        int simdEnd = numSamples - 3;
-        int i = 0;
-
-        for (; i <= simdEnd; i += 4)
-        {
-            float32x4_t data = vld1q_f32(src + i);
-            vst1q_f32(dest + i, data);
-        }
+    SIMDLevel level;
+    int vectorWidth;  // Floats per register
+
+    void (*applyGain)(float* buffer, int numSamples, float gain);
+    void (*add)(float* dest, const float* src, int numSamples);
+    void (*addWithGain)(float* dest, const float* src, int numSamples, float gain);
+    void (*mix)(float* dest, const float* src, int numSamples, float destGain, float srcGain);
+    void (*softClip)(float* buffer, int numSamples, float min, float max);
+    void (*hardClip)(float* buffer, int numSamples, float min, float max);
+    void (*measureLevels)(const float* buffer, int numSamples, float* peak, float* sumSquares);
+    void (*interleaveStereo)(const float* left, const float* right, float* interleaved, int numFrames);
+    void (*deinterleaveStereo)(const float* interleaved, float* left, float* right, int numFrames);
+};
 
-        for (; i < numSamples; ++i)
-        {
-            dest[i] = src[i];
-        }
+namespace detail {
 
-    #elif defined(__AVX__)
+//==============================================================================
+// Lane Abstractions (one per tier; the kernels are written against these)
+//==============================================================================
 
-        int simdEnd = numSamples - 7;
-        int i = 0;
+struct ScalarLanes
+{
+    using Vec = float;
+    static constexpr int width = 1;
+    static constexpr SIMDLevel level = SIMDLevel::Scalar;
+
+    static Vec load(const float* p) { return *p; }
+    static void store(float* p, Vec v) { *p = v; }
+    static Vec set1(float x) { return x; }
+    static Vec zero() { return 0.0f; }
+    static Vec add(Vec a, Vec b) { return a + b; }
+    static Vec mul(Vec a, Vec b) { return a * b; }
+    static Vec fmadd(Vec a, Vec b, Vec c) { return a * b + c; }
+    static Vec min(Vec a, Vec b) { return std::min(a, b); }
+    static Vec max(Vec a, Vec b) { return std::max(a, b); }
+    static Vec abs(Vec a) { return std::abs(a); }
+    static float horizontalSum(Vec a) { return a; }
+    static float horizontalMax(Vec a) { return a; }
+    static void interleave(Vec l, Vec r, Vec& low, Vec& high) { low = l; high = r; }
+    static void deinterleave(Vec a, Vec b, Vec& l, Vec& r) { l = a; r = b; }
+};
 
-        for (; i <= simdEnd; i += 8)
-        {
-            __m256 data = _mm256_loadu_ps(src + i);
-            _mm256_storeu_ps(dest + i, data);
-        }
+namespace scalar {
+    using Lanes = ScalarLanes;
+    #include "SIMDBufferOpsKernels.inl"
+}
 
-        for (; i < numSamples; ++i)
-        {
-            dest[i] = src[i];
-        }
+#if defined(SIMDBUFFEROPS_NEON)
 
-    #elif defined(__SSE4_1__) || defined(__SSE2__)
+struct NEONLanes
+{
+    using Vec = float32x4_t;
+    static constexpr int width = 4;
+    static constexpr SIMDLevel level = SIMDLevel::NEON;
+
+    static Vec load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Vec v) { vst1q_f32(p, v); }
+    static Vec set1(float x) { return vdupq_n_f32(x); }
+    static Vec zero() { return vdupq_n_f32(0.0f); }
+    static Vec add(Vec a, Vec b) { return vaddq_f32(a, b); }
+    static Vec mul(Vec a, Vec b) { return vmulq_f32(a, b); }
+    static Vec fmadd(Vec a, Vec b, Vec c) { return vmlaq_f32(c, a, b); }
+    static Vec min(Vec a, Vec b) { return vminq_f32(a, b); }
+    static Vec max(Vec a, Vec b) { return vmaxq_f32(a, b); }
+    static Vec abs(Vec a) { return vabsq_f32(a); }
+
+    static float horizontalSum(Vec a)
+    {
+        const float32x2_t pair = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+        return vget_lane_f32(vpadd_f32(pair, pair), 0);
+    }
 
-        int simdEnd = numSamples - 3;
-        int i = 0;
+    static float horizontalMax(Vec a)
+    {
+        const float32x2_t pair = vmax_f32(vget_low_f32(a), vget_high_f32(a));
+        return vget_lane_f32(vpmax_f32(pair, pair), 0);
+    }
 
-        for (; i <= simdEnd; i += 4)
-        {
-            __m128 data = _mm_loadu_ps(src + i);
-            _mm_storeu_ps(dest + i, data);
-        }
+    static void interleave(Vec l, Vec r, Vec& low, Vec& high)
+    {
+        const float32x4x2_t zipped = vzipq_f32(l, r);
+        low = zipped.val[0];
+        high = zipped.val[1];
+    }
 
-        for (; i < numSamples; ++i)
-        {
-            dest[i] = src[i];
-        }
+    static void deinterleave(Vec a, Vec b, Vec& l, Vec& r)
+    {
+        const float32x4x2_t unzipped = vuzpq_f32(a, b);
+        l = unzipped.val[0];
+        r = unzipped.val[1];
+    }
+};
 
-    #else
+namespace neon {
+    using Lanes = NEONLanes;
+    #include "SIMDBufferOpsKernels.inl"
+}
 
-        std::memcpy(dest, src, sizeof(float) * numSamples);
+#endif // SIMDBUFFEROPS_NEON
 
-    #endif
-}
+#if defined(SIMDBUFFEROPS_X86)
 
-//==============================================================================
-// Arithmetic Operations
-//==============================================================================
+SIMDBUFFEROPS_BEGIN_TARGET("sse2")
 
-/**
- * @brief Multiply buffer by scalar (amplitude scaling)
- *
- * AVX: 8 floats at once
- * NEON/SSE: 4 floats at once
- * Scalar: Fallback
- */
-inline void multiplyBuffer(float* buffer, int numSamples, float scalar)
+struct SSE2Lanes
 {
-    if (scalar == 1.0f) return;  // No-op optimization
-    if (scalar == 0.0f)
+    using Vec = __m128;
+    static constexpr int width = 4;
+    static constexpr SIMDLevel level = SIMDLevel::SSE2;
+
+    static Vec load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+    static Vec set1(float x) { return _mm_set1_ps(x); }
+    static Vec zero() { return _mm_setzero_ps(); }
+    static Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    static Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    static Vec fmadd(Vec a, Vec b, Vec c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static Vec min(Vec a, Vec b) { return _mm_min_ps(a, b); }
+    static Vec max(Vec a, Vec b) { return _mm_max_ps(a, b); }
+    static Vec abs(Vec a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+    static float horizontalSum(Vec a)
     {
-        clearBuffer(buffer, numSamples);
-        return;
+        const __m128 pairs = _mm_add_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
     }
 
-    #if defined(__ARM_NEON) || defined(__aarch64__)
-
-        int simdEnd = numSamples - 3;
-        int i = 0;
-
-        float32x4_t scalarVec = vdupq_n_f32(scalar);
+    static float horizontalMax(Vec a)
+    {
+        const __m128 pairs = _mm_max_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
 
-        for (; i <= simdEnd; i += 4)
-        {
-            float32x4_t data = vld1q_f32(buffer + i);
-            data = vmulq_f32(data, scalarVec);
-            vst1q_f32(buffer + i, data);
-        }
+    static void interleave(Vec l, Vec r, Vec& low, Vec& high)
+    {
+        low = _mm_unpacklo_ps(l, r);
+        high = _mm_unpackhi_ps(l, r);
+    }
 
-        for (; i < numSamples; ++i)
-        {
-            buffer[i] *= scalar;
-        }
+    static void deinterleave(Vec a, Vec b, Vec& l, Vec& r)
+    {
+        l = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        r = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+};
 
-    #elif defined(__AVX__)
+namespace sse2 {
+    using Lanes = SSE2Lanes;
+    #include "SIMDBufferOpsKernels.inl"
+}
 
-        int simdEnd = numSamples - 7;
-        int i = 0;
+SIMDBUFFEROPS_END_TARGET()
 
-        __m256 scalarVec = _mm256_set1_ps(scalar);
+SIMDBUFFEROPS_BEGIN_TARGET("avx")
 
-        for (; i <= simdEnd; i += 8)
-        {
-            __m256 data = _mm256_loadu_ps(buffer + i);
-            data = _mm256_mul_ps(data, scalarVec);
-            _mm256_storeu_ps(buffer + i, data);
-        }
+struct AVXLanes
+{
+    using Vec = __m256;
+    static constexpr int width = 8;
+    static constexpr SIMDLevel level = SIMDLevel::AVX;
+
+    static Vec load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm256_storeu_ps(p, v); }
+    static Vec set1(float x) { return _mm256_set1_ps(x); }
+    static Vec zero() { return _mm256_setzero_ps(); }
+    static Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+    static Vec mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+    static Vec fmadd(Vec a, Vec b, Vec c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+    static Vec min(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+    static Vec max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+    static Vec abs(Vec a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+
+    static float horizontalSum(Vec a)
+    {
+        return SSE2Lanes::horizontalSum(_mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
 
-        for (; i < numSamples; ++i)
-        {
-            buffer[i] *= scalar;
-        }
+    static float horizontalMax(Vec a)
+    {
+        return SSE2Lanes::horizontalMax(_mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
 
-    #elif defined(__SSE4_1__) || defined(__SSE2__)
+    static void interleave(Vec l, Vec r, Vec& low, Vec& high)
+    {
+        // unpack works within 128-bit halves; permute puts frames back in order
+        const __m256 lowHalves = _mm256_unpacklo_ps(l, r);
+        const __m256 highHalves = _mm256_unpackhi_ps(l, r);
+        low = _mm256_permute2f128_ps(lowHalves, highHalves, 0x20);
+        high = _mm256_permute2f128_ps(lowHalves, highHalves, 0x31);
+    }
 
-        int simdEnd = numSamples - 3;
-        int i = 0;
+    static void deinterleave(Vec a, Vec b, Vec& l, Vec& r)
+    {
+        const __m256 first = _mm256_permute2f128_ps(a, b, 0x20);
+        const __m256 second = _mm256_permute2f128_ps(a, b, 0x31);
+        l = _mm256_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+        r = _mm256_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+};
 
-        __m128 scalarVec = _mm_set1_ps(scalar);
+namespace avx {
+    using Lanes = AVXLanes;
+    #include "SIMDBufferOpsKernels.inl"
+}
 
-        for (; i <= simdEnd; i += 4)
-        {
-            __m128 data = _mm_loadu_ps(buffer + i);
-            data = _mm_mul_ps(data, scalarVec);
-            _mm_storeu_ps(buffer + i, data);
-        }
+SIMDBUFFEROPS_END_TARGET()
 
-        for (; i < numSamples; ++i)
-        {
-            buffer[i] *= scalar;
-        }
+SIMDBUFFEROPS_BEGIN_TARGET("avx2,fma")
 
-    #else
+struct AVX2Lanes : AVXLanes
+{
+    static constexpr SIMDLevel level = SIMDLevel::AVX2;
 
-        for (int i = 0; i < numSamples; ++i)
-        {
-            buffer[i] *= scalar;
-        }
+    static Vec fmadd(Vec a, Vec b, Vec c) { return _mm256_fmadd_ps(a, b, c); }
+};
 
-    #endif
+namespace avx2 {
+    using Lanes = AVX2Lanes;
+    #include "SIMDBufferOpsKernels.inl"
 }
 
-/**
- * @brief Add buffer to buffer (accumulate)
- */
-inline void addBuffers(float* dest, const float* src, int numSamples)
-{
-    #if defined(__ARM_NEON) || defined(__aarch64__)
+SIMDBUFFEROPS_END_TARGET()
 
-        int simdEnd = numSamples - 3;
-        int i = 0;
+SIMDBUFFEROPS_BEGIN_TARGET("avx512f")
 
-        for (; i <= simdEnd; i += 4)
-        {
-            float32x4_t destData = vld1q_f32(dest + i);
-            float32x4_t srcData = vld1q_f32(src + i);
-            destData = vaddq_f32(destData, srcData);
-            vst1q_f32(dest + i, destData);
-        }
+// GCC 12's AVX-512 headers trip -Wuninitialized on their own _mm512_undefined_* helpers
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
 
-        for (; i < numSamples; ++i)
-        {
-            dest[i] += src[i];
-        }
+struct AVX512Lanes
+{
+    using Vec = __m512;
+    static constexpr int width = 16;
+    static constexpr SIMDLevel level = SIMDLevel::AVX512;
+
+    static Vec load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm512_storeu_ps(p, v); }
+    static Vec set1(float x) { return _mm512_set1_ps(x); }
+    static Vec zero() { return _mm512_setzero_ps(); }
+    static Vec add(Vec a, Vec b) { return _mm512_add_ps(a, b); }
+    static Vec mul(Vec a, Vec b) { return _mm512_mul_ps(a, b); }
+    static Vec fmadd(Vec a, Vec b, Vec c) { return _mm512_fmadd_ps(a, b, c); }
+    static Vec min(Vec a, Vec b) { return _mm512_min_ps(a, b); }
+    static Vec max(Vec a, Vec b) { return _mm512_max_ps(a, b); }
+    static Vec abs(Vec a) { return _mm512_abs_ps(a); }
+    static float horizontalSum(Vec a) { return _mm512_reduce_add_ps(a); }
+    static float horizontalMax(Vec a) { return _mm512_reduce_max_ps(a); }
+
+    static void interleave(Vec l, Vec r, Vec& low, Vec& high)
+    {
+        // Indices 0-15 pick from l, 16-31 from r
+        const __m512i lowIndex = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+        const __m512i highIndex = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+        low = _mm512_permutex2var_ps(l, lowIndex, r);
+        high = _mm512_permutex2var_ps(l, highIndex, r);
+    }
 
-    #elif defined(__AVX__)
+    static void deinterleave(Vec a, Vec b, Vec& l, Vec& r)
+    {
+        const __m512i evenIndex = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+        const __m512i oddIndex = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+        l = _mm512_permutex2var_ps(a, evenIndex, b);
+        r = _mm512_permutex2var_ps(a, oddIndex, b);
+    }
+};
 
-        int simdEnd = numSamples - 7;
-        int i = 0;
+namespace avx512 {
+    using Lanes = AVX512Lanes;
+    #include "SIMDBufferOpsKernels.inl"
+}
 
-        for (; i <= simdEnd; i += 8)
-        {
-            __m256 destData = _mm256_loadu_ps(dest + i);
-            __m256 srcData = _mm256_loadu_ps(src + i);
-            destData = _mm256_add_ps(destData, srcData);
-            _mm256_storeu_ps(dest + i, destData);
-        }
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
 
-        for (; i < numSamples; ++i)
-        {
-            dest[i] += src[i];
-        }
+SIMDBUFFEROPS_END_TARGET()
 
-    #elif defined(__SSE4_1__) || defined(__SSE2__)
+#endif // SIMDBUFFEROPS_X86
 
-        int simdEnd = numSamples - 3;
-        int i = 0;
+} // namespace detail
 
-        for (; i <= simdEnd; i += 4)
-        {
-            __m128 destData = _mm_loadu_ps(dest + i);
-            __m128 srcData = _mm_loadu_ps(src + i);
-            destData = _mm_add_ps(destData, srcData);
-            _mm_storeu_ps(dest + i, destData);
-        }
+//==============================================================================
+// Dispatch
+//==============================================================================
 
-        for (; i < numSamples; ++i)
-        {
-            dest[i] += src[i];
-        }
+/**
+ * @brief Kernels for a specific tier, or nullptr if this build or CPU lacks it
+ */
+inline const Kernels* getKernels(SIMDLevel level)
+{
+    if (!isSIMDLevelSupported(level))
+        return nullptr;
 
-    #else
+    switch (level)
+    {
+        case SIMDLevel::Scalar: return &detail::scalar::getTierKernels();
+        #if defined(SIMDBUFFEROPS_NEON)
+            case SIMDLevel::NEON: return &detail::neon::getTierKernels();
+        #endif
+        #if defined(SIMDBUFFEROPS_X86)
+            case SIMDLevel::SSE2: return &detail::sse2::getTierKernels();
+            case SIMDLevel::AVX: return &detail::avx::getTierKernels();
+            case SIMDLevel::AVX2: return &detail::avx2::getTierKernels();
+            case SIMDLevel::AVX512: return &detail::avx512::getTierKernels();
+        #endif
+        default: return nullptr;
+    }
+}
 
-        for (int i = 0; i < numSamples; ++i)
+/**
+ * @brief Kernels for the widest supported tier, chosen once on first use
+ */
+inline const Kernels& getActiveKernels()
+{
+    static const Kernels& active = []() -> const Kernels& {
+        for (SIMDLevel level : { SIMDLevel::AVX512, SIMDLevel::AVX2, SIMDLevel::AVX,
+                                 SIMDLevel::NEON, SIMDLevel::SSE2 })
         {
-            dest[i] += src[i];
+            if (const Kernels* kernels = getKernels(level))
+                return *kernels;
         }
+        return *getKernels(SIMDLevel::Scalar);
+    }();
+    return active;
+}
 
-    #endif
+/**
+ * @brief Tier the buffer operations below run on
+ */
+inline SIMDLevel detectSIMDLevel()
+{
+    return getActiveKernels().level;
 }
 
 //==============================================================================
-// Soft Clipping ( SIMD-optimized)
+// Buffer Clearing Operations
 //==============================================================================
 
 /**
- * @brief Apply soft clipping to prevent overload
+ * @brief Clear buffer to zeros
  *
- * Polynomial approximation of tanh:
- * x * (1.5 - 0.5 * x^2) for |x| < 1.5
- * Hard clip beyond ±1.5
+ * memset is already dispatched to the widest stores by the C library.
  */
-inline void softClipBuffer(float* buffer, int numSamples, float min = -1.0f, float max = 1.0f)
+inline void clearBuffer(float* buffer, int numSamples)
 {
-    const float a = 0.9878f;
-    const float b = -0.3196f;
-
-    #if defined(__ARM_NEON) || defined(__aarch64__)
-
-        int simdEnd = numSamples - 3;
-        int i = 0;
-
-        float32x4_t minVec = vdupq_n_f32(min);
-        float32x4_t maxVec = vdupq_n_f32(max);
-        float32x4_t aVec = vdupq_n_f32(a);
-        float32x4_t bVec = vdupq_n_f32(b);
-
-        for (; i <= simdEnd; i += 4)
-        {
-            float32x4_t x = vld1q_f32(buffer + i);
-
-            // Hard clip beyond bounds
-            x = vminq_f32(x, maxVec);
-            x = vmaxq_f32(x, minVec);
-
-            // Polynomial soft clip
-            float32x4_t x2 = vmulq_f32(x, x);
-            float32x4_t factor = vaddq_f32(aVec, vmulq_f32(bVec, x2));
-            x = vmulq_f32(x, factor);
-
-            vst1q_f32(buffer + i, x);
-        }
-
-        // Handle remaining samples
-        for (; i < numSamples; ++i)
-        {
-            float x = buffer[i];
-            if (x > max) x = max;
-            else if (x < min) x = min;
-            else
-            {
-                float x2 = x * x;
-                x = x * (a + b * x2);
-            }
-            buffer[i] = x;
-        }
-
-    #elif defined(__AVX__)
+    std::memset(buffer, 0, sizeof(float) * static_cast<size_t>(numSamples));
+}
 
-        int simdEnd = numSamples - 7;
-        int i = 0;
+/**
+ * @brief Clear multiple buffers (stereo, surround, etc.)
+ */
+inline void clearBuffers(float** buffers, int numChannels, int numSamples)
+{
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        clearBuffer(buffers[ch], numSamples);
+    }
+}
 
-        __m256 minVec = _mm256_set1_ps(min);
-        __m256 maxVec = _mm256_set1_ps(max);
-        __m256 aVec = _mm256_set1_ps(a);
-        __m256 bVec = _mm256_set1_ps(b);
+//==============================================================================
+// Buffer Copying Operations
+//==============================================================================
 
-        for (; i <= simdEnd; i += 8)
-        {
-            __m256 x = _mm256_loadu_ps(buffer + i);
+/**
+ * @brief Copy buffer (non-overlapping)
+ *
+ * memcpy is already dispatched to the widest loads/stores by the C library.
+ */
+inline void copyBuffer(float* dest, const float* src, int numSamples)
+{
+    std::memcpy(dest, src, sizeof(float) * static_cast<size_t>(numSamples));
+}
 
-            // Hard clip beyond bounds
-            x = _mm256_min_ps(x, maxVec);
-            x = _mm256_max_ps(x, minVec);
+//==============================================================================
+// Arithmetic Operations
+//==============================================================================
 
-            // Polynomial soft clip
-            __m256 x2 = _mm256_mul_ps(x, x);
-            __m256 factor = _mm256_add_ps(aVec, _mm256_mul_ps(bVec, x2));
-            x = _mm256_mul_ps(x, factor);
+/**
+ * @brief Multiply buffer by scalar (amplitude scaling)
+ */
+inline void multiplyBuffer(float* buffer, int numSamples, float scalar)
+{
+    if (scalar == 1.0f) return;  // No-op optimization
+    if (scalar == 0.0f)
+    {
+        clearBuffer(buffer, numSamples);
+        return;
+    }
 
-            _mm256_storeu_ps(buffer + i, x);
-        }
+    getActiveKernels().applyGain(buffer, numSamples, scalar);
+}
 
-        // Handle remaining samples
-        for (; i < numSamples; ++i)
-        {
-            float x = buffer[i];
-            if (x > max) x = max;
-            else if (x < min) x = min;
-            else
-            {
-                float x2 = x * x;
-                x = x * (a + b * x2);
-            }
-            buffer[i] = x;
-        }
+/**
+ * @brief Add buffer to buffer (accumulate)
+ */
+inline void addBuffers(float* dest, const float* src, int numSamples)
+{
+    getActiveKernels().add(dest, src, numSamples);
+}
 
-    #elif defined(__SSE4_1__) || defined(__SSE2__)
+/**
+ * @brief Multiply-accumulate: dest += src * gain (fused on AVX2/AVX-512)
+ */
+inline void addBuffersWithGain(float* dest, const float* src, int numSamples, float gain)
+{
+    getActiveKernels().addWithGain(dest, src, numSamples, gain);
+}
 
-        int simdEnd = numSamples - 3;
-        int i = 0;
+/**
+ * @brief Mix: dest = dest * destGain + src * srcGain (crossfades, wet/dry)
+ */
+inline void mixBuffers(float* dest, const float* src, int numSamples, float destGain, float srcGain)
+{
+    getActiveKernels().mix(dest, src, numSamples, destGain, srcGain);
+}
 
-        __m128 minVec = _mm_set1_ps(min);
-        __m128 maxVec = _mm_set1_ps(max);
-        __m128 aVec = _mm_set1_ps(a);
-        __m128 bVec = _mm_set1_ps(b);
+//==============================================================================
+// Level Measurement
+//==============================================================================
 
-        for (; i <= simdEnd; i += 4)
-        {
-            __m128 x = _mm_loadu_ps(buffer + i);
+/**
+ * @brief Peak absolute value and RMS in one pass
+ */
+inline void getPeakAndRMS(const float* buffer, int numSamples, float& peak, float& rms)
+{
+    float sumSquares = 0.0f;
+    getActiveKernels().measureLevels(buffer, numSamples, &peak, &sumSquares);
+    rms = numSamples > 0 ? std::sqrt(sumSquares / static_cast<float>(numSamples)) : 0.0f;
+}
 
-            // Hard clip beyond bounds
-            x = _mm_min_ps(x, maxVec);
-            x = _mm_max_ps(x, minVec);
+inline float getPeakLevel(const float* buffer, int numSamples)
+{
+    float peak = 0.0f, rms = 0.0f;
+    getPeakAndRMS(buffer, numSamples, peak, rms);
+    return peak;
+}
 
-            // Polynomial soft clip
-            __m128 x2 = _mm_mul_ps(x, x);
-            __m128 factor = _mm_add_ps(aVec, _mm_mul_ps(bVec, x2));
-            x = _mm_mul_ps(x, factor);
+inline float getRMSLevel(const float* buffer, int numSamples)
+{
+    float peak = 0.0f, rms = 0.0f;
+    getPeakAndRMS(buffer, numSamples, peak, rms);
+    return rms;
+}
 
-            _mm_storeu_ps(buffer + i, x);
-        }
+//==============================================================================
+// Interleaving
+//==============================================================================
 
-        for (; i < numSamples; ++i)
-        {
-            float x = buffer[i];
-            if (x > max) x = max;
-            else if (x < min) x = min;
-            else
-            {
-                float x2 = x * x;
-                x = x * (a + b * x2);
-            }
-            buffer[i] = x;
-        }
+/**
+ * @brief Planar stereo to interleaved LRLR... (numFrames * 2 floats out)
+ */
+inline void interleaveStereo(const float* left, const float* right, float* interleaved, int numFrames)
+{
+    getActiveKernels().interleaveStereo(left, right, interleaved, numFrames);
+}
 
-    #else
+/**
+ * @brief Interleaved LRLR... to planar stereo
+ */
+inline void deinterleaveStereo(const float* interleaved, float* left, float* right, int numFrames)
+{
+    getActiveKernels().deinterleaveStereo(interleaved, left, right, numFrames);
+}
 
-        for (int i = 0; i < numSamples; ++i)
-        {
-            float x = buffer[i];
-            if (x > max) x = max;
-            else if (x < min) x = min;
-            else
-            {
-                float x2 = x * x;
-                x = x * (a + b * x2);
-            }
-            buffer[i] = x;
-        }
+//==============================================================================
+// Soft Clipping ( SIMD-optimized)
+//==============================================================================
 
-    #endif
+/**
+ * @brief Apply soft clipping to prevent overload
+ *
+ * Clamps to [min, max], then shapes with the cubic
+ * x * (0.9878 - 0.3196 * x^2), a polynomial approximation of tanh.
+ * Every tier, including scalar, uses the same formula.
+ */
+inline void softClipBuffer(float* buffer, int numSamples, float min = -1.0f, float max = 1.0f)
+{
+    getActiveKernels().softClip(buffer, numSamples, min, max);
 }
 
 //==============================================================================
@@ -549,85 +670,11 @@ inline void softClipBuffer(float* buffer, int numSamples, float min = -1.0f, flo
 //==============================================================================
 
 /**
- * @brief Apply hard clipping with optional soft knee
+ * @brief Apply hard clipping
  */
 inline void hardClipBuffer(float* buffer, int numSamples, float min = -1.0f, float max = 1.0f)
 {
-    #if defined(__ARM_NEON) || defined(__aarch64__)
-
-        int simdEnd = numSamples - 3;
-        int i = 0;
-
-        float32x4_t minVec = vdupq_n_f32(min);
-        float32x4_t maxVec = vdupq_n_f32(max);
-
-        for (; i <= simdEnd; i += 4)
-        {
-            float32x4_t x = vld1q_f32(buffer + i);
-            x = vminq_f32(x, maxVec);
-            x = vmaxq_f32(x, minVec);
-            vst1q_f32(buffer + i, x);
-        }
-
-        for (; i < numSamples; ++i)
-        {
-            if (buffer[i] > max) buffer[i] = max;
-            else if (buffer[i] < min) buffer[i] = min;
-        }
-
-    #elif defined(__AVX__)
-
-        int simdEnd = numSamples - 7;
-        int i = 0;
-
-        __m256 minVec = _mm256_set1_ps(min);
-        __m256 maxVec = _mm256_set1_ps(max);
-
-        for (; i <= simdEnd; i += 8)
-        {
-            __m256 x = _mm256_loadu_ps(buffer + i);
-            x = _mm256_min_ps(x, maxVec);
-            x = _mm256_max_ps(x, minVec);
-            _mm256_storeu_ps(buffer + i, x);
-        }
-
-        for (; i < numSamples; ++i)
-        {
-            if (buffer[i] > max) buffer[i] = max;
-            else if (buffer[i] < min) buffer[i] = min;
-        }
-
-    #elif defined(__SSE4_1__) || defined(__SSE2__)
-
-        int simdEnd = numSamples - 3;
-        int i = 0;
-
-        __m128 minVec = _mm_set1_ps(min);
-        __m128 maxVec = _mm_set1_ps(max);
-
-        for (; i <= simdEnd; i += 4)
-        {
-            __m128 x = _mm_loadu_ps(buffer + i);
-            x = _mm_min_ps(x, maxVec);
-            x = _mm_max_ps(x, minVec);
-            _mm_storeu_ps(buffer + i, x);
-        }
-
-        for (; i < numSamples; ++i)
-        {
-            if (buffer[i] > max) buffer[i] = max;
-            else if (buffer[i] < min) buffer[i] = min;
-        }
-
-    #else
-
-        for (int i = 0; i < numSamples; ++i)
-        {
-            if (buffer[i] > max) buffer[i] = max;
-            else if (buffer[i] < min) buffer[i] = min;
-        }
-
-    #endif
+    getActiveKernels().hardClip(buffer, numSamples, min, max);
 }
 
 //==============================================================================
@@ -636,18 +683,19 @@ inline void hardClipBuffer(float* buffer, int numSamples, float min = -1.0f, flo
 
 /**
  * @brief Get alignment information for buffers
+ *
+ * Largest power of two (up to the active tier's register size) the buffer
+ * is aligned to.
  */
 inline size_t getBufferAlignment(const float* buffer)
 {
-    uintptr_t addr = reinterpret_cast<uintptr_t>(buffer);
-
-    #if defined(__AVX__)
-        if (addr % 32 == 0) return 32;
-    #endif
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(buffer);
+    const size_t registerBytes = sizeof(float) * static_cast<size_t>(getActiveKernels().vectorWidth);
 
-    #if defined(__ARM_NEON) || defined(__aarch64__) || defined(__SSE4_1__) || defined(__SSE2__)
-        if (addr % 16 == 0) return 16;
-    #endif
+    for (size_t alignment = registerBytes; alignment > sizeof(float); alignment /= 2)
+    {
+        if (addr % alignment == 0) return alignment;
+    }
 
     return sizeof(float);
 }
@@ -657,23 +705,16 @@ inline size_t getBufferAlignment(const float* buffer)
  */
 inline void reportSIMDCapabilities()
 {
-    SIMDLevel level = detectSIMDLevel();
+    const Kernels& active = getActiveKernels();
     printf("=== SIMD CAPABILITIES ===\n");
-    printf("  Detected Level: %s\n", getSIMDLevelName(level));
-
-    #if defined(__ARM_NEON) || defined(__aarch64__)
-        printf("  ✓ NEON enabled (128-bit, 4 floats)\n");
-    #elif defined(__AVX__)
-        printf("  ✓ AVX enabled (256-bit, 8 floats)\n");
-    #elif defined(__SSE4_1__)
-        printf("  ✓ SSE4.1 enabled (128-bit, 4 floats)\n");
-    #elif defined(__SSE2__)
-        printf("  ✓ SSE2 enabled (128-bit, 4 floats)\n");
-    #else
-        printf("  ✗ No SIMD detected (scalar only)\n");
-    #endif
+    printf("  Detected Level: %s (%d floats per register)\n", getSIMDLevelName(active.level), active.vectorWidth);
 
-    printf("  Expected Speedup: 4-8x for buffer operations\n");
+    for (SIMDLevel level : { SIMDLevel::Scalar, SIMDLevel::SSE2, SIMDLevel::AVX, SIMDLevel::AVX2,
+                             SIMDLevel::AVX512, SIMDLevel::NEON })
+    {
+        if (const Kernels* kernels = getKernels(level))
+            printf("  ✓ %s available (%d floats)\n", getSIMDLevelName(level), kernels->vectorWidth);
+    }
 }
 
 } // namespace SIMDBufferOps
@@ -0,0 +1,210 @@
+/*
+  ==============================================================================
+
+    SIMDBufferOpsKernels.inl
+    Buffer kernels shared by every SIMDBufferOps instruction-set tier
+
+    Included by SIMDBufferOps.h once per tier, inside that tier's namespace
+    with `Lanes` defined and (on x86) the tier's target pragma active, so the
+    same source compiles to SSE2, AVX, AVX2/FMA and AVX-512 code in one
+    binary. No include guard on purpose.
+
+    Vector loops use unaligned loads/stores; tails run the same arithmetic in
+    scalar form, so every tier matches the scalar tier up to FMA rounding.
+
+  ==============================================================================
+*/
+
+inline void applyGain(float* buffer, int numSamples, float gain)
+{
+    const auto gainVec = Lanes::set1(gain);
+
+    int i = 0;
+    for (; i <= numSamples - Lanes::width; i += Lanes::width)
+    {
+        Lanes::store(buffer + i, Lanes::mul(Lanes::load(buffer + i), gainVec));
+    }
+
+    for (; i < numSamples; ++i)
+    {
+        buffer[i] *= gain;
+    }
+}
+
+inline void add(float* dest, const float* src, int numSamples)
+{
+    int i = 0;
+    for (; i <= numSamples - Lanes::width; i += Lanes::width)
+    {
+        Lanes::store(dest + i, Lanes::add(Lanes::load(dest + i), Lanes::load(src + i)));
+    }
+
+    for (; i < numSamples; ++i)
+    {
+        dest[i] += src[i];
+    }
+}
+
+inline void addWithGain(float* dest, const float* src, int numSamples, float gain)
+{
+    const auto gainVec = Lanes::set1(gain);
+
+    int i = 0;
+    for (; i <= numSamples - Lanes::width; i += Lanes::width)
+    {
+        Lanes::store(dest + i, Lanes::fmadd(Lanes::load(src + i), gainVec, Lanes::load(dest + i)));
+    }
+
+    for (; i < numSamples; ++i)
+    {
+        dest[i] += src[i] * gain;
+    }
+}
+
+inline void mix(float* dest, const float* src, int numSamples, float destGain, float srcGain)
+{
+    const auto destGainVec = Lanes::set1(destGain);
+    const auto srcGainVec = Lanes::set1(srcGain);
+
+    int i = 0;
+    for (; i <= numSamples - Lanes::width; i += Lanes::width)
+    {
+        const auto scaledDest = Lanes::mul(Lanes::load(dest + i), destGainVec);
+        Lanes::store(dest + i, Lanes::fmadd(Lanes::load(src + i), srcGainVec, scaledDest));
+    }
+
+    for (; i < numSamples; ++i)
+    {
+        dest[i] = dest[i] * destGain + src[i] * srcGain;
+    }
+}
+
+inline void softClip(float* buffer, int numSamples, float min, float max)
+{
+    // Hard clip to [min, max], then x * (a + b * x^2)
+    const float a = 0.9878f;
+    const float b = -0.3196f;
+
+    const auto minVec = Lanes::set1(min);
+    const auto maxVec = Lanes::set1(max);
+    const auto aVec = Lanes::set1(a);
+    const auto bVec = Lanes::set1(b);
+
+    int i = 0;
+    for (; i <= numSamples - Lanes::width; i += Lanes::width)
+    {
+        auto x = Lanes::max(Lanes::min(Lanes::load(buffer + i), maxVec), minVec);
+        const auto factor = Lanes::fmadd(bVec, Lanes::mul(x, x), aVec);
+        Lanes::store(buffer + i, Lanes::mul(x, factor));
+    }
+
+    for (; i < numSamples; ++i)
+    {
+        const float x = std::max(std::min(buffer[i], max), min);
+        buffer[i] = x * (a + b * (x * x));
+    }
+}
+
+inline void hardClip(float* buffer, int numSamples, float min, float max)
+{
+    const auto minVec = Lanes::set1(min);
+    const auto maxVec = Lanes::set1(max);
+
+    int i = 0;
+    for (; i <= numSamples - Lanes::width; i += Lanes::width)
+    {
+        Lanes::store(buffer + i, Lanes::max(Lanes::min(Lanes::load(buffer + i), maxVec), minVec));
+    }
+
+    for (; i < numSamples; ++i)
+    {
+        buffer[i] = std::max(std::min(buffer[i], max), min);
+    }
+}
+
+inline void measureLevels(const float* buffer, int numSamples, float* peak, float* sumSquares)
+{
+    // Two accumulator pairs hide the add/FMA latency
+    auto peak0 = Lanes::zero();
+    auto peak1 = Lanes::zero();
+    auto sum0 = Lanes::zero();
+    auto sum1 = Lanes::zero();
+
+    int i = 0;
+    for (; i <= numSamples - 2 * Lanes::width; i += 2 * Lanes::width)
+    {
+        const auto x0 = Lanes::load(buffer + i);
+        const auto x1 = Lanes::load(buffer + i + Lanes::width);
+        peak0 = Lanes::max(peak0, Lanes::abs(x0));
+        peak1 = Lanes::max(peak1, Lanes::abs(x1));
+        sum0 = Lanes::fmadd(x0, x0, sum0);
+        sum1 = Lanes::fmadd(x1, x1, sum1);
+    }
+
+    float peakResult = Lanes::horizontalMax(Lanes::max(peak0, peak1));
+    float sumResult = Lanes::horizontalSum(Lanes::add(sum0, sum1));
+
+    for (; i < numSamples; ++i)
+    {
+        peakResult = std::max(peakResult, std::abs(buffer[i]));
+        sumResult += buffer[i] * buffer[i];
+    }
+
+    *peak = peakResult;
+    *sumSquares = sumResult;
+}
+
+inline void interleaveStereo(const float* left, const float* right, float* interleaved, int numFrames)
+{
+    int i = 0;
+    for (; i <= numFrames - Lanes::width; i += Lanes::width)
+    {
+        Lanes::Vec low, high;
+        Lanes::interleave(Lanes::load(left + i), Lanes::load(right + i), low, high);
+        Lanes::store(interleaved + 2 * i, low);
+        Lanes::store(interleaved + 2 * i + Lanes::width, high);
+    }
+
+    for (; i < numFrames; ++i)
+    {
+        interleaved[2 * i] = left[i];
+        interleaved[2 * i + 1] = right[i];
+    }
+}
+
+inline void deinterleaveStereo(const float* interleaved, float* left, float* right, int numFrames)
+{
+    int i = 0;
+    for (; i <= numFrames - Lanes::width; i += Lanes::width)
+    {
+        Lanes::Vec leftVec, rightVec;
+        Lanes::deinterleave(Lanes::load(interleaved + 2 * i), Lanes::load(interleaved + 2 * i + Lanes::width),
+                            leftVec, rightVec);
+        Lanes::store(left + i, leftVec);
+        Lanes::store(right + i, rightVec);
+    }
+
+    for (; i < numFrames; ++i)
+    {
+        left[i] = interleaved[2 * i];
+        right[i] = interleaved[2 * i + 1];
+    }
+}
+
+inline const Kernels& getTierKernels()
+{
+    static const Kernels kernels = {
+        Lanes::level,
+        Lanes::width,
+        &applyGain,
+        &add,
+        &addWithGain,
+        &mix,
+        &softClip,
+        &hardClip,
+        &measureLevels,
+        &interleaveStereo,
+        &deinterleaveStereo
+    };
+    return kernels;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <algorithm>
+
+namespace schill {
+namespace dynamics {
+
+//==============================================================================
+// Chunked Block Processing
+//==============================================================================
+
+/**
+ * Runs process on consecutive views of at most maxChunk samples, so scratch
+ * sized for the prepared block never has to grow on the audio thread.
+ *
+ * Buffer is juce::AudioBuffer<float> in the chain; any type with the same
+ * referencing constructor (channel pointers, channel count, start sample,
+ * length) works. The views refer to the caller's channel data, so nothing is
+ * copied or allocated.
+ */
+template <typename Buffer, typename Process>
+void forEachChunk(Buffer& buffer, int maxChunk, Process&& process) {
+    const int numSamples = buffer.getNumSamples();
+    if (numSamples <= maxChunk || maxChunk <= 0) {
+        process(buffer);
+        return;
+    }
+
+    for (int start = 0; start < numSamples; start += maxChunk) {
+        Buffer chunk(buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                     start, std::min(maxChunk, numSamples - start));
+        process(chunk);
+    }
+}
+
+} // namespace dynamics
+} // namespace schill
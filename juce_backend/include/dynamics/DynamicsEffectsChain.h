@@ -1,8 +1,10 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <atomic>
 #include "FilterGate.h"
 #include "DynamicsProcessor.h"
+#include "StatsSnapshot.h"
 #include "core/ColorTypes.h"
 
 namespace schill {
@@ -116,10 +118,12 @@ public:
     void reset();
     void prepareToPlay(double sampleRate, int samplesPerBlock);
 
-    // Processing
+    // Processing (allocation-free once prepared; blocks longer than the
+    // prepared size are processed in prepared-size chunks)
     void processBlock(juce::AudioBuffer<float>& buffer);
     void processSidechain(const juce::AudioBuffer<float>& sidechainBuffer);
     void processStereo(juce::AudioBuffer<float>& leftBuffer, juce::AudioBuffer<float>& rightBuffer);
+    void processStereo(float* left, float* right, int numSamples);
 
     // Configuration
     void setConfig(const SlotConfig& config);
@@ -155,9 +159,14 @@ public:
         bool hasSidechainInput;
     };
 
+    // Lock-free snapshot, safe to call from any thread
     SlotStats getStats() const;
     void resetStats();
 
+    // Statistics are measured on one block in every `blocks` (default 16)
+    void setStatsDecimation(int blocks);
+    int getStatsDecimation() const { return statsDecimation.load(std::memory_order_relaxed); }
+
     // Solo/Mute control
     void setSoloGroup(int group);
     int getSoloGroup() const { return currentConfig.soloGroup; }
@@ -194,9 +203,8 @@ private:
     std::unique_ptr<FilterGate> filterGate;
     std::unique_ptr<DynamicsProcessor> dynamicsProcessor;
 
-    // Wet/dry mixing
+    // Wet/dry mixing: the dry copy is only taken while the mix is below 100%
     juce::AudioBuffer<float> dryBuffer;
-    juce::AudioBuffer<float> wetBuffer;
     juce::LinearSmoothedValue<float> smoothedWetDryMix;
     juce::LinearSmoothedValue<float> smoothedOutputGain;
 
@@ -206,9 +214,10 @@ private:
     std::unique_ptr<SlotConfig> previousConfig;
     juce::LinearSmoothedValue<float> crossfadeGain;
 
-    // Analysis and monitoring
-    SlotStats stats;
-    uint64_t samplesProcessed = 0;
+    // Analysis and monitoring: one block in statsDecimation is measured
+    StatsSnapshot<SlotStats> publishedStats;
+    std::atomic<int> statsDecimation { 16 };
+    int blocksUntilStats = 0;
     juce::Time statsResetTime;
 
     // Audio analysis
@@ -220,6 +229,8 @@ private:
     int samplesPerBlock = 512;
 
     // Internal processing
+    void processChunk(juce::AudioBuffer<float>& buffer);
+    bool needsDryCopy() const;
     void processEffect(juce::AudioBuffer<float>& buffer);
     void processWetDryMix(juce::AudioBuffer<float>& buffer);
     void applyBypassMode(juce::AudioBuffer<float>& buffer);
@@ -231,7 +242,7 @@ private:
     void processSidechainForEffect(juce::AudioBuffer<float>& buffer);
 
     // Analysis
-    void updateStats(const juce::AudioBuffer<float>& input, const juce::AudioBuffer<float>& output);
+    void updateStats(float inputSumSquares, const juce::AudioBuffer<float>& output, double elapsedSeconds);
     void analyzeAudio(const juce::AudioBuffer<float>& buffer);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChainSlot)
@@ -251,9 +262,10 @@ public:
     void reset();
     void prepareToPlay(double sampleRate, int samplesPerBlock);
 
-    // Main processing
+    // Main processing (allocation-free once prepared)
     void processBlock(juce::AudioBuffer<float>& buffer);
     void processStereo(juce::AudioBuffer<float>& leftBuffer, juce::AudioBuffer<float>& rightBuffer);
+    void processStereo(float* left, float* right, int numSamples);
     void processMultichannel(juce::AudioBuffer<float>& buffer, int numChannels);
 
     // Sidechain routing
@@ -305,7 +317,7 @@ public:
         float outputLevel;
         float totalGainReduction;
         float totalLatency;
-        int totalCPUUsage;
+        int totalCPUUsage;              // Percent of the measured block's duration
         int activeEffects;
         int bypassedEffects;
         int totalEffects;
@@ -315,10 +327,15 @@ public:
         bool isProcessing;
     };
 
+    // Assembled on the calling thread from the lock-free chain and slot snapshots
     ChainStats getStats() const;
     void resetStats();
     void updateStats();
 
+    // Chain and slot statistics are measured on one block in every `blocks`
+    void setStatsDecimation(int blocks);
+    int getStatsDecimation() const { return statsDecimation.load(std::memory_order_relaxed); }
+
     // Preset management
     struct ChainPreset {
         std::string name;
@@ -441,8 +458,20 @@ private:
     std::unique_ptr<juce::dsp::MidSideEncoder<float>> msEncoder;
     std::unique_ptr<juce::Dsp::MidSideDecoder<float>> msDecoder;
 
-    // Statistics and monitoring
-    ChainStats stats;
+    // Statistics and monitoring: the audio thread publishes the chain-level
+    // fields, getStats() adds the slot snapshots
+    struct ChainLevels {
+        float inputLevel = -100.0f;
+        float outputLevel = -100.0f;
+        int totalCPUUsage = 0;
+        double totalSamplesProcessed = 0.0;
+        juce::int64 lastUpdateMs = 0;
+        bool isProcessing = false;
+    };
+
+    StatsSnapshot<ChainLevels> publishedLevels;
+    std::atomic<int> statsDecimation { 16 };
+    int blocksUntilStats = 0;
     uint64_t totalSamplesProcessed = 0;
     juce::Time statsResetTime;
 
@@ -478,6 +507,7 @@ private:
     int maxAutoSaveHistory = 10;
 
     // Internal processing
+    void processChunk(juce::AudioBuffer<float>& buffer);
     void processSeriesMode(juce::AudioBuffer<float>& buffer);
     void processParallelMode(juce::AudioBuffer<float>& buffer);
     void processMidSideMode(juce::AudioBuffer<float>& buffer);
@@ -492,7 +522,7 @@ private:
     void applySoloMuteToBuffer(juce::AudioBuffer<float>& buffer);
 
     // Analysis and monitoring
-    void updateStats(const juce::AudioBuffer<float>& input, const juce::AudioBuffer<float>& output);
+    void updateStats(float inputSumSquares, const juce::AudioBuffer<float>& output, double elapsedSeconds);
     void analyzeFrequencyContent(const juce::AudioBuffer<float>& buffer);
     void calculateChainStatistics();
 
@@ -521,6 +551,7 @@ private:
     int findNextAvailableSlot() const;
     bool isValidSlotIndex(int slotIndex) const;
     void reorganizeSlots();
+    static float calculateRMSLevel(const juce::AudioBuffer<float>& buffer);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DynamicsEffectsChain)
 };
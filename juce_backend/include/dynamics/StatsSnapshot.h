@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace schill {
+namespace dynamics {
+
+//==============================================================================
+// Lock-free Statistics Snapshot
+//==============================================================================
+
+/**
+ * Single-value seqlock for trivially copyable statistics.
+ *
+ * `sequence` is odd while a write is in progress and advances by two per
+ * publication. Readers on any thread copy the value and retry until the
+ * sequence was even and unchanged across the copy. The audio thread
+ * publishes with waitForWriter = false, so if a control thread is writing
+ * at the same moment (resetStats) that publication is dropped, never waited on.
+ */
+template <typename T>
+class StatsSnapshot {
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "StatsSnapshot needs a trivially copyable type");
+
+    bool publish(const T& newValue, bool waitForWriter) noexcept {
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((seq & 1u) == 0 &&
+                sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                break;
+            }
+            if (!waitForWriter) {
+                return false;
+            }
+            std::this_thread::yield();
+            seq = sequence.load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&value, &newValue, sizeof(T));
+        sequence.store(seq + 2, std::memory_order_release);
+        return true;
+    }
+
+    T read() const noexcept {
+        T result;
+        for (;;) {
+            const uint32_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1u) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::memcpy(&result, &value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                return result;
+            }
+        }
+    }
+
+private:
+    std::atomic<uint32_t> sequence { 0 };
+    T value {};
+};
+
+} // namespace dynamics
+} // namespace schill
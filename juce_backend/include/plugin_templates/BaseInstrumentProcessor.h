@@ -173,6 +173,7 @@ public:
 
     /**
      * Convert MIDI note to frequency (with microtonal tuning if enabled)
+     * Uses the precompiled tuning table; call from the audio thread.
      * @param midiNote - MIDI note number
      * @return Frequency in Hz
      */
@@ -180,7 +181,7 @@ public:
     {
         if (microtonalEnabled_ && tuningManager_)
         {
-            return tuningManager_->getTuning().midiToFrequency(midiNote);
+            return tuningManager_->getFrequencyTable().getFrequency(midiNote);
         }
 
         // Default to standard 12-TET
@@ -3,6 +3,8 @@
 #include <JuceHeader.h>
 #include <unordered_map>
 #include <unordered_set>
+#include <array>
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <functional>
@@ -231,11 +233,16 @@ public:
     RouteID createBroadcastRoute(const std::string& sourceDevice);
     RouteID createAllInstrumentsRoute(const std::string& sourceDevice);
 
+    // The dispatch table binds destination instances when it is compiled;
+    // call after instances are created or destroyed to re-resolve them
+    void refreshInstrumentBindings();
+
     //==============================================================================
     // MIDI Processing
     //==============================================================================
 
-    // Main processing function
+    // Main processing function. Lock-free: dispatches through the compiled route
+    // table; up to maxConcurrentDispatchers threads may call it at once
     void processMidiBlock(const std::string& sourceDevice, juce::MidiBuffer& midiBuffer, int numSamples);
 
     // Individual message processing
@@ -401,8 +408,8 @@ private:
         RouteID id;
         MidiRouteConfig config;
         bool enabled = true;
-        uint64_t messageCount = 0;
-        juce::Time lastActivity;
+        std::atomic<uint64_t> messageCount{0};
+        std::atomic<juce::int64> lastActivityMs{0};
 
         MidiRoute(RouteID routeId, const MidiRouteConfig& routeConfig)
             : id(routeId), config(routeConfig) {}
@@ -425,9 +432,89 @@ private:
     void handleIncomingMidi(juce::MidiInput* source, const juce::MidiMessage& message);
     void handleDeviceConnectionChange(const std::string& deviceIdentifier, bool connected);
 
-    // Route processing
-    void processRoute(MidiRoute& route, const juce::MidiMessage& message);
-    void processRoute(MidiRoute& route, juce::MidiBuffer& buffer);
+    //==============================================================================
+    // Compiled Dispatch Table
+    //==============================================================================
+
+    static constexpr int numDispatchChannels = 16;
+    static constexpr int numStatusNibbles = 8;              // 0x8n .. 0xFn
+    static constexpr int maxConcurrentDispatchers = 4;      // Audio callback plus device threads
+    static constexpr int maxEventsPerBlock = 10000;         // Per destination, per dispatcher
+    static constexpr int bytesPerChannelEvent = 9;          // MidiBuffer: int32 time, uint16 size, 3 data bytes
+    static constexpr int destinationBufferBytes = maxEventsPerBlock * bytesPerChannelEvent;
+    static constexpr uint64_t quiescentEpoch = ~uint64_t(0);
+
+    // A route with its filters and transforms reduced to byte lookups
+    struct CompiledRoute {
+        enum FilterFlags : uint8_t {
+            NoteRange     = 1 << 0,
+            Velocity      = 1 << 1,
+            NoteOnOnly    = 1 << 2,     // 0x9n with velocity > 0
+            NoteOffOnly   = 1 << 3,     // 0x9n with velocity == 0
+            Controllers   = 1 << 4,
+            CustomFilter  = 1 << 5
+        };
+
+        std::shared_ptr<MidiRoute> route;                   // Stats only
+        uint32_t firstDestination = 0;
+        uint32_t numDestinations = 0;
+
+        uint8_t filterFlags = 0;
+        uint8_t noteLow = 0, noteHigh = 127;
+        uint8_t velocityLow = 0, velocityHigh = 127;
+        std::array<uint64_t, 2> controllerMask {};
+
+        bool transforms = false;
+        std::array<uint8_t, 16> channelMap {};
+        std::array<uint8_t, 128> noteMap {};
+        std::array<uint8_t, 128> velocityMap {};
+        std::array<uint8_t, 128> controllerMap {};
+
+        std::function<bool(const juce::MidiMessage&)> customFilter;
+        std::function<juce::MidiMessage(const juce::MidiMessage&)> customTransform;
+
+        bool passesFilter(const uint8_t* data, int numBytes) const;
+        void applyTransform(const uint8_t* data, int numBytes, uint8_t* out) const;   // numBytes <= 3
+    };
+
+    // Routes for one source device, bucketed by [channel][status nibble]
+    struct SourceDispatch {
+        std::array<std::array<std::pair<uint32_t, uint32_t>, numStatusNibbles>, numDispatchChannels> cells {};
+        std::vector<uint32_t> routeIndices;
+    };
+
+    // Immutable once published, apart from the per-dispatcher scratch, which
+    // only the thread holding that dispatcher slot touches
+    struct DispatchTable {
+        std::unordered_map<std::string, SourceDispatch> sources;
+        std::vector<CompiledRoute> routes;
+        std::vector<uint32_t> routeDestinations;
+        std::vector<std::string> destinations;              // Instrument names ("broadcast" = every instance)
+        int broadcastDestination = -1;
+        std::vector<std::shared_ptr<InstrumentInstance>> destinationInstances;  // Null if not loaded
+        std::vector<std::shared_ptr<InstrumentInstance>> broadcastInstances;
+        std::vector<juce::MidiBuffer> destinationBuffers;   // [slot * destinations.size() + d]
+        std::vector<uint32_t> routeEventCounts;             // [slot * routes.size() + r]
+        uint64_t retiredAtEpoch = 0;
+    };
+
+    // Per-dispatcher counters, summed by getStatistics()
+    struct alignas(64) DispatchCounters {
+        std::atomic<uint64_t> messagesRouted{0};
+        std::atomic<uint64_t> messagesFiltered{0};
+        std::atomic<uint64_t> messagesTransformed{0};
+    };
+
+    template <typename Events>
+    void dispatchEvents(const std::string& sourceDevice, const Events& events);
+    void deliverDestinationBuffers(DispatchTable& table, int slot);
+
+    std::unique_ptr<DispatchTable> compileDispatchTable() const;
+    void rebuildDispatchTable();    // Caller holds routesMutex_
+    bool hasDispatchersPassedEpoch(uint64_t epoch) const noexcept;
+    void reclaimRetiredTables();
+
+    void rebuildMidiLearnIndex();   // Caller holds midiLearnMutex_
 
     // Parameter updates
     void updateParameterFromMidi(const MidiLearnConfig& config, float midiValue);
@@ -461,15 +548,27 @@ private:
     std::vector<MidiDeviceInfo> availableOutputDevices_;
 
     // Routing
-    std::unordered_map<RouteID, std::unique_ptr<MidiRoute>> routes_;
+    std::unordered_map<RouteID, std::shared_ptr<MidiRoute>> routes_;
     std::unordered_map<std::string, std::vector<RouteID>> deviceRoutes_;
     std::unordered_map<std::string, std::vector<RouteID>> instrumentRoutes_;
-    RouteID nextRouteId_ = 1;
+    mutable RouteID nextRouteId_ = 1;
+
+    // Compiled dispatch table and epoch-based reclamation of replaced tables
+    std::atomic<DispatchTable*> activeTable_{nullptr};
+    std::atomic<uint64_t> globalEpoch_{0};
+    std::array<std::atomic<uint64_t>, maxConcurrentDispatchers> dispatcherEpochs_;
+    std::array<DispatchCounters, maxConcurrentDispatchers> dispatchCounters_;
+    std::vector<std::unique_ptr<DispatchTable>> retiredTables_;
 
     // MIDI learn
     std::unordered_map<std::string, MidiLearnConfig> midiLearnMappings_;
     std::unordered_set<std::string> activeMidiLearnSessions_;
 
+    // Dispatch-side MIDI learn index: sessions waiting for a controller, and
+    // per controller number the channels (bit n = channel n + 1) with a mapping
+    std::atomic<int> armedMidiLearnSessions_{0};
+    std::array<std::atomic<uint32_t>, 128> learnedControllerChannels_;
+
     // Custom filters and transforms
     std::unordered_map<std::string, std::function<bool(const juce::MidiMessage&)>> customFilters_;
     std::unordered_map<std::string, std::function<juce::MidiMessage(const juce::MidiMessage&)>> customTransforms_;
@@ -496,7 +595,7 @@ private:
     std::unordered_map<std::string, std::vector<MidiLearnConfig>> midiLearnPresets_;
 
     // Statistics and monitoring
-    MidiRoutingStats stats_;
+    mutable MidiRoutingStats stats_;
     std::function<void(const std::string&, const juce::MidiMessage&)> midiActivityCallback_;
 
     // Threading and synchronization
@@ -220,6 +220,9 @@ public:
      * Compute diff between two states
      *
      * Utility for computing what changed between two states.
+     * Collections the two states share (same persistent storage) are
+     * skipped by pointer comparison, so the cost follows the size of the
+     * edit rather than the size of the song.
      *
      * @param before State before change
      * @param after State after change
@@ -0,0 +1,324 @@
+/**
+ * PersistentArray - Structurally shared array for undo snapshots
+ *
+ * An immutable 32-way trie behind a small value handle. Copying a
+ * PersistentArray copies one pointer; editing one copies only the path from
+ * the root to the touched leaf (at most log32(n) nodes), so every other
+ * version keeps sharing the untouched subtrees.
+ *
+ * Core Features:
+ * - O(1) copy, O(log32 n) get/set/add
+ * - Identical subtrees compare by pointer, so diffs skip unchanged storage
+ * - Per-node byte accounting for undo history sizing
+ *
+ * Thread Safety:
+ * - Nodes are never mutated after publication; a handle can be read from any
+ *   thread while another thread edits its own copy
+ * - A single handle is not safe to edit concurrently
+ *
+ * The interface mirrors the subset of juce::Array/StringArray used by
+ * SongState (add, size, isEmpty, operator[]), so SongState callers keep
+ * compiling unchanged.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <unordered_set>
+
+template <typename ElementType>
+class PersistentArray
+{
+public:
+    static constexpr int bitsPerLevel = 5;
+    static constexpr int branching = 1 << bitsPerLevel;
+
+    PersistentArray() = default;
+
+    PersistentArray(std::initializer_list<ElementType> items)
+    {
+        for (const auto& item : items)
+            add(item);
+    }
+
+    // ========================================================================
+    // Reading
+    // ========================================================================
+
+    int size() const noexcept { return numElements; }
+    bool isEmpty() const noexcept { return numElements == 0; }
+
+    /**
+     * Element at index, or a default-constructed element when out of range
+     * (same contract as juce::Array::operator[])
+     */
+    const ElementType& operator[](int index) const noexcept
+    {
+        if (index < 0 || index >= numElements)
+            return defaultElement();
+
+        return getUnchecked(index);
+    }
+
+    const ElementType& getUnchecked(int index) const noexcept
+    {
+        const void* node = root.get();
+        for (int level = shift; level > 0; level -= bitsPerLevel)
+            node = static_cast<const Branch*>(node)->children[(size_t) ((index >> level) & (branching - 1))].get();
+
+        return static_cast<const Leaf*>(node)->values[(size_t) (index & (branching - 1))];
+    }
+
+    const ElementType& getFirst() const noexcept { return (*this)[0]; }
+    const ElementType& getLast() const noexcept { return (*this)[numElements - 1]; }
+
+    class ConstIterator
+    {
+    public:
+        ConstIterator(const PersistentArray& owner, int index) noexcept : owner(&owner), index(index) {}
+        const ElementType& operator*() const noexcept { return owner->getUnchecked(index); }
+        ConstIterator& operator++() noexcept { ++index; return *this; }
+        bool operator!=(const ConstIterator& other) const noexcept { return index != other.index; }
+        bool operator==(const ConstIterator& other) const noexcept { return index == other.index; }
+
+    private:
+        const PersistentArray* owner;
+        int index;
+    };
+
+    ConstIterator begin() const noexcept { return ConstIterator(*this, 0); }
+    ConstIterator end() const noexcept { return ConstIterator(*this, numElements); }
+
+    // ========================================================================
+    // Editing (path copy; other handles are unaffected)
+    // ========================================================================
+
+    void set(int index, const ElementType& value)
+    {
+        if (index < 0 || index >= numElements)
+            return;
+
+        root = setIn(root, shift, index, value);
+    }
+
+    void add(const ElementType& value)
+    {
+        if (root == nullptr)
+        {
+            auto leaf = std::make_shared<Leaf>();
+            leaf->values[0] = value;
+            root = std::move(leaf);
+            shift = 0;
+        }
+        else if (numElements == (branching << shift))
+        {
+            // Root is full: grow one level, old root becomes the first child
+            auto newRoot = std::make_shared<Branch>();
+            newRoot->children[0] = root;
+            newRoot->children[1] = makePath(shift, value);
+            root = std::move(newRoot);
+            shift += bitsPerLevel;
+        }
+        else
+        {
+            root = addIn(root, shift, numElements, value);
+        }
+
+        ++numElements;
+    }
+
+    void clear() noexcept
+    {
+        root.reset();
+        numElements = 0;
+        shift = 0;
+    }
+
+    // ========================================================================
+    // Structural sharing
+    // ========================================================================
+
+    /**
+     * True if both handles point at the same version (cheap equality)
+     */
+    bool sharesStorageWith(const PersistentArray& other) const noexcept
+    {
+        return root == other.root && numElements == other.numElements;
+    }
+
+    bool operator==(const PersistentArray& other) const
+    {
+        if (numElements != other.numElements)
+            return false;
+
+        bool equal = true;
+        forEachDifference(*this, other, [&equal](int) { equal = false; return false; });
+        return equal;
+    }
+
+    bool operator!=(const PersistentArray& other) const { return !(*this == other); }
+
+    /**
+     * Calls fn(index) for each index below min(a.size(), b.size()) whose
+     * elements differ. Subtrees the two versions share are skipped without
+     * being visited. fn returns false to stop early.
+     */
+    template <typename Callback>
+    static void forEachDifference(const PersistentArray& a, const PersistentArray& b, Callback&& fn)
+    {
+        const int common = a.numElements < b.numElements ? a.numElements : b.numElements;
+        if (common == 0 || a.root == b.root)
+            return;
+
+        // Bring both roots to the same height before walking in lockstep
+        const void* nodeA = a.root.get();
+        const void* nodeB = b.root.get();
+        int levelA = a.shift, levelB = b.shift;
+
+        while (levelA > levelB)
+        {
+            nodeA = static_cast<const Branch*>(nodeA)->children[0].get();
+            levelA -= bitsPerLevel;
+        }
+        while (levelB > levelA)
+        {
+            nodeB = static_cast<const Branch*>(nodeB)->children[0].get();
+            levelB -= bitsPerLevel;
+        }
+
+        diffNodes(nodeA, nodeB, levelA, 0, common, fn);
+    }
+
+    /**
+     * Bytes of trie nodes reachable from this handle that are not already in
+     * `visited`; adds them to it. Summing over a history gives the memory it
+     * actually holds, with shared nodes counted once.
+     */
+    size_t addUniqueStorageBytes(std::unordered_set<const void*>& visited) const
+    {
+        return countNode(root.get(), shift, visited);
+    }
+
+private:
+    struct Leaf
+    {
+        std::array<ElementType, branching> values {};
+    };
+
+    struct Branch
+    {
+        std::array<std::shared_ptr<const void>, branching> children;
+    };
+
+    using NodePtr = std::shared_ptr<const void>;
+
+    static const ElementType& defaultElement() noexcept
+    {
+        static const ElementType value {};
+        return value;
+    }
+
+    static size_t slotOf(int index, int level) noexcept
+    {
+        return (size_t) ((index >> level) & (branching - 1));
+    }
+
+    static NodePtr setIn(const NodePtr& node, int level, int index, const ElementType& value)
+    {
+        if (level == 0)
+        {
+            auto leaf = std::make_shared<Leaf>(*static_cast<const Leaf*>(node.get()));
+            leaf->values[slotOf(index, 0)] = value;
+            return leaf;
+        }
+
+        auto branch = std::make_shared<Branch>(*static_cast<const Branch*>(node.get()));
+        auto& child = branch->children[slotOf(index, level)];
+        child = setIn(child, level - bitsPerLevel, index, value);
+        return branch;
+    }
+
+    static NodePtr addIn(const NodePtr& node, int level, int index, const ElementType& value)
+    {
+        // Appends start a fresh subtree exactly where the path runs out
+        if (node == nullptr)
+            return makePath(level, value);
+
+        if (level == 0)
+            return setIn(node, 0, index, value);
+
+        auto branch = std::make_shared<Branch>(*static_cast<const Branch*>(node.get()));
+        auto& child = branch->children[slotOf(index, level)];
+        child = addIn(child, level - bitsPerLevel, index, value);
+        return branch;
+    }
+
+    static NodePtr makePath(int level, const ElementType& value)
+    {
+        if (level == 0)
+        {
+            auto leaf = std::make_shared<Leaf>();
+            leaf->values[0] = value;
+            return leaf;
+        }
+
+        auto branch = std::make_shared<Branch>();
+        branch->children[0] = makePath(level - bitsPerLevel, value);
+        return branch;
+    }
+
+    template <typename Callback>
+    static bool diffNodes(const void* a, const void* b, int level, int firstIndex, int limit, Callback& fn)
+    {
+        if (a == b)
+            return true;
+
+        if (level == 0)
+        {
+            const auto& leafA = *static_cast<const Leaf*>(a);
+            const auto& leafB = *static_cast<const Leaf*>(b);
+            for (int i = 0; i < branching && firstIndex + i < limit; ++i)
+            {
+                if (!(leafA.values[(size_t) i] == leafB.values[(size_t) i]) && !fn(firstIndex + i))
+                    return false;
+            }
+            return true;
+        }
+
+        const auto& branchA = *static_cast<const Branch*>(a);
+        const auto& branchB = *static_cast<const Branch*>(b);
+        const int childSpan = 1 << level;
+
+        for (int i = 0; i < branching; ++i)
+        {
+            const int childFirst = firstIndex + i * childSpan;
+            if (childFirst >= limit)
+                break;
+
+            if (!diffNodes(branchA.children[(size_t) i].get(), branchB.children[(size_t) i].get(),
+                           level - bitsPerLevel, childFirst, limit, fn))
+                return false;
+        }
+        return true;
+    }
+
+    static size_t countNode(const void* node, int level, std::unordered_set<const void*>& visited)
+    {
+        if (node == nullptr || !visited.insert(node).second)
+            return 0;
+
+        if (level == 0)
+            return sizeof(Leaf);
+
+        size_t bytes = sizeof(Branch);
+        for (const auto& child : static_cast<const Branch*>(node)->children)
+            bytes += countNode(child.get(), level - bitsPerLevel, visited);
+        return bytes;
+    }
+
+    NodePtr root;
+    int numElements = 0;
+    int shift = 0;      // bitsPerLevel * (height - 1); 0 means the root is a leaf
+};
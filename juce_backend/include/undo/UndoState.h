@@ -5,14 +5,16 @@
  * Designed for real-time audio safety with lock-free operations where possible.
  *
  * Core Features:
- * - Thread-safe state snapshots using ReadWriteLock
- * - Lock-free atomic reads for audio thread
+ * - Persistent SongState: collections are structurally shared tries, so a
+ *   snapshot is O(1) and an edit copies only the touched path
+ * - Wait-free reads for audio thread
+ * - Deferred reclamation: superseded versions are freed only after every
+ *   reader that could see them has left
  * - Safe state restoration with glitch prevention
- * - Shared pointer management for efficient copying
  *
  * Thread Safety:
- * - Audio thread: Lock-free atomic reads (getCurrentState)
- * - UI thread: Uses ReadWriteLock for mutations (snapshot, restore)
+ * - Audio thread: Wait-free reads (ScopedRead, getCurrentState)
+ * - UI thread: Writers serialised by a lock (setCurrentState, restore, clear)
  * - Never blocks in audio thread
  *
  * Integration:
@@ -25,9 +27,12 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_core/juce_core.h>
+#include "undo/PersistentArray.h"
+#include <array>
 #include <memory>
 #include <atomic>
 #include <shared_mutex>
+#include <unordered_set>
 
 // ============================================================================
 // Forward Declarations
@@ -74,7 +79,9 @@ struct RhythmSystem
  * Song state snapshot (simplified for audio engine)
  *
  * Contains the essential state needed for undo/redo operations.
- * This is a lightweight representation optimized for real-time use.
+ * Scalars and juce::Strings are copied by value (Strings are reference
+ * counted); collections are PersistentArrays, so copying a SongState shares
+ * every collection and editing one copies only the touched path.
  */
 struct SongState
 {
@@ -91,12 +98,12 @@ struct SongState
     juce::String consoleXProfileId;
 
     // Instrument configuration (simplified)
-    juce::StringArray instrumentIds;
-    juce::Array<double> mixGains;
-    juce::Array<double> mixPans;
+    PersistentArray<juce::String> instrumentIds;
+    PersistentArray<double> mixGains;
+    PersistentArray<double> mixPans;
 
     // Rhythm systems (Schillinger Book I)
-    juce::Array<RhythmSystem> rhythmSystems;
+    PersistentArray<RhythmSystem> rhythmSystems;
 
     /**
      * Create empty state
@@ -105,9 +112,20 @@ struct SongState
 
     /**
      * Clone state (thread-safe)
+     *
+     * O(1) in the size of the song: collections are shared with this state
+     * until either copy edits them.
      */
     std::shared_ptr<SongState> clone() const;
 
+    /**
+     * Bytes held by this state that are not already in `visited`
+     *
+     * Adds this state's storage to `visited`, so summing over an undo
+     * history counts shared storage once.
+     */
+    size_t addUniqueStorageBytes(std::unordered_set<const void*>& visited) const;
+
     /**
      * Check if state is valid
      */
@@ -198,12 +216,44 @@ public:
     bool restore(std::shared_ptr<SongState> state);
 
     /**
-     * Get current state (lock-free, audio thread safe)
+     * Scoped read of the current state (wait-free, audio thread safe)
+     *
+     * Pins the current version for the lifetime of the scope without touching
+     * its reference count, so the audio thread never ends up freeing a
+     * SongState. Keep the scope short: the version it pins cannot be
+     * reclaimed until it ends.
+     *
+     * ```cpp
+     * UndoState::ScopedRead state(undoState);
+     * const double tempo = state->tempo;
+     * ```
+     */
+    class ScopedRead
+    {
+    public:
+        explicit ScopedRead(const UndoState& owner) noexcept;
+        ~ScopedRead() noexcept;
+
+        const SongState& operator*() const noexcept { return *state; }
+        const SongState* operator->() const noexcept { return state; }
+
+    private:
+        const UndoState& owner;
+        int slot;
+        const SongState* state;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedRead)
+    };
+
+    /**
+     * Get current state (wait-free, audio thread safe)
      *
      * Called from audio thread.
-     * Uses atomic load for lock-free access.
+     * Pins the current version, copies its shared pointer and unpins.
      *
-     * NEVER blocks, suitable for real-time audio.
+     * NEVER blocks, suitable for real-time audio. Prefer ScopedRead on the
+     * audio thread: the returned pointer may outlive the version's retirement
+     * and then be the last owner.
      *
      * @return Shared pointer to current state
      */
@@ -255,17 +305,53 @@ public:
 
 private:
     /**
-     * Update atomic state pointer
+     * Publish a new current version
      *
-     * Internal method for atomic state updates.
-     * Ensures memory ordering for thread safety.
+     * Called with stateLock held. Swaps the current version slot, retires the
+     * old one together with the number of readers that entered it, and
+     * reclaims any retired version whose readers have all left.
      */
     void updateAtomicState(std::shared_ptr<SongState> state);
 
-    // Current state (atomic for lock-free access)
-    std::atomic<std::shared_ptr<SongState>*> atomicState;
+    /**
+     * Free retired versions whose readers have all departed (writer only)
+     *
+     * @return Number of free slots afterwards
+     */
+    int reclaimRetiredVersions();
+
+    int enterRead() const noexcept;
+    void exitRead(int slot) const noexcept;
+
+    /**
+     * One published version of the state.
+     *
+     * Readers register on the packed `currentVersion` word (slot index in the
+     * top bits, arrival count below) with a single fetch_add, then count
+     * themselves out on `departures`. When a slot is retired the writer
+     * records how many readers arrived; once as many have departed nobody
+     * can still see it and its state is released on the writer's thread.
+     */
+    struct VersionSlot
+    {
+        enum class Status { Free, Current, Retired };
+
+        std::shared_ptr<SongState> state;
+        mutable std::atomic<uint64_t> departures{0};
+        uint64_t arrivals = 0;          // Writer only, valid once retired
+        Status status = Status::Free;   // Writer only
+    };
+
+    static constexpr int numVersionSlots = 16;
+    static constexpr int versionSlotShift = 48;
+    static constexpr uint64_t arrivalMask = (uint64_t(1) << versionSlotShift) - 1;
+
+    std::array<VersionSlot, numVersionSlots> versionSlots;
+
+    // Current slot index << versionSlotShift | readers that entered it
+    mutable std::atomic<uint64_t> currentVersion{0};
 
-    // Read-write lock for mutations (snapshot, restore)
+    // Serialises writers (setCurrentState, restore, clear); readers never take it
     mutable std::shared_mutex stateLock;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UndoState)
@@ -544,9 +544,8 @@ float NexSynthPluginProcessor::getMicrotonalFrequency(int midiNote) {
         return 440.0f * std::pow(2.0f, (midiNote - 69) / 12.0f);
     }
 
-    // Get microtonal frequency from tuning manager
-    auto tuning = tuningManager->getTuning();
-    return tuning.midiToFrequency(midiNote);
+    // Precompiled table for the current tuning (no copy, no pow)
+    return tuningManager->getFrequencyTable().getFrequency(midiNote);
 }
 
 //==============================================================================
@@ -624,8 +624,21 @@ public:
     void advance(int numSamples);
     void processTrack(int trackIndex, float* output, int numSamples);
 
+    // Sample-accurate rendering. Steps, timing offsets, drill micro-hits and
+    // MIDI hits are queued at their exact sample time; callers render in
+    // sub-blocks of at most getSamplesUntilNextEvent() samples, calling
+    // advance() after each, so every trigger lands on its own sample.
+    static constexpr int numVoiceTypes = 15;
+
+    void beginBlock();
+    void scheduleTrigger(int trackIndex, int stepIndex, float velocity, int sampleOffset);
+    int getSamplesUntilNextEvent() const;
+    uint32_t getActiveVoiceMask() const;  // Bit n = voice for DrumType n is sounding
+    void renderVoice(Track::DrumType type, float* output, int numSamples);
+
     void setTrack(int index, const Track& track);
     Track getTrack(int index) const;
+    uint32_t getTrackLayoutVersion() const { return trackLayoutVersion_; }  // Bumped by setTrack
 
     int getNumTracks() const { return static_cast<int>(tracks_.size()); }
     bool hasActiveVoices() const;  // Check if any drum voice is playing
@@ -713,8 +726,26 @@ private:
     double sampleRate_ = 48000.0;
     float samplesPerBeat_ = 0.0f;
     float samplesPerStep_ = 0.0f;
-    double position_ = 0.0;
     int currentStep_ = 0;
+
+    // Sample clock and trigger queue (times are in samples since reset)
+    struct PendingTrigger
+    {
+        double time = 0.0;
+        int trackIndex = 0;
+        int stepIndex = 0;
+        float velocity = 0.0f;
+    };
+
+    static constexpr int kMaxPendingTriggers = 2 * kMaxMicroHitsPerBlock;
+    static constexpr float kStepLookahead = 0.25f;  // Steps are resolved this early so negative offsets land exactly
+
+    double sampleClock_ = 0.0;
+    double nextStepTime_ = 0.0;     // Nominal start of the next step
+    double currentStepTime_ = 0.0;  // Nominal start of the step being resolved
+    std::array<PendingTrigger, kMaxPendingTriggers> pendingTriggers_{};  // Sorted by time
+    int numPendingTriggers_ = 0;
+    uint32_t trackLayoutVersion_ = 0;
     int patternLength_ = 16;
 
     float swingAmount_ = 0.0f;
@@ -768,9 +799,13 @@ private:
     // PRNG state for probability checks (deterministic)
     mutable unsigned probSeed = 123;
 
-    float processDrumVoice(Track::DrumType type, float velocity);
+    void triggerVoice(Track::DrumType type, float velocity);
     void advanceStep();
 
+    // Trigger queue helpers
+    void queueTrigger(int trackIndex, int stepIndex, float velocity, double time);
+    void processDueEvents();
+
     // Timing system helpers
     void updateDillaDrift(int trackIndex, TimingRole role);
     void applyTimingLayers(int trackIndex, int stepIndex);
@@ -931,6 +966,10 @@ public:
     const char* getInstrumentName() const override { return "DrumMachine"; }
     const char* getInstrumentVersion() const override { return "1.0.0"; }
 
+    // Pattern and drill editing
+    StepSequencer& getSequencer() { return sequencer_; }
+    const StepSequencer& getSequencer() const { return sequencer_; }
+
 private:
     StepSequencer sequencer_;
 
@@ -987,6 +1026,17 @@ private:
     void syncVoiceParamsToDSP();
 
     std::array<bool, 16> activeVoices_{};  // Track MIDI-triggered voices
+
+    // Mixing: one voice is rendered at a time into voiceScratch_ (sized in
+    // prepare) and summed with per-voice gains, which fold in every track
+    // playing that voice and are only recomputed when volumes or pans change
+    void updateMixGains();
+
+    std::vector<float> voiceScratch_ = std::vector<float>(512, 0.0f);
+    std::array<float, StepSequencer::numVoiceTypes> voiceGainLeft_{};
+    std::array<float, StepSequencer::numVoiceTypes> voiceGainRight_{};
+    bool mixGainsDirty_ = true;
+    uint32_t mixGainsTrackVersion_ = 0;
 };
 
 //==============================================================================
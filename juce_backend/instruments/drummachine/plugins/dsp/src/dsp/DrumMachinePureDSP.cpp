@@ -18,6 +18,7 @@
 #include <cstring>
 #include <cstdlib>
 #include <cmath>
+#include <limits>
 
 namespace DSP {
 
@@ -672,8 +673,11 @@ void StepSequencer::prepare(double sampleRate, int samplesPerBlock)
     sampleRate_ = sampleRate;
     setTempo(tempo_);
 
-    // Reset micro-hit safety counter at start of each audio block
+    // Restart the sample clock; the first step lands one step in, as before
     microHitsThisBlock_ = 0;
+    sampleClock_ = 0.0;
+    nextStepTime_ = samplesPerStep_;
+    numPendingTriggers_ = 0;
 
     // Prepare all drum voices
     kick_.prepare(sampleRate);
@@ -695,9 +699,11 @@ void StepSequencer::prepare(double sampleRate, int samplesPerBlock)
 
 void StepSequencer::reset()
 {
-    position_ = 0.0;
     currentStep_ = 0;
     microHitsThisBlock_ = 0;  // Reset micro-hit safety counter
+    sampleClock_ = 0.0;
+    nextStepTime_ = samplesPerStep_;
+    numPendingTriggers_ = 0;
 
     kick_.reset();
     snare_.reset();
@@ -764,7 +770,7 @@ void StepSequencer::triggerTrack(int trackIndex, int stepIndex, float velocity)
     if (step.hasFlam)
     {
         // Trigger twice with slight offset
-        processDrumVoice(type, velocity * 0.7f);
+        triggerVoice(type, velocity * 0.7f);
     }
 
     // Apply roll
@@ -773,12 +779,12 @@ void StepSequencer::triggerTrack(int trackIndex, int stepIndex, float velocity)
         // Trigger multiple times within the step
         for (int i = 0; i < step.rollNotes; ++i)
         {
-            processDrumVoice(type, velocity);
+            triggerVoice(type, velocity);
         }
     }
     else
     {
-        processDrumVoice(type, velocity);
+        triggerVoice(type, velocity);
     }
 }
 
@@ -913,22 +919,100 @@ void StepSequencer::triggerAllTracks(int stepIndex)
         }
         else
         {
-            // GROOVE MODE: Apply timing layers (swing + role + Dilla)
+            // GROOVE MODE: Apply timing layers (swing + role + Dilla) and
+            // queue the hit at its offset within the step
             applyTimingLayers(i, stepIndex);
-            triggerTrack(i, stepIndex, cell.velocity / 127.0f);
+            queueTrigger(i, stepIndex, cell.velocity / 127.0f,
+                         currentStepTime_ + cell.timingOffset * samplesPerStep_);
         }
     }
 }
 
 void StepSequencer::advance(int numSamples)
 {
-    position_ += numSamples;
+    sampleClock_ += numSamples;
+    processDueEvents();
+}
+
+void StepSequencer::beginBlock()
+{
+    microHitsThisBlock_ = 0;
+    processDueEvents();
+}
+
+void StepSequencer::scheduleTrigger(int trackIndex, int stepIndex, float velocity, int sampleOffset)
+{
+    queueTrigger(trackIndex, stepIndex, velocity, sampleClock_ + std::max(0, sampleOffset));
+    processDueEvents();
+}
+
+int StepSequencer::getSamplesUntilNextEvent() const
+{
+    double nextEvent = std::numeric_limits<double>::max();
+
+    if (samplesPerStep_ > 0.0f)
+    {
+        nextEvent = nextStepTime_ - kStepLookahead * samplesPerStep_;
+    }
 
-    // Check if we've advanced past the current step
-    while (position_ >= samplesPerStep_)
+    if (numPendingTriggers_ > 0)
     {
-        position_ -= samplesPerStep_;
-        advanceStep();
+        nextEvent = std::min(nextEvent, pendingTriggers_[0].time);
+    }
+
+    // Events fire on the first sample at or after their time
+    const double samples = std::ceil(nextEvent - sampleClock_);
+    return static_cast<int>(std::max(1.0, std::min(samples, 1.0e9)));
+}
+
+void StepSequencer::queueTrigger(int trackIndex, int stepIndex, float velocity, double time)
+{
+    if (numPendingTriggers_ >= kMaxPendingTriggers)
+        return;  // Drop rather than allocate on the audio thread
+
+    // Never schedule into the past (e.g. offsets earlier than the lookahead)
+    time = std::max(time, sampleClock_);
+
+    // Insert after any triggers at the same time so equal-time hits keep their order
+    int insertAt = numPendingTriggers_;
+    while (insertAt > 0 && pendingTriggers_[insertAt - 1].time > time)
+    {
+        pendingTriggers_[insertAt] = pendingTriggers_[insertAt - 1];
+        --insertAt;
+    }
+
+    pendingTriggers_[insertAt] = { time, trackIndex, stepIndex, velocity };
+    ++numPendingTriggers_;
+}
+
+void StepSequencer::processDueEvents()
+{
+    for (;;)
+    {
+        const bool stepDue = samplesPerStep_ > 0.0f
+                          && nextStepTime_ - kStepLookahead * samplesPerStep_ <= sampleClock_;
+        const bool triggerDue = numPendingTriggers_ > 0 && pendingTriggers_[0].time <= sampleClock_;
+
+        if (stepDue && (!triggerDue || nextStepTime_ - kStepLookahead * samplesPerStep_ <= pendingTriggers_[0].time))
+        {
+            // Resolve the next step ahead of its nominal start; its hits are queued
+            currentStepTime_ = nextStepTime_;
+            nextStepTime_ += samplesPerStep_;
+            advanceStep();
+        }
+        else if (triggerDue)
+        {
+            const PendingTrigger trigger = pendingTriggers_[0];
+            --numPendingTriggers_;
+            std::copy(pendingTriggers_.begin() + 1, pendingTriggers_.begin() + 1 + numPendingTriggers_,
+                      pendingTriggers_.begin());
+
+            triggerTrack(trigger.trackIndex, trigger.stepIndex, trigger.velocity);
+        }
+        else
+        {
+            break;
+        }
     }
 }
 
@@ -1109,16 +1193,8 @@ void StepSequencer::processTrack(int trackIndex, float* output, int numSamples)
 {
     if (trackIndex < 0 || trackIndex >= static_cast<int>(tracks_.size())) return;
 
-    // Clear output
-    std::fill(output, output + numSamples, 0.0f);
-
     // Process the drum voice for this track
-    Track::DrumType type = tracks_[trackIndex].type;
-
-    for (int i = 0; i < numSamples; ++i)
-    {
-        output[i] = processDrumVoice(type, 0.0f);  // 0 velocity = process existing envelope
-    }
+    renderVoice(tracks_[trackIndex].type, output, numSamples);
 }
 
 void StepSequencer::setTrack(int index, const Track& track)
@@ -1126,6 +1202,7 @@ void StepSequencer::setTrack(int index, const Track& track)
     if (index >= 0 && index < static_cast<int>(tracks_.size()))
     {
         tracks_[index] = track;
+        ++trackLayoutVersion_;
     }
 }
 
@@ -1160,72 +1237,90 @@ bool StepSequencer::hasActiveVoices() const
     return false;
 }
 
-float StepSequencer::processDrumVoice(Track::DrumType type, float velocity)
+uint32_t StepSequencer::getActiveVoiceMask() const
 {
-    switch (type)
-    {
-        case Track::DrumType::Kick:
-            if (velocity > 0.0f) kick_.trigger(velocity);
-            return kick_.processSample();
-
-        case Track::DrumType::Snare:
-            if (velocity > 0.0f) snare_.trigger(velocity);
-            return snare_.processSample();
-
-        case Track::DrumType::HiHatClosed:
-            if (velocity > 0.0f) hihatClosed_.trigger(velocity);
-            return hihatClosed_.processSample();
+    uint32_t mask = 0;
 
-        case Track::DrumType::HiHatOpen:
-            if (velocity > 0.0f) hihatOpen_.trigger(velocity);
-            return hihatOpen_.processSample();
-
-        case Track::DrumType::Clap:
-            if (velocity > 0.0f) clap_.trigger(velocity);
-            return clap_.processSample();
-
-        case Track::DrumType::TomLow:
-            if (velocity > 0.0f) tomLow_.trigger(velocity);
-            return tomLow_.processSample();
-
-        case Track::DrumType::TomMid:
-            if (velocity > 0.0f) tomMid_.trigger(velocity);
-            return tomMid_.processSample();
-
-        case Track::DrumType::TomHigh:
-            if (velocity > 0.0f) tomHigh_.trigger(velocity);
-            return tomHigh_.processSample();
-
-        case Track::DrumType::Crash:
-            if (velocity > 0.0f) crash_.trigger(velocity);
-            return crash_.processSample();
-
-        case Track::DrumType::Ride:
-            if (velocity > 0.0f) ride_.trigger(velocity);
-            return ride_.processSample();
+    auto setBit = [&mask](Track::DrumType type, bool active)
+    {
+        if (active) mask |= 1u << static_cast<int>(type);
+    };
 
-        case Track::DrumType::Cowbell:
-            if (velocity > 0.0f) cowbell_.trigger(velocity);
-            return cowbell_.processSample();
+    setBit(Track::DrumType::Kick, kick_.isActive());
+    setBit(Track::DrumType::Snare, snare_.isActive());
+    setBit(Track::DrumType::HiHatClosed, hihatClosed_.isActive());
+    setBit(Track::DrumType::HiHatOpen, hihatOpen_.isActive());
+    setBit(Track::DrumType::Clap, clap_.isActive());
+    setBit(Track::DrumType::TomLow, tomLow_.isActive());
+    setBit(Track::DrumType::TomMid, tomMid_.isActive());
+    setBit(Track::DrumType::TomHigh, tomHigh_.isActive());
+    setBit(Track::DrumType::Crash, crash_.isActive());
+    setBit(Track::DrumType::Ride, ride_.isActive());
+    setBit(Track::DrumType::Cowbell, cowbell_.isActive());
+    setBit(Track::DrumType::Shaker, shaker_.isActive());
+    setBit(Track::DrumType::Tambourine, tambourine_.isActive());
+    setBit(Track::DrumType::Percussion, percussion_.isActive());
+    setBit(Track::DrumType::Special, special_.isActive());
 
-        case Track::DrumType::Shaker:
-            if (velocity > 0.0f) shaker_.trigger(velocity);
-            return shaker_.processSample();
+    return mask;
+}
 
-        case Track::DrumType::Tambourine:
-            if (velocity > 0.0f) tambourine_.trigger(velocity);
-            return tambourine_.processSample();
+void StepSequencer::triggerVoice(Track::DrumType type, float velocity)
+{
+    if (velocity <= 0.0f) return;
 
-        case Track::DrumType::Percussion:
-            if (velocity > 0.0f) percussion_.trigger(velocity);
-            return percussion_.processSample();
+    switch (type)
+    {
+        case Track::DrumType::Kick:        kick_.trigger(velocity); break;
+        case Track::DrumType::Snare:       snare_.trigger(velocity); break;
+        case Track::DrumType::HiHatClosed: hihatClosed_.trigger(velocity); break;
+        case Track::DrumType::HiHatOpen:   hihatOpen_.trigger(velocity); break;
+        case Track::DrumType::Clap:        clap_.trigger(velocity); break;
+        case Track::DrumType::TomLow:      tomLow_.trigger(velocity); break;
+        case Track::DrumType::TomMid:      tomMid_.trigger(velocity); break;
+        case Track::DrumType::TomHigh:     tomHigh_.trigger(velocity); break;
+        case Track::DrumType::Crash:       crash_.trigger(velocity); break;
+        case Track::DrumType::Ride:        ride_.trigger(velocity); break;
+        case Track::DrumType::Cowbell:     cowbell_.trigger(velocity); break;
+        case Track::DrumType::Shaker:      shaker_.trigger(velocity); break;
+        case Track::DrumType::Tambourine:  tambourine_.trigger(velocity); break;
+        case Track::DrumType::Percussion:  percussion_.trigger(velocity); break;
+        case Track::DrumType::Special:     special_.trigger(velocity); break;
+        default: break;
+    }
+}
 
-        case Track::DrumType::Special:
-            if (velocity > 0.0f) special_.trigger(velocity);
-            return special_.processSample();
+namespace
+{
+    // One switch per sub-block instead of one per sample
+    template <typename Voice>
+    void renderVoiceSamples(Voice& voice, float* output, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = voice.processSample();
+    }
+}
 
-        default:
-            return 0.0f;
+void StepSequencer::renderVoice(Track::DrumType type, float* output, int numSamples)
+{
+    switch (type)
+    {
+        case Track::DrumType::Kick:        renderVoiceSamples(kick_, output, numSamples); break;
+        case Track::DrumType::Snare:       renderVoiceSamples(snare_, output, numSamples); break;
+        case Track::DrumType::HiHatClosed: renderVoiceSamples(hihatClosed_, output, numSamples); break;
+        case Track::DrumType::HiHatOpen:   renderVoiceSamples(hihatOpen_, output, numSamples); break;
+        case Track::DrumType::Clap:        renderVoiceSamples(clap_, output, numSamples); break;
+        case Track::DrumType::TomLow:      renderVoiceSamples(tomLow_, output, numSamples); break;
+        case Track::DrumType::TomMid:      renderVoiceSamples(tomMid_, output, numSamples); break;
+        case Track::DrumType::TomHigh:     renderVoiceSamples(tomHigh_, output, numSamples); break;
+        case Track::DrumType::Crash:       renderVoiceSamples(crash_, output, numSamples); break;
+        case Track::DrumType::Ride:        renderVoiceSamples(ride_, output, numSamples); break;
+        case Track::DrumType::Cowbell:     renderVoiceSamples(cowbell_, output, numSamples); break;
+        case Track::DrumType::Shaker:      renderVoiceSamples(shaker_, output, numSamples); break;
+        case Track::DrumType::Tambourine:  renderVoiceSamples(tambourine_, output, numSamples); break;
+        case Track::DrumType::Percussion:  renderVoiceSamples(percussion_, output, numSamples); break;
+        case Track::DrumType::Special:     renderVoiceSamples(special_, output, numSamples); break;
+        default: std::fill(output, output + numSamples, 0.0f); break;
     }
 }
 
@@ -1247,6 +1342,10 @@ bool DrumMachinePureDSP::prepare(double sampleRate, int blockSize)
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
 
+    // Mix scratch for one voice; larger host blocks are rendered in slices
+    voiceScratch_.assign(static_cast<size_t>(std::max(blockSize, 1)), 0.0f);
+    mixGainsDirty_ = true;
+
     sequencer_.prepare(sampleRate, blockSize);
     sequencer_.setTempo(params_.tempo);
     sequencer_.setPatternLength(static_cast<int>(params_.patternLength));
@@ -1282,36 +1381,79 @@ void DrumMachinePureDSP::process(float** outputs, int numChannels, int numSample
         std::fill(outputs[ch], outputs[ch] + numSamples, 0.0f);
     }
 
-    // Create temp buffer for mixing
-    float* tempBuffer = new float[numSamples];
-    std::fill(tempBuffer, tempBuffer + numSamples, 0.0f);
+    if (numChannels <= 0 || numSamples <= 0)
+        return;
 
-    // Process each track
-    for (int track = 0; track < 16; ++track)
-    {
-        sequencer_.processTrack(track, tempBuffer, numSamples);
+    if (mixGainsDirty_ || mixGainsTrackVersion_ != sequencer_.getTrackLayoutVersion())
+        updateMixGains();
 
-        // Apply track volume and pan
-        float volume = params_.trackVolumes[track];
-        float pan = 0.5f;  // Default center (could be per-track)
+    sequencer_.beginBlock();
 
-        for (int i = 0; i < numSamples; ++i)
+    float* scratch = voiceScratch_.data();
+    const int maxChunk = static_cast<int>(voiceScratch_.size());
+    int offset = 0;
+
+    // Split the block at every queued event so each hit starts on its own sample
+    while (offset < numSamples)
+    {
+        const int chunk = std::min({ numSamples - offset, sequencer_.getSamplesUntilNextEvent(), maxChunk });
+        const uint32_t activeVoices = sequencer_.getActiveVoiceMask();
+
+        for (int voice = 0; voice < StepSequencer::numVoiceTypes; ++voice)
         {
-            float sample = tempBuffer[i] * volume * params_.masterVolume;
+            // Skip voices that have fully decayed
+            if ((activeVoices & (1u << voice)) == 0)
+                continue;
+
+            sequencer_.renderVoice(static_cast<Track::DrumType>(voice), scratch, chunk);
+
+            const float gainLeft = voiceGainLeft_[voice];
+            const float gainRight = voiceGainRight_[voice];
+            float* left = outputs[0] + offset;
 
-            // Apply pan
-            outputs[0][i] += sample * std::sqrt(1.0f - pan);
             if (numChannels > 1)
             {
-                outputs[1][i] += sample * std::sqrt(pan);
+                float* right = outputs[1] + offset;
+                for (int i = 0; i < chunk; ++i)
+                {
+                    left[i] += scratch[i] * gainLeft;
+                    right[i] += scratch[i] * gainRight;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < chunk; ++i)
+                    left[i] += scratch[i] * gainLeft;
             }
         }
+
+        sequencer_.advance(chunk);
+        offset += chunk;
     }
+}
+
+void DrumMachinePureDSP::updateMixGains()
+{
+    voiceGainLeft_.fill(0.0f);
+    voiceGainRight_.fill(0.0f);
 
-    // Advance sequencer
-    sequencer_.advance(numSamples);
+    // Equal-power pan per track; tracks sharing a voice type sum into its gains
+    for (int track = 0; track < sequencer_.getNumTracks(); ++track)
+    {
+        const Track trackState = sequencer_.getTrack(track);
+        const int voice = static_cast<int>(trackState.type);
+        if (voice < 0 || voice >= StepSequencer::numVoiceTypes)
+            continue;
+
+        const float pan = clamp((trackState.pan + 1.0f) * 0.5f, 0.0f, 1.0f);
+        const float gain = params_.trackVolumes[track] * params_.masterVolume;
 
-    delete[] tempBuffer;
+        voiceGainLeft_[voice] += gain * std::sqrt(1.0f - pan);
+        voiceGainRight_[voice] += gain * std::sqrt(pan);
+    }
+
+    mixGainsTrackVersion_ = sequencer_.getTrackLayoutVersion();
+    mixGainsDirty_ = false;
 }
 
 void DrumMachinePureDSP::handleEvent(const ScheduledEvent& event)
@@ -1324,7 +1466,8 @@ void DrumMachinePureDSP::handleEvent(const ScheduledEvent& event)
             {
                 int track = event.data.note.midiNote % 16;
                 float velocity = event.data.note.velocity;  // Already normalized (0-1)
-                sequencer_.triggerTrack(track, sequencer_.getCurrentStep(), velocity);
+                sequencer_.scheduleTrigger(track, sequencer_.getCurrentStep(), velocity,
+                                           static_cast<int>(event.sampleOffset));
             }
             break;
 
@@ -1473,6 +1616,8 @@ void DrumMachinePureDSP::setParameter(const char* paramId, float value)
         }
     }
 
+    mixGainsDirty_ = true;
+
     // Log parameter change (shared telemetry infrastructure)
     LOG_PARAMETER_CHANGE("DrumMachine", paramId, oldValue, value);
 }
@@ -1883,6 +2028,7 @@ bool DrumMachinePureDSP::loadPresetEx(const char* jsonData, int sections)
     }
     sequencer_.setDillaParams(dillaParams);
 
+    mixGainsDirty_ = true;
     return true;
 }
 
@@ -2111,7 +2257,7 @@ void StepSequencer::scheduleMicroBurst(int trackIndex, const StepCell& cell,
             // Safety check for single hit
             if (microHitsThisBlock_ < kMaxMicroHitsPerBlock)
             {
-                triggerTrack(trackIndex, 0, cell.velocity / 127.0f);
+                queueTrigger(trackIndex, 0, cell.velocity / 127.0f, currentStepTime_ + sampleDelay);
                 microHitsThisBlock_++;
             }
         }
@@ -2233,8 +2379,8 @@ void StepSequencer::scheduleMicroBurst(int trackIndex, const StepCell& cell,
         microCell.velocity = midiVel;
         microCell.useDrill = false; // Prevent infinite recursion
 
-        // Trigger the micro-hit
-        triggerTrack(trackIndex, 0, v);
+        // Queue the micro-hit at its position within the step
+        queueTrigger(trackIndex, 0, v, currentStepTime_ + timingOffsetFraction * samplesPerStep_);
 
         // Increment safety counter
         microHitsThisBlock_++;
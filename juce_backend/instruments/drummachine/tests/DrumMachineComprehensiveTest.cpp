@@ -13,6 +13,7 @@
 #include "../include/dsp/DrumMachinePureDSP.h"
 #include <iostream>
 #include <cstdio>
+#include <chrono>
 #include <cmath>
 #include <vector>
 
@@ -326,6 +327,147 @@ bool testStereoOutput(TestStats& stats) {
     return true;
 }
 
+//==============================================================================
+// Test 8: Sample-Accurate Sequencing
+//==============================================================================
+
+// Sample indices where a hit starts: first non-silent sample after a gap.
+// Idle voices are not rendered, so silence between hits is exactly zero.
+std::vector<int> findOnsets(const std::vector<float>& buffer, float threshold = 0.0f, int minGap = 1000) {
+    std::vector<int> onsets;
+    int lastLoud = -minGap;
+    for (int i = 0; i < static_cast<int>(buffer.size()); ++i) {
+        if (std::abs(buffer[i]) > threshold) {
+            if (i - lastLoud >= minGap) onsets.push_back(i);
+            lastLoud = i;
+        }
+    }
+    return onsets;
+}
+
+// Kick on every step, no Dilla drift, so hits fall exactly on the step grid
+std::vector<float> renderKickGrid(int bufferSize, float swing, int numSamples) {
+    DrumMachinePureDSP dm;
+    dm.prepare(48000.0, 512);
+    dm.setParameter("dilla_amount", 0.0f);
+    dm.setParameter("swing", swing);
+
+    Track kick = dm.getSequencer().getTrack(0);
+    for (auto& step : kick.steps) {
+        step.active = true;
+        step.velocity = 100;
+    }
+    dm.getSequencer().setTrack(0, kick);
+
+    std::vector<float> left(numSamples);
+    std::vector<float> right(numSamples);
+    processAudioInChunks(dm, left.data(), right.data(), numSamples, bufferSize);
+    return left;
+}
+
+bool testSampleAccurateSequencing(TestStats& stats) {
+    std::cout << "\n[Test 8] Sample-Accurate Sequencing" << std::endl;
+
+    const int numSamples = 96000;
+    const int samplesPerStep = 6000;  // 16th notes at 120 BPM, 48 kHz
+
+    for (float swing : { 0.0f, 0.5f }) {
+        // Swing 0.5 delays odd steps by a quarter step
+        std::vector<int> expected;
+        for (int step = 1; step * samplesPerStep < numSamples; ++step) {
+            expected.push_back(step * samplesPerStep + ((step % 2 == 1) ? static_cast<int>(swing * 0.5f * samplesPerStep) : 0));
+        }
+
+        for (int bufferSize : { 64, 333, 512 }) {
+            const auto onsets = findOnsets(renderKickGrid(bufferSize, swing, numSamples));
+            std::cout << "    swing " << swing << ", buffer " << bufferSize << ": "
+                      << onsets.size() << " hits" << std::endl;
+
+            if (onsets != expected) {
+                stats.fail("sample_accurate_steps",
+                           "Hits off the step grid at buffer size " + std::to_string(bufferSize));
+                return false;
+            }
+        }
+    }
+
+    // MIDI hits land on their sample offset within the block
+    DrumMachinePureDSP dm;
+    dm.prepare(48000.0, 512);
+
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 300;
+    event.data.note.midiNote = 36;
+    event.data.note.velocity = 0.8f;
+    dm.handleEvent(event);
+
+    std::vector<float> left(512);
+    std::vector<float> right(512);
+    float* outputs[] = { left.data(), right.data() };
+    dm.process(outputs, 2, 512);
+
+    const auto onsets = findOnsets(left, 0.0f, 1);
+    if (onsets.empty() || onsets.front() != 300) {
+        stats.fail("sample_accurate_midi", "MIDI hit did not start at its sample offset");
+        return false;
+    }
+
+    stats.pass("sample_accurate_sequencing");
+    return true;
+}
+
+//==============================================================================
+// Test 9: Drill Pattern Performance
+//==============================================================================
+
+double renderDrillPattern(int bufferSize, int numSamples) {
+    DrumMachinePureDSP dm;
+    dm.prepare(48000.0, bufferSize);
+    dm.setParameter("tempo", 174.0f);
+
+    auto& sequencer = dm.getSequencer();
+    sequencer.setDrillMode(StepSequencer::presetAmenShredder());
+    sequencer.setRhythmFeelMode(RhythmFeelMode::Drill);
+
+    for (int t = 0; t < sequencer.getNumTracks(); ++t) {
+        Track track = sequencer.getTrack(t);
+        for (int s = 0; s < 16; ++s) {
+            track.steps[s].active = ((s + t) % 3) != 0;
+            track.steps[s].velocity = static_cast<uint8_t>(70 + (s * 7) % 57);
+        }
+        sequencer.setTrack(t, track);
+    }
+
+    std::vector<float> left(bufferSize);
+    std::vector<float> right(bufferSize);
+    float* outputs[] = { left.data(), right.data() };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int offset = 0; offset < numSamples; offset += bufferSize) {
+        dm.process(outputs, 2, bufferSize);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool testDrillPerformance(TestStats& stats) {
+    std::cout << "\n[Test 9] Drill Pattern Performance" << std::endl;
+
+    const int numSamples = 48000 * 20;
+    const double seconds512 = renderDrillPattern(512, numSamples);
+    const double seconds64 = renderDrillPattern(64, numSamples);
+
+    std::cout << "    512-sample buffers: " << (1.0e9 * seconds512 / numSamples) << " ns/sample" << std::endl;
+    std::cout << "     64-sample buffers: " << (1.0e9 * seconds64 / numSamples) << " ns/sample" << std::endl;
+
+    // Reported only: wall-clock ratios are too noisy to fail on
+    std::cout << "    64/512 cost ratio: " << (seconds64 / seconds512) << std::endl;
+
+    stats.pass("drill_performance");
+    return true;
+}
+
 //==============================================================================
 // Main Test Runner
 //==============================================================================
@@ -344,6 +486,8 @@ int main(int argc, char* argv[]) {
     testSampleRates(stats);
     testParameterChanges(stats);
     testStereoOutput(stats);
+    testSampleAccurateSequencing(stats);
+    testDrillPerformance(stats);
 
     stats.printSummary();
 
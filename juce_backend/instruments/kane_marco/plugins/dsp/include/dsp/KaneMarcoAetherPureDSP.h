@@ -137,6 +137,54 @@ struct ModalFilter
     float computeQ(float freq, float damping, float structure);
 };
 
+/**
+ * @brief Structure-of-arrays bank of ModalFilter modes
+ *
+ * Runs the same recurrence as ModalFilter::processSample with the decay factor,
+ * phase increment and 1/N normalisation precomputed per mode, and processes the
+ * modes a vector at a time (16 lanes AVX-512, 8 AVX, 4 SSE2/NEON). The mode
+ * count is padded to the lane width with silent modes, so bodies can carry any
+ * number of modes.
+ *
+ * The sine is a polynomial rather than the 1024-point lookup table. Output
+ * stays within 1e-5 of the summed modal energy (/N) of the scalar path; the
+ * table's own interpolation error is about 5e-6.
+ */
+class ModalResonatorBank
+{
+public:
+    ModalResonatorBank() = default;
+    ~ModalResonatorBank() = default;
+
+    /**
+     * @brief Compile coefficients from the given modes
+     *
+     * @param resetState  Zero phase and energy of every mode; otherwise the
+     *                    running state is kept for modes that still exist
+     */
+    void setModes(const std::vector<ModalFilter>& modes, bool resetState);
+    void reset();
+
+    float processSample(float excitation);
+    void processBlock(const float* excitation, float* output, int numSamples);
+
+    int getNumModes() const { return numModes_; }
+
+private:
+    int numModes_ = 0;
+    int paddedModes_ = 0;
+    float outputScale_ = 0.0f;
+
+    // Coefficients
+    std::vector<float> amplitude_;
+    std::vector<float> decayFactor_;
+    std::vector<float> phaseIncrement_;
+
+    // State
+    std::vector<float> energy_;
+    std::vector<float> phase_;
+};
+
 //==============================================================================
 // Physical Modeling Components
 //==============================================================================
@@ -259,6 +307,7 @@ public:
     void reset();
 
     float processSample(float bridgeEnergy);
+    void processBlock(const float* bridgeEnergy, float* output, int numSamples);
     void setResonance(float amount);
     void setMaterial(MaterialType material);
     void loadGuitarBodyPreset();
@@ -266,11 +315,17 @@ public:
     void loadOrchestralStringPreset();
     float getModeFrequency(int index) const;
 
+    // Replace the body with an arbitrary set of modes (not real-time safe)
+    void setModes(const std::vector<ModalFilter>& modes);
+    const std::vector<ModalFilter>& getModes() const { return modes_; }
+    int getNumModes() const { return static_cast<int>(modes_.size()); }
+
     // Advanced: Re-calculate Q values for all modes based on material
     void recalculateModeQ(float damping, float structure);
 
 private:
-    std::vector<ModalFilter> modes_;
+    std::vector<ModalFilter> modes_;   // Mode parameters
+    ModalResonatorBank bank_;          // Compiled coefficients and running state
     double sr = 48000.0;
     MaterialType material_ = MaterialType::StandardWood;
 };
@@ -367,6 +422,7 @@ public:
 
 private:
     std::vector<WaveguideString> strings_;
+    float outputGain_ = 0.0f;
     bool enabled_ = false;
     double sr = 48000.0;
 };
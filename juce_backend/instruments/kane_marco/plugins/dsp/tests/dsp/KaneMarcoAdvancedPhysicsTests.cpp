@@ -11,6 +11,7 @@
     - Sympathetic Coupling Tests
     - Bridge Impedance Tests
     - Material Preset Tests
+    - SIMD Modal Bank Tests
 
   ==============================================================================
 */
@@ -21,6 +22,7 @@
 #include <algorithm>
 #include <chrono>
 #include <array>
+#include <random>
 #include <vector>
 
 //==============================================================================
@@ -524,6 +526,158 @@ TEST_F(KaneMarcoAdvancedPhysicsTests, Material_OrchestralStringIsBrightest)
     std::cout << "Orchestral string highest mode: " << highestMode << " Hz" << std::endl;
 }
 
+//==============================================================================
+// TEST: SIMD Modal Bank
+//==============================================================================
+
+namespace
+{
+    std::vector<DSP::ModalFilter> makeDenseBody(int numModes)
+    {
+        std::vector<DSP::ModalFilter> modes;
+        for (int i = 0; i < numModes; ++i)
+        {
+            DSP::ModalFilter mode;
+            mode.frequency = 80.0f * (1.0f + 0.73f * static_cast<float>(i));
+            mode.amplitude = 1.0f / (1.0f + 0.1f * static_cast<float>(i));
+            mode.baseAmplitude = mode.amplitude;
+            mode.decay = 1.0f;
+            mode.modeIndex = static_cast<float>(i % 8);
+            modes.push_back(mode);
+        }
+        return modes;
+    }
+
+    /**
+     * Worst deviation of the body from the scalar ModalFilter path, relative to
+     * the mean modal energy at that sample
+     */
+    double worstDeviationFromScalar(DSP::ModalBodyResonator& body, int numSamples)
+    {
+        std::vector<DSP::ModalFilter> reference = body.getModes();
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> noise(-0.3f, 0.3f);
+
+        double worst = 0.0;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float input = (i == 0) ? 1.0f : (i < 2000 ? noise(rng) : 0.0f);
+
+            float expected = 0.0f;
+            double meanEnergy = 0.0;
+            for (auto& mode : reference)
+            {
+                expected += mode.processSample(input);
+                meanEnergy += std::abs(mode.energy);
+            }
+            expected /= static_cast<float>(reference.size());
+            meanEnergy /= static_cast<double>(reference.size());
+
+            const float actual = body.processSample(input);
+            if (meanEnergy > 1e-9)
+                worst = std::max(worst, std::abs(static_cast<double>(actual) - expected) / meanEnergy);
+        }
+        return worst;
+    }
+}
+
+TEST_F(KaneMarcoAdvancedPhysicsTests, ModalBank_MatchesScalarPathWithinTolerance)
+{
+    double sampleRate = 48000.0;
+
+    DSP::ModalBodyResonator guitar;
+    guitar.prepare(sampleRate);
+    guitar.loadGuitarBodyPreset();
+
+    DSP::ModalBodyResonator piano;
+    piano.prepare(sampleRate);
+    piano.loadPianoBodyPreset();
+
+    DSP::ModalBodyResonator orchestral;
+    orchestral.prepare(sampleRate);
+    orchestral.loadOrchestralStringPreset();
+    orchestral.setResonance(1.7f);
+    orchestral.setMaterial(DSP::ModalBodyResonator::MaterialType::Metal);
+
+    // Not a multiple of any lane width
+    DSP::ModalBodyResonator dense;
+    dense.prepare(sampleRate);
+    dense.setModes(makeDenseBody(67));
+    EXPECT_EQ(dense.getNumModes(), 67);
+
+    EXPECT_LT(worstDeviationFromScalar(guitar, 48000), 1e-5);
+    EXPECT_LT(worstDeviationFromScalar(piano, 48000), 1e-5);
+    EXPECT_LT(worstDeviationFromScalar(orchestral, 48000), 1e-5);
+    EXPECT_LT(worstDeviationFromScalar(dense, 48000), 1e-5);
+}
+
+TEST_F(KaneMarcoAdvancedPhysicsTests, ModalBank_BlockMatchesPerSample)
+{
+    DSP::ModalBodyResonator perSample;
+    DSP::ModalBodyResonator perBlock;
+    perSample.prepare(48000.0);
+    perBlock.prepare(48000.0);
+    perSample.setModes(makeDenseBody(64));
+    perBlock.setModes(makeDenseBody(64));
+
+    std::vector<float> input(512, 0.0f);
+    std::vector<float> output(512, 0.0f);
+    input[0] = 1.0f;
+    input[300] = -0.5f;
+
+    perBlock.processBlock(input.data(), output.data(), 512);
+
+    for (int i = 0; i < 512; ++i)
+    {
+        EXPECT_EQ(output[i], perSample.processSample(input[i])) << "sample " << i;
+    }
+}
+
+TEST_F(KaneMarcoAdvancedPhysicsTests, ModalBank_BenchmarkSixtyFourModes)
+{
+    constexpr int numSamples = 48000 * 4;
+    constexpr int blockSize = 512;
+
+    std::vector<DSP::ModalFilter> scalarModes = makeDenseBody(64);
+    for (auto& mode : scalarModes)
+        mode.prepare(48000.0);
+
+    DSP::ModalBodyResonator body;
+    body.prepare(48000.0);
+    body.setModes(scalarModes);
+
+    std::vector<float> input(numSamples, 0.0f);
+    for (int i = 0; i < numSamples; i += 4800)
+        input[i] = 1.0f;
+    std::vector<float> output(blockSize, 0.0f);
+
+    float scalarSum = 0.0f;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < numSamples; ++i)
+    {
+        float sample = 0.0f;
+        for (auto& mode : scalarModes)
+            sample += mode.processSample(input[i]);
+        scalarSum += sample / static_cast<float>(scalarModes.size());
+    }
+    const double scalarSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    float bankSum = 0.0f;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < numSamples; i += blockSize)
+    {
+        body.processBlock(input.data() + i, output.data(), blockSize);
+        bankSum += output[0];
+    }
+    const double bankSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    EXPECT_TRUE(std::isfinite(scalarSum + bankSum));
+    EXPECT_LT(bankSeconds, scalarSeconds);
+
+    std::cout << "64-mode body, scalar ModalFilter: " << (1e9 * scalarSeconds / numSamples) << " ns/sample" << std::endl;
+    std::cout << "64-mode body, ModalResonatorBank: " << (1e9 * bankSeconds / numSamples) << " ns/sample" << std::endl;
+}
+
 //==============================================================================
 // TEST: Integration Tests
 //==============================================================================
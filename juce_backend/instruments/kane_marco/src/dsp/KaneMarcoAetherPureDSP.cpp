@@ -18,6 +18,12 @@
 #include <cmath>
 #include <cassert>
 
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+#elif defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
 namespace DSP {
 
 //==============================================================================
@@ -230,6 +236,325 @@ void ModalFilter::reset()
     computedQ = computeQ(frequency, decay, 1.0f);
 }
 
+//==============================================================================
+// ModalResonatorBank Implementation
+//==============================================================================
+
+namespace {
+
+// One vector of modes per operation; the widest instruction set available wins
+#if defined(__ARM_NEON) || defined(__aarch64__)
+
+struct ModeLanes
+{
+    using Vec = float32x4_t;
+    static constexpr int width = 4;
+
+    static Vec load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Vec v) { vst1q_f32(p, v); }
+    static Vec broadcast(float x) { return vdupq_n_f32(x); }
+    static Vec add(Vec a, Vec b) { return vaddq_f32(a, b); }
+    static Vec sub(Vec a, Vec b) { return vsubq_f32(a, b); }
+    static Vec mul(Vec a, Vec b) { return vmulq_f32(a, b); }
+    static Vec min(Vec a, Vec b) { return vminq_f32(a, b); }
+    static Vec abs(Vec a) { return vabsq_f32(a); }
+
+    // v where test >= limit, else 0
+    static Vec zeroBelow(Vec v, Vec test, Vec limit)
+    {
+        return vbslq_f32(vcltq_f32(test, limit), vdupq_n_f32(0.0f), v);
+    }
+
+    // v - amount where v >= limit
+    static Vec wrap(Vec v, Vec limit, Vec amount)
+    {
+        return vbslq_f32(vcgeq_f32(v, limit), vsubq_f32(v, amount), v);
+    }
+
+    // -v where sign >= 0
+    static Vec negateWhereNonNegative(Vec v, Vec sign)
+    {
+        return vbslq_f32(vcgeq_f32(sign, vdupq_n_f32(0.0f)), vnegq_f32(v), v);
+    }
+
+    static float sum(Vec v)
+    {
+       #if defined(__aarch64__)
+        return vaddvq_f32(v);
+       #else
+        float32x2_t pair = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+        return vget_lane_f32(vpadd_f32(pair, pair), 0);
+       #endif
+    }
+};
+
+#elif defined(__AVX512F__)
+
+struct ModeLanes
+{
+    using Vec = __m512;
+    static constexpr int width = 16;
+
+    static Vec load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm512_storeu_ps(p, v); }
+    static Vec broadcast(float x) { return _mm512_set1_ps(x); }
+    static Vec add(Vec a, Vec b) { return _mm512_add_ps(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm512_sub_ps(a, b); }
+    static Vec mul(Vec a, Vec b) { return _mm512_mul_ps(a, b); }
+    static Vec min(Vec a, Vec b) { return _mm512_min_ps(a, b); }
+    static Vec abs(Vec a) { return _mm512_abs_ps(a); }
+
+    static Vec zeroBelow(Vec v, Vec test, Vec limit)
+    {
+        return _mm512_mask_mov_ps(v, _mm512_cmp_ps_mask(test, limit, _CMP_LT_OQ), _mm512_setzero_ps());
+    }
+
+    static Vec wrap(Vec v, Vec limit, Vec amount)
+    {
+        return _mm512_mask_sub_ps(v, _mm512_cmp_ps_mask(v, limit, _CMP_GE_OQ), v, amount);
+    }
+
+    static Vec negateWhereNonNegative(Vec v, Vec sign)
+    {
+        const __mmask16 mask = _mm512_cmp_ps_mask(sign, _mm512_setzero_ps(), _CMP_GE_OQ);
+        return _mm512_mask_sub_ps(v, mask, _mm512_setzero_ps(), v);
+    }
+
+    static float sum(Vec v) { return _mm512_reduce_add_ps(v); }
+};
+
+#elif defined(__AVX__)
+
+struct ModeLanes
+{
+    using Vec = __m256;
+    static constexpr int width = 8;
+
+    static Vec load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm256_storeu_ps(p, v); }
+    static Vec broadcast(float x) { return _mm256_set1_ps(x); }
+    static Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+    static Vec mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+    static Vec min(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+    static Vec abs(Vec a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+
+    static Vec zeroBelow(Vec v, Vec test, Vec limit)
+    {
+        return _mm256_andnot_ps(_mm256_cmp_ps(test, limit, _CMP_LT_OQ), v);
+    }
+
+    static Vec wrap(Vec v, Vec limit, Vec amount)
+    {
+        return _mm256_sub_ps(v, _mm256_and_ps(_mm256_cmp_ps(v, limit, _CMP_GE_OQ), amount));
+    }
+
+    static Vec negateWhereNonNegative(Vec v, Vec sign)
+    {
+        const Vec mask = _mm256_cmp_ps(sign, _mm256_setzero_ps(), _CMP_GE_OQ);
+        return _mm256_xor_ps(v, _mm256_and_ps(mask, _mm256_set1_ps(-0.0f)));
+    }
+
+    static float sum(Vec v)
+    {
+        __m128 lanes = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        lanes = _mm_add_ps(lanes, _mm_movehl_ps(lanes, lanes));
+        lanes = _mm_add_ss(lanes, _mm_shuffle_ps(lanes, lanes, 0x55));
+        return _mm_cvtss_f32(lanes);
+    }
+};
+
+#elif defined(__SSE2__)
+
+struct ModeLanes
+{
+    using Vec = __m128;
+    static constexpr int width = 4;
+
+    static Vec load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+    static Vec broadcast(float x) { return _mm_set1_ps(x); }
+    static Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+    static Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    static Vec min(Vec a, Vec b) { return _mm_min_ps(a, b); }
+    static Vec abs(Vec a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+    static Vec zeroBelow(Vec v, Vec test, Vec limit)
+    {
+        return _mm_andnot_ps(_mm_cmplt_ps(test, limit), v);
+    }
+
+    static Vec wrap(Vec v, Vec limit, Vec amount)
+    {
+        return _mm_sub_ps(v, _mm_and_ps(_mm_cmpge_ps(v, limit), amount));
+    }
+
+    static Vec negateWhereNonNegative(Vec v, Vec sign)
+    {
+        const Vec mask = _mm_cmpge_ps(sign, _mm_setzero_ps());
+        return _mm_xor_ps(v, _mm_and_ps(mask, _mm_set1_ps(-0.0f)));
+    }
+
+    static float sum(Vec v)
+    {
+        Vec lanes = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        lanes = _mm_add_ss(lanes, _mm_shuffle_ps(lanes, lanes, 0x55));
+        return _mm_cvtss_f32(lanes);
+    }
+};
+
+#else
+
+struct ModeLanes
+{
+    using Vec = float;
+    static constexpr int width = 1;
+
+    static Vec load(const float* p) { return *p; }
+    static void store(float* p, Vec v) { *p = v; }
+    static Vec broadcast(float x) { return x; }
+    static Vec add(Vec a, Vec b) { return a + b; }
+    static Vec sub(Vec a, Vec b) { return a - b; }
+    static Vec mul(Vec a, Vec b) { return a * b; }
+    static Vec min(Vec a, Vec b) { return std::min(a, b); }
+    static Vec abs(Vec a) { return std::abs(a); }
+    static Vec zeroBelow(Vec v, Vec test, Vec limit) { return test < limit ? 0.0f : v; }
+    static Vec wrap(Vec v, Vec limit, Vec amount) { return v >= limit ? v - amount : v; }
+    static Vec negateWhereNonNegative(Vec v, Vec sign) { return sign >= 0.0f ? -v : v; }
+    static float sum(Vec v) { return v; }
+};
+
+#endif
+
+/**
+ * sin(2 pi phase) for phase in [0, 1)
+ *
+ * Folds to [0, pi/2] and evaluates the degree-11 odd Taylor polynomial
+ * (truncation error < 6e-8).
+ */
+inline ModeLanes::Vec sinTwoPi(ModeLanes::Vec phase)
+{
+    using L = ModeLanes;
+
+    // sin(2 pi p) = -sin(2 pi x) with x = p - 1/2 in [-1/2, 1/2)
+    const L::Vec half = L::broadcast(0.5f);
+    const L::Vec x = L::sub(phase, half);
+    const L::Vec a = L::abs(x);
+    const L::Vec t = L::mul(L::min(a, L::sub(half, a)), L::broadcast(6.28318530718f));
+    const L::Vec t2 = L::mul(t, t);
+
+    L::Vec poly = L::broadcast(-2.50521084e-8f);
+    poly = L::add(L::mul(poly, t2), L::broadcast(2.75573192e-6f));
+    poly = L::add(L::mul(poly, t2), L::broadcast(-1.98412698e-4f));
+    poly = L::add(L::mul(poly, t2), L::broadcast(8.33333333e-3f));
+    poly = L::add(L::mul(poly, t2), L::broadcast(-1.66666667e-1f));
+    poly = L::add(L::mul(poly, t2), L::broadcast(1.0f));
+
+    return L::negateWhereNonNegative(L::mul(poly, t), x);
+}
+
+} // namespace
+
+void ModalResonatorBank::setModes(const std::vector<ModalFilter>& modes, bool resetState)
+{
+    constexpr int lanes = ModeLanes::width;
+
+    numModes_ = static_cast<int>(modes.size());
+    paddedModes_ = (numModes_ + lanes - 1) / lanes * lanes;
+    outputScale_ = numModes_ > 0 ? 1.0f / static_cast<float>(numModes_) : 0.0f;
+
+    amplitude_.assign(paddedModes_, 0.0f);
+    decayFactor_.assign(paddedModes_, 0.0f);
+    phaseIncrement_.assign(paddedModes_, 0.0f);
+
+    if (resetState)
+    {
+        energy_.assign(paddedModes_, 0.0f);
+        phase_.assign(paddedModes_, 0.0f);
+    }
+    else
+    {
+        energy_.resize(paddedModes_, 0.0f);
+        phase_.resize(paddedModes_, 0.0f);
+    }
+
+    for (int i = 0; i < numModes_; ++i)
+    {
+        const ModalFilter& mode = modes[i];
+
+        // Same expressions as ModalFilter::processSample, hoisted out of the loop
+        float decay = 1.0f - (1.0f / (mode.computedQ * mode.sr * 0.001f));
+        decay = std::max(0.999f, std::min(0.99999f, decay));
+
+        amplitude_[i] = mode.amplitude;
+        decayFactor_[i] = decay;
+        phaseIncrement_[i] = static_cast<float>(mode.frequency / mode.sr);
+    }
+
+    // Padding lanes stay silent
+    for (int i = numModes_; i < paddedModes_; ++i)
+    {
+        energy_[i] = 0.0f;
+        phase_[i] = 0.0f;
+    }
+}
+
+void ModalResonatorBank::reset()
+{
+    std::fill(energy_.begin(), energy_.end(), 0.0f);
+    std::fill(phase_.begin(), phase_.end(), 0.0f);
+}
+
+float ModalResonatorBank::processSample(float excitation)
+{
+    float output = 0.0f;
+    processBlock(&excitation, &output, 1);
+    return output;
+}
+
+void ModalResonatorBank::processBlock(const float* excitation, float* output, int numSamples)
+{
+    using L = ModeLanes;
+
+    if (numModes_ == 0)
+    {
+        std::fill(output, output + numSamples, 0.0f);
+        return;
+    }
+
+    const L::Vec denormalLimit = L::broadcast(1e-10f);
+    const L::Vec one = L::broadcast(1.0f);
+
+    float* energy = energy_.data();
+    float* phase = phase_.data();
+    const float* amplitude = amplitude_.data();
+    const float* decayFactor = decayFactor_.data();
+    const float* phaseIncrement = phaseIncrement_.data();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const L::Vec input = L::broadcast(excitation[i]);
+        L::Vec sum = L::broadcast(0.0f);
+
+        for (int m = 0; m < paddedModes_; m += L::width)
+        {
+            L::Vec e = L::add(L::load(energy + m), L::mul(input, L::load(amplitude + m)));
+            e = L::mul(e, L::load(decayFactor + m));
+            e = L::zeroBelow(e, L::abs(e), denormalLimit);
+
+            const L::Vec p = L::wrap(L::add(L::load(phase + m), L::load(phaseIncrement + m)), one, one);
+
+            L::store(energy + m, e);
+            L::store(phase + m, p);
+
+            sum = L::add(sum, L::mul(e, sinTwoPi(p)));
+        }
+
+        output[i] = L::sum(sum) * outputScale_;
+    }
+}
+
 //==============================================================================
 // WaveguideString Implementation
 //==============================================================================
@@ -466,25 +791,24 @@ void ModalBodyResonator::prepare(double sampleRate)
     sr = sampleRate;
     for (auto& mode : modes_)
         mode.prepare(sampleRate);
+    bank_.setModes(modes_, false);
 }
 
 void ModalBodyResonator::reset()
 {
     for (auto& mode : modes_)
         mode.reset();
+    bank_.setModes(modes_, true);
 }
 
 float ModalBodyResonator::processSample(float bridgeEnergy)
 {
-    float output = 0.0f;
-    
-    for (auto& mode : modes_)
-        output += mode.processSample(bridgeEnergy);
-    
-    if (!modes_.empty())
-        output /= static_cast<float>(modes_.size());
-    
-    return output;
+    return bank_.processSample(bridgeEnergy);
+}
+
+void ModalBodyResonator::processBlock(const float* bridgeEnergy, float* output, int numSamples)
+{
+    bank_.processBlock(bridgeEnergy, output, numSamples);
 }
 
 void ModalBodyResonator::setResonance(float amount)
@@ -492,6 +816,7 @@ void ModalBodyResonator::setResonance(float amount)
     amount = std::max(0.0f, std::min(2.0f, amount));
     for (auto& mode : modes_)
         mode.amplitude = mode.baseAmplitude * amount;
+    bank_.setModes(modes_, false);
 }
 
 void ModalBodyResonator::setMaterial(MaterialType material)
@@ -521,6 +846,7 @@ void ModalBodyResonator::setMaterial(MaterialType material)
         mode.materialFactor = materialFactor;
         mode.computedQ = mode.computeQ(mode.frequency, mode.decay, 1.0f);
     }
+    bank_.setModes(modes_, false);
 }
 
 void ModalBodyResonator::recalculateModeQ(float damping, float structure)
@@ -530,6 +856,7 @@ void ModalBodyResonator::recalculateModeQ(float damping, float structure)
         modes_[i].modeIndex = static_cast<float>(i);
         modes_[i].computedQ = modes_[i].computeQ(modes_[i].frequency, damping, structure);
     }
+    bank_.setModes(modes_, false);
 }
 
 void ModalBodyResonator::loadGuitarBodyPreset()
@@ -630,6 +957,7 @@ void ModalBodyResonator::loadGuitarBodyPreset()
     // Prepare all modes (this will compute Q values)
     for (auto& mode : modes_)
         mode.prepare(sr);
+    bank_.setModes(modes_, true);
 }
 
 void ModalBodyResonator::loadPianoBodyPreset()
@@ -656,6 +984,7 @@ void ModalBodyResonator::loadPianoBodyPreset()
 
     for (auto& mode : modes_)
         mode.prepare(sr);
+    bank_.setModes(modes_, true);
 }
 
 void ModalBodyResonator::loadOrchestralStringPreset()
@@ -682,6 +1011,7 @@ void ModalBodyResonator::loadOrchestralStringPreset()
 
     for (auto& mode : modes_)
         mode.prepare(sr);
+    bank_.setModes(modes_, true);
 }
 
 float ModalBodyResonator::getModeFrequency(int index) const
@@ -691,6 +1021,14 @@ float ModalBodyResonator::getModeFrequency(int index) const
     return 0.0f;
 }
 
+void ModalBodyResonator::setModes(const std::vector<ModalFilter>& modes)
+{
+    modes_ = modes;
+    for (auto& mode : modes_)
+        mode.prepare(sr);
+    bank_.setModes(modes_, true);
+}
+
 //==============================================================================
 // ArticulationStateMachine Implementation
 //==============================================================================
@@ -899,6 +1237,7 @@ void SympatheticStringBank::prepare(double sampleRate, const SympatheticStringCo
     
     strings_.clear();
     strings_.resize(config.numStrings);
+    outputGain_ = strings_.empty() ? 0.0f : 0.3f / static_cast<float>(strings_.size());
     
     for (auto& string : strings_)
         string.prepare(sampleRate);
@@ -929,7 +1268,7 @@ float SympatheticStringBank::processSample()
     for (auto& string : strings_)
         output += string.processSample();
     
-    return output * 0.3f / static_cast<float>(strings_.size());
+    return output * outputGain_;
 }
 
 //==============================================================================
@@ -971,49 +1310,67 @@ void AetherVoice::processBlock(float* output, int numSamples, double sampleRate)
         std::fill(output, output + numSamples, 0.0f);
         return;
     }
-    
-    for (int i = 0; i < numSamples; ++i)
+
+    // The body is feed-forward, so it runs a sub-block at a time between the
+    // per-sample string/articulation pass and the per-sample pedalboard pass
+    constexpr int subBlockSize = 64;
+    float bridgeEnergy[subBlockSize];
+    float bodyOut[subBlockSize];
+    float sympOut[subBlockSize];
+    float previousGain[subBlockSize];
+    float currentGain[subBlockSize];
+
+    const double deltaTime = 1.0 / sampleRate;
+
+    for (int start = 0; start < numSamples; start += subBlockSize)
     {
-        float excitation = fsm.getCurrentExcitation();
-        float stringOut = string.processSample();
-        
-        float processed;
-        if (sharedBridge != nullptr)
+        const int n = std::min(subBlockSize, numSamples - start);
+
+        for (int i = 0; i < n; ++i)
         {
-            int voiceIndex = 0;
-            float reflected = sharedBridge->addStringEnergy(stringOut + excitation, voiceIndex);
-            stringOut = reflected;
-            
-            float bridgeEnergy = sharedBridge->getBridgeMotion();
-            float bodyOut = body.processSample(bridgeEnergy);
-            
-            float sympOut = 0.0f;
-            if (sympatheticStrings != nullptr)
+            float excitation = fsm.getCurrentExcitation();
+            float stringOut = string.processSample();
+
+            if (sharedBridge != nullptr)
             {
-                if (i == 0)
-                    sympatheticStrings->exciteFromBridge(bridgeEnergy);
-                sympOut = sympatheticStrings->processSample();
+                int voiceIndex = 0;
+                sharedBridge->addStringEnergy(stringOut + excitation, voiceIndex);
+
+                bridgeEnergy[i] = sharedBridge->getBridgeMotion();
+                sympOut[i] = 0.0f;
+
+                if (sympatheticStrings != nullptr)
+                {
+                    if (start + i == 0)
+                        sympatheticStrings->exciteFromBridge(bridgeEnergy[i]);
+                    sympOut[i] = sympatheticStrings->processSample();
+                }
             }
-            
-            processed = (pedalboard != nullptr) ? pedalboard->processSample(bodyOut + sympOut * 0.3f) : (bodyOut + sympOut * 0.3f);
+            else
+            {
+                bridgeEnergy[i] = bridge.processString(stringOut + excitation);
+            }
+
+            fsm.update(static_cast<float>(deltaTime));
+            previousGain[i] = fsm.getPreviousGain();
+            currentGain[i] = fsm.getCurrentGain();
+
+            age += deltaTime;
+
+            if (fsm.getCurrentState() == ArticulationState::IDLE)
+                isActive = false;
         }
-        else
+
+        body.processBlock(bridgeEnergy, bodyOut, n);
+
+        for (int i = 0; i < n; ++i)
         {
-            float bridgeEnergy = bridge.processString(stringOut + excitation);
-            float bodyOut = body.processSample(bridgeEnergy);
-            processed = (pedalboard != nullptr) ? pedalboard->processSample(bodyOut) : bodyOut;
+            float processed = (sharedBridge != nullptr) ? bodyOut[i] + sympOut[i] * 0.3f : bodyOut[i];
+            if (pedalboard != nullptr)
+                processed = pedalboard->processSample(processed);
+
+            output[start + i] = processed * previousGain[i] + processed * currentGain[i];
         }
-        
-        fsm.update(1.0f / sampleRate);
-        
-        float outputPrev = processed * fsm.getPreviousGain();
-        float outputCurr = processed * fsm.getCurrentGain();
-        output[i] = outputPrev + outputCurr;
-        
-        age += 1.0f / sampleRate;
-        
-        if (fsm.getCurrentState() == ArticulationState::IDLE)
-            isActive = false;
     }
 }
 
@@ -1108,16 +1465,16 @@ void AetherVoiceManager::processBlock(float* output, int numSamples, double samp
 {
     std::fill(output, output + numSamples, 0.0f);
     
-    float temp[6][512];
+    float temp[512];
     
-    for (int v = 0; v < 6; ++v)
+    for (auto& voice : voices_)
     {
-        if (voices_[v].isActive)
+        if (voice.isActive)
         {
-            voices_[v].processBlock(temp[v], numSamples, sampleRate);
+            voice.processBlock(temp, numSamples, sampleRate);
             
             for (int i = 0; i < numSamples; ++i)
-                output[i] += temp[v][i];
+                output[i] += temp[i];
         }
     }
     
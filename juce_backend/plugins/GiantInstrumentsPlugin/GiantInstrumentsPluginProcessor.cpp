@@ -146,7 +146,7 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
             float frequency = midiNote;
             if (microtonalEnabled && tuningManager)
             {
-                frequency = tuningManager->getTuning().midiToFrequency(midiNote);
+                frequency = tuningManager->getFrequencyTable().getFrequency(midiNote);
             }
 
             // Create note-on event
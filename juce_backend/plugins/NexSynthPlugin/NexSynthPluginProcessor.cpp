@@ -386,20 +386,25 @@ void NexSynthPluginProcessor::setupParameters() {
 }
 
 void NexSynthPluginProcessor::setupParameterCallbacks() {
-    // Create telemetry recorder with lock-free queue (256 events)
+    // Create telemetry recorder with lock-free queues (4096 events each)
     // Queue size is power of 2 as required by juce::AbstractFifo
-    telemetryRecorder = std::make_unique<ParameterTelemetryRecorder>(256);
+    telemetryRecorder = std::make_unique<ParameterTelemetryRecorder>(4096);
 
-    // Add listener to capture parameter changes
+    // Intern every parameter ID up front so the audio thread only does a
+    // lookup, then listen to each one.
     // This will be called from the audio thread when parameters change
     if (parameters) {
-        parameters->addListener(telemetryRecorder.get());
+        telemetryRecorder->registerParameters(*this);
+
+        for (int i = 0; i < telemetryRecorder->getNumParameters(); ++i) {
+            parameters->addParameterListener(telemetryRecorder->getParameterID(i), telemetryRecorder.get());
+        }
     }
 
     // Log initialization
     DBG("ParameterTelemetryRecorder: Listening for parameter changes");
-    DBG("  Queue capacity: 256 events");
-    DBG("  Thread-safe: Yes (lock-free)");
+    DBG("  Parameters: " + juce::String(telemetryRecorder->getNumParameters()));
+    DBG("  Queue capacity: 4096 events per producer");
 }
 
 void NexSynthPluginProcessor::updateNexSynthParameters() {
@@ -540,9 +545,8 @@ float NexSynthPluginProcessor::getMicrotonalFrequency(int midiNote) {
         return 440.0f * std::pow(2.0f, (midiNote - 69) / 12.0f);
     }
 
-    // Get microtonal frequency from tuning manager
-    auto tuning = tuningManager->getTuning();
-    return tuning.midiToFrequency(midiNote);
+    // Precompiled table for the current tuning (no copy, no pow)
+    return tuningManager->getFrequencyTable().getFrequency(midiNote);
 }
 
 //==============================================================================
@@ -1,10 +1,11 @@
 #include "AudioRoutingEngine.h"
-#include "../instrument/InstrumentInstance.h"
+#include "../engine/instruments/InstrumentInstance.h"
 #include <juce_core/juce_core.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
 #include <algorithm>
 #include <chrono>
+#include <map>
 
 namespace SchillingerEcosystem::Routing {
 
@@ -225,37 +226,60 @@ MixerBus::MixerBus(const juce::String& identifier, Type type, int channels)
     juce::Logger::writeToLog("Created mixer bus: " + identifier + " (" + juce::String(channels) + " channels)");
 }
 
-void MixerBus::processAudio(juce::AudioBuffer<float>& buffer)
+void MixerBus::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    if (buffer.getNumChannels() < numChannels)
-        return;
+    mixBuffer.setSize(numChannels, samplesPerBlock, false, true, true);
+    effectsMidi.ensureSize(2048);
 
-    std::lock_guard<std::mutex> lock(stateMutex);
+    if (effectsChain)
+        effectsChain->prepareToPlay(sampleRate, samplesPerBlock);
+}
 
-    // Clear mix buffer
+void MixerBus::reset()
+{
     mixBuffer.clear();
 
-    // Apply gain
-    float linearGain = RoutingUtils::dBToLinear(gain);
-    buffer.applyGain(linearGain);
+    if (effectsChain)
+        effectsChain->reset();
+
+    currentState = BusState();
+}
+
+void MixerBus::processAudio(juce::AudioBuffer<float>& buffer)
+{
+    if (buffer.getNumChannels() < numChannels)
+        return;
 
-    // Apply pan (if stereo)
-    if (numChannels >= 2)
+    // Called from the routing engine's audio callback: no locks, no allocation
+    if (muted)
+    {
+        buffer.clear();
+    }
+    else
     {
-        auto [leftGain, rightGain] = RoutingUtils::panToStereoGains(pan);
+        // Apply gain, folded into the pan gains when stereo
+        float linearGain = RoutingUtils::dBToLinear(gain);
 
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+        if (numChannels >= 2)
+        {
+            auto [leftGain, rightGain] = RoutingUtils::panToStereoGains(pan);
+            buffer.applyGain(0, 0, buffer.getNumSamples(), linearGain * leftGain);
+            buffer.applyGain(1, 0, buffer.getNumSamples(), linearGain * rightGain);
+
+            for (int channel = 2; channel < numChannels; ++channel)
+                buffer.applyGain(channel, 0, buffer.getNumSamples(), linearGain);
+        }
+        else
         {
-            buffer.setSample(0, sample, buffer.getSample(0, sample) * leftGain);
-            buffer.setSample(1, sample, buffer.getSample(1, sample) * rightGain);
+            buffer.applyGain(linearGain);
         }
     }
 
     // Apply effects if not bypassed
     if (!bypassed && effectsChain)
     {
-        juce::MidiBuffer emptyMidi;
-        effectsChain->processBlock(buffer, emptyMidi);
+        effectsChain->processBlock(buffer, effectsMidi);
+        effectsMidi.clear();
     }
 
     // Update monitoring
@@ -380,12 +404,14 @@ bool MixerBus::isClipping(int channel) const
 AudioRoutingEngine::AudioRoutingEngine()
 {
     // Create master bus
-    masterBus = std::make_unique<MixerBus>("master", MixerBus::Type::Master, 2);
-    buses["master"] = std::make_unique<MixerBus>(*masterBus);
+    auto master = std::make_unique<MixerBus>("master", MixerBus::Type::Master, 2);
+    masterBus = master.get();
+    buses["master"] = std::move(master);
 
-    // Initialize temporary buffers
-    tempBuffers.reserve(16);
-    masterBuffer.setSize(2, 512);
+    {
+        std::lock_guard<std::mutex> lock(routingMutex);
+        publishRoutingState();
+    }
 
     juce::Logger::writeToLog("Audio routing engine initialized");
 }
@@ -393,6 +419,7 @@ AudioRoutingEngine::AudioRoutingEngine()
 AudioRoutingEngine::~AudioRoutingEngine()
 {
     reset();
+    releaseRetiredObjects(true);
     juce::Logger::writeToLog("Audio routing engine destroyed");
 }
 
@@ -421,10 +448,11 @@ bool AudioRoutingEngine::registerInstrument(const juce::String& identifier, std:
     node->sampleRate = format.sampleRate;
     node->blockSize = format.preferredBlockSize;
 
+    retireNode(identifier);
     instrumentNodes[identifier] = instrument;
     nodes[identifier] = std::move(node);
 
-    buildProcessingGraph();
+    publishRoutingState();
 
     juce::Logger::writeToLog("Registered instrument node: " + identifier);
     return true;
@@ -452,7 +480,7 @@ bool AudioRoutingEngine::createNode(const juce::String& identifier, AudioNode::T
     node->blockSize = currentBlockSize;
 
     nodes[identifier] = std::move(node);
-    buildProcessingGraph();
+    publishRoutingState();
 
     juce::Logger::writeToLog("Created audio node: " + identifier + " (" + juce::String(channels) + " channels)");
     return true;
@@ -481,8 +509,9 @@ bool AudioRoutingEngine::registerEffectNode(const juce::String& identifier, std:
         node->numOutputChannels = node->processor->getTotalNumOutputChannels();
     }
 
+    retireNode(identifier);
     nodes[identifier] = std::move(node);
-    buildProcessingGraph();
+    publishRoutingState();
 
     juce::Logger::writeToLog("Registered effect node: " + identifier);
     return true;
@@ -508,11 +537,13 @@ bool AudioRoutingEngine::removeNode(const juce::String& identifier)
         routes.erase(routeId);
     }
 
-    // Remove node
-    nodes.erase(identifier);
-    instrumentNodes.erase(identifier);
+    // Remove node; the audio thread may still be reading it until the
+    // next routing state is picked up
+    retireNode(identifier);
+    if (buses.find(identifier) == buses.end())
+        releaseBufferSlot(identifier);
 
-    buildProcessingGraph();
+    publishRoutingState();
 
     juce::Logger::writeToLog("Removed audio node: " + identifier);
     return true;
@@ -602,8 +633,13 @@ juce::String AudioRoutingEngine::createRoute(const juce::String& sourceNode, con
 
     std::lock_guard<std::mutex> lock(routingMutex);
 
-    // Check if nodes exist
-    if (nodes.find(sourceNode) == nodes.end() || nodes.find(destNode) == nodes.end())
+    // Check if endpoints exist (nodes or mixer buses)
+    auto endpointExists = [this](const juce::String& id)
+    {
+        return nodes.find(id) != nodes.end() || buses.find(id) != buses.end();
+    };
+
+    if (!endpointExists(sourceNode) || !endpointExists(destNode))
         return {};
 
     // Create unique route identifier
@@ -626,7 +662,7 @@ juce::String AudioRoutingEngine::createRoute(const juce::String& sourceNode, con
     route->destinationChannel = destChannel;
 
     routes[routeId] = std::move(route);
-    buildProcessingGraph();
+    publishRoutingState();
 
     juce::Logger::writeToLog("Created audio route: " + routeId);
     return routeId;
@@ -644,7 +680,7 @@ bool AudioRoutingEngine::removeRoute(const juce::String& routeIdentifier)
         return false;
 
     routes.erase(it);
-    buildProcessingGraph();
+    publishRoutingState();
 
     juce::Logger::writeToLog("Removed audio route: " + routeIdentifier);
     return true;
@@ -772,6 +808,7 @@ MixerBus* AudioRoutingEngine::createBus(const juce::String& identifier, MixerBus
 
     MixerBus* busPtr = bus.get();
     buses[identifier] = std::move(bus);
+    publishRoutingState();
 
     juce::Logger::writeToLog("Created mixer bus: " + identifier);
     return busPtr;
@@ -827,15 +864,30 @@ bool AudioRoutingEngine::removeBus(const juce::String& identifier)
     std::lock_guard<std::mutex> lock(routingMutex);
 
     auto it = buses.find(identifier);
-    if (it == buses.end())
+    if (it == buses.end() || it->second.get() == masterBus)
         return false;
 
+    RetiredObjects retired;
+    retired.version = nextStateVersion;
+    retired.bus = std::move(it->second);
+    retiredObjects.push_back(std::move(retired));
     buses.erase(it);
 
+    if (nodes.find(identifier) == nodes.end())
+        releaseBufferSlot(identifier);
+
+    publishRoutingState();
+
     juce::Logger::writeToLog("Removed mixer bus: " + identifier);
     return true;
 }
 
+void AudioRoutingEngine::refreshRoutingTable()
+{
+    std::lock_guard<std::mutex> lock(routingMutex);
+    publishRoutingState();
+}
+
 //==============================================================================
 // AUDIO PROCESSING
 //==============================================================================
@@ -864,15 +916,15 @@ void AudioRoutingEngine::prepareToPlay(double sampleRate, int samplesPerBlock)
         bus->prepareToPlay(sampleRate, samplesPerBlock);
     }
 
-    // Prepare master buffer
-    masterBuffer.setSize(2, samplesPerBlock);
+    // The audio thread is stopped here: size every routing snapshot so no
+    // block ever allocates, then hand the reader a fresh one
+    processorMidi.ensureSize(2048);
+    releaseRetiredObjects(true);
 
-    // Prepare temporary buffers
-    tempBuffers.clear();
-    for (int i = 0; i < 16; ++i)
-    {
-        tempBuffers.emplace_back(32, samplesPerBlock); // Max 32 channels
-    }
+    for (auto& state : routingStates)
+        compileRoutingState(state);
+
+    publishRoutingState();
 
     juce::Logger::writeToLog("Audio routing engine prepared: " +
                            juce::String(sampleRate) + "Hz, " +
@@ -881,36 +933,28 @@ void AudioRoutingEngine::prepareToPlay(double sampleRate, int samplesPerBlock)
 
 void AudioRoutingEngine::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    juce::ignoreUnused(midiMessages);
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    std::lock_guard<std::mutex> lock(routingMutex);
+    // Announce the callback before looking for a new snapshot, so a writer
+    // that has just published either sees us busy or knows we will take it
+    audioCallbackActive.store(true);
 
-    // Clear master buffer
-    masterBuffer.clear();
+    if (middleStateSlot.load() & freshStateBit)
+        readerStateSlot = middleStateSlot.exchange(readerStateSlot) & stateIndexMask;
 
-    try
-    {
-        // Process audio through the routing graph
-        processGraph();
+    auto& state = routingStates[readerStateSlot];
+    audioStateVersion.store(state.version, std::memory_order_release);
 
-        // Mix final output
-        mixOutputs(buffer);
+    renderRoutingState(state, buffer);
 
-        // Update statistics
-        updateNodeStates();
-        updateBusStates();
-    }
-    catch (const std::exception& e)
-    {
-        juce::Logger::writeToLog("Audio routing error: " + juce::String(e.what()));
-        buffer.clear();
-    }
+    audioCallbackActive.store(false, std::memory_order_release);
 
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
-    cachedStats.processingTime = duration.count() / 1000.0;
+    lastProcessingTimeMs.store(duration.count() / 1000.0, std::memory_order_relaxed);
 
-    processingIteration.fetch_add(1);
+    processingIteration.fetch_add(1, std::memory_order_relaxed);
 }
 
 void AudioRoutingEngine::reset()
@@ -931,10 +975,7 @@ void AudioRoutingEngine::reset()
         bus->reset();
     }
 
-    // Clear buffers
-    masterBuffer.clear();
-    for (auto& tempBuffer : tempBuffers)
-        tempBuffer.clear();
+    releaseRetiredObjects(false);
 
     juce::Logger::writeToLog("Audio routing engine reset");
 }
@@ -1007,6 +1048,7 @@ AudioRoutingEngine::EngineStats AudioRoutingEngine::getStatistics() const
         lastStatsUpdate = now;
     }
 
+    cachedStats.processingTime = lastProcessingTimeMs.load(std::memory_order_relaxed);
     return cachedStats;
 }
 
@@ -1153,238 +1195,383 @@ std::vector<std::vector<juce::String>> AudioRoutingEngine::detectLoops() const
 // PRIVATE IMPLEMENTATION
 //==============================================================================
 
-void AudioRoutingEngine::processNodes()
+void AudioRoutingEngine::compileRoutingState(RoutingState& state)
 {
-    // Process instrument nodes first
-    for (const auto& [id, instrument] : instrumentNodes)
+    // Endpoints are nodes and buses; a node and a bus sharing an identifier
+    // are one endpoint (the node renders, then the bus processes the result)
+    std::vector<juce::String> endpointIds;
+    endpointIds.reserve(nodes.size() + buses.size());
+
+    for (const auto& [id, node] : nodes)
+        endpointIds.push_back(id);
+
+    for (const auto& [id, bus] : buses)
+    {
+        if (nodes.find(id) == nodes.end())
+            endpointIds.push_back(id);
+    }
+
+    std::sort(endpointIds.begin(), endpointIds.end());
+
+    const int numEndpoints = static_cast<int>(endpointIds.size());
+    std::unordered_map<juce::String, int> endpointIndex;
+    std::vector<CompiledEndpoint> endpoints(static_cast<size_t>(numEndpoints));
+
+    for (int i = 0; i < numEndpoints; ++i)
     {
-        if (auto node = getNode(id))
+        const auto& id = endpointIds[static_cast<size_t>(i)];
+        auto& endpoint = endpoints[static_cast<size_t>(i)];
+        endpointIndex[id] = i;
+
+        endpoint.slot = acquireBufferSlot(id);
+        endpoint.numChannels = 1;
+
+        auto nodeIt = nodes.find(id);
+        if (nodeIt != nodes.end())
         {
-            // Get appropriate temporary buffer
-            int bufferIndex = 0;
-            if (bufferIndex < static_cast<int>(tempBuffers.size()))
-            {
-                auto& buffer = tempBuffers[bufferIndex];
-                buffer.clear();
+            const auto& node = *nodeIt->second;
+            endpoint.numChannels = std::max(node.numInputChannels, node.numOutputChannels);
 
-                juce::MidiBuffer midiBuffer; // Would need to route MIDI here too
-                instrument->processBlock(buffer, midiBuffer);
+            auto instrumentIt = instrumentNodes.find(id);
+            if (instrumentIt != instrumentNodes.end())
+                endpoint.instrument = instrumentIt->second.get();
 
-                node->state = AudioNode::State::Active;
-            }
+            if (node.processor && !node.bypassed)
+                endpoint.processor = node.processor.get();
         }
-    }
 
-    // Process effect nodes
-    for (const auto& [id, node] : nodes)
-    {
-        if (node->type == AudioNode::Type::Effect && node->processor)
+        auto busIt = buses.find(id);
+        if (busIt != buses.end())
         {
-            // Process effect through its processor
-            if (node->state == AudioNode::State::Active)
-            {
-                // Get input from routes and process
-                // This is simplified - full implementation would handle complex routing
-                node->processor->processBlock(masterBuffer, juce::MidiBuffer());
-            }
+            endpoint.bus = busIt->second.get();
+            endpoint.numChannels = std::max(endpoint.numChannels, endpoint.bus->getNumChannels());
         }
+
+        endpoint.numChannels = juce::jlimit(1, maxChannelsPerNode, endpoint.numChannels);
     }
-}
 
-void AudioRoutingEngine::processRoutes()
-{
+    // Outgoing routes per endpoint: explicit routes, then bus sends
+    std::vector<std::vector<std::pair<int, CompiledRoute>>> outgoing(static_cast<size_t>(numEndpoints));
+
+    auto addEdge = [&](int from, int to, int sourceChannel, int destChannel, float gain, bool monoToStereo)
+    {
+        const auto& source = endpoints[static_cast<size_t>(from)];
+        const auto& dest = endpoints[static_cast<size_t>(to)];
+
+        // A channel given on one side only maps to the same channel on the other
+        if (sourceChannel < 0)
+            sourceChannel = destChannel;
+        if (destChannel < 0)
+            destChannel = sourceChannel;
+
+        if (sourceChannel >= source.numChannels || destChannel >= dest.numChannels)
+            return;
+
+        CompiledRoute route;
+        route.sourceChannel = sourceChannel;
+        route.destinationChannel = destChannel;
+        route.destinationChannels = dest.numChannels;
+        route.gain = gain;
+        route.monoToStereo = monoToStereo;
+        outgoing[static_cast<size_t>(from)].emplace_back(to, route);
+    };
+
     for (const auto& [routeId, route] : routes)
     {
-        if (!route->enabled)
-            continue;
+        auto sourceIt = endpointIndex.find(route->sourceNodeId);
+        auto destIt = endpointIndex.find(route->destinationNodeId);
 
-        auto sourceNode = getNode(route->sourceNodeId);
-        auto destNode = getNode(route->destinationNodeId);
+        if (!route->enabled || sourceIt == endpointIndex.end() || destIt == endpointIndex.end())
+            continue;
 
-        if (!sourceNode || !destNode)
+        auto sourceNodeIt = nodes.find(route->sourceNodeId);
+        if (sourceNodeIt != nodes.end() && sourceNodeIt->second->muted)
             continue;
 
-        route->isActive = true;
+        const float gain = route->phaseInvert ? -route->gain : route->gain;
+        addEdge(sourceIt->second, destIt->second, route->sourceChannel, route->destinationChannel,
+                gain, route->monoToStereo);
+    }
 
-        // Route audio from source to destination
-        // This is simplified - full implementation would handle channel mapping and gain
-        if (sourceNode->state == AudioNode::State::Active)
+    for (const auto& [id, bus] : buses)
+    {
+        const int from = endpointIndex[id];
+        for (const auto& [target, level] : bus->getSends())
         {
-            destNode->state = AudioNode::State::Active;
+            auto targetIt = endpointIndex.find(target);
+            if (targetIt != endpointIndex.end() && targetIt->second != from)
+                addEdge(from, targetIt->second, -1, -1, level, false);
         }
     }
-}
 
-void AudioRoutingEngine::processBuses()
-{
-    for (const auto& [id, bus] : buses)
-    {
-        // Process each bus
-        juce::AudioBuffer<float> busBuffer(bus->getNumChannels(), currentBlockSize);
-        busBuffer.clear();
+    // Anything that feeds nothing else ends up on the master bus
+    auto masterIt = endpointIndex.find(masterBus->getIdentifier());
+    const int masterIndex = masterIt != endpointIndex.end() ? masterIt->second : -1;
 
-        // Add inputs from connected nodes/routes
-        // This is simplified - full implementation would collect inputs properly
-        bus->processAudio(busBuffer);
+    for (int i = 0; i < numEndpoints; ++i)
+    {
+        if (i != masterIndex && masterIndex >= 0 && outgoing[static_cast<size_t>(i)].empty())
+            addEdge(i, masterIndex, -1, -1, 1.0f, endpoints[static_cast<size_t>(i)].numChannels == 1);
     }
-}
 
-void AudioRoutingEngine::mixOutputs(juce::AudioBuffer<float>& finalOutput)
-{
-    // Ensure final output buffer is the right size
-    if (finalOutput.getNumChannels() < 2)
-        finalOutput.setSize(2, finalOutput.getNumSamples(), true, false, false);
+    // Kahn's algorithm; endpoints caught in a loop run last in identifier order
+    std::vector<int> pendingInputs(static_cast<size_t>(numEndpoints), 0);
+    for (const auto& edges : outgoing)
+        for (const auto& edge : edges)
+            ++pendingInputs[static_cast<size_t>(edge.first)];
 
-    finalOutput.clear();
+    std::vector<int> order;
+    order.reserve(static_cast<size_t>(numEndpoints));
+    std::vector<bool> scheduled(static_cast<size_t>(numEndpoints), false);
 
-    // Mix from master bus
-    if (masterBus)
+    for (int i = 0; i < numEndpoints; ++i)
     {
-        // Get audio from all nodes and routes to master
-        for (const auto& [id, node] : nodes)
+        if (pendingInputs[static_cast<size_t>(i)] == 0)
         {
-            if (node->state == AudioNode::State::Active)
+            order.push_back(i);
+            scheduled[static_cast<size_t>(i)] = true;
+        }
+    }
+
+    for (size_t next = 0; next < order.size(); ++next)
+    {
+        for (const auto& edge : outgoing[static_cast<size_t>(order[next])])
+        {
+            if (--pendingInputs[static_cast<size_t>(edge.first)] == 0 && !scheduled[static_cast<size_t>(edge.first)])
             {
-                // Add node output to master mix
-                // This is simplified - full implementation would collect actual audio
+                order.push_back(edge.first);
+                scheduled[static_cast<size_t>(edge.first)] = true;
             }
         }
+    }
 
-        // Process master bus
-        masterBus->processAudio(finalOutput);
+    for (int i = 0; i < numEndpoints; ++i)
+    {
+        if (!scheduled[static_cast<size_t>(i)])
+            order.push_back(i);
     }
+
+    // Flatten into the snapshot
+    state.endpoints.clear();
+    state.routes.clear();
+    state.endpoints.reserve(static_cast<size_t>(numEndpoints));
+
+    for (int index : order)
+    {
+        auto endpoint = endpoints[static_cast<size_t>(index)];
+        endpoint.firstRoute = static_cast<int>(state.routes.size());
+
+        for (auto [to, route] : outgoing[static_cast<size_t>(index)])
+        {
+            route.destinationSlot = endpoints[static_cast<size_t>(to)].slot;
+            state.routes.push_back(route);
+        }
+
+        endpoint.numRoutes = static_cast<int>(state.routes.size()) - endpoint.firstRoute;
+        state.endpoints.push_back(endpoint);
+    }
+
+    state.masterSlot = masterIndex >= 0 ? endpoints[static_cast<size_t>(masterIndex)].slot : -1;
+
+    // Size slot buffers; existing allocations are kept when large enough
+    state.blockCapacity = std::max(1, currentBlockSize);
+
+    if (static_cast<int>(state.slotBuffers.size()) < numBufferSlots)
+        state.slotBuffers.resize(static_cast<size_t>(numBufferSlots));
+
+    for (const auto& endpoint : state.endpoints)
+        state.slotBuffers[static_cast<size_t>(endpoint.slot)].setSize(endpoint.numChannels, state.blockCapacity,
+                                                                      false, true, true);
 }
 
-void AudioRoutingEngine::validateRoute(const AudioRoute& route)
+void AudioRoutingEngine::publishRoutingState()
 {
-    // Check if nodes exist
-    if (nodes.find(route.sourceNodeId) == nodes.end())
-        return;
+    auto& state = routingStates[writerStateSlot];
+    compileRoutingState(state);
+    state.version = nextStateVersion++;
 
-    if (nodes.find(route.destinationNodeId) == nodes.end())
-        return;
+    writerStateSlot = middleStateSlot.exchange(static_cast<uint8_t>(writerStateSlot | freshStateBit))
+                    & stateIndexMask;
 
-    // Validate channel numbers
-    auto sourceNode = nodes.at(route.sourceNodeId);
-    auto destNode = nodes.at(route.destinationNodeId);
+    releaseRetiredObjects(false);
+}
 
-    if (route.sourceChannel >= sourceNode->numOutputChannels)
+void AudioRoutingEngine::releaseRetiredObjects(bool audioStopped)
+{
+    if (retiredObjects.empty())
         return;
 
-    if (route.destinationChannel >= destNode->numInputChannels)
-        return;
+    // Seen after our publish: if the callback is idle its next block takes
+    // the fresh snapshot; otherwise wait until it has acknowledged one
+    const bool idle = audioStopped || !audioCallbackActive.load();
+    const uint64_t acknowledged = audioStateVersion.load(std::memory_order_acquire);
+
+    retiredObjects.erase(std::remove_if(retiredObjects.begin(), retiredObjects.end(),
+                                        [&](const RetiredObjects& retired)
+                                        {
+                                            return idle || acknowledged >= retired.version;
+                                        }),
+                         retiredObjects.end());
 }
 
-void AudioRoutingEngine::updateNodeStates()
+void AudioRoutingEngine::retireNode(const juce::String& identifier)
 {
-    for (const auto& [id, node] : nodes)
+    RetiredObjects retired;
+    retired.version = nextStateVersion;
+
+    auto nodeIt = nodes.find(identifier);
+    if (nodeIt != nodes.end())
     {
-        // Update CPU usage, latency, etc.
-        // This is simplified - full implementation would track actual performance
-        if (node->state == AudioNode::State::Active)
-        {
-            node->cpuUsage = 5.0; // Example value
-            node->latency = 2.0;   // Example value
-        }
+        retired.node = std::move(nodeIt->second);
+        nodes.erase(nodeIt);
+    }
+
+    auto instrumentIt = instrumentNodes.find(identifier);
+    if (instrumentIt != instrumentNodes.end())
+    {
+        retired.instrument = std::move(instrumentIt->second);
+        instrumentNodes.erase(instrumentIt);
     }
+
+    if (retired.node || retired.instrument)
+        retiredObjects.push_back(std::move(retired));
 }
 
-void AudioRoutingEngine::updateBusStates()
+int AudioRoutingEngine::acquireBufferSlot(const juce::String& identifier)
 {
-    // Bus states are updated in the bus processing
+    auto it = bufferSlots.find(identifier);
+    if (it != bufferSlots.end())
+        return it->second;
+
+    int slot;
+    if (!freeBufferSlots.empty())
+    {
+        slot = freeBufferSlots.back();
+        freeBufferSlots.pop_back();
+    }
+    else
+    {
+        slot = numBufferSlots++;
+    }
+
+    bufferSlots[identifier] = slot;
+    return slot;
 }
 
-void AudioRoutingEngine::buildProcessingGraph()
+void AudioRoutingEngine::releaseBufferSlot(const juce::String& identifier)
 {
-    processingGraph.clear();
-    processingOrder.clear();
+    auto it = bufferSlots.find(identifier);
+    if (it == bufferSlots.end())
+        return;
 
-    // Create processing nodes
-    for (const auto& [id, node] : nodes)
+    freeBufferSlots.push_back(it->second);
+    bufferSlots.erase(it);
+}
+
+void AudioRoutingEngine::renderRoutingState(RoutingState& state, juce::AudioBuffer<float>& finalOutput)
+{
+    const int totalSamples = finalOutput.getNumSamples();
+    const int outputChannels = finalOutput.getNumChannels();
+
+    if (state.masterSlot < 0)
     {
-        auto procNode = std::make_unique<ProcessingNode>();
-        procNode->node = node.get();
-        processingGraph.push_back(std::move(procNode));
+        finalOutput.clear();
+        return;
     }
 
-    // Build connections
-    for (auto& procNode : processingGraph)
+    const auto& masterBuffer = state.slotBuffers[static_cast<size_t>(state.masterSlot)];
+
+    // Hosts may exceed the prepared block size; render in prepared-size chunks
+    for (int start = 0; start < totalSamples; start += state.blockCapacity)
     {
-        for (const auto& [routeId, route] : routes)
+        const int numSamples = std::min(state.blockCapacity, totalSamples - start);
+
+        for (const auto& endpoint : state.endpoints)
+            state.slotBuffers[static_cast<size_t>(endpoint.slot)].clear(0, numSamples);
+
+        for (const auto& endpoint : state.endpoints)
         {
-            if (route->sourceNodeId == procNode->node->identifier)
+            auto& slotBuffer = state.slotBuffers[static_cast<size_t>(endpoint.slot)];
+
+            // Non-owning view of exactly this chunk
+            juce::AudioBuffer<float> block(slotBuffer.getArrayOfWritePointers(), endpoint.numChannels, 0, numSamples);
+
+            if (endpoint.instrument != nullptr)
             {
-                // Find destination processing node
-                for (auto& destProcNode : processingGraph)
-                {
-                    if (destProcNode->node->identifier == route->destinationNodeId)
-                    {
-                        procNode->outputRoutes.push_back(route.get());
-                        destProcNode->inputRoutes.push_back(route.get());
-                        break;
-                    }
-                }
+                processorMidi.clear();
+                endpoint.instrument->processBlock(block, processorMidi);
             }
-        }
-    }
 
-    // Determine processing order (topological sort)
-    std::unordered_set<ProcessingNode*> visited;
-    std::function<void(ProcessingNode*)> visit = [&](ProcessingNode* node)
-    {
-        if (visited.count(node))
-            return;
+            if (endpoint.processor != nullptr)
+            {
+                processorMidi.clear();
+                endpoint.processor->processBlock(block, processorMidi);
+            }
 
-        // Visit dependencies first
-        for (auto* inputRoute : node->inputRoutes)
-        {
-            for (auto* depNode : processingGraph)
+            if (endpoint.bus != nullptr)
+                endpoint.bus->processAudio(block);
+
+            for (int r = 0; r < endpoint.numRoutes; ++r)
             {
-                if (depNode->node->identifier == inputRoute->sourceNodeId)
-                {
-                    visit(depNode);
-                    break;
-                }
+                const auto& route = state.routes[static_cast<size_t>(endpoint.firstRoute + r)];
+                mixRoute(slotBuffer, endpoint.numChannels,
+                         state.slotBuffers[static_cast<size_t>(route.destinationSlot)], route, numSamples);
             }
         }
 
-        visited.insert(node);
-        processingOrder.push_back(node);
-    };
-
-    for (auto& node : processingGraph)
-    {
-        if (!visited.count(node))
+        const int masterChannels = masterBuffer.getNumChannels();
+        for (int ch = 0; ch < outputChannels; ++ch)
         {
-            visit(node.get());
+            if (ch < masterChannels)
+                finalOutput.copyFrom(ch, start, masterBuffer, ch, 0, numSamples);
+            else
+                finalOutput.clear(ch, start, numSamples);
         }
     }
 }
 
-void AudioRoutingEngine::processGraph()
+void AudioRoutingEngine::mixRoute(const juce::AudioBuffer<float>& source, int sourceChannels,
+                                  juce::AudioBuffer<float>& destination, const CompiledRoute& route, int numSamples)
 {
-    // Process nodes in dependency order
-    for (auto* procNode : processingOrder)
-    {
-        if (!procNode->node || procNode->node->state != AudioNode::State::Active)
-            continue;
+    if (route.gain == 0.0f)
+        return;
 
-        // Collect input from input routes
-        // Process node
-        // Send to output routes
-        // This is simplified - full implementation would handle actual audio buffers
+    if (route.sourceChannel >= 0)
+    {
+        destination.addFrom(route.destinationChannel, 0, source, route.sourceChannel, 0, numSamples, route.gain);
+        return;
+    }
 
-        if (procNode->node->processor)
-        {
-            // Get appropriate buffer and process
-            int bufferIndex = 0;
-            if (bufferIndex < static_cast<int>(tempBuffers.size()))
-            {
-                auto& buffer = tempBuffers[bufferIndex];
-                procNode->node->processor->processBlock(buffer, juce::MidiBuffer());
-            }
-        }
+    if (route.monoToStereo && sourceChannels == 1)
+    {
+        for (int ch = 0; ch < route.destinationChannels; ++ch)
+            destination.addFrom(ch, 0, source, 0, 0, numSamples, route.gain);
+        return;
     }
+
+    const int channels = std::min(sourceChannels, route.destinationChannels);
+    for (int ch = 0; ch < channels; ++ch)
+        destination.addFrom(ch, 0, source, ch, 0, numSamples, route.gain);
+}
+
+void AudioRoutingEngine::validateRoute(const AudioRoute& route)
+{
+    // Check if nodes exist
+    if (nodes.find(route.sourceNodeId) == nodes.end())
+        return;
+
+    if (nodes.find(route.destinationNodeId) == nodes.end())
+        return;
+
+    // Validate channel numbers
+    const auto& sourceNode = nodes.at(route.sourceNodeId);
+    const auto& destNode = nodes.at(route.destinationNodeId);
+
+    if (route.sourceChannel >= sourceNode->numOutputChannels)
+        return;
+
+    if (route.destinationChannel >= destNode->numInputChannels)
+        return;
 }
 
 //==============================================================================
@@ -1417,7 +1604,7 @@ float linearToDB(float gain)
 bool hasRoutingConflicts(const std::vector<AudioRoute*>& routes)
 {
     // Check for multiple routes to same destination channel
-    std::unordered_map<std::pair<juce::String, int>, int> destinationCounts;
+    std::map<std::pair<juce::String, int>, int> destinationCounts;
 
     for (const auto* route : routes)
     {
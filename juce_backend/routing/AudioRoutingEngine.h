@@ -6,9 +6,15 @@
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <mutex>
 
+namespace SchillingerEcosystem::Instrument {
+class InstrumentInstance; // Forward declaration
+}
+
 namespace SchillingerEcosystem::Routing {
 
 /**
@@ -22,7 +28,7 @@ namespace SchillingerEcosystem::Routing {
  * - Performance optimization
  */
 
-class InstrumentInstance; // Forward declaration
+using Instrument::InstrumentInstance;
 
 /**
  * @brief Audio routing node (source or destination)
@@ -69,6 +75,8 @@ struct AudioNode
     double latency = 0.0;           // Latency in milliseconds
     int clippingCount = 0;          // Clipping detection count
 
+    AudioNode() = default;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioNode)
 };
 
@@ -92,6 +100,8 @@ struct AudioRoute
     bool phaseInvert = false;            // Phase inversion
     bool monoToStereo = false;           // Mono to stereo conversion
 
+    AudioRoute() = default;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioRoute)
 };
 
@@ -200,6 +210,16 @@ public:
     MixerBus(const juce::String& identifier, Type type = Type::Audio, int channels = 2);
     ~MixerBus() = default;
 
+    /**
+     * Prepare bus effects and buffers for processing
+     */
+    void prepareToPlay(double sampleRate, int samplesPerBlock);
+
+    /**
+     * Reset bus effects and meters
+     */
+    void reset();
+
     /**
      * Bus configuration
      */
@@ -243,6 +263,7 @@ public:
     void addSend(const juce::String& busIdentifier, float sendLevel);
     void removeSend(const juce::String& busIdentifier);
     float getSendLevel(const juce::String& busIdentifier) const;
+    const std::unordered_map<juce::String, float>& getSends() const { return sends; }
 
     /**
      * Bus monitoring
@@ -279,6 +300,7 @@ private:
     std::unordered_map<juce::String, float> sends;
 
     juce::AudioBuffer<float> mixBuffer;
+    juce::MidiBuffer effectsMidi;   // Reused by every effects call; sized in prepareToPlay
     BusState currentState;
     mutable std::mutex stateMutex;
 
@@ -397,10 +419,16 @@ public:
     std::vector<const MixerBus*> getAllBuses() const;
 
     /**
-     * Remove bus
+     * Remove bus (the master bus cannot be removed)
      */
     bool removeBus(const juce::String& identifier);
 
+    /**
+     * Republish the route table after editing nodes, routes or bus sends
+     * through the pointers returned by the getters above
+     */
+    void refreshRoutingTable();
+
     //==============================================================================
     // AUDIO PROCESSING
     //==============================================================================
@@ -499,36 +527,90 @@ public:
 
 private:
     //==============================================================================
-    // INTERNAL PROCESSING
+    // COMPILED ROUTING STATE
     //==============================================================================
 
-    void processNodes();
-    void processRoutes();
-    void processBuses();
-    void mixOutputs(juce::AudioBuffer<float>& finalOutput);
+    /**
+     * Route table entry: mixes the owning endpoint's buffer into another slot
+     */
+    struct CompiledRoute
+    {
+        int destinationSlot = 0;
+        int sourceChannel = -1;          // -1 = all channels
+        int destinationChannel = -1;     // -1 = all channels
+        int destinationChannels = 2;
+        float gain = 1.0f;               // Includes phase inversion
+        bool monoToStereo = false;
+    };
 
-    void validateRoute(const AudioRoute& route);
-    void updateNodeStates();
-    void updateBusStates();
+    /**
+     * One processing step: a node and/or bus rendered in place in its buffer
+     * slot, followed by its outgoing routes [firstRoute, firstRoute + numRoutes)
+     */
+    struct CompiledEndpoint
+    {
+        int slot = 0;
+        int numChannels = 2;
+        InstrumentInstance* instrument = nullptr;
+        juce::AudioProcessor* processor = nullptr;
+        MixerBus* bus = nullptr;
+        int firstRoute = 0;
+        int numRoutes = 0;
+    };
 
-    // Graph processing
-    struct ProcessingNode
+    /**
+     * Snapshot of the routing graph consumed by the audio thread
+     *
+     * Compiled on the message thread and handed over through a lock-free
+     * triple buffer, so processBlock never waits on an edit. Each snapshot
+     * owns its slot buffers; recompiling reuses them (slots are stable per
+     * node/bus), so only endpoints added since prepareToPlay allocate, and
+     * never on the audio thread.
+     */
+    struct RoutingState
     {
-        AudioNode* node = nullptr;
-        std::vector<AudioRoute*> inputRoutes;
-        std::vector<AudioRoute*> outputRoutes;
-        std::vector<float> inputBuffers;
-        std::vector<float> outputBuffers;
-        bool processed = false;
+        std::vector<CompiledEndpoint> endpoints;    // Processing order
+        std::vector<CompiledRoute> routes;
+        std::vector<juce::AudioBuffer<float>> slotBuffers;
+        int masterSlot = -1;
+        int blockCapacity = 0;
+        uint64_t version = 0;
     };
 
-    void buildProcessingGraph();
-    void processGraph();
+    /**
+     * Objects removed on the message thread, freed once the audio thread
+     * has moved on to a snapshot that no longer references them
+     */
+    struct RetiredObjects
+    {
+        uint64_t version = 0;
+        std::unique_ptr<AudioNode> node;
+        std::shared_ptr<InstrumentInstance> instrument;
+        std::unique_ptr<MixerBus> bus;
+    };
+
+    //==============================================================================
+    // INTERNAL PROCESSING
+    //==============================================================================
+
+    void compileRoutingState(RoutingState& state);
+    void publishRoutingState();
+    void releaseRetiredObjects(bool audioStopped);
+    void retireNode(const juce::String& identifier);
+    int acquireBufferSlot(const juce::String& identifier);
+    void releaseBufferSlot(const juce::String& identifier);
+
+    void renderRoutingState(RoutingState& state, juce::AudioBuffer<float>& finalOutput);
+    static void mixRoute(const juce::AudioBuffer<float>& source, int sourceChannels,
+                         juce::AudioBuffer<float>& destination, const CompiledRoute& route, int numSamples);
+
+    void validateRoute(const AudioRoute& route);
 
     //==============================================================================
     // MEMBER VARIABLES
     //==============================================================================
 
+    // Guards the editable graph below; never taken on the audio thread
     mutable std::mutex routingMutex;
 
     // Nodes and routing
@@ -538,11 +620,31 @@ private:
 
     // Mixer system
     std::unordered_map<juce::String, std::unique_ptr<MixerBus>> buses;
-    std::unique_ptr<MixerBus> masterBus;
+    MixerBus* masterBus = nullptr;
 
-    // Processing graph
-    std::vector<std::unique_ptr<ProcessingNode>> processingGraph;
-    std::vector<ProcessingNode*> processingOrder;
+    // Triple-buffered routing snapshots: writer and audio thread each own a
+    // slot and trade through the middle one
+    static constexpr uint8_t stateIndexMask = 0x3;
+    static constexpr uint8_t freshStateBit = 0x4;
+
+    std::array<RoutingState, 3> routingStates;
+    std::atomic<uint8_t> middleStateSlot{1};
+    uint8_t writerStateSlot = 0;    // Message thread only
+    uint8_t readerStateSlot = 2;    // Audio thread only
+    uint64_t nextStateVersion = 1;
+
+    // Stable buffer slot per node/bus identifier
+    std::unordered_map<juce::String, int> bufferSlots;
+    std::vector<int> freeBufferSlots;
+    int numBufferSlots = 0;
+
+    // Deferred destruction of removed nodes and buses
+    std::vector<RetiredObjects> retiredObjects;
+    std::atomic<uint64_t> audioStateVersion{0};
+    std::atomic<bool> audioCallbackActive{false};
+
+    // Audio thread scratch
+    juce::MidiBuffer processorMidi;
 
     // Audio configuration
     double currentSampleRate = 44100.0;
@@ -550,13 +652,10 @@ private:
     bool realtimeRoutingEnabled = true;
     int maxChannelsPerNode = 32;
 
-    // Temporary buffers
-    std::vector<juce::AudioBuffer<float>> tempBuffers;
-    juce::AudioBuffer<float> masterBuffer;
-
     // Statistics and monitoring
     mutable EngineStats cachedStats;
     mutable juce::Time lastStatsUpdate;
+    std::atomic<double> lastProcessingTimeMs{0.0};
     std::atomic<int> processingIteration{0};
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioRoutingEngine)
@@ -43,10 +43,22 @@ MidiRoutingEngine::MidiRoutingEngine(InstrumentManager* instrumentManager)
     for (int i = 1; i <= 16; ++i) {
         allowedChannels_.insert(i);
     }
+
+    for (auto& epoch : dispatcherEpochs_) {
+        epoch.store(quiescentEpoch);
+    }
+
+    for (auto& channels : learnedControllerChannels_) {
+        channels.store(0);
+    }
 }
 
 MidiRoutingEngine::~MidiRoutingEngine() {
     shutdown();
+
+    // No dispatcher may still be running once the engine is destroyed
+    delete activeTable_.exchange(nullptr);
+    retiredTables_.clear();
 }
 
 bool MidiRoutingEngine::initialize() {
@@ -118,6 +130,7 @@ void MidiRoutingEngine::shutdown() {
         routes_.clear();
         deviceRoutes_.clear();
         instrumentRoutes_.clear();
+        rebuildDispatchTable();
     }
 
     // Clear MIDI learn mappings
@@ -125,6 +138,7 @@ void MidiRoutingEngine::shutdown() {
         juce::ScopedLock learnLock(midiLearnMutex_);
         midiLearnMappings_.clear();
         activeMidiLearnSessions_.clear();
+        rebuildMidiLearnIndex();
     }
 
     initialized_ = false;
@@ -371,11 +385,12 @@ RouteID MidiRoutingEngine::createRoute(const MidiRouteConfig& config) {
     juce::ScopedLock lock(routesMutex_);
 
     RouteID routeId = generateRouteId();
-    auto route = std::make_unique<MidiRoute>(routeId, config);
+    auto route = std::make_shared<MidiRoute>(routeId, config);
 
     routes_[routeId] = std::move(route);
     deviceRoutes_[config.sourceDevice].push_back(routeId);
     instrumentRoutes_[config.targetInstrument].push_back(routeId);
+    rebuildDispatchTable();
 
     // Update statistics
     {
@@ -409,6 +424,7 @@ bool MidiRoutingEngine::removeRoute(RouteID routeId) {
                           instrumentRoutes.end());
 
     routes_.erase(it);
+    rebuildDispatchTable();
 
     // Update statistics
     {
@@ -448,6 +464,7 @@ bool MidiRoutingEngine::updateRouteConfig(RouteID routeId, const MidiRouteConfig
     }
 
     it->second->config = config;
+    rebuildDispatchTable();
 
     juce::Logger::writeToLog("Updated MIDI route config: " + juce::String(routeId));
     return true;
@@ -497,6 +514,7 @@ bool MidiRoutingEngine::enableRoute(RouteID routeId) {
     auto it = routes_.find(routeId);
     if (it != routes_.end()) {
         it->second->enabled = true;
+        rebuildDispatchTable();
         return true;
     }
     return false;
@@ -507,6 +525,7 @@ bool MidiRoutingEngine::disableRoute(RouteID routeId) {
     auto it = routes_.find(routeId);
     if (it != routes_.end()) {
         it->second->enabled = false;
+        rebuildDispatchTable();
         return true;
     }
     return false;
@@ -530,109 +549,212 @@ RouteID MidiRoutingEngine::createAllInstrumentsRoute(const std::string& sourceDe
     return createRoute(config);
 }
 
+void MidiRoutingEngine::refreshInstrumentBindings() {
+    juce::ScopedLock lock(routesMutex_);
+    rebuildDispatchTable();
+}
+
 //==============================================================================
 // MIDI Processing
 //==============================================================================
 
 void MidiRoutingEngine::processMidiBlock(const std::string& sourceDevice,
                                         juce::MidiBuffer& midiBuffer, int numSamples) {
+    juce::ignoreUnused(numSamples);
+
     if (!initialized_) {
         return;
     }
 
-    juce::ScopedLock lock(routesMutex_);
+    dispatchEvents(sourceDevice, midiBuffer);
 
-    // Get routes for this source device
-    auto routeIt = deviceRoutes_.find(sourceDevice);
-    if (routeIt == deviceRoutes_.end()) {
-        return; // No routes for this device
+    // Call activity callback
+    if (midiActivityCallback_) {
+        for (const auto metadata : midiBuffer) {
+            midiActivityCallback_(sourceDevice, metadata.getMessage());
+        }
     }
+}
 
-    juce::MidiBuffer filteredBuffer;
-    juce::MidiBuffer transformedBuffer;
+void MidiRoutingEngine::processMidiMessage(const std::string& sourceDevice,
+                                         const juce::MidiMessage& message) {
+    if (!initialized_) {
+        return;
+    }
 
-    for (RouteID routeId : routeIt->second) {
-        auto routeIt = routes_.find(routeId);
-        if (routeIt == routes_.end() || !routeIt->second->enabled) {
-            continue;
+    const std::array<juce::MidiMessageMetadata, 1> events {
+        juce::MidiMessageMetadata(message.getRawData(), message.getRawDataSize(), 0)
+    };
+    dispatchEvents(sourceDevice, events);
+
+    if (midiActivityCallback_) {
+        midiActivityCallback_(sourceDevice, message);
+    }
+}
+
+template <typename Events>
+void MidiRoutingEngine::dispatchEvents(const std::string& sourceDevice, const Events& events) {
+    // Claim a dispatcher slot, announcing the epoch we read the table in, so a
+    // writer that replaces the table after this point keeps it alive for us
+    const uint64_t epoch = globalEpoch_.load(std::memory_order_acquire);
+    int slot = -1;
+
+    for (int i = 0; i < maxConcurrentDispatchers; ++i) {
+        uint64_t expected = quiescentEpoch;
+        if (dispatcherEpochs_[i].compare_exchange_strong(expected, epoch)) {
+            slot = i;
+            break;
         }
+    }
 
-        auto& route = routeIt->second;
-        route->messageCount++;
-        route->lastActivity = juce::Time::getCurrentTime();
+    if (slot < 0) {
+        return; // More concurrent callers than dispatcher slots
+    }
 
-        // Apply filtering
-        filteredBuffer.clear();
-        if (route->config.filterMask == 0) {
-            filteredBuffer = midiBuffer; // No filtering
-        } else {
-            applyMessageFilter(midiBuffer, route->config);
+    struct SlotRelease {
+        std::atomic<uint64_t>& epochSlot;
+        ~SlotRelease() { epochSlot.store(quiescentEpoch, std::memory_order_release); }
+    } slotRelease { dispatcherEpochs_[slot] };
+
+    DispatchTable* table = activeTable_.load();
+    const SourceDispatch* source = nullptr;
+
+    if (table != nullptr) {
+        auto sourceIt = table->sources.find(sourceDevice);
+        if (sourceIt != table->sources.end()) {
+            source = &sourceIt->second;
         }
+    }
 
-        // Apply transformation
-        transformedBuffer.clear();
-        if (route->config.transformMask == 0) {
-            transformedBuffer = filteredBuffer; // No transformation
-        } else {
-            applyMessageTransform(filteredBuffer, route->config);
+    juce::MidiBuffer* buffers = nullptr;
+    uint32_t* routeCounts = nullptr;
+
+    if (source != nullptr) {
+        buffers = table->destinationBuffers.data() + static_cast<size_t>(slot) * table->destinations.size();
+        routeCounts = table->routeEventCounts.data() + static_cast<size_t>(slot) * table->routes.size();
+    }
+
+    const bool learnArmed = armedMidiLearnSessions_.load(std::memory_order_acquire) > 0;
+    uint64_t routed = 0;
+    uint64_t filtered = 0;
+    uint64_t transformed = 0;
+
+    for (const auto metadata : events) {
+        const uint8_t* data = metadata.data;
+        const int numBytes = metadata.numBytes;
+
+        if (numBytes <= 0 || data[0] < 0x80) {
+            continue;
         }
 
-        // Route to target
-        if (route->config.targetInstrument == "broadcast") {
-            // Send to all instruments
-            auto allInstances = instrumentManager_->getAllInstances();
-            for (auto& instance : allInstances) {
-                if (instance) {
-                    instance->processMidi(transformedBuffer);
+        const uint8_t status = data[0];
+        const int nibble = (status >> 4) - 8;
+        const int channel = status < 0xF0 ? (status & 0x0F) : 0;
+
+        if (source != nullptr) {
+            const auto cell = source->cells[channel][nibble];
+
+            for (uint32_t i = cell.first; i < cell.second; ++i) {
+                const uint32_t routeIndex = source->routeIndices[i];
+                const auto& route = table->routes[routeIndex];
+
+                if (route.filterFlags != 0 && !route.passesFilter(data, numBytes)) {
+                    ++filtered;
+                    continue;
                 }
-            }
-        } else if (route->config.targetInstrument == "all_instruments") {
-            // Send to all built-in instruments
-            auto instanceNames = {"NEX_FM", "Sam_Sampler", "LocalGal"};
-            for (const auto& name : instanceNames) {
-                auto instance = instrumentManager_->getInstance(name);
-                if (instance) {
-                    instance->processMidi(transformedBuffer);
+
+                const uint8_t* out = data;
+                uint8_t mapped[3];
+
+                if (route.transforms && numBytes <= 3 && status < 0xF0) {
+                    route.applyTransform(data, numBytes, mapped);
+                    out = mapped;
+                    ++transformed;
                 }
-            }
-        } else {
-            // Send to specific instrument
-            auto instance = instrumentManager_->getInstance(route->config.targetInstrument);
-            if (instance) {
-                instance->processMidi(transformedBuffer);
+
+                const uint32_t* destinations = table->routeDestinations.data() + route.firstDestination;
+
+                if (route.customTransform) {
+                    const auto message = route.customTransform(juce::MidiMessage(out, numBytes, 0));
+                    for (uint32_t d = 0; d < route.numDestinations; ++d) {
+                        buffers[destinations[d]].addEvent(message, metadata.samplePosition);
+                    }
+                } else {
+                    for (uint32_t d = 0; d < route.numDestinations; ++d) {
+                        buffers[destinations[d]].addEvent(out, numBytes, metadata.samplePosition);
+                    }
+                }
+
+                ++routeCounts[routeIndex];
+                ++routed;
             }
         }
 
-        // Update statistics
-        {
-            juce::ScopedLock statsLock(statsMutex_);
-            stats_.totalMessagesRouted += transformedBuffer.getNumEvents();
+        // MIDI learn runs only while a session is armed or for mapped controllers
+        if (nibble == 3 && numBytes >= 3) {
+            const uint32_t mappedChannels = learnedControllerChannels_[data[1] & 0x7F].load(std::memory_order_relaxed);
+            if (learnArmed || (mappedChannels & (1u << channel)) != 0) {
+                processMidiLearn(juce::MidiMessage(data, numBytes, 0));
+            }
         }
     }
 
-    // Process MIDI learn for all messages
-    juce::MidiBuffer::Iterator it(midiBuffer);
-    juce::MidiMessage message;
-    int samplePosition;
+    if (source != nullptr) {
+        deliverDestinationBuffers(*table, slot);
+    }
 
-    while (it.getNextEvent(message, samplePosition)) {
-        processMidiLearn(message);
+    auto& counters = dispatchCounters_[slot];
+    if (routed != 0) {
+        counters.messagesRouted.fetch_add(routed, std::memory_order_relaxed);
+    }
+    if (filtered != 0) {
+        counters.messagesFiltered.fetch_add(filtered, std::memory_order_relaxed);
     }
+    if (transformed != 0) {
+        counters.messagesTransformed.fetch_add(transformed, std::memory_order_relaxed);
+    }
+}
 
-    // Call activity callback
-    if (midiActivityCallback_) {
-        juce::MidiBuffer::Iterator activityIt(midiBuffer);
-        while (activityIt.getNextEvent(message, samplePosition)) {
-            midiActivityCallback_(sourceDevice, message);
+void MidiRoutingEngine::deliverDestinationBuffers(DispatchTable& table, int slot) {
+    const size_t numDestinations = table.destinations.size();
+    juce::MidiBuffer* buffers = table.destinationBuffers.data() + static_cast<size_t>(slot) * numDestinations;
+
+    for (size_t d = 0; d < numDestinations; ++d) {
+        auto& buffer = buffers[d];
+        if (buffer.isEmpty()) {
+            continue;
         }
+
+        if (static_cast<int>(d) == table.broadcastDestination) {
+            for (const auto& instance : table.broadcastInstances) {
+                instance->processMidi(buffer);
+            }
+        } else if (const auto& instance = table.destinationInstances[d]) {
+            instance->processMidi(buffer);
+        }
+
+        buffer.clear();
     }
-}
 
-void MidiRoutingEngine::processMidiMessage(const std::string& sourceDevice,
-                                         const juce::MidiMessage& message) {
-    juce::MidiBuffer buffer;
-    buffer.addEvent(message, 0);
-    processMidiBlock(sourceDevice, buffer, 1);
+    // Fold this block's per-route counts into the routes, reading the clock once
+    const size_t numRoutes = table.routes.size();
+    uint32_t* routeCounts = table.routeEventCounts.data() + static_cast<size_t>(slot) * numRoutes;
+    juce::int64 now = 0;
+
+    for (size_t r = 0; r < numRoutes; ++r) {
+        if (routeCounts[r] == 0) {
+            continue;
+        }
+
+        if (now == 0) {
+            now = juce::Time::currentTimeMillis();
+        }
+
+        auto& route = *table.routes[r].route;
+        route.messageCount.fetch_add(routeCounts[r], std::memory_order_relaxed);
+        route.lastActivityMs.store(now, std::memory_order_relaxed);
+        routeCounts[r] = 0;
+    }
 }
 
 void MidiRoutingEngine::sendMidiToInstrument(const std::string& instrumentName,
@@ -678,6 +800,7 @@ bool MidiRoutingEngine::startMidiLearn(const std::string& parameterName,
     }
 
     midiLearnMappings_[key].isLearning = true;
+    rebuildMidiLearnIndex();
 
     juce::Logger::writeToLog("Started MIDI learn for: " + juce::String(key));
     return true;
@@ -694,6 +817,7 @@ bool MidiRoutingEngine::stopMidiLearn(const std::string& parameterName,
     if (it != midiLearnMappings_.end()) {
         it->second.isLearning = false;
     }
+    rebuildMidiLearnIndex();
 
     juce::Logger::writeToLog("Stopped MIDI learn for: " + juce::String(key));
     return true;
@@ -717,6 +841,7 @@ bool MidiRoutingEngine::addMidiLearnMapping(const MidiLearnConfig& config) {
 
     std::string key = config.instrumentName + "::" + config.parameterName;
     midiLearnMappings_[key] = config;
+    rebuildMidiLearnIndex();
 
     juce::Logger::writeToLog("Added MIDI learn mapping: " + juce::String(key) +
                             " -> CC" + juce::String(config.midiCC));
@@ -732,6 +857,7 @@ bool MidiRoutingEngine::removeMidiLearnMapping(const std::string& parameterName,
     if (it != midiLearnMappings_.end()) {
         midiLearnMappings_.erase(it);
         activeMidiLearnSessions_.erase(key);
+        rebuildMidiLearnIndex();
 
         juce::Logger::writeToLog("Removed MIDI learn mapping: " + juce::String(key));
         return true;
@@ -793,6 +919,7 @@ void MidiRoutingEngine::processMidiLearn(const juce::MidiMessage& message) {
             midiLearnMappings_[key] = mutableConfig;
 
             activeMidiLearnSessions_.erase(key);
+            rebuildMidiLearnIndex();
 
             // Update statistics
             {
@@ -827,6 +954,7 @@ void MidiRoutingEngine::clearAllMidiLearnMappings() {
     juce::ScopedLock lock(midiLearnMutex_);
     midiLearnMappings_.clear();
     activeMidiLearnSessions_.clear();
+    rebuildMidiLearnIndex();
 
     juce::Logger::writeToLog("Cleared all MIDI learn mappings");
 }
@@ -1102,20 +1230,36 @@ std::unordered_set<int> MidiRoutingEngine::getAllowedChannels() const {
 
 MidiRoutingStats MidiRoutingEngine::getStatistics() const {
     juce::ScopedLock lock(statsMutex_);
-    return stats_;
+    MidiRoutingStats stats = stats_;
+
+    for (const auto& counters : dispatchCounters_) {
+        stats.totalMessagesRouted += counters.messagesRouted.load(std::memory_order_relaxed);
+        stats.messagesFiltered += counters.messagesFiltered.load(std::memory_order_relaxed);
+        stats.messagesTransformed += counters.messagesTransformed.load(std::memory_order_relaxed);
+    }
+
+    return stats;
 }
 
 void MidiRoutingEngine::resetStatistics() {
     juce::ScopedLock lock(statsMutex_);
     stats_.reset();
+
+    for (auto& counters : dispatchCounters_) {
+        counters.messagesRouted.store(0, std::memory_order_relaxed);
+        counters.messagesFiltered.store(0, std::memory_order_relaxed);
+        counters.messagesTransformed.store(0, std::memory_order_relaxed);
+    }
 }
 
 std::vector<std::string> MidiRoutingEngine::getActiveRoutes() const {
     juce::ScopedLock lock(routesMutex_);
     std::vector<std::string> activeRoutes;
 
+    const juce::int64 activeSinceMs = juce::Time::currentTimeMillis() - 5000;
+
     for (const auto& [routeId, route] : routes_) {
-        if (route->enabled && route->lastActivity > juce::Time::getCurrentTime() - juce::RelativeTime::seconds(5.0)) {
+        if (route->enabled && route->lastActivityMs.load(std::memory_order_relaxed) > activeSinceMs) {
             activeRoutes.push_back(route->config.name);
         }
     }
@@ -1126,7 +1270,7 @@ std::vector<std::string> MidiRoutingEngine::getActiveRoutes() const {
 uint64_t MidiRoutingEngine::getMessageCountForRoute(RouteID routeId) const {
     juce::ScopedLock lock(routesMutex_);
     auto it = routes_.find(routeId);
-    return (it != routes_.end()) ? it->second->messageCount : 0;
+    return (it != routes_.end()) ? it->second->messageCount.load(std::memory_order_relaxed) : 0;
 }
 
 //==============================================================================
@@ -1237,6 +1381,7 @@ bool MidiRoutingEngine::loadState(const juce::File& file) {
             juce::ScopedLock learnLock(midiLearnMutex_);
             midiLearnMappings_.clear();
             activeMidiLearnSessions_.clear();
+            rebuildMidiLearnIndex();
         }
 
         // Load routes
@@ -1251,7 +1396,7 @@ bool MidiRoutingEngine::loadState(const juce::File& file) {
                 config.targetInstrument = routeObj->getProperty("targetInstrument").toString().toStdString();
 
                 RouteID routeId = static_cast<RouteID>(static_cast<int64_t>(routeObj->getProperty("id")));
-                auto route = std::make_unique<MidiRoute>(routeId, config);
+                auto route = std::make_shared<MidiRoute>(routeId, config);
                 route->enabled = routeObj->getProperty("enabled");
 
                 {
@@ -1281,10 +1426,16 @@ bool MidiRoutingEngine::loadState(const juce::File& file) {
                 {
                     juce::ScopedLock lock(midiLearnMutex_);
                     midiLearnMappings_[key] = config;
+                    rebuildMidiLearnIndex();
                 }
             }
         }
 
+        {
+            juce::ScopedLock lock(routesMutex_);
+            rebuildDispatchTable();
+        }
+
         juce::Logger::writeToLog("Loaded MIDI routing state from: " + file.getFullPathName());
         return true;
 
@@ -1294,6 +1445,354 @@ bool MidiRoutingEngine::loadState(const juce::File& file) {
     }
 }
 
+//==============================================================================
+// Compiled Dispatch Table
+//==============================================================================
+
+bool MidiRoutingEngine::CompiledRoute::passesFilter(const uint8_t* data, int numBytes) const {
+    const uint8_t kind = data[0] & 0xF0;
+    const bool isNote = (kind == 0x80 || kind == 0x90) && numBytes >= 3;
+    const bool isNoteOn = kind == 0x90 && numBytes >= 3 && data[2] != 0;
+
+    if ((filterFlags & NoteOnOnly) && kind == 0x90 && !isNoteOn) {
+        return false;
+    }
+
+    if ((filterFlags & NoteOffOnly) && isNoteOn) {
+        return false;
+    }
+
+    if ((filterFlags & NoteRange) && isNote && (data[1] < noteLow || data[1] > noteHigh)) {
+        return false;
+    }
+
+    if ((filterFlags & Velocity) && isNoteOn && (data[2] < velocityLow || data[2] > velocityHigh)) {
+        return false;
+    }
+
+    if ((filterFlags & Controllers) && kind == 0xB0 && numBytes >= 2) {
+        const uint8_t controller = data[1] & 0x7F;
+        if (((controllerMask[controller >> 6] >> (controller & 63)) & 1) == 0) {
+            return false;
+        }
+    }
+
+    if ((filterFlags & CustomFilter) && customFilter(juce::MidiMessage(data, numBytes, 0))) {
+        return false;
+    }
+
+    return true;
+}
+
+void MidiRoutingEngine::CompiledRoute::applyTransform(const uint8_t* data, int numBytes, uint8_t* out) const {
+    const uint8_t kind = data[0] & 0xF0;
+    out[0] = static_cast<uint8_t>(kind | channelMap[data[0] & 0x0F]);
+
+    for (int i = 1; i < numBytes; ++i) {
+        out[i] = data[i];
+    }
+
+    if ((kind == 0x80 || kind == 0x90) && numBytes >= 3) {
+        out[1] = noteMap[data[1] & 0x7F];
+        if (kind == 0x90 && data[2] != 0) {
+            out[2] = velocityMap[data[2] & 0x7F];
+        }
+    } else if (kind == 0xB0 && numBytes >= 2) {
+        out[1] = controllerMap[data[1] & 0x7F];
+    }
+}
+
+std::unique_ptr<MidiRoutingEngine::DispatchTable> MidiRoutingEngine::compileDispatchTable() const {
+    auto table = std::make_unique<DispatchTable>();
+
+    std::unordered_map<std::string, uint32_t> destinationIndex;
+    auto destinationFor = [&](const std::string& name) {
+        auto [it, inserted] = destinationIndex.emplace(name, static_cast<uint32_t>(table->destinations.size()));
+        if (inserted) {
+            table->destinations.push_back(name);
+        }
+        return it->second;
+    };
+
+    using CellRoutes = std::array<std::array<std::vector<uint32_t>, numStatusNibbles>, numDispatchChannels>;
+    std::unordered_map<std::string, CellRoutes> cellRoutes;
+
+    // Route id order keeps dispatch order stable across rebuilds
+    std::vector<RouteID> routeIds;
+    for (const auto& [routeId, route] : routes_) {
+        if (route->enabled) {
+            routeIds.push_back(routeId);
+        }
+    }
+    std::sort(routeIds.begin(), routeIds.end());
+
+    for (RouteID routeId : routeIds) {
+        const auto& route = routes_.at(routeId);
+        const auto& config = route->config;
+
+        CompiledRoute compiled;
+        compiled.route = route;
+
+        // Destinations, with the "all_instruments" target expanded here
+        compiled.firstDestination = static_cast<uint32_t>(table->routeDestinations.size());
+        if (config.targetInstrument == "all_instruments") {
+            for (const char* name : { "NEX_FM", "Sam_Sampler", "LocalGal" }) {
+                table->routeDestinations.push_back(destinationFor(name));
+            }
+        } else {
+            table->routeDestinations.push_back(destinationFor(config.targetInstrument));
+        }
+        compiled.numDestinations = static_cast<uint32_t>(table->routeDestinations.size()) - compiled.firstDestination;
+
+        // Channel and message type filters select table cells; the rest are
+        // checked per message
+        const uint32_t filters = config.filterMask;
+        uint32_t channelMask = 0xFFFF;
+        bool systemAllowed = true;
+        std::array<bool, numStatusNibbles> nibbleAllowed;
+        nibbleAllowed.fill(true);
+
+        if (filters & static_cast<uint32_t>(MidiFilterType::Channel)) {
+            channelMask = 0;
+            for (int channel : config.allowedChannels) {
+                if (channel >= 1 && channel <= 16) {
+                    channelMask |= 1u << (channel - 1);
+                }
+            }
+            systemAllowed = false;   // System messages have no channel
+        }
+
+        if (filters & static_cast<uint32_t>(MidiFilterType::MessageType)) {
+            const auto allows = [&config](int type) { return config.allowedMessageTypes.count(type) != 0; };
+            const bool noteOn = allows(0);
+            const bool noteOff = allows(1);
+
+            nibbleAllowed[0] = noteOff;              // 0x8n
+            nibbleAllowed[1] = noteOn || noteOff;    // 0x9n (velocity 0 is a note off)
+            nibbleAllowed[2] = allows(5);            // Poly aftertouch
+            nibbleAllowed[3] = allows(2);            // Controller
+            nibbleAllowed[4] = allows(6);            // Program change
+            nibbleAllowed[5] = allows(4);            // Channel pressure
+            nibbleAllowed[6] = allows(3);            // Pitch wheel
+            nibbleAllowed[7] = false;
+
+            if (noteOn && !noteOff) {
+                compiled.filterFlags |= CompiledRoute::NoteOnOnly;
+            } else if (noteOff && !noteOn) {
+                compiled.filterFlags |= CompiledRoute::NoteOffOnly;
+            }
+        }
+
+        if (filters & static_cast<uint32_t>(MidiFilterType::NoteRange)) {
+            // Same bounds as shouldFilterMessage, which reads velocityRange
+            compiled.filterFlags |= CompiledRoute::NoteRange;
+            compiled.noteLow = static_cast<uint8_t>(config.velocityRange.first);
+            compiled.noteHigh = static_cast<uint8_t>(config.velocityRange.second);
+        }
+
+        if (filters & static_cast<uint32_t>(MidiFilterType::VelocityRange)) {
+            compiled.filterFlags |= CompiledRoute::Velocity;
+            compiled.velocityLow = static_cast<uint8_t>(config.velocityRange.first);
+            compiled.velocityHigh = static_cast<uint8_t>(config.velocityRange.second);
+        }
+
+        if (filters & static_cast<uint32_t>(MidiFilterType::Controller)) {
+            compiled.filterFlags |= CompiledRoute::Controllers;
+            for (int controller : config.allowedControllers) {
+                if (controller >= 0 && controller < 128) {
+                    compiled.controllerMask[controller >> 6] |= uint64_t(1) << (controller & 63);
+                }
+            }
+        }
+
+        if ((filters & static_cast<uint32_t>(MidiFilterType::Custom)) && config.customFilter) {
+            compiled.filterFlags |= CompiledRoute::CustomFilter;
+            compiled.customFilter = config.customFilter;
+        }
+
+        // Transforms become byte lookups applied together
+        const uint32_t transforms = config.transformMask;
+        compiled.transforms = transforms != 0;
+
+        for (int i = 0; i < 16; ++i) {
+            compiled.channelMap[i] = static_cast<uint8_t>(i);
+        }
+        for (int i = 0; i < 128; ++i) {
+            compiled.noteMap[i] = static_cast<uint8_t>(i);
+            compiled.velocityMap[i] = static_cast<uint8_t>(i);
+            compiled.controllerMap[i] = static_cast<uint8_t>(i);
+        }
+
+        if (transforms & static_cast<uint32_t>(MidiTransformType::Transpose)) {
+            for (int note = 0; note < 128; ++note) {
+                compiled.noteMap[note] = static_cast<uint8_t>(juce::jlimit(0, 127, note + config.transposeSemi));
+            }
+        }
+
+        if (transforms & static_cast<uint32_t>(MidiTransformType::NoteMap)) {
+            for (const auto& [from, to] : config.noteMap) {
+                if (from >= 0 && from < 128 && to >= 0 && to < 128) {
+                    compiled.noteMap[from] = static_cast<uint8_t>(to);
+                }
+            }
+        }
+
+        if (transforms & static_cast<uint32_t>(MidiTransformType::VelocityScale)) {
+            for (int velocity = 1; velocity < 128; ++velocity) {
+                float scaled = juce::jlimit(0.0f, 127.0f, velocity * config.velocityScale);
+                scaled = applyVelocityCurve(scaled / 127.0f, config.velocityCurve) * 127.0f;
+                compiled.velocityMap[velocity] = static_cast<uint8_t>(juce::jlimit(0.0f, 127.0f, scaled));
+            }
+        }
+
+        if (transforms & static_cast<uint32_t>(MidiTransformType::ChannelMap)) {
+            for (const auto& [from, to] : config.channelMap) {
+                if (from >= 1 && from <= 16 && to >= 1 && to <= 16) {
+                    compiled.channelMap[from - 1] = static_cast<uint8_t>(to - 1);
+                }
+            }
+        }
+
+        if (transforms & static_cast<uint32_t>(MidiTransformType::ControllerMap)) {
+            for (const auto& [from, to] : config.controllerMap) {
+                if (from >= 0 && from < 128 && to >= 0 && to < 128) {
+                    compiled.controllerMap[from] = static_cast<uint8_t>(to);
+                }
+            }
+        }
+
+        if ((transforms & static_cast<uint32_t>(MidiTransformType::Custom)) && config.customTransform) {
+            compiled.customTransform = config.customTransform;
+        }
+
+        const auto routeIndex = static_cast<uint32_t>(table->routes.size());
+        table->routes.push_back(std::move(compiled));
+
+        auto& cells = cellRoutes[config.sourceDevice];
+        for (int channel = 0; channel < numDispatchChannels; ++channel) {
+            if ((channelMask & (1u << channel)) == 0) {
+                continue;
+            }
+            for (int nibble = 0; nibble < numStatusNibbles - 1; ++nibble) {
+                if (nibbleAllowed[nibble]) {
+                    cells[channel][nibble].push_back(routeIndex);
+                }
+            }
+        }
+
+        if (systemAllowed && nibbleAllowed[numStatusNibbles - 1]) {
+            cells[0][numStatusNibbles - 1].push_back(routeIndex);
+        }
+    }
+
+    // Flatten each source's cells into one index array
+    for (const auto& [sourceDevice, cells] : cellRoutes) {
+        auto& dispatch = table->sources[sourceDevice];
+
+        for (int channel = 0; channel < numDispatchChannels; ++channel) {
+            for (int nibble = 0; nibble < numStatusNibbles; ++nibble) {
+                const auto& routeIndices = cells[channel][nibble];
+                const auto first = static_cast<uint32_t>(dispatch.routeIndices.size());
+                dispatch.routeIndices.insert(dispatch.routeIndices.end(), routeIndices.begin(), routeIndices.end());
+                dispatch.cells[channel][nibble] = { first, static_cast<uint32_t>(dispatch.routeIndices.size()) };
+            }
+        }
+    }
+
+    auto broadcastIt = destinationIndex.find("broadcast");
+    if (broadcastIt != destinationIndex.end()) {
+        table->broadcastDestination = static_cast<int>(broadcastIt->second);
+    }
+
+    // Resolve instances once so delivery indexes them instead of looking up names
+    table->destinationInstances.resize(table->destinations.size());
+    if (instrumentManager_ != nullptr) {
+        for (size_t d = 0; d < table->destinations.size(); ++d) {
+            if (static_cast<int>(d) != table->broadcastDestination) {
+                table->destinationInstances[d] = instrumentManager_->getInstance(table->destinations[d]);
+            }
+        }
+
+        if (table->broadcastDestination >= 0) {
+            for (auto& instance : instrumentManager_->getAllInstances()) {
+                if (instance) {
+                    table->broadcastInstances.push_back(std::move(instance));
+                }
+            }
+        }
+    }
+
+    // Scratch for every dispatcher slot, sized for maxEventsPerBlock and
+    // allocated here rather than per block
+    table->destinationBuffers.resize(static_cast<size_t>(maxConcurrentDispatchers) * table->destinations.size());
+    for (auto& buffer : table->destinationBuffers) {
+        buffer.ensureSize(destinationBufferBytes);
+    }
+    table->routeEventCounts.assign(static_cast<size_t>(maxConcurrentDispatchers) * table->routes.size(), 0);
+
+    return table;
+}
+
+void MidiRoutingEngine::rebuildDispatchTable() {
+    DispatchTable* previous = activeTable_.exchange(compileDispatchTable().release());
+    const uint64_t epoch = globalEpoch_.fetch_add(1) + 1;
+
+    if (previous != nullptr) {
+        previous->retiredAtEpoch = epoch;
+        retiredTables_.emplace_back(previous);
+    }
+
+    reclaimRetiredTables();
+}
+
+bool MidiRoutingEngine::hasDispatchersPassedEpoch(uint64_t epoch) const noexcept {
+    for (const auto& slot : dispatcherEpochs_) {
+        const uint64_t dispatcherEpoch = slot.load();
+        if (dispatcherEpoch != quiescentEpoch && dispatcherEpoch < epoch) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void MidiRoutingEngine::reclaimRetiredTables() {
+    retiredTables_.erase(
+        std::remove_if(retiredTables_.begin(), retiredTables_.end(),
+            [this](const std::unique_ptr<DispatchTable>& retired) {
+                return hasDispatchersPassedEpoch(retired->retiredAtEpoch);
+            }),
+        retiredTables_.end());
+}
+
+void MidiRoutingEngine::rebuildMidiLearnIndex() {
+    std::array<uint32_t, 128> controllerChannels {};
+    int armedSessions = 0;
+
+    for (const auto& [key, config] : midiLearnMappings_) {
+        if (config.isLearning) {
+            ++armedSessions;
+            continue;
+        }
+
+        if (config.midiCC < 0 || config.midiCC > 127) {
+            continue;
+        }
+
+        // Matches processMidiLearn: a negative channel means any channel
+        if (config.midiChannel < 0) {
+            controllerChannels[config.midiCC] |= 0xFFFFu;
+        } else if (config.midiChannel >= 1 && config.midiChannel <= 16) {
+            controllerChannels[config.midiCC] |= 1u << (config.midiChannel - 1);
+        }
+    }
+
+    for (int controller = 0; controller < 128; ++controller) {
+        learnedControllerChannels_[controller].store(controllerChannels[controller], std::memory_order_relaxed);
+    }
+    armedMidiLearnSessions_.store(armedSessions, std::memory_order_release);
+}
+
 //==============================================================================
 // Internal Methods
 //==============================================================================
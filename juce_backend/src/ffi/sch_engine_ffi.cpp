@@ -35,6 +35,9 @@
 #include <atomic>
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
+#include <thread>
 
 // ============================================================================
 // Internal Engine Implementation
@@ -64,6 +67,26 @@ public:
         return true;
     }
 
+    // Publish all items with a single index store, or none if they don't fit
+    bool tryPushBatch(const T* items, size_t count) {
+        const size_t write = writeIndex_.load(std::memory_order_relaxed);
+        const size_t read = readIndex_.load(std::memory_order_acquire);
+        const size_t used = (write + Capacity - read) % Capacity;
+
+        if (count > Capacity - 1 - used) {
+            return false;  // Not enough space for the whole batch
+        }
+
+        size_t index = write;
+        for (size_t i = 0; i < count; ++i) {
+            buffer_[index] = items[i];
+            index = (index + 1) % Capacity;
+        }
+
+        writeIndex_.store(index, std::memory_order_release);
+        return true;
+    }
+
     bool tryPop(T& item) {
         const size_t read = readIndex_.load(std::memory_order_relaxed);
         if (read == writeIndex_.load(std::memory_order_acquire)) {
@@ -82,9 +105,24 @@ public:
 };
 
 // Command queue wrapper
-using CommandQueue = LockFreeSPSCQueue<sch_command_t, 256>;
-static_assert(std::is_trivially_copyable<sch_command_t>::value,
-              "sch_command_t must be trivially copyable for lock-free queue");
+using CommandQueue = LockFreeSPSCQueue<sch_timed_command_t, SCH_COMMAND_QUEUE_CAPACITY>;
+static_assert(std::is_trivially_copyable<sch_timed_command_t>::value,
+              "sch_timed_command_t must be trivially copyable for lock-free queue");
+
+// Atomic view of a plain uint64_t living in the C-layout telemetry region
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) &&
+              alignof(std::atomic<uint64_t>) == alignof(uint64_t),
+              "std::atomic<uint64_t> must be layout-compatible with uint64_t");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Telemetry sequence counters must be lock-free");
+
+inline std::atomic<uint64_t>& atomicView(uint64_t& value) {
+    return *reinterpret_cast<std::atomic<uint64_t>*>(&value);
+}
+
+inline const std::atomic<uint64_t>& atomicView(const uint64_t& value) {
+    return *reinterpret_cast<const std::atomic<uint64_t>*>(&value);
+}
 
 // Internal engine state
 struct EngineState {
@@ -93,19 +131,47 @@ struct EngineState {
     juce::AudioSourcePlayer audioSourcePlayer;
     std::unique_ptr<juce::AudioSource> audioSource;
 
-    // Transport state (atomic for thread-safe reads)
+    // Transport state (written only by the publisher; atomic for thread-safe reads)
     std::atomic<double> tempo{120.0};
     std::atomic<double> position{0.0};
     std::atomic<bool> isPlaying{false};
     std::atomic<uint32_t> activeVoiceCount{0};
 
-    // Performance blend state (atomic for real-time updates)
+    // Performance blend state (written only by the publisher, see below)
     std::atomic<double> blendValue{0.5};
     sch_uuid_t performanceAId{};
     sch_uuid_t performanceBId{};
 
-    // Command queue (lock-free SPSC)
+    // Command queue (lock-free SPSC; producers serialise on producerBusy)
     std::unique_ptr<CommandQueue> commandQueue;
+    std::atomic_flag producerBusy = ATOMIC_FLAG_INIT;
+
+    // Publisher-owned commands popped from the queue (arrival order) and their
+    // offset-sorted order. Entries beyond the current block carry over.
+    std::array<sch_timed_command_t, SCH_COMMAND_QUEUE_CAPACITY> pendingCommands{};
+    std::array<uint16_t, SCH_COMMAND_QUEUE_CAPACITY> pendingOrder{};
+    std::array<uint16_t, SCH_COMMAND_QUEUE_CAPACITY> pendingOrderScratch{};
+    std::array<sch_timed_command_t, SCH_COMMAND_QUEUE_CAPACITY> carryScratch{};
+    size_t numPendingCommands{0};
+
+    // Telemetry region (seqlock snapshot + per-block ring, read by frontends)
+    std::unique_ptr<sch_telemetry_region_t> telemetry;
+
+    // Held by whoever drains the command queue and writes telemetry. The audio
+    // thread and state readers only ever try it; control threads that push
+    // commands spin on it while idle.
+    std::atomic_flag publisherBusy = ATOMIC_FLAG_INIT;
+    std::atomic<bool> audioRunning{false};
+    std::atomic<double> sampleRate{48000.0};
+
+    // Publisher-owned block counters
+    uint64_t blockIndex{0};
+    uint64_t samplePosition{0};
+
+    // Audio-thread owned: blocks rendered while a control thread held the
+    // publisher, folded into the counters by the next block that gets it
+    uint64_t skippedBlocks{0};
+    uint64_t skippedFrames{0};
 
     // Event callback
     sch_event_callback_t eventCallback{nullptr};
@@ -124,17 +190,376 @@ struct EngineState {
         // Clear UUIDs
         std::memset(performanceAId, 0, sizeof(sch_uuid_t));
         std::memset(performanceBId, 0, sizeof(sch_uuid_t));
+
+        // Telemetry region (zeroed; sequence 0 = initial stable snapshot)
+        telemetry = std::make_unique<sch_telemetry_region_t>();
+        std::memset(telemetry.get(), 0, sizeof(sch_telemetry_region_t));
+        telemetry->magic = SCH_TELEMETRY_MAGIC;
+        telemetry->layout_version = SCH_TELEMETRY_LAYOUT_VERSION;
+        telemetry->ring_capacity = SCH_TELEMETRY_RING_CAPACITY;
+        telemetry->max_channels = SCH_TELEMETRY_MAX_CHANNELS;
+        writeSnapshot(0.0f);
     }
 
     ~EngineState() {
+        deviceManager.removeAudioCallback(&audioSourcePlayer);
         audioSourcePlayer.setSource(nullptr);
         audioSource.reset();
         deviceManager.closeAudioDevice();
     }
 
+    //==========================================================================
+    // Publisher (audio thread, or a control thread while audio is idle)
+    //==========================================================================
+
+    void applyCommand(const sch_command_t& command) {
+        switch (command.type) {
+            case SCH_CMD_SET_PERFORMANCE_BLEND:
+                std::memcpy(performanceAId, command.data.set_performance_blend.perf_a_id,
+                            sizeof(sch_uuid_t));
+                std::memcpy(performanceBId, command.data.set_performance_blend.perf_b_id,
+                            sizeof(sch_uuid_t));
+                performanceAId[36] = '\0';
+                performanceBId[36] = '\0';
+                blendValue.store(command.data.set_performance_blend.blend_value,
+                                 std::memory_order_release);
+                break;
+
+            case SCH_CMD_SET_TEMPO:
+                if (command.data.set_tempo.tempo > 0.0)
+                    tempo.store(command.data.set_tempo.tempo, std::memory_order_release);
+                break;
+
+            case SCH_CMD_SET_POSITION:
+                if (command.data.set_position.position >= 0.0)
+                    position.store(command.data.set_position.position, std::memory_order_release);
+                break;
+
+            case SCH_CMD_TRANSPORT:
+                isPlaying.store(command.data.transport.state == SCH_TRANSPORT_PLAYING ||
+                                command.data.transport.state == SCH_TRANSPORT_RECORDING,
+                                std::memory_order_release);
+                if (command.data.transport.state == SCH_TRANSPORT_STOPPED)
+                    position.store(0.0, std::memory_order_release);
+                break;
+
+            case SCH_CMD_NOTE_ON:
+                activeVoiceCount.fetch_add(1, std::memory_order_relaxed);
+                break;
+
+            case SCH_CMD_NOTE_OFF: {
+                uint32_t count = activeVoiceCount.load(std::memory_order_relaxed);
+                while (count > 0 && !activeVoiceCount.compare_exchange_weak(
+                           count, count - 1, std::memory_order_relaxed)) {}
+                break;
+            }
+
+            case SCH_CMD_ALL_NOTES_OFF:
+            case SCH_CMD_PANIC:
+                activeVoiceCount.store(0, std::memory_order_release);
+                break;
+        }
+    }
+
+    // Control thread: push under the producer guard (the queue is SPSC)
+    bool pushCommands(const sch_timed_command_t* commands, size_t count) {
+        if (!commandQueue)
+            return false;
+
+        while (producerBusy.test_and_set(std::memory_order_acquire))
+            std::this_thread::yield();
+
+        const bool pushed = commandQueue->tryPushBatch(commands, count);
+        producerBusy.clear(std::memory_order_release);
+        return pushed;
+    }
+
+    // Control thread: transport, tempo and position edits go through the
+    // queue so the publisher stays their only writer while audio runs
+    bool pushCommand(const sch_command_t& command) {
+        sch_timed_command_t timed{};
+        timed.command = command;
+        if (!pushCommands(&timed, 1))
+            return false;
+
+        publishIfIdle();
+        return true;
+    }
+
+    bool pushTransport(sch_transport_state_t state) {
+        sch_command_t command{};
+        command.type = SCH_CMD_TRANSPORT;
+        command.data.transport.state = state;
+        return pushCommand(command);
+    }
+
+    // Pop everything queued into pendingCommands and sort pendingOrder by
+    // offset. Stable bottom-up merge sort over 16-bit indices into
+    // preallocated scratch: O(n log n), never allocates.
+    void collectCommands() {
+        if (!commandQueue)
+            return;
+
+        const size_t previous = numPendingCommands;
+        while (numPendingCommands < pendingCommands.size() &&
+               commandQueue->tryPop(pendingCommands[numPendingCommands])) {
+            pendingOrder[numPendingCommands] = static_cast<uint16_t>(numPendingCommands);
+            ++numPendingCommands;
+        }
+
+        if (numPendingCommands == previous)
+            return;
+
+        // Fast path: already in order (typical for well-formed batches)
+        bool sorted = true;
+        for (size_t i = 1; i < numPendingCommands && sorted; ++i)
+            sorted = offsetAt(i - 1) <= offsetAt(i);
+        if (sorted)
+            return;
+
+        uint16_t* source = pendingOrder.data();
+        uint16_t* dest = pendingOrderScratch.data();
+        const size_t n = numPendingCommands;
+
+        for (size_t width = 1; width < n; width *= 2) {
+            for (size_t lo = 0; lo < n; lo += 2 * width) {
+                const size_t mid = std::min(lo + width, n);
+                const size_t hi = std::min(lo + 2 * width, n);
+                size_t a = lo, b = mid, out = lo;
+
+                while (a < mid && b < hi) {
+                    dest[out++] = pendingCommands[source[b]].sample_offset <
+                                  pendingCommands[source[a]].sample_offset
+                        ? source[b++] : source[a++];
+                }
+                while (a < mid) dest[out++] = source[a++];
+                while (b < hi) dest[out++] = source[b++];
+            }
+            std::swap(source, dest);
+        }
+
+        if (source != pendingOrder.data())
+            std::copy(source, source + n, pendingOrder.data());
+    }
+
+    uint32_t offsetAt(size_t orderIndex) const {
+        return pendingCommands[pendingOrder[orderIndex]].sample_offset;
+    }
+
+    void advanceTransport(uint32_t numFrames, double rate) {
+        if (numFrames > 0 && rate > 0.0 && isPlaying.load(std::memory_order_relaxed)) {
+            position.store(position.load(std::memory_order_relaxed) + numFrames / rate,
+                           std::memory_order_release);
+        }
+    }
+
+    // Apply pending commands at their frame offsets within this block,
+    // advancing the transport between them
+    void applyCommandsInBlock(uint32_t numFrames, double rate) {
+        uint32_t cursor = 0;
+        size_t applied = 0;
+
+        while (applied < numPendingCommands && offsetAt(applied) < numFrames) {
+            const uint32_t offset = offsetAt(applied);
+            advanceTransport(offset - cursor, rate);
+            cursor = offset;
+            applyCommand(pendingCommands[pendingOrder[applied]].command);
+            ++applied;
+        }
+
+        advanceTransport(numFrames - cursor, rate);
+
+        if (applied == numPendingCommands) {
+            numPendingCommands = 0;
+            return;
+        }
+
+        // Carry the remainder into the next block, compacted in sorted order.
+        // Gather into scratch first: pendingOrder may point at slots that an
+        // in-place copy would already have overwritten
+        const size_t remaining = numPendingCommands - applied;
+        for (size_t i = 0; i < remaining; ++i) {
+            carryScratch[i] = pendingCommands[pendingOrder[applied + i]];
+            carryScratch[i].sample_offset -= numFrames;
+        }
+        for (size_t i = 0; i < remaining; ++i) {
+            pendingCommands[i] = carryScratch[i];
+            pendingOrder[i] = static_cast<uint16_t>(i);
+        }
+        numPendingCommands = remaining;
+    }
+
+    void applyAllPendingCommands() {
+        for (size_t i = 0; i < numPendingCommands; ++i)
+            applyCommand(pendingCommands[pendingOrder[i]].command);
+        numPendingCommands = 0;
+    }
+
+    void writeSnapshot(float cpuLoad) {
+        auto& snapshot = telemetry->snapshot;
+        auto& sequence = atomicView(snapshot.sequence);
+        const uint64_t seq = sequence.load(std::memory_order_relaxed);
+
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        snapshot.block_index = blockIndex;
+        snapshot.sample_position = samplePosition;
+        snapshot.blend_value = blendValue.load(std::memory_order_acquire);
+        snapshot.tempo = tempo.load(std::memory_order_acquire);
+        snapshot.position = position.load(std::memory_order_acquire);
+        snapshot.is_playing = isPlaying.load(std::memory_order_acquire) ? 1u : 0u;
+        snapshot.active_voice_count = activeVoiceCount.load(std::memory_order_acquire);
+        snapshot.cpu_load = cpuLoad;
+        std::memcpy(snapshot.performance_a_id, performanceAId, sizeof(sch_uuid_t));
+        std::memcpy(snapshot.performance_b_id, performanceBId, sizeof(sch_uuid_t));
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    void writeTelemetryBlock(float* const* channels, uint32_t numChannels,
+                             uint32_t numFrames, float cpuLoad) {
+        const uint64_t index = atomicView(telemetry->write_index).load(std::memory_order_relaxed);
+        auto& slot = telemetry->ring[index & (SCH_TELEMETRY_RING_CAPACITY - 1)];
+        auto& sequence = atomicView(slot.sequence);
+
+        sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto& block = slot.block;
+        block.block_index = index;
+        block.sample_position = samplePosition;
+        block.num_frames = numFrames;
+        block.channel_count = std::min(numChannels, SCH_TELEMETRY_MAX_CHANNELS);
+        block.active_voice_count = activeVoiceCount.load(std::memory_order_relaxed);
+        block.cpu_load = cpuLoad;
+
+        for (uint32_t ch = 0; ch < SCH_TELEMETRY_MAX_CHANNELS; ++ch) {
+            float peak = 0.0f;
+            double sumSquares = 0.0;
+
+            if (ch < block.channel_count && channels[ch] != nullptr) {
+                const float* data = channels[ch];
+                for (uint32_t i = 0; i < numFrames; ++i) {
+                    const float sample = data[i];
+                    peak = std::max(peak, std::abs(sample));
+                    sumSquares += static_cast<double>(sample) * sample;
+                }
+            }
+
+            block.peak[ch] = peak;
+            block.rms[ch] = numFrames > 0
+                ? static_cast<float>(std::sqrt(sumSquares / numFrames))
+                : 0.0f;
+        }
+
+        sequence.store(2 * index + 2, std::memory_order_release);
+        atomicView(telemetry->write_index).store(index + 1, std::memory_order_release);
+    }
+
+    // Audio thread: one call per block
+    void processBlock(float* const* channels, uint32_t numChannels, uint32_t numFrames) {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        // Engine has no DSP graph attached yet; render silence
+        for (uint32_t ch = 0; ch < numChannels; ++ch) {
+            if (channels[ch] != nullptr)
+                std::fill(channels[ch], channels[ch] + numFrames, 0.0f);
+        }
+
+        // Never wait on a control thread; remember the block so the clock,
+        // transport and carried-over commands still move on by its length
+        if (publisherBusy.test_and_set(std::memory_order_acquire)) {
+            ++skippedBlocks;
+            skippedFrames += numFrames;
+            return;
+        }
+
+        const double rate = sampleRate.load(std::memory_order_relaxed);
+        if (skippedFrames > 0) {
+            applyCommandsInBlock(static_cast<uint32_t>(skippedFrames), rate);
+            samplePosition += skippedFrames;
+            blockIndex += skippedBlocks;
+            skippedBlocks = 0;
+            skippedFrames = 0;
+        }
+
+        collectCommands();
+        applyCommandsInBlock(numFrames, rate);
+
+        const double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - startTime).count();
+        const double budget = rate > 0.0 ? numFrames / rate : 0.0;
+        const float cpuLoad = budget > 0.0 ? static_cast<float>(elapsed / budget) : 0.0f;
+
+        writeTelemetryBlock(channels, numChannels, numFrames, cpuLoad);
+        samplePosition += numFrames;
+        ++blockIndex;
+        writeSnapshot(cpuLoad);
+
+        publisherBusy.clear(std::memory_order_release);
+    }
+
+    // Control thread: apply queued commands and refresh the snapshot when no
+    // audio callback is running, so polling reflects edits made while stopped.
+    // Without waitForPublisher, gives up if another thread is publishing.
+    void publishIfIdle(bool waitForPublisher = true) {
+        if (audioRunning.load(std::memory_order_acquire))
+            return;
+
+        if (publisherBusy.test_and_set(std::memory_order_acquire)) {
+            if (!waitForPublisher)
+                return;
+            while (publisherBusy.test_and_set(std::memory_order_acquire))
+                std::this_thread::yield();
+        }
+
+        // No block to place them in: apply in offset order immediately
+        collectCommands();
+        applyAllPendingCommands();
+        writeSnapshot(telemetry->snapshot.cpu_load);
+
+        publisherBusy.clear(std::memory_order_release);
+    }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EngineState)
 };
 
+// Device-driven block source: forwards each callback to EngineState::processBlock
+class EngineAudioSource : public juce::AudioSource {
+public:
+    explicit EngineAudioSource(EngineState& owner) : engine(owner) {}
+
+    void prepareToPlay(int /*samplesPerBlockExpected*/, double sampleRate) override {
+        engine.sampleRate.store(sampleRate, std::memory_order_relaxed);
+        engine.audioRunning.store(true, std::memory_order_release);
+    }
+
+    void releaseResources() override {
+        engine.audioRunning.store(false, std::memory_order_release);
+    }
+
+    void getNextAudioBlock(const juce::AudioSourceChannelInfo& info) override {
+        if (info.buffer == nullptr || info.numSamples <= 0)
+            return;
+
+        std::array<float*, 32> channels{};
+        const auto numChannels = static_cast<uint32_t>(
+            std::min(info.buffer->getNumChannels(), static_cast<int>(channels.size())));
+
+        for (uint32_t ch = 0; ch < numChannels; ++ch)
+            channels[ch] = info.buffer->getWritePointer(static_cast<int>(ch), info.startSample);
+
+        engine.processBlock(channels.data(), numChannels,
+                            static_cast<uint32_t>(info.numSamples));
+    }
+
+private:
+    EngineState& engine;
+
+    JUCE_DECLARE_NON_COPYABLE(EngineAudioSource)
+};
+
 } // namespace ffi
 } // namespace schillinger
 
@@ -323,8 +748,10 @@ sch_result_t sch_engine_load_song(
         if (songObj->hasProperty("globals")) {
             auto* globals = songObj->getProperty("globals").getDynamicObject();
             if (globals && globals->hasProperty("tempo")) {
-                double tempo = globals->getProperty("tempo");
-                state->tempo.store(tempo, std::memory_order_release);
+                sch_command_t command{};
+                command.type = SCH_CMD_SET_TEMPO;
+                command.data.set_tempo.tempo = globals->getProperty("tempo");
+                state->pushCommand(command);
             }
         }
 
@@ -422,6 +849,7 @@ sch_result_t sch_engine_audio_init(
 
 #if defined(__IOS__) || defined(TARGET_OS_IPHONE)
         // iOS: Bypass AudioDeviceManager for now
+        state->sampleRate.store(config->sample_rate, std::memory_order_relaxed);
         DBG("Schillinger FFI: iOS audio init at " << config->sample_rate << " Hz");
         // TODO: Integrate with audio_only_bridge.mm for proper iOS audio
         return SCH_OK;
@@ -440,6 +868,15 @@ sch_result_t sch_engine_audio_init(
             return SCH_ERR_AUDIO_FAILED;
         }
 
+        state->sampleRate.store(config->sample_rate, std::memory_order_relaxed);
+
+        // Route device callbacks through the engine's block processor
+        if (!state->audioSource) {
+            state->audioSource = std::make_unique<schillinger::ffi::EngineAudioSource>(*state);
+            state->audioSourcePlayer.setSource(state->audioSource.get());
+            state->deviceManager.addAudioCallback(&state->audioSourcePlayer);
+        }
+
         DBG("Schillinger FFI: Audio initialized at " << config->sample_rate << " Hz");
         return SCH_OK;
 #endif
@@ -460,7 +897,9 @@ sch_result_t sch_engine_audio_start(sch_engine_handle engine) {
         }
 
         // Set playing state
-        state->isPlaying.store(true, std::memory_order_release);
+        if (!state->pushTransport(SCH_TRANSPORT_PLAYING)) {
+            return SCH_ERR_REJECTED;
+        }
 
         // TODO: Start audio processing
         // For now, just update transport state
@@ -485,9 +924,10 @@ sch_result_t sch_engine_audio_stop(sch_engine_handle engine) {
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // Set stopped state
-        state->isPlaying.store(false, std::memory_order_release);
-        state->position.store(0.0, std::memory_order_release);
+        // Set stopped state (rewinds to the start)
+        if (!state->pushTransport(SCH_TRANSPORT_STOPPED)) {
+            return SCH_ERR_REJECTED;
+        }
 
         // TODO: Stop audio processing
         invokeEventCallback(state, SCH_EVT_TRANSPORT_STOPPED,
@@ -556,28 +996,30 @@ sch_result_t sch_engine_set_transport(
             return SCH_ERR_ENGINE_NULL;
         }
 
+        if (state == SCH_TRANSPORT_RECORDING) {
+            // TODO: Implement recording
+            return SCH_ERR_NOT_IMPLEMENTED;
+        }
+
         // Update transport state
+        if (!engineState->pushTransport(state)) {
+            return SCH_ERR_REJECTED;
+        }
+
         switch (state) {
             case SCH_TRANSPORT_PLAYING:
-                engineState->isPlaying.store(true, std::memory_order_release);
                 invokeEventCallback(engineState, SCH_EVT_TRANSPORT_STARTED,
                                   "Transport started");
                 break;
 
             case SCH_TRANSPORT_STOPPED:
-                engineState->isPlaying.store(false, std::memory_order_release);
-                engineState->position.store(0.0, std::memory_order_release);
                 invokeEventCallback(engineState, SCH_EVT_TRANSPORT_STOPPED,
                                   "Transport stopped");
                 break;
 
             case SCH_TRANSPORT_PAUSED:
-                engineState->isPlaying.store(false, std::memory_order_release);
-                break;
-
             case SCH_TRANSPORT_RECORDING:
-                // TODO: Implement recording
-                return SCH_ERR_NOT_IMPLEMENTED;
+                break;
         }
 
         DBG("Schillinger FFI: Transport state set to " << state);
@@ -601,7 +1043,13 @@ sch_result_t sch_engine_set_tempo(
             return SCH_ERR_ENGINE_NULL;
         }
 
-        state->tempo.store(tempo, std::memory_order_release);
+        sch_command_t command{};
+        command.type = SCH_CMD_SET_TEMPO;
+        command.data.set_tempo.tempo = tempo;
+        if (!state->pushCommand(command)) {
+            return SCH_ERR_REJECTED;
+        }
+
         DBG("Schillinger FFI: Tempo set to " << tempo);
         return SCH_OK;
     } catch (const std::exception& e) {
@@ -623,7 +1071,13 @@ sch_result_t sch_engine_set_position(
             return SCH_ERR_ENGINE_NULL;
         }
 
-        state->position.store(position, std::memory_order_release);
+        sch_command_t command{};
+        command.type = SCH_CMD_SET_POSITION;
+        command.data.set_position.position = position;
+        if (!state->pushCommand(command)) {
+            return SCH_ERR_REJECTED;
+        }
+
         return SCH_OK;
     } catch (const std::exception& e) {
         return exceptionToResult(e);
@@ -744,10 +1198,21 @@ sch_result_t sch_engine_set_performance_blend(
             return SCH_ERR_INVALID_ARG;
         }
 
-        // Update performance state
-        copyUUID(state->performanceAId, performance_a_id);
-        copyUUID(state->performanceBId, performance_b_id);
-        state->blendValue.store(blend_value, std::memory_order_release);
+        // Queue for the audio thread so IDs and blend land in the same block
+        sch_command_t command{};
+        command.type = SCH_CMD_SET_PERFORMANCE_BLEND;
+        copyUUID(command.data.set_performance_blend.perf_a_id, performance_a_id);
+        copyUUID(command.data.set_performance_blend.perf_b_id, performance_b_id);
+        command.data.set_performance_blend.blend_value = blend_value;
+
+        sch_timed_command_t timed{};
+        timed.command = command;
+        if (!state->pushCommands(&timed, 1)) {
+            DBG("Schillinger FFI: Command queue full");
+            return SCH_ERR_REJECTED;
+        }
+
+        state->publishIfIdle();
 
         DBG("Schillinger FFI: Performance blend - "
             << performance_a_id << " (" << (1.0 - blend_value) * 100 << "%) ↔ "
@@ -773,13 +1238,48 @@ sch_result_t sch_engine_push_command(
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // Try to push to lock-free queue
-        if (!state->commandQueue->tryPush(*command)) {
+        // Try to push to lock-free queue (applied at the start of the next block)
+        sch_timed_command_t timed{};
+        timed.command = *command;
+        if (!state->pushCommands(&timed, 1)) {
             // Queue full
             DBG("Schillinger FFI: Command queue full");
             return SCH_ERR_REJECTED;
         }
 
+        state->publishIfIdle();
+        return SCH_OK;
+    } catch (const std::exception& e) {
+        return exceptionToResult(e);
+    }
+}
+
+sch_result_t sch_engine_push_commands(
+    sch_engine_handle engine,
+    const sch_timed_command_t* commands,
+    uint32_t count
+) {
+    if (!engine || (count > 0 && !commands)) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    try {
+        auto* state = getEngineState(engine);
+        if (!state || !state->commandQueue) {
+            return SCH_ERR_ENGINE_NULL;
+        }
+
+        if (count == 0) {
+            return SCH_OK;
+        }
+
+        // All-or-nothing commit
+        if (!state->pushCommands(commands, count)) {
+            DBG("Schillinger FFI: Command batch rejected (queue full)");
+            return SCH_ERR_REJECTED;
+        }
+
+        state->publishIfIdle();
         return SCH_OK;
     } catch (const std::exception& e) {
         return exceptionToResult(e);
@@ -800,19 +1300,23 @@ sch_result_t sch_engine_get_performance_state(
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // Copy performance IDs
-        std::memcpy(out_state->performance_a_id, state->performanceAId,
+        // Refresh from control-side atomics if no audio block will do it,
+        // unless another thread is already publishing
+        state->publishIfIdle(false);
+
+        // All fields come from one published block
+        sch_performance_snapshot_t snapshot;
+        sch_performance_snapshot_read(&state->telemetry->snapshot, &snapshot);
+
+        std::memcpy(out_state->performance_a_id, snapshot.performance_a_id,
                    sizeof(sch_uuid_t));
-        std::memcpy(out_state->performance_b_id, state->performanceBId,
+        std::memcpy(out_state->performance_b_id, snapshot.performance_b_id,
                    sizeof(sch_uuid_t));
-
-        // Read atomic values
-        out_state->blend_value = state->blendValue.load(std::memory_order_acquire);
-        out_state->tempo = state->tempo.load(std::memory_order_acquire);
-        out_state->position = state->position.load(std::memory_order_acquire);
-        out_state->is_playing = state->isPlaying.load(std::memory_order_acquire);
-        out_state->active_voice_count = state->activeVoiceCount.load(
-            std::memory_order_acquire);
+        out_state->blend_value = snapshot.blend_value;
+        out_state->tempo = snapshot.tempo;
+        out_state->position = snapshot.position;
+        out_state->is_playing = snapshot.is_playing != 0;
+        out_state->active_voice_count = snapshot.active_voice_count;
 
         return SCH_OK;
     } catch (const std::exception& e) {
@@ -820,6 +1324,110 @@ sch_result_t sch_engine_get_performance_state(
     }
 }
 
+sch_result_t sch_engine_process_block(
+    sch_engine_handle engine,
+    float* const* channels,
+    uint32_t num_channels,
+    uint32_t num_frames
+) {
+    if (!engine || (num_channels > 0 && !channels)) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    auto* state = getEngineState(engine);
+    if (!state->audioRunning.load(std::memory_order_relaxed)) {
+        state->audioRunning.store(true, std::memory_order_release);
+    }
+
+    state->processBlock(channels, num_channels, num_frames);
+    return SCH_OK;
+}
+
+sch_result_t sch_engine_get_telemetry_region(
+    sch_engine_handle engine,
+    const sch_telemetry_region_t** out_region
+) {
+    if (!engine || !out_region) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    auto* state = getEngineState(engine);
+    *out_region = state->telemetry.get();
+    return SCH_OK;
+}
+
+sch_result_t sch_performance_snapshot_read(
+    const sch_performance_snapshot_t* snapshot,
+    sch_performance_snapshot_t* out_snapshot
+) {
+    if (!snapshot || !out_snapshot) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    using schillinger::ffi::atomicView;
+    const auto& sequence = atomicView(snapshot->sequence);
+
+    for (;;) {
+        const uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1u) {
+            continue;  // Writer mid-update
+        }
+
+        std::memcpy(out_snapshot, snapshot, sizeof(sch_performance_snapshot_t));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (sequence.load(std::memory_order_relaxed) == before) {
+            out_snapshot->sequence = before;
+            return SCH_OK;
+        }
+    }
+}
+
+sch_result_t sch_telemetry_ring_read(
+    const sch_telemetry_region_t* region,
+    uint64_t* cursor,
+    sch_telemetry_block_t* out_blocks,
+    uint32_t max_blocks,
+    uint32_t* out_count
+) {
+    if (!region || !cursor || !out_count || (max_blocks > 0 && !out_blocks)) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    using schillinger::ffi::atomicView;
+    const uint64_t written = atomicView(region->write_index).load(std::memory_order_acquire);
+    uint64_t next = *cursor;
+
+    // Reader fell behind: skip to the oldest record still in the ring
+    if (written - std::min(next, written) > SCH_TELEMETRY_RING_CAPACITY) {
+        next = written - SCH_TELEMETRY_RING_CAPACITY;
+    }
+
+    uint32_t count = 0;
+    while (next < written && count < max_blocks) {
+        const auto& slot = region->ring[next & (SCH_TELEMETRY_RING_CAPACITY - 1)];
+        const auto& sequence = atomicView(slot.sequence);
+        const uint64_t expected = 2 * next + 2;
+
+        if (sequence.load(std::memory_order_acquire) != expected) {
+            ++next;  // Overwritten by a newer block
+            continue;
+        }
+
+        std::memcpy(&out_blocks[count], &slot.block, sizeof(sch_telemetry_block_t));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (sequence.load(std::memory_order_relaxed) == expected) {
+            ++count;
+        }
+        ++next;
+    }
+
+    *cursor = next;
+    *out_count = count;
+    return SCH_OK;
+}
+
 // ============================================================================
 // C API Implementation - Callbacks
 // ============================================================================
@@ -12,7 +12,8 @@
 //
 //  Thread Safety:
 //  - All functions are thread-safe (use internal locking)
-//  - Audio thread updates atomic state (poll with sch_engine_get_performance_state)
+//  - Audio thread publishes a seqlock snapshot once per block (poll with
+//    sch_engine_get_performance_state, or read the telemetry region directly)
 //  - Commands queued via sch_engine_push_command (lock-free SPSC queue)
 //
 
@@ -96,6 +97,72 @@ typedef struct {
     uint32_t active_voice_count;
 } sch_performance_state_t;
 
+// ============================================================================
+// TELEMETRY (shared memory, written by the audio thread once per block)
+// ============================================================================
+
+#define SCH_TELEMETRY_MAGIC 0x54484353u          // 'SCHT'
+#define SCH_TELEMETRY_LAYOUT_VERSION 1u
+#define SCH_TELEMETRY_MAX_CHANNELS 8u
+#define SCH_TELEMETRY_RING_CAPACITY 256u         // Power of two
+
+// Versioned performance snapshot (seqlock)
+//
+// The audio thread is the only writer. `sequence` is odd while a write is in
+// progress and advances by two per published block. Readers copy the struct,
+// then re-read `sequence`; if it changed (or was odd) the copy is retried.
+typedef struct {
+    uint64_t sequence;
+    uint64_t block_index;
+    uint64_t sample_position;
+    double blend_value;
+    double tempo;
+    double position;
+    uint32_t is_playing;
+    uint32_t active_voice_count;
+    float cpu_load;
+    uint32_t reserved;
+    sch_uuid_t performance_a_id;
+    sch_uuid_t performance_b_id;
+} sch_performance_snapshot_t;
+
+// Per-block telemetry record
+typedef struct {
+    uint64_t block_index;
+    uint64_t sample_position;
+    uint32_t num_frames;
+    uint32_t channel_count;
+    uint32_t active_voice_count;
+    float cpu_load;                              // Fraction of block budget (0.0-1.0+)
+    float peak[SCH_TELEMETRY_MAX_CHANNELS];
+    float rms[SCH_TELEMETRY_MAX_CHANNELS];
+} sch_telemetry_block_t;
+
+// Ring slot: `sequence` is 2 * block_index + 2 once the slot is stable
+typedef struct {
+    uint64_t sequence;
+    sch_telemetry_block_t block;
+} sch_telemetry_slot_t;
+
+// Telemetry region (single producer, any number of readers)
+//
+// Owned by the engine and valid until sch_engine_destroy. Frontends obtain the
+// pointer once with sch_engine_get_telemetry_region and then read it directly
+// at frame rate; no FFI call is required per frame.
+//
+// Ring protocol: `write_index` counts published blocks. Block n lives in
+// ring[n % SCH_TELEMETRY_RING_CAPACITY] and is valid when that slot's
+// `sequence` equals 2 * n + 2 both before and after copying it.
+typedef struct {
+    uint32_t magic;
+    uint32_t layout_version;
+    uint32_t ring_capacity;
+    uint32_t max_channels;
+    sch_performance_snapshot_t snapshot;
+    uint64_t write_index;
+    sch_telemetry_slot_t ring[SCH_TELEMETRY_RING_CAPACITY];
+} sch_telemetry_region_t;
+
 // Command types for lock-free queue
 typedef enum {
     SCH_CMD_SET_PERFORMANCE_BLEND = 0,
@@ -139,6 +206,16 @@ typedef struct {
     } data;
 } sch_command_t;
 
+// Maximum number of commands in flight (single + batched pushes combined)
+#define SCH_COMMAND_QUEUE_CAPACITY 4096u
+
+// Command stamped with a frame offset into the next processed block.
+// Offsets past the end of that block carry over into following blocks.
+typedef struct {
+    uint32_t sample_offset;
+    sch_command_t command;
+} sch_timed_command_t;
+
 // Event types (callbacks from audio thread)
 typedef enum {
     SCH_EVT_ERROR = 0,
@@ -270,6 +347,9 @@ sch_result_t sch_engine_get_audio_status(
 /**
  * Set transport state
  *
+ * Queued like sch_engine_push_command: applied at the start of the next
+ * block, or immediately while no audio callback is running.
+ *
  * @param engine Engine handle
  * @param state New transport state
  * @return SCH_OK on success
@@ -282,6 +362,8 @@ sch_result_t sch_engine_set_transport(
 /**
  * Set tempo
  *
+ * Queued; takes effect like sch_engine_set_transport.
+ *
  * @param engine Engine handle
  * @param tempo Tempo in BPM
  * @return SCH_OK on success
@@ -294,6 +376,8 @@ sch_result_t sch_engine_set_tempo(
 /**
  * Set playback position
  *
+ * Queued; takes effect like sch_engine_set_transport.
+ *
  * @param engine Engine handle
  * @param position Position in seconds
  * @return SCH_OK on success
@@ -385,9 +469,32 @@ sch_result_t sch_engine_push_command(
 );
 
 /**
- * Get current performance state (atomic read)
+ * Push a batch of timestamped commands
+ *
+ * The batch is committed atomically: either every command becomes visible to
+ * the audio thread in the same block, or none does. The audio thread applies
+ * commands in sample_offset order (stable for equal offsets).
  *
- * Thread-safe: Can be called from any thread without blocking
+ * Thread-safe: Can be called from any thread
+ *
+ * @param engine Engine handle
+ * @param commands Array of commands (borrowed)
+ * @param count Number of commands
+ * @return SCH_OK on success, SCH_ERR_REJECTED if the batch does not fit
+ */
+sch_result_t sch_engine_push_commands(
+    sch_engine_handle engine,
+    const sch_timed_command_t* commands,
+    uint32_t count
+);
+
+/**
+ * Get current performance state (seqlock snapshot read)
+ *
+ * Thread-safe: Can be called from any thread without blocking. While the
+ * engine is stopped, queued commands are applied first unless another
+ * thread is publishing at that moment, in which case the last published
+ * snapshot is returned. All fields come from the same audio block.
  *
  * @param engine Engine handle
  * @param out_state Pointer to receive state
@@ -398,6 +505,78 @@ sch_result_t sch_engine_get_performance_state(
     sch_performance_state_t* out_state
 );
 
+/**
+ * Process one audio block
+ *
+ * Called by the engine's own device callback, or by hosts that drive the
+ * engine themselves. Drains queued commands, renders into the caller's planar
+ * buffers, and publishes the performance snapshot and a telemetry record.
+ *
+ * Real-time safe: no locks, no allocation.
+ *
+ * @param engine Engine handle
+ * @param channels Planar output buffers (num_channels pointers, may be NULL if num_channels is 0)
+ * @param num_channels Number of channels
+ * @param num_frames Number of frames per channel
+ * @return SCH_OK on success
+ */
+sch_result_t sch_engine_process_block(
+    sch_engine_handle engine,
+    float* const* channels,
+    uint32_t num_channels,
+    uint32_t num_frames
+);
+
+/**
+ * Get the shared telemetry region
+ *
+ * The returned pointer stays valid until the engine is destroyed.
+ *
+ * @param engine Engine handle
+ * @param out_region Pointer to receive the region
+ * @return SCH_OK on success
+ */
+sch_result_t sch_engine_get_telemetry_region(
+    sch_engine_handle engine,
+    const sch_telemetry_region_t** out_region
+);
+
+/**
+ * Read a consistent copy of a performance snapshot
+ *
+ * Reference implementation of the seqlock read protocol. Never blocks the
+ * writer; retries only if a block was published during the copy.
+ *
+ * @param snapshot Snapshot inside a telemetry region
+ * @param out_snapshot Pointer to receive the copy
+ * @return SCH_OK on success
+ */
+sch_result_t sch_performance_snapshot_read(
+    const sch_performance_snapshot_t* snapshot,
+    sch_performance_snapshot_t* out_snapshot
+);
+
+/**
+ * Read telemetry records published since `cursor`
+ *
+ * If the reader fell more than SCH_TELEMETRY_RING_CAPACITY blocks behind,
+ * the cursor skips forward to the oldest record still in the ring.
+ *
+ * @param region Telemetry region
+ * @param cursor In: next block index to read. Out: advanced past records read
+ * @param out_blocks Destination array
+ * @param max_blocks Capacity of out_blocks
+ * @param out_count Pointer to receive number of records copied
+ * @return SCH_OK on success
+ */
+sch_result_t sch_telemetry_ring_read(
+    const sch_telemetry_region_t* region,
+    uint64_t* cursor,
+    sch_telemetry_block_t* out_blocks,
+    uint32_t max_blocks,
+    uint32_t* out_count
+);
+
 // ============================================================================
 // CALLBACKS
 // ============================================================================
@@ -23,8 +23,12 @@
 
 // InstrumentManager includes
 #include "../../engine/instruments/InstrumentManager.h"
+#include "../../engine/instruments/InstrumentInstance.h"
 
 // Standard library
+#include <array>
+#include <atomic>
+#include <cmath>
 #include <cstring>
 #include <cstdlib>
 #include <stdexcept>
@@ -32,6 +36,55 @@
 #include <vector>
 #include <mutex>
 
+static_assert(sizeof(sch_midi_event_t) == 8, "sch_midi_event_t is packed into 8 bytes");
+
+// ============================================================================
+// Instrument Handle
+// ============================================================================
+
+// Opaque handle behind sch_instrument_handle: the instance plus the state the
+// real-time entry points need, all sized outside the audio thread
+struct sch_instrument_t {
+    using InstrumentInstance = SchillingerEcosystem::Instrument::InstrumentInstance;
+
+    static constexpr int maxParameterHandles = 1024;
+    static constexpr int liveMidiCapacity = 512;
+    static constexpr int captureBlocks = 4;
+
+    // Resolved parameter: instruments with indexed parameters take the ramp
+    // queue; others fall back to their address setters
+    struct ParameterSlot {
+        int parameterIndex = -1;
+        juce::String address;
+    };
+
+    explicit sch_instrument_t(std::unique_ptr<InstrumentInstance> instance_)
+        : instance(std::move(instance_)) {}
+
+    std::unique_ptr<InstrumentInstance> instance;
+
+    // Parameter handles (slots are filled before numParameterHandles publishes them)
+    std::array<ParameterSlot, maxParameterHandles> parameterSlots;
+    std::atomic<int> numParameterHandles{0};
+    std::mutex resolveMutex;
+
+    // Live MIDI from note_on/off etc. (lock-free SPSC; producers serialise on liveMidiProducerBusy)
+    juce::AbstractFifo liveMidiFifo{liveMidiCapacity};
+    std::array<sch_midi_event_t, liveMidiCapacity> liveMidi{};
+    std::atomic_flag liveMidiProducerBusy = ATOMIC_FLAG_INIT;
+
+    // Audio-thread state (sized by sch_instrument_prepare)
+    std::atomic<bool> prepared{false};
+    int maxBlockSize = 0;
+    juce::AudioBuffer<float> hostBuffer;
+    juce::MidiBuffer blockMidi;
+    std::atomic<uint32_t> droppedMidiEvents{0};
+
+    // Rendered frames for sch_instrument_get_audio (interleaved stereo)
+    juce::AbstractFifo captureFifo{1};
+    std::vector<float> captureData;
+};
+
 // ============================================================================
 // Internal Types and Helpers
 // ============================================================================
@@ -116,7 +169,124 @@ static SchillingerEcosystem::Instrument::InstrumentInstance* getInstrumentInstan
     if (!instrument) {
         return nullptr;
     }
-    return reinterpret_cast<SchillingerEcosystem::Instrument::InstrumentInstance*>(instrument);
+    return instrument->instance.get();
+}
+
+// Resolved parameter slot, or nullptr for an unknown handle (O(1))
+static const sch_instrument_t::ParameterSlot* getParameterSlot(
+    sch_instrument_handle instrument,
+    sch_parameter_handle_t parameter
+) {
+    if (parameter < 0 || parameter >= instrument->numParameterHandles.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    return &instrument->parameterSlots[static_cast<size_t>(parameter)];
+}
+
+static uint8_t toMidiDataByte(float normalized) {
+    return static_cast<uint8_t>(juce::jlimit(0, 127, juce::roundToInt(normalized * 127.0f)));
+}
+
+static sch_midi_event_t makeMidiEvent(uint8_t status, uint8_t data1, uint8_t data2) {
+    sch_midi_event_t event{};
+    event.size = 3;
+    event.data[0] = status;
+    event.data[1] = data1;
+    event.data[2] = data2;
+    return event;
+}
+
+// Queue live events for the next block; all or nothing
+static sch_result_t pushLiveMidi(
+    sch_instrument_handle instrument,
+    const sch_midi_event_t* events,
+    int numEvents
+) {
+    while (instrument->liveMidiProducerBusy.test_and_set(std::memory_order_acquire)) {
+        // Control threads only; the audio thread never takes this
+    }
+
+    int start1, size1, start2, size2;
+    instrument->liveMidiFifo.prepareToWrite(numEvents, start1, size1, start2, size2);
+
+    const bool fits = size1 + size2 == numEvents;
+    if (fits) {
+        std::copy(events, events + size1, instrument->liveMidi.begin() + start1);
+        std::copy(events + size1, events + numEvents, instrument->liveMidi.begin() + start2);
+        instrument->liveMidiFifo.finishedWrite(numEvents);
+    }
+
+    instrument->liveMidiProducerBusy.clear(std::memory_order_release);
+    return fits ? SCH_OK : SCH_ERR_REJECTED;
+}
+
+// Fill the block's MidiBuffer: queued live events at frame 0, then the
+// caller's events at their offsets. blockMidi was sized by prepare, so this
+// never allocates; events past SCH_INSTRUMENT_MAX_MIDI_EVENTS are dropped.
+static void buildBlockMidi(
+    sch_instrument_handle instrument,
+    int numSamples,
+    const sch_midi_event_t* events,
+    int numEvents
+) {
+    auto& midi = instrument->blockMidi;
+    midi.clear();
+
+    int budget = SCH_INSTRUMENT_MAX_MIDI_EVENTS;
+    const int lastFrame = juce::jmax(0, numSamples - 1);
+
+    auto addEvent = [&](const sch_midi_event_t& event, int frame) {
+        if (event.size < 1 || event.size > 3 || budget == 0) {
+            instrument->droppedMidiEvents.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        midi.addEvent(event.data, event.size, frame);
+        --budget;
+    };
+
+    int start1, size1, start2, size2;
+    instrument->liveMidiFifo.prepareToRead(instrument->liveMidiFifo.getNumReady(), start1, size1, start2, size2);
+    for (int i = 0; i < size1; ++i) {
+        addEvent(instrument->liveMidi[static_cast<size_t>(start1 + i)], 0);
+    }
+    for (int i = 0; i < size2; ++i) {
+        addEvent(instrument->liveMidi[static_cast<size_t>(start2 + i)], 0);
+    }
+    instrument->liveMidiFifo.finishedRead(size1 + size2);
+
+    for (int i = 0; i < numEvents; ++i) {
+        addEvent(events[i], static_cast<int>(juce::jmin(events[i].sample_offset, static_cast<uint32_t>(lastFrame))));
+    }
+}
+
+// Copy rendered frames into the get_audio ring while it has room
+static void captureOutput(
+    sch_instrument_handle instrument,
+    float* const* channels,
+    int numChannels,
+    int numSamples
+) {
+    int start1, size1, start2, size2;
+    instrument->captureFifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+    if (size1 + size2 == 0) {
+        return;
+    }
+
+    const float* left = numChannels > 0 ? channels[0] : nullptr;
+    const float* right = numChannels > 1 ? channels[1] : left;
+    float* data = instrument->captureData.data();
+
+    auto copyFrames = [&](int destFrame, int srcFrame, int count) {
+        float* dest = data + 2 * destFrame;
+        for (int i = 0; i < count; ++i) {
+            dest[2 * i] = left ? left[srcFrame + i] : 0.0f;
+            dest[2 * i + 1] = right ? right[srcFrame + i] : 0.0f;
+        }
+    };
+
+    copyFrames(start1, 0, size1);
+    copyFrames(start2, size1, size2);
+    instrument->captureFifo.finishedWrite(size1 + size2);
 }
 
 } // namespace ffi
@@ -360,7 +530,7 @@ sch_result_t sch_instrument_load(
         }
 
         // Transfer ownership to caller
-        *out_instrument = reinterpret_cast<sch_instrument_handle>(instance.release());
+        *out_instrument = new sch_instrument_t(std::move(instance));
         return SCH_OK;
 
     } catch (const std::exception& e) {
@@ -379,8 +549,7 @@ sch_result_t sch_instrument_destroy(
     }
 
     try {
-        InstrumentInstance* instance = getInstrumentInstance(instrument);
-        delete instance;
+        delete instrument;
         return SCH_OK;
 
     } catch (const std::exception& e) {
@@ -395,6 +564,7 @@ sch_result_t sch_instrument_is_available(
     bool* out_available
 ) {
     using namespace SchillingerEcosystem::Instrument;
+    using namespace schillinger::ffi;
 
     if (!identifier || !out_available) {
         return SCH_ERR_INVALID_ARG;
@@ -428,8 +598,7 @@ sch_result_t sch_instrument_get_parameter_count(
     }
 
     try {
-        // TODO: Implement parameter count
-        *out_count = 0;
+        *out_count = static_cast<int>(instrument->instance->getAllParameters().size());
         return SCH_OK;
 
     } catch (const std::exception& e) {
@@ -448,8 +617,20 @@ sch_result_t sch_instrument_get_parameter_info(
     }
 
     try {
-        // TODO: Implement parameter info
-        return SCH_ERR_NOT_IMPLEMENTED;
+        const auto parameters = instrument->instance->getAllParameters();
+        if (index < 0 || index >= static_cast<int>(parameters.size())) {
+            return SCH_ERR_INVALID_ARG;
+        }
+
+        const auto& info = parameters[static_cast<size_t>(index)];
+        out_info->address = schillinger::ffi::juceStringToAllocatedCString(info.address);
+        out_info->name = schillinger::ffi::juceStringToAllocatedCString(info.name);
+        out_info->min_value = info.minValue;
+        out_info->max_value = info.maxValue;
+        out_info->default_value = info.defaultValue;
+        out_info->is_automatable = info.isAutomatable;
+        out_info->unit = schillinger::ffi::juceStringToAllocatedCString(info.unit);
+        return SCH_OK;
 
     } catch (const std::exception& e) {
         DBG("FFI Exception in sch_instrument_get_parameter_info: " << e.what());
@@ -467,8 +648,13 @@ sch_result_t sch_instrument_get_parameter_value(
     }
 
     try {
-        // TODO: Implement parameter get
-        return SCH_ERR_NOT_IMPLEMENTED;
+        auto* instance = instrument->instance.get();
+        if (!instance->getParameterInfo(address)) {
+            return SCH_ERR_NOT_FOUND;
+        }
+
+        *out_value = instance->getParameterValue(address);
+        return SCH_OK;
 
     } catch (const std::exception& e) {
         DBG("FFI Exception in sch_instrument_get_parameter_value: " << e.what());
@@ -486,8 +672,12 @@ sch_result_t sch_instrument_set_parameter_value(
     }
 
     try {
-        // TODO: Implement parameter set
-        DBG("TODO: Set parameter " << address << " = " << value);
+        auto* instance = instrument->instance.get();
+        if (!instance->getParameterInfo(address)) {
+            return SCH_ERR_NOT_FOUND;
+        }
+
+        instance->setParameterValue(address, value);
         return SCH_OK;
 
     } catch (const std::exception& e) {
@@ -507,8 +697,12 @@ sch_result_t sch_instrument_set_parameter_smooth(
     }
 
     try {
-        // TODO: Implement smooth parameter transition
-        DBG("TODO: Set parameter " << address << " = " << value << " over " << time_ms << "ms");
+        auto* instance = instrument->instance.get();
+        if (!instance->getParameterInfo(address)) {
+            return SCH_ERR_NOT_FOUND;
+        }
+
+        instance->setParameterSmooth(address, value, time_ms);
         return SCH_OK;
 
     } catch (const std::exception& e) {
@@ -517,6 +711,114 @@ sch_result_t sch_instrument_set_parameter_smooth(
     }
 }
 
+sch_result_t sch_instrument_resolve_parameter(
+    sch_instrument_handle instrument,
+    const char* address,
+    sch_parameter_handle_t* out_handle
+) {
+    if (!instrument || !address || !out_handle) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    try {
+        auto* instance = instrument->instance.get();
+        const auto parameterAddress = juce::String(juce::CharPointer_UTF8(address));
+
+        const int parameterIndex = instance->resolveParameterIndex(parameterAddress);
+        if (parameterIndex < 0 && !instance->getParameterInfo(parameterAddress)) {
+            return SCH_ERR_NOT_FOUND;
+        }
+
+        std::lock_guard<std::mutex> lock(instrument->resolveMutex);
+        const int numHandles = instrument->numParameterHandles.load(std::memory_order_relaxed);
+
+        for (int i = 0; i < numHandles; ++i) {
+            if (instrument->parameterSlots[static_cast<size_t>(i)].address == parameterAddress) {
+                *out_handle = i;
+                return SCH_OK;
+            }
+        }
+
+        if (numHandles >= sch_instrument_t::maxParameterHandles) {
+            return SCH_ERR_OUT_OF_MEMORY;
+        }
+
+        // Fill the slot before publishing it to the audio thread
+        auto& slot = instrument->parameterSlots[static_cast<size_t>(numHandles)];
+        slot.parameterIndex = parameterIndex;
+        slot.address = parameterAddress;
+        instrument->numParameterHandles.store(numHandles + 1, std::memory_order_release);
+
+        *out_handle = numHandles;
+        return SCH_OK;
+
+    } catch (const std::exception& e) {
+        DBG("FFI Exception in sch_instrument_resolve_parameter: " << e.what());
+        return SCH_ERR_INTERNAL;
+    }
+}
+
+sch_result_t sch_instrument_get_parameter_by_handle(
+    sch_instrument_handle instrument,
+    sch_parameter_handle_t parameter,
+    float* out_value
+) {
+    using namespace schillinger::ffi;
+
+    if (!instrument || !out_value) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    const auto* slot = getParameterSlot(instrument, parameter);
+    if (!slot) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    auto* instance = instrument->instance.get();
+    *out_value = slot->parameterIndex >= 0 ? instance->getParameterValueByIndex(slot->parameterIndex)
+                                           : instance->getParameterValue(slot->address);
+    return SCH_OK;
+}
+
+sch_result_t sch_instrument_set_parameter_by_handle(
+    sch_instrument_handle instrument,
+    sch_parameter_handle_t parameter,
+    float value
+) {
+    // A zero-length ramp keeps the jump ordered with ramps already queued
+    return sch_instrument_set_parameter_smooth_by_handle(instrument, parameter, value, 0.0);
+}
+
+sch_result_t sch_instrument_set_parameter_smooth_by_handle(
+    sch_instrument_handle instrument,
+    sch_parameter_handle_t parameter,
+    float value,
+    double time_ms
+) {
+    using namespace schillinger::ffi;
+
+    if (!instrument) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    const auto* slot = getParameterSlot(instrument, parameter);
+    if (!slot) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    auto* instance = instrument->instance.get();
+
+    if (slot->parameterIndex < 0) {
+        // Instrument without indexed parameters: its own address setter
+        instance->setParameterSmooth(slot->address, value, time_ms);
+    } else if (!instance->postParameterRamp(slot->parameterIndex, value, juce::jmax(0.0, time_ms))) {
+        // Ramp queue full: jump straight to the target
+        instance->setParameterValueByIndex(slot->parameterIndex, value);
+    }
+
+    return SCH_OK;
+}
+
 // ============================================================================
 // MIDI CONTROL
 // ============================================================================
@@ -527,21 +829,25 @@ sch_result_t sch_instrument_note_on(
     float velocity,
     int channel
 ) {
-    using namespace SchillingerEcosystem::Instrument;
+    using namespace schillinger::ffi;
 
     if (!instrument) {
         return SCH_ERR_INVALID_ARG;
     }
 
     try {
-        InstrumentInstance* instance = getInstrumentInstance(instrument);
-        if (!instance) {
+        if (!getInstrumentInstance(instrument)) {
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // TODO: Implement note-on via InstrumentInstance
-        DBG("TODO: Note on: channel=" << channel << " note=" << midi_note << " velocity=" << velocity);
-        return SCH_OK;
+        if (midi_note < 0 || midi_note > 127 || channel < 0 || channel > 15) {
+            return SCH_ERR_INVALID_ARG;
+        }
+
+        // Velocity 0 would read as note-off, so any positive velocity sends at least 1
+        const uint8_t midiVelocity = velocity > 0.0f ? juce::jmax<uint8_t>(1, toMidiDataByte(velocity)) : 0;
+        const auto event = makeMidiEvent(static_cast<uint8_t>(0x90 | channel), static_cast<uint8_t>(midi_note), midiVelocity);
+        return pushLiveMidi(instrument, &event, 1);
 
     } catch (const std::exception& e) {
         DBG("FFI Exception in sch_instrument_note_on: " << e.what());
@@ -555,21 +861,24 @@ sch_result_t sch_instrument_note_off(
     float velocity,
     int channel
 ) {
-    using namespace SchillingerEcosystem::Instrument;
+    using namespace schillinger::ffi;
 
     if (!instrument) {
         return SCH_ERR_INVALID_ARG;
     }
 
     try {
-        InstrumentInstance* instance = getInstrumentInstance(instrument);
-        if (!instance) {
+        if (!getInstrumentInstance(instrument)) {
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // TODO: Implement note-off via InstrumentInstance
-        DBG("TODO: Note off: channel=" << channel << " note=" << midi_note);
-        return SCH_OK;
+        if (midi_note < 0 || midi_note > 127 || channel < 0 || channel > 15) {
+            return SCH_ERR_INVALID_ARG;
+        }
+
+        const auto event = makeMidiEvent(static_cast<uint8_t>(0x80 | channel), static_cast<uint8_t>(midi_note),
+                                         toMidiDataByte(velocity));
+        return pushLiveMidi(instrument, &event, 1);
 
     } catch (const std::exception& e) {
         DBG("FFI Exception in sch_instrument_note_off: " << e.what());
@@ -581,21 +890,30 @@ sch_result_t sch_instrument_all_notes_off(
     sch_instrument_handle instrument,
     int channel
 ) {
-    using namespace SchillingerEcosystem::Instrument;
+    using namespace schillinger::ffi;
 
     if (!instrument) {
         return SCH_ERR_INVALID_ARG;
     }
 
     try {
-        InstrumentInstance* instance = getInstrumentInstance(instrument);
-        if (!instance) {
+        if (!getInstrumentInstance(instrument)) {
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // TODO: Implement all-notes-off via InstrumentInstance
-        DBG("TODO: All notes off: channel=" << channel);
-        return SCH_OK;
+        if (channel < -1 || channel > 15) {
+            return SCH_ERR_INVALID_ARG;
+        }
+
+        // CC 123 (All Notes Off) on one channel, or on all 16
+        std::array<sch_midi_event_t, 16> events{};
+        int numEvents = 0;
+        for (int ch = 0; ch < 16; ++ch) {
+            if (channel < 0 || ch == channel) {
+                events[static_cast<size_t>(numEvents++)] = makeMidiEvent(static_cast<uint8_t>(0xB0 | ch), 123, 0);
+            }
+        }
+        return pushLiveMidi(instrument, events.data(), numEvents);
 
     } catch (const std::exception& e) {
         DBG("FFI Exception in sch_instrument_all_notes_off: " << e.what());
@@ -608,21 +926,26 @@ sch_result_t sch_instrument_pitch_bend(
     float value,
     int channel
 ) {
-    using namespace SchillingerEcosystem::Instrument;
+    using namespace schillinger::ffi;
 
     if (!instrument) {
         return SCH_ERR_INVALID_ARG;
     }
 
     try {
-        InstrumentInstance* instance = getInstrumentInstance(instrument);
-        if (!instance) {
+        if (!getInstrumentInstance(instrument)) {
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // TODO: Implement pitch bend via InstrumentInstance
-        DBG("TODO: Pitch bend: channel=" << channel << " value=" << value);
-        return SCH_OK;
+        if (channel < 0 || channel > 15) {
+            return SCH_ERR_INVALID_ARG;
+        }
+
+        // -1..+1 onto the 14-bit range, centre 8192
+        const int bend = juce::jlimit(0, 16383, juce::roundToInt((juce::jlimit(-1.0f, 1.0f, value) + 1.0f) * 8192.0f));
+        const auto event = makeMidiEvent(static_cast<uint8_t>(0xE0 | channel), static_cast<uint8_t>(bend & 0x7f),
+                                         static_cast<uint8_t>(bend >> 7));
+        return pushLiveMidi(instrument, &event, 1);
 
     } catch (const std::exception& e) {
         DBG("FFI Exception in sch_instrument_pitch_bend: " << e.what());
@@ -636,21 +959,24 @@ sch_result_t sch_instrument_control_change(
     float value,
     int channel
 ) {
-    using namespace SchillingerEcosystem::Instrument;
+    using namespace schillinger::ffi;
 
     if (!instrument) {
         return SCH_ERR_INVALID_ARG;
     }
 
     try {
-        InstrumentInstance* instance = getInstrumentInstance(instrument);
-        if (!instance) {
+        if (!getInstrumentInstance(instrument)) {
             return SCH_ERR_ENGINE_NULL;
         }
 
-        // TODO: Implement control change via InstrumentInstance
-        DBG("TODO: Control change: channel=" << channel << " controller=" << controller << " value=" << value);
-        return SCH_OK;
+        if (controller < 0 || controller > 127 || channel < 0 || channel > 15) {
+            return SCH_ERR_INVALID_ARG;
+        }
+
+        const auto event = makeMidiEvent(static_cast<uint8_t>(0xB0 | channel), static_cast<uint8_t>(controller),
+                                         toMidiDataByte(juce::jlimit(0.0f, 1.0f, value)));
+        return pushLiveMidi(instrument, &event, 1);
 
     } catch (const std::exception& e) {
         DBG("FFI Exception in sch_instrument_control_change: " << e.what());
@@ -727,19 +1053,71 @@ sch_result_t sch_instrument_save_preset(
 // AUDIO PROCESSING
 // ============================================================================
 
+sch_result_t sch_instrument_prepare(
+    sch_instrument_handle instrument,
+    double sample_rate,
+    int max_block_size
+) {
+    if (!instrument || !(sample_rate > 0.0) || max_block_size <= 0) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    try {
+        instrument->prepared.store(false, std::memory_order_release);
+
+        instrument->instance->prepareToPlay(sample_rate, max_block_size);
+        instrument->maxBlockSize = max_block_size;
+
+        // Each event takes a timestamp, a length and up to 3 bytes
+        instrument->blockMidi.ensureSize(static_cast<size_t>(SCH_INSTRUMENT_MAX_MIDI_EVENTS) * 16);
+
+        // One extra frame: AbstractFifo keeps a slot free
+        const int captureFrames = sch_instrument_t::captureBlocks * max_block_size + 1;
+        instrument->captureFifo.setTotalSize(captureFrames);
+        instrument->captureData.assign(2 * static_cast<size_t>(captureFrames), 0.0f);
+
+        instrument->prepared.store(true, std::memory_order_release);
+        return SCH_OK;
+
+    } catch (const std::exception& e) {
+        DBG("FFI Exception in sch_instrument_prepare: " << e.what());
+        return SCH_ERR_INTERNAL;
+    }
+}
+
 sch_result_t sch_instrument_process(
     sch_instrument_handle instrument,
-    float* audio_buffer,
+    float* const* channels,
+    int num_channels,
     int num_samples,
-    const uint8_t* midi_data,
-    int midi_size
+    const sch_midi_event_t* midi_events,
+    int num_midi_events
 ) {
-    if (!instrument || !audio_buffer) {
+    using namespace schillinger::ffi;
+
+    if (!instrument || num_channels < 0 || num_channels > SCH_INSTRUMENT_MAX_CHANNELS || num_samples < 0
+        || (num_channels > 0 && !channels) || num_midi_events < 0 || (num_midi_events > 0 && !midi_events)) {
+        return SCH_ERR_INVALID_ARG;
+    }
+
+    if (!instrument->prepared.load(std::memory_order_acquire)) {
+        return SCH_ERR_INVALID_STATE;
+    }
+
+    if (num_samples > instrument->maxBlockSize) {
         return SCH_ERR_INVALID_ARG;
     }
 
     try {
-        // TODO: Implement audio processing
+        const juce::ScopedNoDenormals noDenormals;
+
+        buildBlockMidi(instrument, num_samples, midi_events, num_midi_events);
+
+        // Refers to the caller's channels (no copy, no allocation below 32 channels)
+        instrument->hostBuffer.setDataToReferTo(const_cast<float**>(channels), num_channels, num_samples);
+        instrument->instance->processBlock(instrument->hostBuffer, instrument->blockMidi);
+
+        captureOutput(instrument, channels, num_channels, num_samples);
         return SCH_OK;
 
     } catch (const std::exception& e) {
@@ -754,19 +1132,25 @@ sch_result_t sch_instrument_get_audio(
     int num_samples,
     int* out_samples
 ) {
-    if (!instrument || !audio_buffer || !out_samples) {
+    if (!instrument || !audio_buffer || !out_samples || num_samples < 0) {
         return SCH_ERR_INVALID_ARG;
     }
 
-    try {
-        // TODO: Implement audio retrieval
-        *out_samples = 0;
+    *out_samples = 0;
+    if (!instrument->prepared.load(std::memory_order_acquire)) {
         return SCH_OK;
-
-    } catch (const std::exception& e) {
-        DBG("FFI Exception in sch_instrument_get_audio: " << e.what());
-        return SCH_ERR_INTERNAL;
     }
+
+    int start1, size1, start2, size2;
+    instrument->captureFifo.prepareToRead(num_samples, start1, size1, start2, size2);
+
+    const float* data = instrument->captureData.data();
+    std::memcpy(audio_buffer, data + 2 * start1, 2 * static_cast<size_t>(size1) * sizeof(float));
+    std::memcpy(audio_buffer + 2 * size1, data + 2 * start2, 2 * static_cast<size_t>(size2) * sizeof(float));
+    instrument->captureFifo.finishedRead(size1 + size2);
+
+    *out_samples = size1 + size2;
+    return SCH_OK;
 }
 
 // ============================================================================
@@ -872,3 +1256,9 @@ void sch_free_preset_array(
 }
 
 } // extern "C"
+
+sch_instrument_handle sch_instrument_adopt_instance(
+    std::unique_ptr<SchillingerEcosystem::Instrument::InstrumentInstance> instance
+) {
+    return instance ? new sch_instrument_t(std::move(instance)) : nullptr;
+}
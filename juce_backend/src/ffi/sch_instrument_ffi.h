@@ -15,6 +15,13 @@
 //  - Audio processing happens on audio thread
 //  - Control functions can be called from any thread
 //
+//  Real-Time Path:
+//  - sch_instrument_process renders into caller-owned planar buffers in place
+//    and takes a packed, sample-stamped MIDI event array; it never locks,
+//    allocates or copies audio beyond the optional capture for get_audio
+//  - Resolve parameter addresses to handles once (sch_instrument_resolve_parameter)
+//    and use the *_by_handle setters per block; they never hash strings
+//
 
 #pragma once
 
@@ -22,6 +29,8 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+#include "sch_engine_ffi.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -30,11 +39,7 @@ extern "C" {
 // TYPES
 // ============================================================================
 
-// Forward declaration from sch_engine_ffi.h
-typedef struct sch_engine_t sch_engine_t;
-typedef sch_engine_t* sch_engine_handle;
-
-// Opaque instrument handle (pointer to internal C++ InstrumentInstance)
+// Opaque instrument handle (wraps the C++ InstrumentInstance and its real-time state)
 typedef struct sch_instrument_t sch_instrument_t;
 typedef sch_instrument_t* sch_instrument_handle;
 
@@ -71,6 +76,25 @@ typedef struct {
     char* unit;             // Unit (Hz, %, etc.) (caller must free)
 } sch_parameter_info_t;
 
+// Parameter handle (resolved once from an address, valid for the instrument's lifetime)
+typedef int32_t sch_parameter_handle_t;
+
+#define SCH_PARAMETER_HANDLE_INVALID (-1)
+
+// Packed MIDI event stamped with a frame offset into the processed block.
+// Offsets past the end of the block are clamped to its last frame.
+typedef struct {
+    uint32_t sample_offset;  // Frame offset into the block
+    uint8_t size;            // Valid bytes in data (1-3)
+    uint8_t data[3];         // Raw MIDI bytes, status byte first
+} sch_midi_event_t;
+
+// Maximum planar channels per sch_instrument_process call
+#define SCH_INSTRUMENT_MAX_CHANNELS 16
+
+// Maximum MIDI events delivered per block (block events + queued live events)
+#define SCH_INSTRUMENT_MAX_MIDI_EVENTS 1024
+
 // Preset info
 typedef struct {
     char* name;             // Preset name (caller must free)
@@ -263,6 +287,74 @@ sch_result_t sch_instrument_set_parameter_smooth(
     double time_ms
 );
 
+/**
+ * Resolve a parameter address to a handle
+ *
+ * Call once per parameter from a control thread, then use the handle for
+ * per-block automation. Resolving the same address again returns the same
+ * handle.
+ *
+ * @param instrument Instrument handle
+ * @param address Parameter address
+ * @param out_handle Pointer to receive the parameter handle
+ * @return SCH_OK on success, SCH_ERR_NOT_FOUND if parameter doesn't exist,
+ *         SCH_ERR_OUT_OF_MEMORY if the handle table is full
+ */
+sch_result_t sch_instrument_resolve_parameter(
+    sch_instrument_handle instrument,
+    const char* address,
+    sch_parameter_handle_t* out_handle
+);
+
+/**
+ * Get parameter value by handle
+ *
+ * @param instrument Instrument handle
+ * @param parameter Parameter handle
+ * @param out_value Pointer to receive parameter value
+ * @return SCH_OK on success, SCH_ERR_INVALID_ARG if the handle is invalid
+ */
+sch_result_t sch_instrument_get_parameter_by_handle(
+    sch_instrument_handle instrument,
+    sch_parameter_handle_t parameter,
+    float* out_value
+);
+
+/**
+ * Set parameter value by handle
+ *
+ * Real-time safe: O(1), no string hashing, no allocation. The value takes
+ * effect at the start of the next processed block.
+ *
+ * @param instrument Instrument handle
+ * @param parameter Parameter handle
+ * @param value Parameter value
+ * @return SCH_OK on success, SCH_ERR_INVALID_ARG if the handle is invalid
+ */
+sch_result_t sch_instrument_set_parameter_by_handle(
+    sch_instrument_handle instrument,
+    sch_parameter_handle_t parameter,
+    float value
+);
+
+/**
+ * Set parameter value by handle with smooth transition
+ *
+ * Real-time safe: O(1), no string hashing, no allocation.
+ *
+ * @param instrument Instrument handle
+ * @param parameter Parameter handle
+ * @param value Target parameter value
+ * @param time_ms Transition time in milliseconds
+ * @return SCH_OK on success, SCH_ERR_INVALID_ARG if the handle is invalid
+ */
+sch_result_t sch_instrument_set_parameter_smooth_by_handle(
+    sch_instrument_handle instrument,
+    sch_parameter_handle_t parameter,
+    float value,
+    double time_ms
+);
+
 // ============================================================================
 // MIDI CONTROL
 // ============================================================================
@@ -270,6 +362,9 @@ sch_result_t sch_instrument_set_parameter_smooth(
 /**
  * Send note-on event
  *
+ * Live events from any thread are queued and delivered at the start of the
+ * next sch_instrument_process block.
+ *
  * @param instrument Instrument handle
  * @param midi_note MIDI note number (0-127)
  * @param velocity Velocity (0.0-1.0)
@@ -391,34 +486,62 @@ sch_result_t sch_instrument_save_preset(
 // AUDIO PROCESSING
 // ============================================================================
 
+/**
+ * Prepare instrument for processing
+ *
+ * Allocates everything the real-time path needs. Call from a control thread
+ * before the first sch_instrument_process, and again whenever the sample rate
+ * or maximum block size changes (never concurrently with processing).
+ *
+ * @param instrument Instrument handle
+ * @param sample_rate Sample rate in Hz
+ * @param max_block_size Largest num_samples that will be passed to process
+ * @return SCH_OK on success, SCH_ERR_INVALID_ARG on bad rate or block size
+ */
+sch_result_t sch_instrument_prepare(
+    sch_instrument_handle instrument,
+    double sample_rate,
+    int max_block_size
+);
+
 /**
  * Process audio through instrument
  *
- * This is called internally by the audio engine. Usually you don't need to
- * call this directly from Swift - just let the JUCE audio engine handle it.
+ * Renders in place into the caller's planar buffers. Queued live MIDI is
+ * delivered at frame 0, then the block's events at their sample offsets.
+ * Usually the JUCE audio engine calls this; hosts embedding the engine
+ * through the C ABI call it from their own audio callback.
+ *
+ * Real-time safe: no locks, no allocation, no copies of the audio.
  *
  * @param instrument Instrument handle
- * @param audio_buffer Audio buffer (interleaved stereo)
- * @param num_samples Number of samples to process
- * @param midi_data MIDI message data
- * @param midi_size Size of MIDI data
- * @return SCH_OK on success
+ * @param channels Planar audio buffers (num_channels pointers)
+ * @param num_channels Number of channels (0 to SCH_INSTRUMENT_MAX_CHANNELS)
+ * @param num_samples Frames per channel (at most the prepared max_block_size)
+ * @param midi_events Packed MIDI events for this block (can be NULL if num_midi_events is 0)
+ * @param num_midi_events Number of MIDI events
+ * @return SCH_OK on success, SCH_ERR_INVALID_STATE if not prepared
  */
 sch_result_t sch_instrument_process(
     sch_instrument_handle instrument,
-    float* audio_buffer,
+    float* const* channels,
+    int num_channels,
     int num_samples,
-    const uint8_t* midi_data,
-    int midi_size
+    const sch_midi_event_t* midi_events,
+    int num_midi_events
 );
 
 /**
  * Get output audio from instrument
  *
+ * Pops frames rendered by sch_instrument_process from a capture ring
+ * (single reader). The ring holds four prepared blocks; frames rendered while
+ * it is full are not captured.
+ *
  * @param instrument Instrument handle
  * @param audio_buffer Audio buffer to fill (interleaved stereo)
- * @param num_samples Maximum number of samples to retrieve
- * @param out_samples Pointer to receive actual number of samples retrieved
+ * @param num_samples Maximum number of frames to retrieve
+ * @param out_samples Pointer to receive actual number of frames retrieved
  * @return SCH_OK on success
  */
 sch_result_t sch_instrument_get_audio(
@@ -500,9 +623,20 @@ void sch_free_preset_array(
     size_t count
 );
 
-// Forward declare from sch_engine_ffi.h
-void sch_free_string(char** str);
-
 #ifdef __cplusplus
 }
+
+#include <memory>
+
+namespace SchillingerEcosystem::Instrument { class InstrumentInstance; }
+
+/**
+ * Wrap an instrument created in C++ in an FFI handle (takes ownership)
+ *
+ * For hosts and tests that construct instruments directly rather than through
+ * sch_instrument_load. Destroy with sch_instrument_destroy.
+ */
+sch_instrument_handle sch_instrument_adopt_instance(
+    std::unique_ptr<SchillingerEcosystem::Instrument::InstrumentInstance> instance
+);
 #endif
@@ -11,6 +11,8 @@
 */
 
 #include "ParameterTelemetryRecorder.h"
+#include <algorithm>
+#include <unordered_map>
 
 //==============================================================================
 // EMPTY Callback Blocker
@@ -29,59 +31,657 @@
  */
 static constexpr float EMPTY_CALLBACK_EPSILON = 0.00001f;
 
+//==============================================================================
+// ParameterChangeEvent
+//==============================================================================
+
+void ParameterChangeEvent::writeJSON(juce::OutputStream& out, const juce::String& sessionID,
+                                     const juce::String& parameterID) const
+{
+    out << "{\"event_type\":\"parameter_change\","
+        << "\"event_id\":\"" << sessionID << "-" << juce::String(static_cast<juce::uint64>(sequence)) << "\","
+        << "\"parameter_id\":\"" << parameterID << "\","
+        << "\"previous_value\":" << juce::String(previousValue, 6) << ","
+        << "\"new_value\":" << juce::String(newValue, 6) << ","
+        << "\"delta\":" << juce::String(getDelta(), 6) << ","
+        << "\"is_undo\":" << (isUndo != 0 ? "true" : "false") << ","
+        << "\"duration_ms\":" << static_cast<int>(durationMs) << ","
+        << "\"timestamp_ms\":" << juce::String(static_cast<juce::int64>(timestampMs))
+        << "}";
+}
+
+//==============================================================================
+// ParameterTelemetryLog - Varint Helpers
+//==============================================================================
+
+namespace
+{
+    constexpr char logMagic[4] = { 'P', 'T', 'L', 'F' };
+    constexpr juce::uint8 dictionaryBlockTag = 'D';
+    constexpr juce::uint8 eventBlockTag = 'E';
+
+    void writeVarint(juce::MemoryOutputStream& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.writeByte(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.writeByte(static_cast<char>(value));
+    }
+
+    uint64_t zigzag(int64_t value) noexcept
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t unzigzag(uint64_t value) noexcept
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    uint32_t floatBits(float value) noexcept
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    float bitsToFloat(uint32_t bits) noexcept
+    {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Bounds-checked varint reader over a decoded block.
+     */
+    struct VarintReader
+    {
+        const juce::uint8* data;
+        size_t size;
+        size_t position = 0;
+        bool failed = false;
+
+        uint64_t next() noexcept
+        {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                if (position >= size)
+                    break;
+
+                const juce::uint8 byte = data[position++];
+                value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+
+                if ((byte & 0x80) == 0)
+                    return value;
+            }
+
+            failed = true;
+            return 0;
+        }
+    };
+
+    bool writeBlockHeader(juce::OutputStream& out, juce::uint8 tag, int count, size_t rawSize, size_t storedSize)
+    {
+        return out.writeByte(static_cast<char>(tag))
+            && out.writeInt(count)
+            && out.writeInt(static_cast<int>(rawSize))
+            && out.writeInt(static_cast<int>(storedSize));
+    }
+}
+
+//==============================================================================
+// ParameterTelemetryLog
+//==============================================================================
+
+bool ParameterTelemetryLog::writeHeader(juce::OutputStream& out, const juce::String& sessionID)
+{
+    return out.write(logMagic, sizeof(logMagic))
+        && out.writeInt(static_cast<int>(formatVersion))
+        && out.writeString(sessionID);
+}
+
+bool ParameterTelemetryLog::writeDictionaryBlock(juce::OutputStream& out, const juce::StringArray& parameterIDs,
+                                                 int firstIndex)
+{
+    const int count = parameterIDs.size() - firstIndex;
+    if (count <= 0)
+        return true;
+
+    juce::MemoryOutputStream payload;
+    for (int i = firstIndex; i < parameterIDs.size(); ++i)
+    {
+        const auto utf8 = parameterIDs[i].toUTF8();
+        const auto numBytes = parameterIDs[i].getNumBytesAsUTF8();
+        writeVarint(payload, static_cast<uint64_t>(i));
+        writeVarint(payload, static_cast<uint64_t>(numBytes));
+        payload.write(utf8.getAddress(), numBytes);
+    }
+
+    return writeBlockHeader(out, dictionaryBlockTag, count, payload.getDataSize(), payload.getDataSize())
+        && out.write(payload.getData(), payload.getDataSize());
+}
+
+void ParameterTelemetryLog::encodeColumns(const ParameterChangeEvent* events, int numEvents,
+                                          juce::MemoryOutputStream& out)
+{
+    // Column 1: sequence deltas
+    int64_t lastSequence = 0;
+    for (int i = 0; i < numEvents; ++i)
+    {
+        writeVarint(out, zigzag(static_cast<int64_t>(events[i].sequence) - lastSequence));
+        lastSequence = static_cast<int64_t>(events[i].sequence);
+    }
+
+    // Column 2: timestamp deltas
+    int64_t lastTimestamp = 0;
+    for (int i = 0; i < numEvents; ++i)
+    {
+        writeVarint(out, zigzag(events[i].timestampMs - lastTimestamp));
+        lastTimestamp = events[i].timestampMs;
+    }
+
+    // Column 3: parameter indices
+    for (int i = 0; i < numEvents; ++i)
+        writeVarint(out, events[i].parameterIndex);
+
+    // Columns 4 and 5: values XOR'd against the parameter's last new value.
+    // Consecutive values of one parameter share sign and exponent, so only
+    // the low mantissa bits survive the XOR.
+    std::unordered_map<uint16_t, uint32_t> lastNewValue;
+    for (int i = 0; i < numEvents; ++i)
+    {
+        auto& last = lastNewValue[events[i].parameterIndex];
+        const uint32_t bits = floatBits(events[i].newValue);
+        writeVarint(out, bits ^ last);
+        last = bits;
+    }
+
+    lastNewValue.clear();
+    for (int i = 0; i < numEvents; ++i)
+    {
+        auto& last = lastNewValue[events[i].parameterIndex];
+        writeVarint(out, floatBits(events[i].previousValue) ^ last);
+        last = floatBits(events[i].newValue);
+    }
+
+    // Column 6: duration and undo flag
+    for (int i = 0; i < numEvents; ++i)
+        writeVarint(out, (static_cast<uint64_t>(static_cast<uint32_t>(events[i].durationMs)) << 1)
+                             | (events[i].isUndo != 0 ? 1u : 0u));
+}
+
+bool ParameterTelemetryLog::decodeColumns(const void* data, size_t size, int numEvents,
+                                          std::vector<ParameterChangeEvent>& events)
+{
+    if (numEvents <= 0)
+        return numEvents == 0;
+
+    VarintReader reader { static_cast<const juce::uint8*>(data), size };
+    const size_t first = events.size();
+    events.resize(first + static_cast<size_t>(numEvents));
+    ParameterChangeEvent* block = events.data() + first;
+
+    int64_t sequence = 0;
+    for (int i = 0; i < numEvents; ++i)
+    {
+        sequence += unzigzag(reader.next());
+        block[i].sequence = static_cast<uint64_t>(sequence);
+    }
+
+    int64_t timestamp = 0;
+    for (int i = 0; i < numEvents; ++i)
+    {
+        timestamp += unzigzag(reader.next());
+        block[i].timestampMs = timestamp;
+    }
+
+    for (int i = 0; i < numEvents; ++i)
+        block[i].parameterIndex = static_cast<uint16_t>(reader.next());
+
+    std::unordered_map<uint16_t, uint32_t> lastNewValue;
+    for (int i = 0; i < numEvents; ++i)
+    {
+        auto& last = lastNewValue[block[i].parameterIndex];
+        last ^= static_cast<uint32_t>(reader.next());
+        block[i].newValue = bitsToFloat(last);
+    }
+
+    lastNewValue.clear();
+    for (int i = 0; i < numEvents; ++i)
+    {
+        auto& last = lastNewValue[block[i].parameterIndex];
+        block[i].previousValue = bitsToFloat(static_cast<uint32_t>(reader.next()) ^ last);
+        last = floatBits(block[i].newValue);
+    }
+
+    for (int i = 0; i < numEvents; ++i)
+    {
+        const uint64_t packed = reader.next();
+        block[i].durationMs = static_cast<int32_t>(packed >> 1);
+        block[i].isUndo = static_cast<uint8_t>(packed & 1);
+    }
+
+    if (reader.failed || reader.position != size)
+    {
+        events.resize(first);
+        return false;
+    }
+
+    return true;
+}
+
+bool ParameterTelemetryLog::writeEventBlock(juce::OutputStream& out, const ParameterChangeEvent* events, int numEvents)
+{
+    if (numEvents <= 0)
+        return true;
+
+    juce::MemoryOutputStream columns;
+    encodeColumns(events, numEvents, columns);
+
+    juce::MemoryOutputStream compressed;
+    {
+        juce::GZIPCompressorOutputStream zipper(compressed, 9);
+        zipper.write(columns.getData(), columns.getDataSize());
+        zipper.flush();
+    }
+
+    return writeBlockHeader(out, eventBlockTag, numEvents, columns.getDataSize(), compressed.getDataSize())
+        && out.write(compressed.getData(), compressed.getDataSize());
+}
+
+juce::Result ParameterTelemetryLog::read(const juce::File& file, Contents& contents)
+{
+    juce::FileInputStream in(file);
+    if (in.failedToOpen())
+        return juce::Result::fail("Cannot open telemetry log: " + in.getStatus().getErrorMessage());
+
+    char magic[sizeof(logMagic)] = {};
+    if (in.read(magic, sizeof(magic)) != static_cast<int>(sizeof(magic))
+        || std::memcmp(magic, logMagic, sizeof(magic)) != 0)
+        return juce::Result::fail("Not a parameter telemetry log");
+
+    if (static_cast<uint32_t>(in.readInt()) != formatVersion)
+        return juce::Result::fail("Unsupported parameter telemetry log version");
+
+    contents.sessionID = in.readString();
+    contents.parameterIDs.clear();
+    contents.events.clear();
+
+    constexpr int blockHeaderSize = 13;
+    juce::MemoryBlock stored;
+
+    // Stop quietly at the first incomplete block: the writer may have been
+    // interrupted mid-append, and every earlier block is still valid.
+    while (in.getNumBytesRemaining() >= blockHeaderSize)
+    {
+        const auto tag = static_cast<juce::uint8>(in.readByte());
+        const int count = in.readInt();
+        const int rawSize = in.readInt();
+        const int storedSize = in.readInt();
+
+        if (count < 0 || rawSize < 0 || storedSize < 0 || in.getNumBytesRemaining() < storedSize)
+            break;
+
+        stored.setSize(static_cast<size_t>(storedSize));
+        if (in.read(stored.getData(), storedSize) != storedSize)
+            break;
+
+        if (tag == dictionaryBlockTag)
+        {
+            VarintReader reader { static_cast<const juce::uint8*>(stored.getData()), stored.getSize() };
+            for (int i = 0; i < count && !reader.failed; ++i)
+            {
+                const auto index = static_cast<int>(reader.next());
+                const auto numBytes = static_cast<size_t>(reader.next());
+                if (reader.failed || index < 0 || numBytes > reader.size - reader.position)
+                    break;
+
+                while (contents.parameterIDs.size() <= index)
+                    contents.parameterIDs.add({});
+
+                contents.parameterIDs.set(index, juce::String::fromUTF8(
+                    reinterpret_cast<const char*>(reader.data + reader.position), static_cast<int>(numBytes)));
+                reader.position += numBytes;
+            }
+        }
+        else if (tag == eventBlockTag)
+        {
+            juce::MemoryInputStream compressed(stored, false);
+            juce::GZIPDecompressorInputStream unzipper(compressed);
+
+            juce::MemoryBlock columns(static_cast<size_t>(rawSize));
+            if (unzipper.read(columns.getData(), rawSize) != rawSize
+                || !decodeColumns(columns.getData(), columns.getSize(), count, contents.events))
+                break;
+        }
+    }
+
+    return juce::Result::ok();
+}
+
+//==============================================================================
+// Background Writer
+//==============================================================================
+
+/**
+ * Drains the recorder's rings into ParameterTelemetryLog blocks.
+ *
+ * Wakes every flushIntervalMs, so the audio thread never signals anything;
+ * the ring capacity only has to cover one interval of automation.
+ */
+class ParameterTelemetryRecorder::WriterThread : public juce::Thread
+{
+public:
+    WriterThread(ParameterTelemetryRecorder& owner_, std::unique_ptr<juce::FileOutputStream> stream_,
+                 int flushIntervalMs_)
+        : juce::Thread("Parameter Telemetry Writer")
+        , owner(owner_)
+        , stream(std::move(stream_))
+        , flushIntervalMs(flushIntervalMs_)
+        , block(static_cast<size_t>(ParameterTelemetryLog::blockSize))
+    {
+    }
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            wait(flushIntervalMs);
+            writePendingEvents();
+        }
+
+        // Final drain after stopWriting()
+        writePendingEvents();
+    }
+
+private:
+    void writePendingEvents()
+    {
+        bool wroteAnything = false;
+
+        for (;;)
+        {
+            const int numEvents = owner.drainEvents(block.data(), ParameterTelemetryLog::blockSize);
+            if (numEvents == 0)
+                break;
+
+            writeNewParameterIDs();
+            ParameterTelemetryLog::writeEventBlock(*stream, block.data(), numEvents);
+            wroteAnything = true;
+        }
+
+        if (wroteAnything)
+            stream->flush();
+    }
+
+    void writeNewParameterIDs()
+    {
+        // IDs are published before the count, so [0, numParameters) is stable
+        const int numParameters = owner.getNumParameters();
+        while (parameterIDs.size() < numParameters)
+            parameterIDs.add(owner.getParameterID(parameterIDs.size()));
+
+        ParameterTelemetryLog::writeDictionaryBlock(*stream, parameterIDs, numWrittenParameterIDs);
+        numWrittenParameterIDs = parameterIDs.size();
+    }
+
+    ParameterTelemetryRecorder& owner;
+    std::unique_ptr<juce::FileOutputStream> stream;
+    const int flushIntervalMs;
+
+    std::vector<ParameterChangeEvent> block;
+    juce::StringArray parameterIDs;
+    int numWrittenParameterIDs = 0;
+};
+
 //==============================================================================
 // ParameterTelemetryRecorder Implementation
 //==============================================================================
 
+ParameterTelemetryRecorder::ParameterTelemetryRecorder(int capacity)
+    : sessionID(juce::Uuid().toString())
+    , messageThreadQueue(capacity)
+    , audioThreadQueue(capacity)
+{
+}
+
+ParameterTelemetryRecorder::~ParameterTelemetryRecorder()
+{
+    stopWriting();
+}
+
+//==============================================================================
+// Parameter Interning
+//==============================================================================
+
+int ParameterTelemetryRecorder::findSlot(const juce::String& parameterID) const noexcept
+{
+    auto slot = static_cast<int>(static_cast<uint32_t>(parameterID.hashCode()) & (hashTableSize - 1));
+
+    for (int probe = 0; probe < hashTableSize; ++probe)
+    {
+        const int entry = parameterTable[static_cast<size_t>(slot)].load(std::memory_order_acquire);
+        if (entry == 0 || parameterIDs[static_cast<size_t>(entry - 1)] == parameterID)
+            return slot;
+
+        slot = (slot + 1) & (hashTableSize - 1);
+    }
+
+    return -1;
+}
+
+int ParameterTelemetryRecorder::registerParameter(const juce::String& parameterID, float initialValue)
+{
+    const int slot = findSlot(parameterID);
+    if (slot < 0)
+        return -1;
+
+    const int entry = parameterTable[static_cast<size_t>(slot)].load(std::memory_order_acquire);
+    if (entry != 0)
+        return entry - 1;
+
+    const int index = numParameters.load(std::memory_order_relaxed);
+    if (index >= maxParameters)
+    {
+        jassertfalse; // raise maxParameters
+        return -1;
+    }
+
+    // Fill the entry before publishing it to the audio thread
+    parameterIDs[static_cast<size_t>(index)] = parameterID;
+    lastValues[static_cast<size_t>(index)].store(initialValue, std::memory_order_relaxed);
+    parameterTable[static_cast<size_t>(slot)].store(index + 1, std::memory_order_release);
+    numParameters.store(index + 1, std::memory_order_release);
+    return index;
+}
+
+void ParameterTelemetryRecorder::registerParameters(juce::AudioProcessor& processor)
+{
+    for (auto* parameter : processor.getParameters())
+    {
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter))
+            registerParameter(ranged->paramID, ranged->convertFrom0to1(ranged->getValue()));
+        else if (auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameter))
+            registerParameter(withID->paramID, withID->getValue());
+    }
+}
+
+int ParameterTelemetryRecorder::getParameterIndex(const juce::String& parameterID) const noexcept
+{
+    const int slot = findSlot(parameterID);
+    if (slot < 0)
+        return -1;
+
+    return parameterTable[static_cast<size_t>(slot)].load(std::memory_order_acquire) - 1;
+}
+
+const juce::String& ParameterTelemetryRecorder::getParameterID(int parameterIndex) const noexcept
+{
+    static const juce::String empty;
+
+    if (parameterIndex < 0 || parameterIndex >= getNumParameters())
+        return empty;
+
+    return parameterIDs[static_cast<size_t>(parameterIndex)];
+}
+
+//==============================================================================
+// Recording
+//==============================================================================
+
 void ParameterTelemetryRecorder::parameterChanged(const juce::String& parameterID, float newValue)
 {
-    // Get previous value (if we have tracking for this parameter)
-    float previousValue = getPreviousValue(parameterID);
+    const int parameterIndex = getParameterIndex(parameterID);
 
-    // EMPTY CALLBACK BLOCKER:
-    // Skip if the value hasn't meaningfully changed (within epsilon)
-    // This prevents callback spam and false telemetry events
-    float delta = std::abs(newValue - previousValue);
-    if (delta < EMPTY_CALLBACK_EPSILON)
+    if (parameterIndex < 0)
     {
-        // Value hasn't changed - skip this callback
-        DBG("ParameterTelemetryRecorder: Empty callback blocked for " + parameterID +
-            " (delta: " + juce::String(delta, 8) + " < epsilon: " + juce::String(EMPTY_CALLBACK_EPSILON, 8) + ")");
+        // Not interned: the audio thread can't allocate a table entry
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
         return;
     }
 
-    // Calculate duration of adjustment
-    int durationMs = calculateDurationMs(parameterID);
-
     // Check if this is an undo operation
     // TODO: Integrate with undo manager when available
-    bool isUndo = false;
+    recordChange(parameterIndex, newValue, false);
+}
+
+bool ParameterTelemetryRecorder::recordChange(int parameterIndex, float newValue, bool isUndo) noexcept
+{
+    if (parameterIndex < 0 || parameterIndex >= getNumParameters())
+    {
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto& lastValue = lastValues[static_cast<size_t>(parameterIndex)];
+    const float previousValue = lastValue.load(std::memory_order_relaxed);
 
-    // Generate event ID (UUID)
-    juce::String eventID = juce::Uuid().toString();
+    // EMPTY CALLBACK BLOCKER:
+    // Skip if the value hasn't meaningfully changed (within epsilon)
+    // This prevents callback spam and false telemetry events
+    if (std::abs(newValue - previousValue) < EMPTY_CALLBACK_EPSILON)
+        return false;
+
+    ParameterChangeEvent event;
+    event.sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+    event.timestampMs = juce::Time::currentTimeMillis();
+    event.previousValue = previousValue;
+    event.newValue = newValue;
+    event.durationMs = calculateDurationMs(parameterIndex);
+    event.parameterIndex = static_cast<uint16_t>(parameterIndex);
+    event.isUndo = isUndo ? 1 : 0;
 
-    // Create event
-    ParameterChangeEvent event(
-        eventID,
-        parameterID,
-        previousValue,
-        newValue,
-        isUndo,
-        durationMs
-    );
+    bool queued = false;
 
-    // Queue event (non-blocking, drops if full)
-    bool queued = queue.push(event);
+    if (juce::MessageManager::existsAndIsCurrentThread())
+    {
+        queued = messageThreadQueue.push(event);
+    }
+    else if (!audioQueueBusy.exchange(true, std::memory_order_acquire))
+    {
+        // The audio ring is single-producer: a second non-message thread
+        // arriving at the same moment drops its event instead of waiting
+        queued = audioThreadQueue.push(event);
+        audioQueueBusy.store(false, std::memory_order_release);
+    }
 
     if (!queued)
     {
-        // Queue full - drop event and log
-        // In production, this should be rate-limited
-        DBG("ParameterTelemetryRecorder: Queue full, dropped event for " + parameterID);
+        // Sequence numbers have a gap where the event was dropped
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return false;
     }
-    else
+
+    // Update previous value tracking
+    lastValue.store(newValue, std::memory_order_relaxed);
+    return true;
+}
+
+//==============================================================================
+// Background Log Writer
+//==============================================================================
+
+juce::Result ParameterTelemetryRecorder::startWriting(const juce::File& logFile, int flushIntervalMs)
+{
+    if (writer != nullptr)
+        return juce::Result::fail("Telemetry log writer already running");
+
+    if (logFile.existsAsFile() && !logFile.deleteFile())
+        return juce::Result::fail("Cannot replace telemetry log: " + logFile.getFullPathName());
+
+    auto stream = std::make_unique<juce::FileOutputStream>(logFile);
+    if (stream->failedToOpen())
+        return juce::Result::fail("Cannot create telemetry log: " + stream->getStatus().getErrorMessage());
+
+    if (!ParameterTelemetryLog::writeHeader(*stream, sessionID) || !stream->getStatus().wasOk())
+        return juce::Result::fail("Cannot write telemetry log header");
+
+    writer = std::make_unique<WriterThread>(*this, std::move(stream), juce::jmax(1, flushIntervalMs));
+    writer->startThread();
+    return juce::Result::ok();
+}
+
+void ParameterTelemetryRecorder::stopWriting()
+{
+    if (writer == nullptr)
+        return;
+
+    // The writer drains whatever is still queued before run() returns
+    writer->stopThread(10000);
+    writer.reset();
+}
+
+//==============================================================================
+// Event Flushing
+//==============================================================================
+
+int ParameterTelemetryRecorder::drainEvents(ParameterChangeEvent* output, int maxEvents)
+{
+    int numEvents = audioThreadQueue.pop(output, maxEvents);
+    numEvents += messageThreadQueue.pop(output + numEvents, maxEvents - numEvents);
+
+    // Each ring is in order; merge them back into one sequence
+    std::sort(output, output + numEvents, [](const ParameterChangeEvent& a, const ParameterChangeEvent& b) {
+        return a.sequence < b.sequence;
+    });
+
+    return numEvents;
+}
+
+juce::String ParameterTelemetryRecorder::flushEvents(int maxEvents)
+{
+    // The background writer is the only consumer while it runs
+    jassert(writer == nullptr);
+
+    if (maxEvents <= 0)
+        maxEvents = getNumQueuedEvents();
+
+    if (maxEvents <= 0)
+        return {};
+
+    std::vector<ParameterChangeEvent> events(static_cast<size_t>(maxEvents));
+    const int numEvents = drainEvents(events.data(), maxEvents);
+
+    if (numEvents == 0)
+        return {};
+
+    // Serialize to JSONL format
+    juce::MemoryOutputStream jsonl(static_cast<size_t>(numEvents) * 256);
+    for (int i = 0; i < numEvents; ++i)
     {
-        // Update previous value tracking
-        updatePreviousValue(parameterID, newValue);
+        const auto& event = events[static_cast<size_t>(i)];
+        event.writeJSON(jsonl, sessionID, getParameterID(event.parameterIndex));
+        jsonl << "\n";
     }
+
+    return jsonl.toString();
+}
+
+int ParameterTelemetryRecorder::getNumQueuedEvents() const
+{
+    return audioThreadQueue.getNumEvents() + messageThreadQueue.getNumEvents();
 }
@@ -12,11 +12,16 @@
 
 #pragma once
 
+#include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_data_structures/juce_data_structures.h>
 #include <juce_core/juce_core.h>
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 //==============================================================================
 // Parameter Change Event
@@ -28,87 +33,58 @@
  * Captured from JUCE audio thread and queued for serialization.
  * Matches the data model specification in:
  * plans/ui-telemetry-constraints-testing/data-model.md
+ *
+ * Fixed-size POD (32 bytes) so it can be copied through the ring buffer and
+ * written in bulk. The parameter is an interned index into the recorder's
+ * parameter table, and the event ID is a per-session sequence number
+ * (rendered as "<sessionID>-<sequence>" in JSON).
  */
 struct ParameterChangeEvent {
-    /// Unique event identifier (UUID)
-    juce::String eventID;
+    /// Per-session sequence number (event identifier)
+    uint64_t sequence = 0;
 
-    /// Parameter identifier (e.g., "op1_ratio", "masterVolume")
-    juce::String parameterID;
+    /// Unix timestamp in milliseconds
+    int64_t timestampMs = 0;
 
     /// Previous value before change
-    float previousValue;
+    float previousValue = 0.0f;
 
     /// New value after change
-    float newValue;
-
-    /// Absolute change magnitude
-    float delta;
-
-    /// Whether this change is from an undo operation
-    bool isUndo;
+    float newValue = 0.0f;
 
     /// Duration of parameter adjustment (ms)
     /// 0 for instantaneous changes, >0 for continuous adjustments
-    int durationMs;
+    int32_t durationMs = 0;
 
-    /// Unix timestamp in milliseconds
-    int64 timestampMs;
-
-    /// Default constructor
-    ParameterChangeEvent()
-        : previousValue(0.0f)
-        , newValue(0.0f)
-        , delta(0.0f)
-        , isUndo(false)
-        , durationMs(0)
-        , timestampMs(0) {
-    }
+    /// Interned parameter index (see ParameterTelemetryRecorder::getParameterID)
+    uint16_t parameterIndex = 0;
 
-    /// Constructor with all fields
-    ParameterChangeEvent(
-        const juce::String& eventID_,
-        const juce::String& parameterID_,
-        float previousValue_,
-        float newValue_,
-        bool isUndo_,
-        int durationMs_
-    ) : eventID(eventID_)
-      , parameterID(parameterID_)
-      , previousValue(previousValue_)
-      , newValue(newValue_)
-      , delta(std::abs(newValue_ - previousValue_))
-      , isUndo(isUndo_)
-      , durationMs(durationMs_)
-      , timestampMs(juce::Time::currentTimeMillis()) {
-    }
+    /// Whether this change is from an undo operation
+    uint8_t isUndo = 0;
+
+    uint8_t reserved = 0;
+
+    /// Absolute change magnitude
+    float getDelta() const { return std::abs(newValue - previousValue); }
 
     /// Convert to JSON for serialization
-    juce::String toJSON() const {
-        juce::String json = "{";
-        json += "\"event_type\":\"parameter_change\",";
-        json += "\"event_id\":\"" + eventID + "\",";
-        json += "\"parameter_id\":\"" + parameterID + "\",";
-        json += "\"previous_value\":" + juce::String(previousValue, 6) + ",";
-        json += "\"new_value\":" + juce::String(newValue, 6) + ",";
-        json += "\"delta\":" + juce::String(delta, 6) + ",";
-        json += "\"is_undo\":" + juce::String(isUndo ? "true" : "false") + ",";
-        json += "\"duration_ms\":" + juce::String(durationMs) + ",";
-        json += "\"timestamp_ms\":" + juce::String(timestampMs);
-        json += "}";
-        return json;
-    }
+    void writeJSON(juce::OutputStream& out, const juce::String& sessionID, const juce::String& parameterID) const;
 };
 
+static_assert(std::is_trivially_copyable<ParameterChangeEvent>::value,
+              "ParameterChangeEvent is copied through the ring with memcpy");
+static_assert(sizeof(ParameterChangeEvent) == 32, "ParameterChangeEvent should stay one half cache line");
+
 //==============================================================================
 // Lock-Free Parameter Event Queue
 //==============================================================================
 
 /**
- * Lock-free queue for parameter change events from audio thread.
+ * Wait-free single-producer/single-consumer ring for parameter events.
  *
- * Uses juce::AbstractFifo for thread-safe ring buffer operations.
- * Events are queued from audio thread and flushed from message thread.
+ * Uses juce::AbstractFifo for the indices over a preallocated POD buffer, so
+ * push is a bounds check and a 32-byte copy. Exactly one thread may push and
+ * one thread may pop.
  */
 class ParameterEventQueue {
 public:
@@ -117,86 +93,142 @@ public:
      *
      * @param capacity Maximum number of events (must be power of 2)
      */
-    explicit ParameterEventQueue(int capacity = 256)
-        : fifo(capacity) {
-        jassert(capacity > 0 && juce::isPowerOfTwo(capacity),
-                "Capacity must be a positive power of 2");
-        buffer.insertMultiple(0, ParameterChangeEvent(), capacity);
+    explicit ParameterEventQueue(int capacity = 4096)
+        : fifo(capacity)
+        , buffer(static_cast<size_t>(capacity)) {
+        jassert(capacity > 0 && juce::isPowerOfTwo(capacity));
     }
 
     /**
-     * Queue a parameter change event (call from any thread).
-     *
-     * Thread-safe: Can be called from audio thread.
+     * Queue a parameter change event (producer thread only).
      *
      * @param event Parameter change event to queue
      * @return true if event was queued, false if queue is full
      */
-    bool push(const ParameterChangeEvent& event) {
+    bool push(const ParameterChangeEvent& event) noexcept {
         int start1, size1, start2, size2;
         fifo.prepareToWrite(1, start1, size1, start2, size2);
 
         if (size1 == 0) {
-            // Queue is full
             return false;
         }
 
-        buffer[start1] = event;
-        fifo.finishedWrite(size1 != 0 ? 1 : 1 + size2);
-
+        buffer[static_cast<size_t>(start1)] = event;
+        fifo.finishedWrite(1);
         return true;
     }
 
     /**
-     * Pop events from queue (call from message thread).
-     *
-     * Thread-safe: Should only be called from one consumer thread.
+     * Pop events from queue (consumer thread only).
      *
      * @param output Destination array for popped events
      * @param maxEvents Maximum number of events to pop
      * @return Number of events actually popped
      */
-    int pop(ParameterChangeEvent* output, int maxEvents) {
+    int pop(ParameterChangeEvent* output, int maxEvents) noexcept {
         int start1, size1, start2, size2;
         fifo.prepareToRead(maxEvents, start1, size1, start2, size2);
 
-        int totalRead = size1 + size2;
-
-        if (totalRead == 0) {
-            return 0;
-        }
-
-        // Read first block
         if (size1 > 0) {
-            memcpy(output, buffer.begin() + start1, size1 * sizeof(ParameterChangeEvent));
+            std::memcpy(output, buffer.data() + start1, static_cast<size_t>(size1) * sizeof(ParameterChangeEvent));
         }
 
-        // Read second block (if wrapped)
         if (size2 > 0) {
-            memcpy(output + size1, buffer.begin(), size2 * sizeof(ParameterChangeEvent));
+            std::memcpy(output + size1, buffer.data() + start2, static_cast<size_t>(size2) * sizeof(ParameterChangeEvent));
         }
 
-        fifo.finishedRead(totalRead);
-        return totalRead;
+        fifo.finishedRead(size1 + size2);
+        return size1 + size2;
     }
 
     /**
      * Get the number of events currently in the queue.
      */
-    int getNumEvents() const {
+    int getNumEvents() const noexcept {
         return fifo.getNumReady();
     }
 
     /**
      * Check if the queue is empty.
      */
-    bool isEmpty() const {
+    bool isEmpty() const noexcept {
         return fifo.getNumReady() == 0;
     }
 
 private:
     juce::AbstractFifo fifo;
-    juce::Array<ParameterChangeEvent> buffer;
+    std::vector<ParameterChangeEvent> buffer;
+};
+
+//==============================================================================
+// Columnar Telemetry Log
+//==============================================================================
+
+/**
+ * Append-only, compressed, columnar file format for parameter events.
+ *
+ * FILE LAYOUT:
+ * - Header: magic "PTLF", format version, session ID
+ * - Blocks, each: tag byte, uint32 event/entry count, uint32 raw size,
+ *   uint32 stored size, payload
+ *   - 'D' dictionary block: (index, parameter ID) pairs interned so far
+ *   - 'E' event block: gzip-compressed columns for up to blockSize events
+ *
+ * EVENT COLUMNS (all varints, each column contiguous):
+ * - sequence deltas, timestamp deltas (ms)
+ * - parameter index
+ * - new value, XOR'd with the parameter's previous new value in the block
+ * - previous value, XOR'd with the parameter's previous new value in the block
+ *   (zero whenever no change was dropped)
+ * - duration << 1 | isUndo
+ *
+ * Automation moves a few parameters by small amounts, so most XORs and
+ * deltas fit in one or two bytes before compression. Blocks decode
+ * independently, so a file truncated mid-block still replays up to the last
+ * complete block.
+ */
+class ParameterTelemetryLog {
+public:
+    static constexpr int blockSize = 4096;
+    static constexpr uint32_t formatVersion = 1;
+
+    /**
+     * Write the file header (once, at the start of a new file).
+     */
+    static bool writeHeader(juce::OutputStream& out, const juce::String& sessionID);
+
+    /**
+     * Append a dictionary block for parameters [firstIndex, parameterIDs.size()).
+     */
+    static bool writeDictionaryBlock(juce::OutputStream& out, const juce::StringArray& parameterIDs, int firstIndex);
+
+    /**
+     * Encode and append one event block.
+     */
+    static bool writeEventBlock(juce::OutputStream& out, const ParameterChangeEvent* events, int numEvents);
+
+    /**
+     * Decoded contents of a log file.
+     */
+    struct Contents {
+        juce::String sessionID;
+        juce::StringArray parameterIDs;
+        std::vector<ParameterChangeEvent> events;
+    };
+
+    /**
+     * Read a whole log back for replay.
+     *
+     * @return Result::fail on a bad header; a truncated trailing block is
+     *         ignored and everything before it is returned
+     */
+    static juce::Result read(const juce::File& file, Contents& contents);
+
+    /**
+     * Columnar encoding of one block, before compression (exposed for tests).
+     */
+    static void encodeColumns(const ParameterChangeEvent* events, int numEvents, juce::MemoryOutputStream& out);
+    static bool decodeColumns(const void* data, size_t size, int numEvents, std::vector<ParameterChangeEvent>& events);
 };
 
 //==============================================================================
@@ -208,32 +240,73 @@ private:
  *
  * IMPLEMENTATION:
  * - Implements AudioProcessorValueTreeState::Listener interface
- * - Queues events to lock-free queue from parameterChanged callback
- * - Provides flush method for message thread serialization
+ * - Parameter IDs are interned up front (registerParameters); the audio
+ *   thread resolves an ID with a read-only hash probe and records a 32-byte
+ *   POD event with a sequence-number ID
+ * - Events go through wait-free SPSC rings: one for the message thread and
+ *   one for the audio thread, so each ring has a single producer
+ * - Either a background writer batches events into a ParameterTelemetryLog
+ *   file, or flushEvents() drains them to JSONL on the message thread
  *
  * USAGE:
- * 1. Create instance with reference to AudioProcessorValueTreeState
- * 2. Add as listener: parameters->addListener(&recorder)
+ * 1. Create instance and registerParameters(processor)
+ * 2. Add as listener for each registered parameter ID
  * 3. In audio callback: events are automatically queued
- * 4. In message thread: call flushEvents() to serialize
+ * 4. Either startWriting(file) once, or call flushEvents() periodically
  *
  * THREAD SAFETY:
- * - parameterChanged() called from audio thread (must be lock-free)
- * - flushEvents() called from message thread
- * - Queue operations use juce::AbstractFifo (wait-free)
+ * - parameterChanged() is wait-free, lock-free and allocation-free
+ * - registerParameter(), startWriting(), stopWriting() and flushEvents()
+ *   are message thread only
+ * - A change arriving from a third thread while the audio ring is in use is
+ *   dropped and counted rather than blocking (see getNumDroppedEvents)
  */
 class ParameterTelemetryRecorder : public juce::AudioProcessorValueTreeState::Listener {
 public:
+    static constexpr int maxParameters = 2048;
+
     /**
      * Creates a telemetry recorder with specified queue capacity.
      *
-     * @param capacity Maximum number of events to buffer (power of 2)
+     * @param capacity Maximum number of events to buffer per ring (power of 2)
      */
-    explicit ParameterTelemetryRecorder(int capacity = 256)
-        : queue(capacity) {
-    }
+    explicit ParameterTelemetryRecorder(int capacity = 4096);
+
+    ~ParameterTelemetryRecorder() override;
+
+    //==========================================================================
+    // Parameter Interning (Message Thread)
+    //==========================================================================
+
+    /**
+     * Intern a parameter ID (returns the existing index if already interned).
+     *
+     * @param initialValue Value the first change is measured against
+     * @return Parameter index, or -1 if the table is full
+     */
+    int registerParameter(const juce::String& parameterID, float initialValue = 0.0f);
 
-    ~ParameterTelemetryRecorder() override = default;
+    /**
+     * Intern every parameter of a processor that has an ID, seeded with its
+     * current (denormalised) value.
+     */
+    void registerParameters(juce::AudioProcessor& processor);
+
+    /**
+     * Look up an interned parameter (any thread, no allocation).
+     *
+     * @return Parameter index, or -1 if not registered
+     */
+    int getParameterIndex(const juce::String& parameterID) const noexcept;
+
+    /**
+     * ID of an interned parameter, or an empty string.
+     */
+    const juce::String& getParameterID(int parameterIndex) const noexcept;
+
+    int getNumParameters() const noexcept { return numParameters.load(std::memory_order_acquire); }
+
+    const juce::String& getSessionID() const noexcept { return sessionID; }
 
     //==========================================================================
     // AudioProcessorValueTreeState::Listener Interface
@@ -243,117 +316,96 @@ public:
      * Called when a parameter value changes.
      *
      * IMPORTANT: This is called from the AUDIO THREAD.
-     * Must be wait-free and non-blocking.
+     * Wait-free: a hash probe, a few atomics and a 32-byte copy.
      *
      * @param parameterID Parameter that changed
      * @param newValue New parameter value
      */
-    void parameterChanged(const juce::String& parameterID, float newValue) override {
-        // Get previous value (if we have tracking for this parameter)
-        float previousValue = getPreviousValue(parameterID);
-
-        // Calculate duration of adjustment
-        int durationMs = calculateDurationMs(parameterID);
-
-        // Check if this is an undo operation
-        // TODO: Integrate with undo manager when available
-        bool isUndo = false;
-
-        // Generate event ID (UUID)
-        juce::String eventID = juce::Uuid().toString();
-
-        // Create event
-        ParameterChangeEvent event(
-            eventID,
-            parameterID,
-            previousValue,
-            newValue,
-            isUndo,
-            durationMs
-        );
-
-        // Queue event (non-blocking, drops if full)
-        bool queued = queue.push(event);
-
-        if (!queued) {
-            // Queue full - drop event and log
-            // In production, this should be rate-limited
-            DBG("ParameterTelemetryRecorder: Queue full, dropped event for " + parameterID);
-        } else {
-            // Update previous value tracking
-            updatePreviousValue(parameterID, newValue);
-        }
-    }
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+
+    /**
+     * Record a change by interned index (same guarantees as parameterChanged).
+     *
+     * @return true if the event was queued
+     */
+    bool recordChange(int parameterIndex, float newValue, bool isUndo = false) noexcept;
 
     //==========================================================================
-    // Event Flushing (Message Thread)
+    // Background Log Writer (Message Thread)
     //==========================================================================
 
     /**
-     * Flush queued events to JSONL format for serialization.
-     *
-     * IMPORTANT: This should be called from the MESSAGE THREAD.
+     * Start a background thread that appends batched events to a columnar
+     * log file. While it runs it is the only consumer of the queues.
      *
-     * @param maxEvents Maximum number of events to flush (0 = all)
-     * @return JSONL string with serialized events
+     * @param logFile File to create (an existing file is replaced)
+     * @param flushIntervalMs Longest time an event waits before being written
      */
-    juce::String flushEvents(int maxEvents = 0) {
-        if (maxEvents <= 0) {
-            maxEvents = queue.getNumEvents();
-        }
+    juce::Result startWriting(const juce::File& logFile, int flushIntervalMs = 250);
 
-        juce::Array<ParameterChangeEvent> events;
-        events.ensureStorageAllocated(maxEvents);
+    /**
+     * Drain remaining events, write them and stop the writer thread.
+     */
+    void stopWriting();
 
-        int numEvents = queue.pop(events.getRawDataPointer(), maxEvents);
+    bool isWriting() const noexcept { return writer != nullptr; }
 
-        if (numEvents == 0) {
-            return {};
-        }
+    //==========================================================================
+    // Event Flushing (Message Thread)
+    //==========================================================================
 
-        // Serialize to JSONL format
-        juce::String jsonl;
-        for (int i = 0; i < numEvents; ++i) {
-            jsonl += events[i].toJSON();
-            jsonl += "\n";
-        }
+    /**
+     * Drain queued events in sequence order (message thread, writer stopped).
+     *
+     * @return Number of events written to output
+     */
+    int drainEvents(ParameterChangeEvent* output, int maxEvents);
 
-        return jsonl;
-    }
+    /**
+     * Flush queued events to JSONL format for serialization.
+     *
+     * IMPORTANT: This should be called from the MESSAGE THREAD, and not while
+     * the background writer is running.
+     *
+     * @param maxEvents Maximum number of events to flush (0 = all)
+     * @return JSONL string with serialized events
+     */
+    juce::String flushEvents(int maxEvents = 0);
 
     /**
      * Check if there are events pending to flush.
      *
      * @return Number of queued events
      */
-    int getNumQueuedEvents() const {
-        return queue.getNumEvents();
-    }
+    int getNumQueuedEvents() const;
+
+    /**
+     * Events dropped because a ring was full, a producer collided, or the
+     * parameter was never registered.
+     */
+    uint64_t getNumDroppedEvents() const noexcept { return droppedEvents.load(std::memory_order_relaxed); }
 
 private:
+    class WriterThread;
+
     //==========================================================================
-    // Previous Value Tracking
+    // Interning
     //==========================================================================
 
-    /**
-     * Get the previous value for a parameter.
-     */
-    float getPreviousValue(const juce::String& parameterID) {
-        const juce::GenericScopedLock<juce::SpinLock> lock(previousValuesLock);
-        auto it = previousValues.find(parameterID);
-        if (it != previousValues.end()) {
-            return it->second;
-        }
-        return 0.0f; // Default if no previous value
-    }
+    static constexpr int hashTableSize = maxParameters * 2;
 
-    /**
-     * Update the previous value for a parameter.
-     */
-    void updatePreviousValue(const juce::String& parameterID, float value) {
-        const juce::GenericScopedLock<juce::SpinLock> lock(previousValuesLock);
-        previousValues[parameterID] = value;
-    }
+    int findSlot(const juce::String& parameterID) const noexcept;
+
+    /// Interned IDs; entries are written once, before being published
+    std::array<juce::String, maxParameters> parameterIDs;
+
+    /// Open-addressed index table: 0 = empty, otherwise parameter index + 1
+    std::array<std::atomic<int>, hashTableSize> parameterTable {};
+
+    std::atomic<int> numParameters{0};
+
+    /// Last recorded value per parameter (for previous value and delta)
+    std::array<std::atomic<float>, maxParameters> lastValues {};
 
     //==========================================================================
     // Duration Calculation
@@ -369,8 +421,8 @@ private:
      *
      * TODO: Implement interaction duration tracking for continuous knobs/sliders
      */
-    int calculateDurationMs(const juce::String& parameterID) {
-        juce::ignoreUnused(parameterID);
+    int calculateDurationMs(int parameterIndex) const noexcept {
+        juce::ignoreUnused(parameterIndex);
         return 0; // Instantaneous for now
     }
 
@@ -378,14 +430,24 @@ private:
     // Member Variables
     //==========================================================================
 
-    /// Lock-free queue for parameter events
-    ParameterEventQueue queue;
+    /// Session identifier; event IDs are "<sessionID>-<sequence>"
+    const juce::String sessionID;
+
+    /// Next event sequence number
+    std::atomic<uint64_t> nextSequence{0};
+
+    /// Ring fed by the message thread
+    ParameterEventQueue messageThreadQueue;
+
+    /// Ring fed by the audio thread (and any other non-message thread)
+    ParameterEventQueue audioThreadQueue;
+
+    /// Claimed by a non-message producer while it pushes to audioThreadQueue
+    std::atomic<bool> audioQueueBusy{false};
 
-    /// Map of previous parameter values (for delta calculation)
-    juce::HashMap<juce::String, float> previousValues;
+    std::atomic<uint64_t> droppedEvents{0};
 
-    /// Spin lock for previous values map
-    juce::SpinLock previousValuesLock;
+    std::unique_ptr<WriterThread> writer;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterTelemetryRecorder)
 };
@@ -141,6 +141,40 @@ void AudioEngineUndo::cancelPendingChanges()
     pendingChanges.clear();
 }
 
+namespace
+{
+    // Parameter changes for one mix array. Shared subtrees are skipped by
+    // pointer, so the cost follows the number of edits, not the mix size.
+    void diffMixArray(
+        const PersistentArray<double>& before,
+        const PersistentArray<double>& after,
+        const juce::String& pathPrefix,
+        SongDiff& diff)
+    {
+        if (before.sharesStorageWith(after))
+        {
+            return;
+        }
+
+        auto addChange = [&](int index) {
+            ParameterChange paramChange;
+            paramChange.parameterPath = pathPrefix + juce::String(index);
+            paramChange.oldValue = before[index];
+            paramChange.newValue = after[index];
+            paramChange.smoothTime = 0.05; // 50ms, the engine default
+            diff.parameterChanges.add(paramChange);
+            return true;
+        };
+
+        PersistentArray<double>::forEachDifference(before, after, addChange);
+
+        for (int i = juce::jmin(before.size(), after.size()); i < juce::jmax(before.size(), after.size()); ++i)
+        {
+            addChange(i);
+        }
+    }
+}
+
 SongDiff AudioEngineUndo::computeDiff(
     const SongState& before,
     const SongState& after
@@ -148,6 +182,12 @@ SongDiff AudioEngineUndo::computeDiff(
 {
     SongDiff diff;
 
+    // Same version: nothing can differ
+    if (&before == &after)
+    {
+        return diff;
+    }
+
     // Check for performance changes
     if (before.activePerformanceId != after.activePerformanceId ||
         before.density != after.density ||
@@ -167,29 +207,32 @@ SongDiff AudioEngineUndo::computeDiff(
         diff.performanceChanges.add(perfChange);
     }
 
-    // Check for instrument changes (simplified)
-    // Full implementation would compare instrument arrays
-    if (before.instrumentIds.size() != after.instrumentIds.size())
+    // Check for instrument changes, one per role whose instrument differs.
+    // Untouched subtrees are shared between versions and skipped by pointer.
+    if (!before.instrumentIds.sharesStorageWith(after.instrumentIds))
     {
-        // Instrument count changed
-        InstrumentChange instChange;
-        instChange.role = "default";
-        instChange.oldInstrumentId = before.instrumentIds.isEmpty() ? "none" : before.instrumentIds[0];
-        instChange.newInstrumentId = after.instrumentIds.isEmpty() ? "none" : after.instrumentIds[0];
-
-        diff.instrumentChanges.add(instChange);
+        auto addChange = [&](int index) {
+            InstrumentChange instChange;
+            instChange.role = "role_" + juce::String(index);
+            instChange.oldInstrumentId = index < before.instrumentIds.size() ? before.instrumentIds[index] : "none";
+            instChange.newInstrumentId = index < after.instrumentIds.size() ? after.instrumentIds[index] : "none";
+            diff.instrumentChanges.add(instChange);
+            return true;
+        };
+
+        PersistentArray<juce::String>::forEachDifference(before.instrumentIds, after.instrumentIds, addChange);
+
+        const int numBefore = before.instrumentIds.size();
+        const int numAfter = after.instrumentIds.size();
+        for (int i = juce::jmin(numBefore, numAfter); i < juce::jmax(numBefore, numAfter); ++i)
+        {
+            addChange(i);
+        }
     }
 
     // Check for parameter changes (mix gains/pans)
-    if (before.mixGains.size() != after.mixGains.size())
-    {
-        ParameterChange paramChange;
-        paramChange.parameterPath = "mix.gains";
-        paramChange.oldValue = before.mixGains.isEmpty() ? 0.0 : before.mixGains[0];
-        paramChange.newValue = after.mixGains.isEmpty() ? 0.0 : after.mixGains[0];
-
-        diff.parameterChanges.add(paramChange);
-    }
+    diffMixArray(before.mixGains, after.mixGains, "mix.gains.", diff);
+    diffMixArray(before.mixPans, after.mixPans, "mix.pans.", diff);
 
     return diff;
 }
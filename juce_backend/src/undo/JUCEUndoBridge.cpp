@@ -3,6 +3,8 @@
  */
 
 #include "undo/JUCEUndoBridge.h"
+#include <limits>
+#include <unordered_set>
 
 // ============================================================================
 // SongContractUndoableAction Implementation
@@ -63,30 +65,28 @@ bool SongContractUndoableAction::undo()
 
 int SongContractUndoableAction::getSizeInUnits()
 {
-    // Estimate size in bytes
-    int size = 0;
+    // Estimate size in bytes. The two states share every collection subtree
+    // the edit did not touch, so only storage the after state adds over the
+    // before state is charged to this step.
+    std::unordered_set<const void*> visited;
+    size_t size = 0;
 
     if (beforeState)
     {
-        size += beforeState->id.toUTF8().lengthInBytes();
-        size += beforeState->name.toUTF8().lengthInBytes();
-        size += beforeState->activePerformanceId.toUTF8().lengthInBytes();
-        size += sizeof(double) * 3; // tempo, density
-        size += sizeof(int) * 2; // time signature
+        beforeState->addUniqueStorageBytes(visited);
     }
 
     if (afterState)
     {
-        size += afterState->id.toUTF8().lengthInBytes();
-        size += afterState->name.toUTF8().lengthInBytes();
-        size += afterState->activePerformanceId.toUTF8().lengthInBytes();
-        size += sizeof(double) * 3;
-        size += sizeof(int) * 2;
+        size += afterState->addUniqueStorageBytes(visited);
+        size += afterState->id.getNumBytesAsUTF8();
+        size += afterState->name.getNumBytesAsUTF8();
+        size += afterState->activePerformanceId.getNumBytesAsUTF8();
     }
 
-    size += description.toUTF8().lengthInBytes();
+    size += description.getNumBytesAsUTF8();
 
-    return size;
+    return static_cast<int>(juce::jmin(size, static_cast<size_t>(std::numeric_limits<int>::max())));
 }
 
 juce::String SongContractUndoableAction::getDescription() const
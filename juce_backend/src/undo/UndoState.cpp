@@ -3,6 +3,7 @@
  */
 
 #include "undo/UndoState.h"
+#include <thread>
 
 // ============================================================================
 // SongState Implementation
@@ -18,20 +19,23 @@ SongState::SongState()
 
 std::shared_ptr<SongState> SongState::clone() const
 {
-    auto copy = std::make_shared<SongState>();
-    copy->id = id;
-    copy->name = name;
-    copy->tempo = tempo;
-    copy->timeSignatureNumerator = timeSignatureNumerator;
-    copy->timeSignatureDenominator = timeSignatureDenominator;
-    copy->activePerformanceId = activePerformanceId;
-    copy->density = density;
-    copy->grooveProfileId = grooveProfileId;
-    copy->consoleXProfileId = consoleXProfileId;
-    copy->instrumentIds = juce::StringArray(instrumentIds);
-    copy->mixGains = juce::Array<double>(mixGains);
-    copy->mixPans = juce::Array<double>(mixPans);
-    return copy;
+    // Member-wise copy: Strings share their buffers and collections share
+    // their tries until one side edits
+    return std::make_shared<SongState>(*this);
+}
+
+size_t SongState::addUniqueStorageBytes(std::unordered_set<const void*>& visited) const
+{
+    if (!visited.insert(this).second)
+    {
+        return 0;
+    }
+
+    return sizeof(SongState)
+         + instrumentIds.addUniqueStorageBytes(visited)
+         + mixGains.addUniqueStorageBytes(visited)
+         + mixPans.addUniqueStorageBytes(visited)
+         + rhythmSystems.addUniqueStorageBytes(visited);
 }
 
 bool SongState::isValid() const
@@ -59,33 +63,26 @@ bool SongContract::isValid() const
 
 UndoState::UndoState()
 {
-    // Initialize with empty state
-    auto initialState = std::make_shared<SongState>();
-    auto statePtr = new std::shared_ptr<SongState>(initialState);
-    atomicState.store(statePtr, std::memory_order_release);
+    // Initialize with empty state in slot 0
+    versionSlots[0].state = std::make_shared<SongState>();
+    versionSlots[0].status = VersionSlot::Status::Current;
+    currentVersion.store(0, std::memory_order_release);
 }
 
 UndoState::~UndoState()
 {
-    // Clean up atomic state
-    auto statePtr = atomicState.load(std::memory_order_acquire);
-    if (statePtr != nullptr)
+    // No readers may outlive the owner, so every slot can be released
+    for (auto& slot : versionSlots)
     {
-        delete statePtr;
-        atomicState.store(nullptr, std::memory_order_release);
+        slot.state.reset();
     }
 }
 
 std::shared_ptr<SongState> UndoState::snapshot()
 {
-    // Lock-free atomic read (audio thread safe)
-    auto statePtr = atomicState.load(std::memory_order_acquire);
-    if (statePtr != nullptr)
-    {
-        // Clone the state for a snapshot
-        return (*statePtr)->clone();
-    }
-    return std::make_shared<SongState>();
+    // Wait-free read; the clone shares all collections with the current state
+    ScopedRead current(*this);
+    return current->clone();
 }
 
 bool UndoState::restore(std::shared_ptr<SongState> state)
@@ -106,13 +103,11 @@ bool UndoState::restore(std::shared_ptr<SongState> state)
 
 std::shared_ptr<SongState> UndoState::getCurrentState() const
 {
-    // Lock-free atomic read (audio thread safe, NEVER blocks)
-    auto statePtr = atomicState.load(std::memory_order_acquire);
-    if (statePtr != nullptr)
-    {
-        return *statePtr;
-    }
-    return std::make_shared<SongState>();
+    // Wait-free: one fetch_add to pin the version, one to unpin it
+    const int slot = enterRead();
+    auto state = versionSlots[(size_t) slot].state;
+    exitRead(slot);
+    return state;
 }
 
 void UndoState::setCurrentState(std::shared_ptr<SongState> state)
@@ -131,9 +126,9 @@ void UndoState::setCurrentState(std::shared_ptr<SongState> state)
 
 bool UndoState::hasValidState() const
 {
-    // Lock-free atomic check
-    auto statePtr = atomicState.load(std::memory_order_acquire);
-    return statePtr != nullptr && (*statePtr)->isValid();
+    // Wait-free check
+    ScopedRead current(*this);
+    return current->isValid();
 }
 
 void UndoState::clear()
@@ -176,16 +171,90 @@ SongContract UndoState::toContract(const SongState& state)
 
 void UndoState::updateAtomicState(std::shared_ptr<SongState> state)
 {
-    // Delete old state pointer and create new one
-    auto oldStatePtr = atomicState.load(std::memory_order_acquire);
-    auto newStatePtr = new std::shared_ptr<SongState>(state);
-    atomicState.store(newStatePtr, std::memory_order_release);
+    // Find a free slot for the new version. Readers only pin a version for a
+    // few instructions, so a slot frees up almost immediately if all are busy.
+    int freeSlot = -1;
+    while (freeSlot < 0)
+    {
+        if (reclaimRetiredVersions() == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (int i = 0; i < numVersionSlots; ++i)
+        {
+            if (versionSlots[(size_t) i].status == VersionSlot::Status::Free)
+            {
+                freeSlot = i;
+                break;
+            }
+        }
+    }
+
+    auto& next = versionSlots[(size_t) freeSlot];
+    next.state = std::move(state);
+    next.departures.store(0, std::memory_order_relaxed);
+    next.status = VersionSlot::Status::Current;
+
+    // Publish; the old word tells us how many readers entered the old version
+    const uint64_t previous = currentVersion.exchange(
+        static_cast<uint64_t>(freeSlot) << versionSlotShift, std::memory_order_acq_rel);
+
+    auto& retired = versionSlots[(size_t) (previous >> versionSlotShift)];
+    retired.arrivals = previous & arrivalMask;
+    retired.status = VersionSlot::Status::Retired;
+
+    // Usually no reader is inside the old version and it goes right away
+    reclaimRetiredVersions();
+}
+
+int UndoState::reclaimRetiredVersions()
+{
+    int numFree = 0;
 
-    // Clean up old pointer (safe to delete after store)
-    if (oldStatePtr != nullptr)
+    for (auto& slot : versionSlots)
     {
-        // Schedule for deletion (not immediate to avoid races)
-        // In practice, shared_ptr handles the actual object deletion
-        delete oldStatePtr;
+        if (slot.status == VersionSlot::Status::Retired
+            && slot.departures.load(std::memory_order_acquire) == slot.arrivals)
+        {
+            // Released here, on the writer's thread, never on the audio thread
+            slot.state.reset();
+            slot.status = VersionSlot::Status::Free;
+        }
+
+        if (slot.status == VersionSlot::Status::Free)
+        {
+            ++numFree;
+        }
     }
+
+    return numFree;
+}
+
+int UndoState::enterRead() const noexcept
+{
+    const uint64_t version = currentVersion.fetch_add(1, std::memory_order_acquire);
+    return static_cast<int>(version >> versionSlotShift);
+}
+
+void UndoState::exitRead(int slot) const noexcept
+{
+    versionSlots[(size_t) slot].departures.fetch_add(1, std::memory_order_release);
+}
+
+// ============================================================================
+// UndoState::ScopedRead Implementation
+// ============================================================================
+
+UndoState::ScopedRead::ScopedRead(const UndoState& undoState) noexcept
+    : owner(undoState)
+    , slot(undoState.enterRead())
+    , state(undoState.versionSlots[(size_t) slot].state.get())
+{
+}
+
+UndoState::ScopedRead::~ScopedRead() noexcept
+{
+    owner.exitRead(slot);
 }
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
@@ -320,4 +324,147 @@ TEST_F(CoreDSPAnalyzerTests, JSONOutputFormatValidation) {
         << "JSON should contain sample rate";
     EXPECT_TRUE(results.contains("\"bufferSize\""))
         << "JSON should contain buffer size";
-}
\ No newline at end of file
+}
+
+// Streaming STFT: feeds audio through process() in arbitrary chunks
+namespace {
+
+std::vector<float> makeNoise(int numSamples, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> samples(static_cast<size_t>(numSamples));
+    for (auto& s : samples) s = dist(rng);
+    return samples;
+}
+
+void streamInChunks(CoreDSPAnalyzer& analyzer, const std::vector<float>& samples, int chunkSize) {
+    for (size_t pos = 0; pos < samples.size(); pos += static_cast<size_t>(chunkSize)) {
+        const float* channel = samples.data() + pos;
+        const int n = static_cast<int>(std::min(samples.size() - pos, static_cast<size_t>(chunkSize)));
+        analyzer.process(&channel, 1, n);
+    }
+}
+
+} // namespace
+
+// Test 13: One frame per hop once the first window is full
+TEST_F(CoreDSPAnalyzerTests, StreamingEmitsFrameEveryHop) {
+    CoreDSPAnalyzer analyzer;
+    ASSERT_TRUE(analyzer.initialize(48000.0, std::vector<int>{ 1024 }, 2));
+    EXPECT_EQ(analyzer.getHopSize(0), 512);
+
+    std::vector<double> times;
+    analyzer.setFrameCallback([&](int resolution, const CoreDSPAnalyzer::FrameDescriptors& frame) {
+        EXPECT_EQ(resolution, 0);
+        times.push_back(frame.time);
+    });
+
+    streamInChunks(analyzer, makeNoise(48000, 1), 333);
+
+    ASSERT_EQ(times.size(), static_cast<size_t>(1 + (48000 - 1024) / 512));
+    EXPECT_EQ(analyzer.getAggregate().numFrames, static_cast<int64_t>(times.size()));
+    for (size_t i = 0; i < times.size(); ++i) {
+        EXPECT_NEAR(times[i], (512.0 + 512.0 * static_cast<double>(i)) / 48000.0, 1e-9);
+    }
+}
+
+// Test 14: Descriptors of a steady sine sit on the tone
+TEST_F(CoreDSPAnalyzerTests, SineDescriptorsMatchTone) {
+    constexpr double sampleRate = 48000.0;
+    constexpr int frameSize = 4096;
+    const double binWidth = sampleRate / frameSize;
+    const double frequency = 100.0 * binWidth;
+
+    CoreDSPAnalyzer analyzer;
+    ASSERT_TRUE(analyzer.initialize(sampleRate, std::vector<int>{ frameSize }, 4));
+
+    std::vector<float> sine(48000);
+    for (size_t i = 0; i < sine.size(); ++i)
+        sine[i] = 0.5f * static_cast<float>(std::sin(2.0 * juce::MathConstants<double>::pi * frequency * static_cast<double>(i) / sampleRate));
+    streamInChunks(analyzer, sine, 480);
+
+    const auto& frame = analyzer.getLatestFrame();
+    EXPECT_NEAR(frame.spectralCentroid, frequency, binWidth);
+    EXPECT_NEAR(frame.spectralRolloff, frequency, binWidth * 1.01);
+    EXPECT_LT(frame.spectralFlatness, 0.05f);
+    EXPECT_LT(frame.spectralFlux, 1e-3f);
+    for (int band = 1; band < CoreDSPAnalyzer::kNumBands; ++band)
+        EXPECT_LT(frame.bandEnergies[static_cast<size_t>(band)], 1e-3f * frame.bandEnergies[0]);
+
+    // Noise is far flatter than a tone
+    CoreDSPAnalyzer noiseAnalyzer;
+    ASSERT_TRUE(noiseAnalyzer.initialize(sampleRate, std::vector<int>{ frameSize }, 4));
+    streamInChunks(noiseAnalyzer, makeNoise(48000, 2), 480);
+    EXPECT_GT(noiseAnalyzer.getAggregate().mean.spectralFlatness, 0.5f);
+}
+
+// Test 15: Results do not depend on how the stream is chunked
+TEST_F(CoreDSPAnalyzerTests, ResultsIndependentOfChunkSize) {
+    const auto noise = makeNoise(30000, 3);
+
+    CoreDSPAnalyzer reference;
+    ASSERT_TRUE(reference.initialize(44100.0, std::vector<int>{ 512, 2048 }, 2));
+    streamInChunks(reference, noise, static_cast<int>(noise.size()));
+
+    for (int chunkSize : { 1, 37, 512, 4096 }) {
+        CoreDSPAnalyzer analyzer;
+        ASSERT_TRUE(analyzer.initialize(44100.0, std::vector<int>{ 512, 2048 }, 2));
+        streamInChunks(analyzer, noise, chunkSize);
+
+        for (int r = 0; r < 2; ++r) {
+            const auto& expected = reference.getAggregate(r);
+            const auto& actual = analyzer.getAggregate(r);
+            EXPECT_EQ(actual.numFrames, expected.numFrames);
+            EXPECT_EQ(actual.mean.spectralCentroid, expected.mean.spectralCentroid);
+            EXPECT_EQ(actual.mean.spectralFlux, expected.mean.spectralFlux);
+            EXPECT_EQ(actual.peak.spectralRolloff, expected.peak.spectralRolloff);
+            EXPECT_EQ(actual.mean.bandEnergies, expected.mean.bandEnergies);
+        }
+    }
+}
+
+// Test 16: Each resolution keeps its own hop and frame count
+TEST_F(CoreDSPAnalyzerTests, MultiResolutionFrameCounts) {
+    CoreDSPAnalyzer analyzer;
+    ASSERT_TRUE(analyzer.initialize(48000.0, std::vector<int>{ 256, 2048, 8192 }, 4));
+    ASSERT_EQ(analyzer.getNumResolutions(), 3);
+
+    std::vector<int> counts(3, 0);
+    analyzer.setFrameCallback([&](int resolution, const CoreDSPAnalyzer::FrameDescriptors&) {
+        ++counts[static_cast<size_t>(resolution)];
+    });
+
+    constexpr int numSamples = 48000;
+    streamInChunks(analyzer, makeNoise(numSamples, 4), 1000);
+
+    for (int r = 0; r < 3; ++r) {
+        const int frameSize = analyzer.getFrameSize(r);
+        const int hopSize = analyzer.getHopSize(r);
+        EXPECT_EQ(hopSize, frameSize / 4);
+        EXPECT_EQ(counts[static_cast<size_t>(r)], 1 + (numSamples - frameSize) / hopSize);
+    }
+
+    EXPECT_FALSE(analyzer.initialize(48000.0, std::vector<int>{ 256, 1000 }, 2))
+        << "Every frame size must be a power of 2";
+    EXPECT_FALSE(analyzer.initialize(48000.0, std::vector<int>{}, 2));
+}
+
+// Test 17: Throughput of a three-resolution analysis (target: over 200x real time)
+TEST_F(CoreDSPAnalyzerTests, BenchmarkStreamingThroughput) {
+    constexpr double sampleRate = 48000.0;
+    constexpr int numSamples = 48000 * 30;
+    const auto noise = makeNoise(numSamples, 5);
+
+    CoreDSPAnalyzer analyzer;
+    ASSERT_TRUE(analyzer.initialize(sampleRate, std::vector<int>{ 512, 2048, 8192 }, 2));
+
+    const auto start = std::chrono::steady_clock::now();
+    streamInChunks(analyzer, noise, 4096);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_GT(analyzer.getAggregate(0).numFrames, 0);
+
+    std::printf("\n=== CoreDSPAnalyzer, STFT at 512/2048/8192, 50%% overlap ===\n");
+    std::printf("  %.1f ns/sample, %.0fx real time\n",
+                1e9 * seconds / numSamples, (numSamples / sampleRate) / seconds);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../../include/audio/PolyphaseResampler.h"
+
+using namespace SchillingerEcosystem::Audio;
+
+/**
+ * PolyphaseResampler tests
+ *
+ * Checks that in-band tones come through at the right instants, that
+ * out-of-band tones are rejected at each quality, that block size does not
+ * change the output, the number of samples produced over a long stream, and
+ * the cost of a 44.1 kHz -> 48 kHz device mismatch.
+ */
+class PolyphaseResamplerTests : public ::testing::Test {
+protected:
+    static constexpr double pi = 3.14159265358979323846;
+
+    static std::vector<float> makeSine(double frequency, double sampleRate, int numSamples) {
+        std::vector<float> samples(static_cast<size_t>(numSamples));
+        for (int i = 0; i < numSamples; ++i)
+            samples[static_cast<size_t>(i)] = static_cast<float>(0.5 * std::sin(2.0 * pi * frequency * i / sampleRate));
+        return samples;
+    }
+
+    static std::vector<float> resample(PolyphaseResampler& resampler, const std::vector<float>& input, int blockSize) {
+        std::vector<float> output;
+        std::vector<float> block(static_cast<size_t>(resampler.getMaxOutputSamples(blockSize)));
+
+        for (size_t pos = 0; pos < input.size(); pos += static_cast<size_t>(blockSize)) {
+            const int n = static_cast<int>(std::min(input.size() - pos, static_cast<size_t>(blockSize)));
+            const int produced = resampler.process(input.data() + pos, n, block.data(), static_cast<int>(block.size()));
+            output.insert(output.end(), block.begin(), block.begin() + produced);
+        }
+        return output;
+    }
+
+    static double rms(const std::vector<float>& samples, size_t start) {
+        double sum = 0.0;
+        for (size_t i = start; i < samples.size(); ++i)
+            sum += static_cast<double>(samples[i]) * samples[i];
+        return std::sqrt(sum / static_cast<double>(samples.size() - start));
+    }
+};
+
+TEST_F(PolyphaseResamplerTests, InBandSineLandsOnOutputInstants) {
+    constexpr double inputRate = 44100.0;
+    constexpr double outputRate = 48000.0;
+    constexpr double frequency = 1000.0;
+
+    for (auto quality : { PolyphaseResampler::Quality::Low, PolyphaseResampler::Quality::Medium, PolyphaseResampler::Quality::High }) {
+        PolyphaseResampler resampler;
+        ASSERT_TRUE(resampler.prepare(inputRate, outputRate, 512, quality));
+
+        const auto output = resample(resampler, makeSine(frequency, inputRate, 44100), 512);
+
+        // Output sample k sits at input time k * inputRate / outputRate
+        double maxError = 0.0;
+        for (size_t k = 200; k < output.size(); ++k) {
+            const double expected = 0.5 * std::sin(2.0 * pi * frequency * static_cast<double>(k) / outputRate);
+            maxError = std::max(maxError, std::abs(output[k] - expected));
+        }
+        EXPECT_LT(maxError, 2e-3) << "quality " << static_cast<int>(quality);
+    }
+}
+
+TEST_F(PolyphaseResamplerTests, RejectsTonesAboveOutputNyquist) {
+    constexpr double inputRate = 48000.0;
+    constexpr double outputRate = 32000.0;
+
+    // 20 kHz would alias to 12 kHz at 32 kHz without band-limiting
+    const auto tone = makeSine(20000.0, inputRate, 48000);
+    const double inputLevel = 0.5 / std::sqrt(2.0);
+
+    const std::pair<PolyphaseResampler::Quality, double> limits[] = {
+        { PolyphaseResampler::Quality::Low, -40.0 },
+        { PolyphaseResampler::Quality::Medium, -60.0 },
+        { PolyphaseResampler::Quality::High, -80.0 },
+    };
+
+    for (const auto& [quality, limitDb] : limits) {
+        PolyphaseResampler resampler;
+        ASSERT_TRUE(resampler.prepare(inputRate, outputRate, 1024, quality));
+
+        const auto output = resample(resampler, tone, 1024);
+        const double levelDb = 20.0 * std::log10(rms(output, 512) / inputLevel + 1e-12);
+        EXPECT_LT(levelDb, limitDb) << "quality " << static_cast<int>(quality);
+        std::printf("  quality %d: %d taps, alias at %.1f dB\n",
+                    static_cast<int>(quality), resampler.getNumTaps(), levelDb);
+    }
+}
+
+TEST_F(PolyphaseResamplerTests, OutputIndependentOfBlockSize) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> noise(20000);
+    for (auto& s : noise) s = dist(rng);
+
+    PolyphaseResampler reference;
+    ASSERT_TRUE(reference.prepare(48000.0, 44100.0, 20000));
+    const auto expected = resample(reference, noise, 20000);
+
+    for (int blockSize : { 1, 7, 64, 333 }) {
+        PolyphaseResampler resampler;
+        ASSERT_TRUE(resampler.prepare(48000.0, 44100.0, blockSize));
+        const auto output = resample(resampler, noise, blockSize);
+        EXPECT_EQ(output, expected) << "block size " << blockSize;
+    }
+}
+
+TEST_F(PolyphaseResamplerTests, ProducesOutputAtTheConversionRatio) {
+    PolyphaseResampler resampler;
+    ASSERT_TRUE(resampler.prepare(44100.0, 96000.0, 256, PolyphaseResampler::Quality::Medium));
+
+    constexpr int numInput = 44100 * 5;
+    const auto output = resample(resampler, std::vector<float>(numInput, 0.25f), 256);
+
+    // Everything except the last latency samples of input has been converted
+    const double expected = (numInput - resampler.getLatencyInputSamples()) * 96000.0 / 44100.0;
+    EXPECT_NEAR(static_cast<double>(output.size()), expected, 2.0);
+
+    // Unity gain at DC once the kernel is past the start
+    EXPECT_NEAR(output.back(), 0.25f, 1e-5f);
+
+    EXPECT_FALSE(resampler.prepare(44100.0, 44100.0 * 9.0, 256));
+    EXPECT_FALSE(resampler.prepare(0.0, 48000.0, 256));
+}
+
+TEST_F(PolyphaseResamplerTests, Benchmark44k1To48kDeviceMismatch) {
+    constexpr double inputRate = 44100.0;
+    constexpr double outputRate = 48000.0;
+    constexpr int blockSize = 441;
+    constexpr int numBlocks = 2000;
+
+    const auto input = makeSine(440.0, inputRate, blockSize * numBlocks);
+
+    for (auto quality : { PolyphaseResampler::Quality::Low, PolyphaseResampler::Quality::Medium, PolyphaseResampler::Quality::High }) {
+        PolyphaseResampler resampler;
+        ASSERT_TRUE(resampler.prepare(inputRate, outputRate, blockSize, quality));
+        std::vector<float> output(static_cast<size_t>(resampler.getMaxOutputSamples(blockSize)));
+
+        double seconds = 0.0;
+        long produced = 0;
+        for (int b = 0; b < numBlocks; ++b) {
+            const auto start = std::chrono::steady_clock::now();
+            produced += resampler.process(input.data() + b * blockSize, blockSize, output.data(), static_cast<int>(output.size()));
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        EXPECT_GT(produced, 0);
+
+        std::printf("\n=== PolyphaseResampler, 44.1 -> 48 kHz, quality %d (%d taps) ===\n",
+                    static_cast<int>(quality), resampler.getNumTaps());
+        std::printf("  %.1f ns/output sample, %.3f%% of real time\n",
+                    1e9 * seconds / static_cast<double>(produced),
+                    100.0 * seconds / (numBlocks * blockSize / inputRate));
+    }
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_core/juce_core.h>
+#include "../../include/audio/PitchDetector.h"
+#include "../../include/audio/YinPitchTracker.h"
+
+/**
+ * YinPitchTracker accuracy and speed tests
+ *
+ * Compares the streaming FFT-YIN tracker against PitchDetector on guitar-range
+ * test signals (pure sines and harmonic plucks) and reports per-channel CPU.
+ */
+class YinPitchTrackerTests : public ::testing::Test {
+protected:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 128;
+
+    // Harmonic pluck-like tone: 1/h amplitudes with a slow decay
+    static std::vector<float> makeTone(double frequency, int numSamples, bool harmonic) {
+        std::vector<float> samples(static_cast<size_t>(numSamples));
+        const double twoPi = juce::MathConstants<double>::twoPi;
+
+        for (int i = 0; i < numSamples; ++i) {
+            const double t = i / sampleRate;
+            double value = std::sin(twoPi * frequency * t);
+
+            if (harmonic) {
+                for (int h = 2; h <= 6; ++h) {
+                    value += std::sin(twoPi * frequency * h * t) / h;
+                }
+                value *= 0.4 * std::exp(-1.5 * t);
+            } else {
+                value *= 0.5;
+            }
+
+            samples[static_cast<size_t>(i)] = static_cast<float>(value);
+        }
+
+        return samples;
+    }
+
+    static double centsBetween(double a, double b) {
+        return 1200.0 * std::log2(a / b);
+    }
+
+    // Guitar standard tuning open strings plus fretted notes up to ~1.3 kHz
+    const std::vector<double> testFrequencies { 82.41, 110.0, 146.83, 196.0, 246.94,
+                                                329.63, 440.0, 659.26, 987.77, 1318.51 };
+};
+
+TEST_F(YinPitchTrackerTests, TracksGuitarRangeWithinFiveCents) {
+    YinPitchTracker tracker;
+    ASSERT_TRUE(tracker.prepare(sampleRate, 1));
+
+    for (double frequency : testFrequencies) {
+        for (bool harmonic : { false, true }) {
+            tracker.reset();
+            const auto tone = makeTone(frequency, 16384, harmonic);
+
+            for (size_t pos = 0; pos + blockSize <= tone.size(); pos += blockSize) {
+                tracker.process(0, tone.data() + pos, blockSize);
+            }
+
+            const auto frame = tracker.getLatestFrame(0);
+            ASSERT_TRUE(frame.isPitched) << frequency << " Hz";
+            EXPECT_LT(std::abs(centsBetween(frame.frequency, frequency)), 5.0)
+                << frequency << " Hz detected as " << frame.frequency;
+            EXPECT_GT(frame.confidence, 0.8);
+        }
+    }
+}
+
+TEST_F(YinPitchTrackerTests, SilenceIsUnpitched) {
+    YinPitchTracker tracker;
+    ASSERT_TRUE(tracker.prepare(sampleRate, 1));
+
+    std::vector<float> silence(8192, 0.0f);
+    tracker.process(0, silence.data(), static_cast<int>(silence.size()));
+
+    EXPECT_FALSE(tracker.getLatestFrame(0).isPitched);
+}
+
+TEST_F(YinPitchTrackerTests, ChannelsAreIndependent) {
+    YinPitchTracker tracker;
+    ASSERT_TRUE(tracker.prepare(sampleRate, 2));
+
+    const auto low = makeTone(110.0, 8192, true);
+    const auto high = makeTone(659.26, 8192, true);
+
+    for (size_t pos = 0; pos + blockSize <= low.size(); pos += blockSize) {
+        tracker.process(0, low.data() + pos, blockSize);
+        tracker.process(1, high.data() + pos, blockSize);
+    }
+
+    EXPECT_NEAR(tracker.getLatestFrame(0).frequency, 110.0, 1.0);
+    EXPECT_NEAR(tracker.getLatestFrame(1).frequency, 659.26, 3.0);
+}
+
+TEST_F(YinPitchTrackerTests, ReportsLatencyAndCpuPerChannel) {
+    YinPitchTracker tracker;
+    ASSERT_TRUE(tracker.prepare(sampleRate, 1));
+
+    const auto tone = makeTone(196.0, 8192, true);
+    tracker.process(0, tone.data(), static_cast<int>(tone.size()));
+
+    const auto stats = tracker.getChannelStats(0);
+    EXPECT_NEAR(stats.latencyMs, 1000.0 * tracker.getLatencySamples() / sampleRate, 1e-9);
+    EXPECT_GT(stats.framesAnalysed, 0);
+    EXPECT_GT(stats.lastFrameMicros, 0.0);
+
+    std::printf("  window %d, hop %d, latency %.2f ms, cpu/channel %.3f%%\n",
+                tracker.getWindowSize(), tracker.getHopSize(), stats.latencyMs,
+                100.0 * stats.cpuLoad);
+}
+
+TEST_F(YinPitchTrackerTests, BenchmarkAgainstPitchDetector) {
+    constexpr int analysisSize = 4096;
+    constexpr int iterations = 50;
+
+    PitchDetector detector;
+    ASSERT_TRUE(detector.initialize(sampleRate, analysisSize));
+
+    YinPitchTracker tracker;
+    YinPitchTracker::Config config;
+    config.minFrequency = 80.0;
+    config.maxFrequency = 4000.0;
+    config.hopSize = analysisSize;   // One estimate per block, like PitchDetector
+    ASSERT_TRUE(tracker.prepare(sampleRate, 1, config));
+
+    double detectorSeconds = 0.0;
+    double trackerSeconds = 0.0;
+    double detectorErrorCents = 0.0;
+    double trackerErrorCents = 0.0;
+    int detectorHits = 0;
+    int trackerHits = 0;
+
+    juce::AudioBuffer<float> block(1, analysisSize);
+
+    for (double frequency : testFrequencies) {
+        const auto tone = makeTone(frequency, analysisSize, true);
+        std::copy(tone.begin(), tone.end(), block.getWritePointer(0));
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            detector.processBlock(block);
+        }
+        detectorSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const auto detected = detector.getLatestPitchResult();
+        if (detected.isPitched) {
+            detectorErrorCents += std::abs(centsBetween(detected.frequency, frequency));
+            ++detectorHits;
+        }
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            tracker.process(0, tone.data(), analysisSize);
+        }
+        trackerSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const auto frame = tracker.getLatestFrame(0);
+        if (frame.isPitched) {
+            trackerErrorCents += std::abs(centsBetween(frame.frequency, frequency));
+            ++trackerHits;
+        }
+    }
+
+    const int runs = iterations * static_cast<int>(testFrequencies.size());
+    std::printf("\n=== Pitch detection: PitchDetector vs YinPitchTracker (%d-sample frames) ===\n",
+                analysisSize);
+    std::printf("  PitchDetector   : %8.1f us/frame, %2d/%zu pitched, mean error %7.2f cents\n",
+                1e6 * detectorSeconds / runs, detectorHits, testFrequencies.size(),
+                detectorHits > 0 ? detectorErrorCents / detectorHits : 0.0);
+    std::printf("  YinPitchTracker : %8.1f us/frame, %2d/%zu pitched, mean error %7.2f cents\n",
+                1e6 * trackerSeconds / runs, trackerHits, testFrequencies.size(),
+                trackerHits > 0 ? trackerErrorCents / trackerHits : 0.0);
+
+    EXPECT_EQ(trackerHits, static_cast<int>(testFrequencies.size()));
+    EXPECT_LT(trackerErrorCents / std::max(1, trackerHits), 5.0);
+}
@@ -0,0 +1,280 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "../../include/dynamics/ChunkedProcessing.h"
+#include "../../include/dynamics/StatsSnapshot.h"
+
+using namespace schill::dynamics;
+
+/**
+ * DynamicsEffectsChain real-time primitives
+ *
+ * Checks that the StatsSnapshot seqlock never hands a reader a torn value
+ * while the audio thread and a control thread publish, and that a slot-like
+ * processor run through forEachChunk in prepared-size views produces the
+ * same output as one pass over the whole block.
+ */
+
+//==============================================================================
+// StatsSnapshot
+//==============================================================================
+
+namespace {
+
+// Every field carries the same stamp, so a torn copy shows up as a mismatch
+struct Stamped {
+    std::array<uint64_t, 16> fields;
+
+    static Stamped make(uint64_t stamp) {
+        Stamped s;
+        s.fields.fill(stamp);
+        return s;
+    }
+
+    bool isConsistent() const {
+        for (uint64_t field : fields)
+            if (field != fields[0])
+                return false;
+        return true;
+    }
+};
+
+} // namespace
+
+// Enough reads that the writer is preempted mid-copy many times, even on one core
+constexpr int64_t numReads = 1000000;
+
+TEST(StatsSnapshotTests, ReaderNeverSeesTornSnapshot) {
+    StatsSnapshot<Stamped> snapshot;
+    std::atomic<bool> stop{false};
+    uint64_t lastPublished = 0;
+
+    std::thread writer([&] {
+        while (!stop.load(std::memory_order_acquire))
+            snapshot.publish(Stamped::make(++lastPublished), false);
+    });
+
+    int64_t torn = 0;
+    int64_t backwards = 0;
+    uint64_t last = 0;
+
+    for (int64_t i = 0; i < numReads; ++i) {
+        const Stamped value = snapshot.read();
+        if (!value.isConsistent())
+            ++torn;
+        if (value.fields[0] < last)
+            ++backwards;
+        last = value.fields[0];
+    }
+
+    stop.store(true, std::memory_order_release);
+    writer.join();
+
+    EXPECT_EQ(torn, 0);
+    EXPECT_EQ(backwards, 0);
+    EXPECT_EQ(snapshot.read().fields[0], lastPublished);
+}
+
+TEST(StatsSnapshotTests, ControlWriterAlwaysPublishesAlongsideAudioWriter) {
+    StatsSnapshot<Stamped> snapshot;
+    std::atomic<bool> stop{false};
+
+    // Audio thread: odd stamps, drops a publication rather than wait
+    std::thread audio([&] {
+        for (uint64_t stamp = 1; !stop.load(std::memory_order_acquire); stamp += 2)
+            snapshot.publish(Stamped::make(stamp), false);
+    });
+
+    // Control thread (resetStats): even stamps, waits for the audio writer
+    int64_t controlAttempts = 0;
+    int64_t controlPublished = 0;
+    std::thread control([&] {
+        for (uint64_t stamp = 0; !stop.load(std::memory_order_acquire); stamp += 2) {
+            ++controlAttempts;
+            controlPublished += snapshot.publish(Stamped::make(stamp), true) ? 1 : 0;
+        }
+    });
+
+    int64_t torn = 0;
+    for (int64_t i = 0; i < numReads; ++i)
+        torn += snapshot.read().isConsistent() ? 0 : 1;
+
+    stop.store(true, std::memory_order_release);
+    audio.join();
+    control.join();
+
+    EXPECT_EQ(torn, 0);
+    EXPECT_GT(controlAttempts, 0);
+    EXPECT_EQ(controlPublished, controlAttempts);
+    EXPECT_TRUE(snapshot.read().isConsistent());
+}
+
+//==============================================================================
+// Chunked processing
+//==============================================================================
+
+namespace {
+
+// Stand-in for juce::AudioBuffer<float>'s referencing constructor
+class ViewBuffer {
+public:
+    static constexpr int maxChannels = 8;
+
+    ViewBuffer(float* const* data, int channels, int startSample, int samples)
+        : numChannels(channels), numSamples(samples) {
+        for (int ch = 0; ch < channels; ++ch)
+            pointers[static_cast<size_t>(ch)] = data[ch] + startSample;
+    }
+
+    float* const* getArrayOfWritePointers() { return pointers.data(); }
+    float* getWritePointer(int channel) { return pointers[static_cast<size_t>(channel)]; }
+    int getNumChannels() const { return numChannels; }
+    int getNumSamples() const { return numSamples; }
+
+private:
+    std::array<float*, maxChannels> pointers{};
+    int numChannels = 0;
+    int numSamples = 0;
+};
+
+// A linear per-sample ramp, standing in for juce::SmoothedValue
+struct Ramp {
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    int remaining = 0;
+
+    void setTarget(float newTarget, int rampSamples) {
+        target = newTarget;
+        remaining = rampSamples;
+        step = (target - current) / static_cast<float>(rampSamples);
+    }
+
+    float getNextValue() {
+        if (remaining > 0) {
+            current = --remaining == 0 ? target : current + step;
+        }
+        return current;
+    }
+};
+
+// Mirrors ChainSlot::processChunk: dry copy into prepared scratch, a stateful
+// effect, a ramped wet/dry mix and a ramped output gain
+class SlotModel {
+public:
+    explicit SlotModel(int preparedBlockSize)
+        : dry(2, std::vector<float>(static_cast<size_t>(preparedBlockSize))) {
+        wetMix.current = 0.25f;
+        wetMix.setTarget(0.9f, 700);
+        gain.current = 1.0f;
+        gain.setTarget(0.5f, 300);
+    }
+
+    void process(ViewBuffer& buffer) {
+        const int numSamples = buffer.getNumSamples();
+        if (numSamples > static_cast<int>(dry[0].size())) {
+            overflowed = true;
+            return;
+        }
+
+        for (int ch = 0; ch < 2; ++ch) {
+            float* data = buffer.getWritePointer(ch);
+            std::copy(data, data + numSamples, dry[static_cast<size_t>(ch)].begin());
+
+            for (int i = 0; i < numSamples; ++i) {
+                state[ch] += 0.05f * (data[i] - state[ch]);
+                data[i] = state[ch];
+            }
+        }
+
+        for (int i = 0; i < numSamples; ++i) {
+            const float mix = wetMix.getNextValue();
+            const float g = gain.getNextValue();
+            for (int ch = 0; ch < 2; ++ch) {
+                float& sample = buffer.getWritePointer(ch)[i];
+                const float drySample = dry[static_cast<size_t>(ch)][static_cast<size_t>(i)];
+                sample = g * (drySample + mix * (sample - drySample));
+            }
+        }
+    }
+
+    bool overflowed = false;
+
+private:
+    std::vector<std::vector<float>> dry;
+    float state[2] = { 0.0f, 0.0f };
+    Ramp wetMix;
+    Ramp gain;
+};
+
+std::vector<std::vector<float>> makeInput(int numSamples) {
+    std::vector<std::vector<float>> channels(2, std::vector<float>(static_cast<size_t>(numSamples)));
+    uint32_t seed = 1u;
+    for (auto& channel : channels) {
+        for (auto& sample : channel) {
+            seed = seed * 1664525u + 1013904223u;
+            sample = static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * 2.0f - 1.0f;
+        }
+    }
+    return channels;
+}
+
+} // namespace
+
+TEST(ChunkedProcessingTests, ChunkedSlotMatchesWholeBlock) {
+    constexpr int preparedSize = 64;
+    const int hostBlocks[] = { 1000, 64, 63, 129, 512 };
+
+    SlotModel chunked(preparedSize);
+    SlotModel whole(1000);
+
+    for (int numSamples : hostBlocks) {
+        auto chunkedData = makeInput(numSamples);
+        auto wholeData = chunkedData;
+
+        float* chunkedChannels[] = { chunkedData[0].data(), chunkedData[1].data() };
+        float* wholeChannels[] = { wholeData[0].data(), wholeData[1].data() };
+        ViewBuffer chunkedBuffer(chunkedChannels, 2, 0, numSamples);
+        ViewBuffer wholeBuffer(wholeChannels, 2, 0, numSamples);
+
+        forEachChunk(chunkedBuffer, preparedSize, [&](ViewBuffer& chunk) { chunked.process(chunk); });
+        whole.process(wholeBuffer);
+
+        EXPECT_EQ(chunkedData, wholeData) << "host block " << numSamples;
+    }
+
+    EXPECT_FALSE(chunked.overflowed);
+    EXPECT_FALSE(whole.overflowed);
+}
+
+TEST(ChunkedProcessingTests, ViewsCoverBlockInOrderWithoutCopying) {
+    std::vector<float> left(1000), right(1000);
+    float* channels[] = { left.data(), right.data() };
+    ViewBuffer buffer(channels, 2, 0, 1000);
+
+    std::vector<std::pair<const float*, int>> views;
+    forEachChunk(buffer, 256, [&](ViewBuffer& chunk) {
+        EXPECT_EQ(chunk.getNumChannels(), 2);
+        EXPECT_EQ(chunk.getWritePointer(1) - right.data(), chunk.getWritePointer(0) - left.data());
+        views.emplace_back(chunk.getWritePointer(0), chunk.getNumSamples());
+    });
+
+    ASSERT_EQ(views.size(), 4u);
+    const float* expectedStart = left.data();
+    for (const auto& [start, length] : views) {
+        EXPECT_EQ(start, expectedStart);
+        EXPECT_LE(length, 256);
+        expectedStart += length;
+    }
+    EXPECT_EQ(expectedStart, left.data() + left.size());
+
+    // Blocks that fit, and unprepared scratch, are processed in one pass
+    int calls = 0;
+    forEachChunk(buffer, 1000, [&](ViewBuffer&) { ++calls; });
+    forEachChunk(buffer, 0, [&](ViewBuffer&) { ++calls; });
+    EXPECT_EQ(calls, 2);
+}
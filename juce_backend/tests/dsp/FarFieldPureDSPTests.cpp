@@ -0,0 +1,302 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "../../effects/farfaraway/include/FarFieldPureDSP.h"
+
+using namespace farfield;
+
+/**
+ * FarFieldPureDSP tests
+ *
+ * Checks the block-coefficient path against the per-sample formulas, that
+ * parameter jumps are smoothed, that the propagation delay produces the
+ * expected delay and Doppler pitch, that the SIMD scene matches independent
+ * FarField instances, and the cost of 64 moving sources.
+ */
+class FarFieldPureDSPTests : public ::testing::Test {
+protected:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 256;
+
+    // The per-sample distance chain, evaluated directly from the parameters
+    struct PerSampleReference {
+        FarFieldParams params;
+        float lastLeftIn = 0.0f;
+        float lastRightIn = 0.0f;
+
+        void process(float& left, float& right) {
+            float effectiveDistance = std::max(params.distance_m, 1.0f);
+            float distanceGain = 1.0f / (1.0f + 0.01f * effectiveDistance * effectiveDistance);
+            float distanceRatio = std::clamp((effectiveDistance - params.nearFade_m) /
+                                             std::max(0.1f, params.farFade_m - params.nearFade_m), 0.0f, 1.0f);
+            float fadeFactor = 0.5f * (1.0f - std::cos(distanceRatio * 3.14159265f));
+
+            float rc = 1.0f / (2.0f * 3.14159265f * 20000.0f * (1.0f - params.airAmount * 0.5f));
+            float dt = 1.0f / static_cast<float>(sampleRate);
+            float alpha = dt / (rc + dt);
+            float maxDelta = 1.0f - params.soften * 0.9f;
+
+            auto chain = [&](float in, float last) {
+                float air = last + alpha * (in - last);
+                float processed = in + (air - in) * fadeFactor;
+                return (last + std::clamp(processed - last, -maxDelta, maxDelta)) * distanceGain;
+            };
+
+            float leftGained = chain(left, lastLeftIn);
+            float rightGained = chain(right, lastRightIn);
+            lastLeftIn = left;
+            lastRightIn = right;
+
+            float mid = (leftGained + rightGained) * 0.5f;
+            float side = (leftGained - rightGained) * 0.5f;
+            float widthFactor = params.width * (1.0f - 0.5f * fadeFactor);
+            left = (mid + side * widthFactor) * params.level;
+            right = (mid - side * widthFactor) * params.level;
+        }
+    };
+
+    static void applyParams(FarField& farField, const FarFieldParams& params) {
+        farField.setDistance(params.distance_m);
+        farField.setMaxDistance(params.maxDistance_m);
+        farField.setAirAmount(params.airAmount);
+        farField.setSoften(params.soften);
+        farField.setWidth(params.width);
+        farField.setLevel(params.level);
+        farField.setNearFade(params.nearFade_m);
+        farField.setFarFade(params.farFade_m);
+        farField.setSourceVelocity(params.sourceVelocity);
+        farField.setDopplerAmount(params.dopplerAmount);
+    }
+
+    static std::vector<float> tone(float frequency, int numSamples, float phase = 0.0f) {
+        std::vector<float> buffer(static_cast<size_t>(numSamples));
+        for (int i = 0; i < numSamples; ++i)
+            buffer[i] = 0.5f * std::sin(phase + 2.0f * 3.14159265f * frequency * i / static_cast<float>(sampleRate));
+        return buffer;
+    }
+
+    // Frequency from rising zero crossings in [start, end)
+    static double measureFrequency(const std::vector<float>& buffer, size_t start, size_t end) {
+        double first = -1.0, last = -1.0;
+        int crossings = 0;
+        for (size_t i = start + 1; i < end; ++i) {
+            if (buffer[i - 1] < 0.0f && buffer[i] >= 0.0f) {
+                double t = (i - 1) + buffer[i - 1] / (buffer[i - 1] - buffer[i]);
+                if (first < 0.0) first = t; else ++crossings;
+                last = t;
+            }
+        }
+        return crossings > 0 ? crossings * sampleRate / (last - first) : 0.0;
+    }
+};
+
+TEST_F(FarFieldPureDSPTests, StaticParamsMatchPerSampleFormulas) {
+    FarFieldParams params;
+    params.distance_m = 12.0f;
+    params.airAmount = 0.9f;
+    params.soften = 0.7f;
+    params.width = 0.8f;
+    params.level = 1.5f;
+
+    FarField farField;
+    farField.prepare(sampleRate, blockSize);
+    applyParams(farField, params);
+
+    PerSampleReference reference;
+    reference.params = params;
+
+    std::vector<float> left = tone(440.0f, blockSize * 20);
+    std::vector<float> right = tone(660.0f, blockSize * 20, 1.0f);
+    std::vector<float> refLeft = left, refRight = right;
+
+    for (size_t i = 0; i < refLeft.size(); ++i)
+        reference.process(refLeft[i], refRight[i]);
+    for (int b = 0; b < 20; ++b)
+        farField.processStereo(left.data() + b * blockSize, right.data() + b * blockSize, blockSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < left.size(); ++i)
+        maxError = std::max({ maxError, std::abs(left[i] - refLeft[i]), std::abs(right[i] - refRight[i]) });
+
+    EXPECT_LT(maxError, 1e-6f);
+}
+
+TEST_F(FarFieldPureDSPTests, DistanceJumpIsSmoothed) {
+    FarField farField;
+    farField.prepare(sampleRate, blockSize);
+    farField.setSoften(0.0f);
+    farField.setDistance(1.0f);
+
+    std::vector<float> left(blockSize), right(blockSize);
+    float previous = 0.0f;
+    float maxStep = 0.0f;
+
+    for (int b = 0; b < 80; ++b) {
+        if (b == 10)
+            farField.setDistance(30.0f);
+
+        std::fill(left.begin(), left.end(), 0.5f);
+        std::fill(right.begin(), right.end(), 0.5f);
+        farField.processStereo(left.data(), right.data(), blockSize);
+
+        for (int i = 0; i < blockSize; ++i) {
+            if (b >= 10)
+                maxStep = std::max(maxStep, std::abs(left[i] - previous));
+            previous = left[i];
+        }
+    }
+
+    // Gain falls from 0.99 to 0.1 of the DC input; no single step may take
+    // more than a small slice of that
+    EXPECT_NEAR(previous, 0.5f / (1.0f + 0.01f * 900.0f), 1e-3f);
+    EXPECT_LT(maxStep, 0.01f);
+}
+
+TEST_F(FarFieldPureDSPTests, PropagationDelayMatchesDistance) {
+    for (float amount : { 0.0f, 1.0f }) {
+        FarField farField;
+        farField.prepare(sampleRate, blockSize);
+        farField.setDistance(34.3f);
+        farField.setDopplerAmount(amount);
+
+        std::vector<float> left(static_cast<size_t>(blockSize) * 30, 0.0f), right = left;
+        left[0] = right[0] = 1.0f;
+        for (size_t start = 0; start < left.size(); start += blockSize)
+            farField.processStereo(left.data() + start, right.data() + start, blockSize);
+
+        const size_t arrival = static_cast<size_t>(std::max_element(left.begin(), left.end(),
+            [](float a, float b) { return std::abs(a) < std::abs(b); }) - left.begin());
+
+        // 34.3 m at 343 m/s is 100 ms
+        EXPECT_EQ(arrival, amount > 0.0f ? 4800u : 0u);
+    }
+}
+
+TEST_F(FarFieldPureDSPTests, ApproachingSourceIsPitchedUp) {
+    constexpr float velocity = 40.0f;
+    constexpr int numSamples = static_cast<int>(sampleRate) * 3 / 2;
+
+    FarField farField;
+    farField.prepare(sampleRate, blockSize);
+    farField.setDistance(100.0f);
+    farField.setSourceVelocity(velocity);
+    farField.setDopplerAmount(1.0f);
+    farField.setAirAmount(0.0f);
+    farField.setSoften(0.0f);
+
+    std::vector<float> left = tone(1000.0f, numSamples), right = left;
+    for (int start = 0; start < numSamples; start += blockSize)
+        farField.processStereo(left.data() + start, right.data() + start, std::min(blockSize, numSamples - start));
+
+    // The delay shrinks by velocity / c samples per sample
+    const double expected = 1000.0 * (1.0 + velocity / kSpeedOfSound);
+    EXPECT_NEAR(measureFrequency(left, 36000, 66000), expected, expected * 0.002);
+}
+
+TEST_F(FarFieldPureDSPTests, SceneMatchesIndependentFarFields) {
+    constexpr int numSources = 6;
+    constexpr int numBlocks = 60;
+
+    FarFieldScene scene;
+    scene.prepare(sampleRate, blockSize, numSources);
+
+    std::vector<FarField> farFields(numSources);
+    std::vector<std::vector<float>> inputs;
+    for (int s = 0; s < numSources; ++s) {
+        FarFieldParams params;
+        params.distance_m = 5.0f + 12.0f * s;
+        params.maxDistance_m = 90.0f;
+        params.airAmount = 0.1f * s;
+        params.soften = 0.15f * s;
+        params.width = 1.0f - 0.1f * s;
+        params.sourceVelocity = (s % 2 == 0 ? 1.0f : -1.0f) * 10.0f * s;
+        params.dopplerAmount = s == 0 ? 0.0f : 1.0f / s;
+        scene.setSourceParams(s, params);
+
+        farFields[s].prepare(sampleRate, blockSize);
+        applyParams(farFields[s], params);
+        inputs.push_back(tone(200.0f + 150.0f * s, blockSize * numBlocks, 0.3f * s));
+    }
+
+    std::vector<float> sceneLeft(blockSize), sceneRight(blockSize);
+    std::vector<float> left(blockSize), right(blockSize), sumLeft(blockSize), sumRight(blockSize);
+    std::vector<const float*> sourceLeft(numSources), sourceRight(numSources);
+    float maxError = 0.0f;
+
+    for (int b = 0; b < numBlocks; ++b) {
+        // Move source 1 every block, as a scene caller would
+        if (b % 10 == 5) {
+            scene.getSourceParams(1).distance_m += 3.0f;
+            farFields[1].setDistance(scene.getSourceParams(1).distance_m);
+        }
+
+        std::fill(sumLeft.begin(), sumLeft.end(), 0.0f);
+        std::fill(sumRight.begin(), sumRight.end(), 0.0f);
+
+        for (int s = 0; s < numSources; ++s) {
+            const float* in = inputs[s].data() + b * blockSize;
+            sourceLeft[s] = in;
+            sourceRight[s] = in;
+
+            std::copy(in, in + blockSize, left.begin());
+            std::copy(in, in + blockSize, right.begin());
+            farFields[s].processStereo(left.data(), right.data(), blockSize);
+            for (int i = 0; i < blockSize; ++i) {
+                sumLeft[i] += left[i];
+                sumRight[i] += right[i];
+            }
+        }
+
+        scene.process(sourceLeft.data(), sourceRight.data(), sceneLeft.data(), sceneRight.data(), blockSize);
+
+        for (int i = 0; i < blockSize; ++i)
+            maxError = std::max({ maxError, std::abs(sceneLeft[i] - sumLeft[i]), std::abs(sceneRight[i] - sumRight[i]) });
+    }
+
+    EXPECT_LT(maxError, 1e-5f);
+}
+
+TEST_F(FarFieldPureDSPTests, Benchmark64MovingSources) {
+    constexpr int numSources = 64;
+    constexpr int hostBlock = 512;
+    constexpr int numBlocks = static_cast<int>(sampleRate) * 5 / hostBlock;
+
+    FarFieldScene scene;
+    scene.prepare(sampleRate, hostBlock, numSources);
+
+    std::vector<std::vector<float>> inputs;
+    std::vector<const float*> sources(numSources);
+    for (int s = 0; s < numSources; ++s) {
+        FarFieldParams params;
+        params.distance_m = 2.0f + s;
+        params.sourceVelocity = (s % 2 == 0 ? 1.0f : -1.0f) * (5.0f + 0.5f * s);
+        params.dopplerAmount = 1.0f;
+        scene.setSourceParams(s, params);
+
+        inputs.push_back(tone(100.0f + 37.0f * s, hostBlock, 0.1f * s));
+        sources[s] = inputs.back().data();
+    }
+
+    std::vector<float> left(hostBlock), right(hostBlock);
+
+    double seconds = 0.0;
+    for (int b = 0; b < numBlocks; ++b) {
+        // Sources drift a little every block
+        for (int s = 0; s < numSources; ++s)
+            scene.getSourceParams(s).distance_m = 2.0f + s + 10.0f * std::sin(0.01f * (b + s));
+
+        const auto start = std::chrono::steady_clock::now();
+        scene.process(sources.data(), sources.data(), left.data(), right.data(), hostBlock);
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    EXPECT_TRUE(std::isfinite(left[0]) && std::isfinite(right[0]));
+
+    std::printf("\n=== FarFieldScene, 64 moving sources, 48 kHz ===\n");
+    std::printf("  %.1f ns/frame, %.2f%% of real time\n",
+                1e9 * seconds / (static_cast<double>(numBlocks) * hostBlock),
+                100.0 * seconds / (numBlocks * hostBlock / sampleRate));
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../../include/dsp/MPEUniversalSupport.h"
+
+/**
+ * MPENoteTracker tests
+ *
+ * Checks (channel, note) lookup, that per-channel expression only reaches
+ * notes on that channel, slot reuse at capacity, agreement with a plain
+ * list of notes under a random MPE stream, and the cost of a 15-channel
+ * controller sending 1 kHz per-note expression.
+ */
+class MPENoteTrackerTests : public ::testing::Test {
+protected:
+    MPEZoneDetector zones;
+
+    void send(MPENoteTracker& tracker, const juce::MidiMessage& msg) {
+        tracker.processMIDI(msg, zones);
+    }
+
+    // Straightforward list of notes with the tracker's update rules
+    struct ListReference {
+        std::vector<MPENoteState> notes;
+
+        MPENoteState* find(int note, int channel) {
+            for (auto& state : notes)
+                if (state.midiNote == note && state.midiChannel == channel)
+                    return &state;
+            return nullptr;
+        }
+
+        void process(const juce::MidiMessage& msg) {
+            const int channel = msg.getChannel();
+            if (msg.isNoteOn()) {
+                auto* state = find(msg.getNoteNumber(), channel);
+                if (state == nullptr) {
+                    notes.emplace_back();
+                    state = &notes.back();
+                    state->midiNote = msg.getNoteNumber();
+                    state->midiChannel = channel;
+                }
+                state->velocity = msg.getVelocity() / 127.0f;
+                state->isActive = true;
+            } else if (msg.isNoteOff()) {
+                notes.erase(std::remove_if(notes.begin(), notes.end(), [&](const MPENoteState& s) {
+                    return s.midiNote == msg.getNoteNumber() && s.midiChannel == channel;
+                }), notes.end());
+            } else {
+                for (auto& state : notes) {
+                    if (state.midiChannel != channel) continue;
+                    if (msg.isPitchWheel()) state.pitchBend = (msg.getPitchWheelValue() - 8192) / 8192.0f;
+                    else if (msg.isChannelPressure()) state.pressure = msg.getChannelPressureValue() / 127.0f;
+                    else if (msg.isController() && msg.getControllerNumber() == 74) state.timbre = msg.getControllerValue() / 127.0f;
+                }
+            }
+        }
+    };
+};
+
+TEST_F(MPENoteTrackerTests, LooksUpNotesByChannelAndNumber) {
+    MPENoteTracker tracker;
+    send(tracker, juce::MidiMessage::noteOn(2, 60, (juce::uint8) 100));
+    send(tracker, juce::MidiMessage::noteOn(3, 60, (juce::uint8) 50));
+
+    ASSERT_NE(tracker.getNoteState(60, 2), nullptr);
+    ASSERT_NE(tracker.getNoteState(60, 3), nullptr);
+    EXPECT_FLOAT_EQ(tracker.getNoteState(60, 2)->velocity, 100.0f / 127.0f);
+    EXPECT_FLOAT_EQ(tracker.getNoteState(60, 3)->velocity, 50.0f / 127.0f);
+    EXPECT_EQ(tracker.getNoteState(61, 2), nullptr);
+    EXPECT_EQ(tracker.getNumActiveNotes(), 2);
+
+    send(tracker, juce::MidiMessage::noteOff(2, 60));
+    EXPECT_EQ(tracker.getNoteState(60, 2), nullptr);
+    EXPECT_NE(tracker.getNoteState(60, 3), nullptr);
+    EXPECT_EQ(tracker.getNumActiveNotes(), 1);
+    EXPECT_EQ(tracker.getActiveNote(0).midiChannel, 3);
+}
+
+TEST_F(MPENoteTrackerTests, ExpressionOnlyReachesNotesOnItsChannel) {
+    MPENoteTracker tracker;
+    send(tracker, juce::MidiMessage::noteOn(2, 60, (juce::uint8) 100));
+    send(tracker, juce::MidiMessage::noteOn(2, 64, (juce::uint8) 100));
+    send(tracker, juce::MidiMessage::noteOn(5, 67, (juce::uint8) 100));
+
+    send(tracker, juce::MidiMessage::pitchWheel(2, 16383));
+    send(tracker, juce::MidiMessage::channelPressureChange(2, 127));
+    send(tracker, juce::MidiMessage::controllerEvent(2, 74, 127));
+
+    for (int note : { 60, 64 }) {
+        const auto* state = tracker.getNoteState(note, 2);
+        ASSERT_NE(state, nullptr);
+        EXPECT_NEAR(state->pitchBend, 1.0f, 1e-3f);
+        EXPECT_FLOAT_EQ(state->pressure, 1.0f);
+        EXPECT_FLOAT_EQ(state->timbre, 1.0f);
+    }
+
+    const auto* other = tracker.getNoteState(67, 5);
+    ASSERT_NE(other, nullptr);
+    EXPECT_EQ(other->pitchBend, 0.0f);
+    EXPECT_EQ(other->pressure, 0.0f);
+    EXPECT_EQ(other->timbre, 0.0f);
+}
+
+TEST_F(MPENoteTrackerTests, ReusesSlotsAndIgnoresNotesBeyondCapacity) {
+    MPENoteTracker tracker;
+
+    for (int i = 0; i < MPENoteTracker::kMaxNotes + 20; ++i)
+        send(tracker, juce::MidiMessage::noteOn(1 + i % 16, i % 128, (juce::uint8) 90));
+    EXPECT_EQ(tracker.getNumActiveNotes(), MPENoteTracker::kMaxNotes);
+
+    // Existing notes stay where they are while others come and go
+    const MPENoteState* kept = tracker.getNoteState(100, 5);
+    ASSERT_NE(kept, nullptr);
+
+    for (int i = 0; i < 64; ++i)
+        send(tracker, juce::MidiMessage::noteOff(1 + i % 16, i % 128));
+    EXPECT_EQ(tracker.getNumActiveNotes(), MPENoteTracker::kMaxNotes - 64);
+
+    for (int i = 0; i < 64; ++i)
+        send(tracker, juce::MidiMessage::noteOn(16, i, (juce::uint8) 90));
+    EXPECT_EQ(tracker.getNumActiveNotes(), MPENoteTracker::kMaxNotes);
+    EXPECT_EQ(tracker.getNoteState(100, 5), kept);
+}
+
+TEST_F(MPENoteTrackerTests, MatchesListReferenceUnderRandomStream) {
+    MPENoteTracker tracker;
+    ListReference reference;
+    std::mt19937 rng(1234);
+
+    for (int step = 0; step < 20000; ++step) {
+        const int channel = 1 + static_cast<int>(rng() % 16);
+        const int note = 48 + static_cast<int>(rng() % 8);
+        const int value = static_cast<int>(rng() % 128);
+
+        juce::MidiMessage msg;
+        switch (rng() % 6) {
+            case 0: msg = juce::MidiMessage::noteOn(channel, note, (juce::uint8) std::max(1, value)); break;
+            case 1: msg = juce::MidiMessage::noteOff(channel, note); break;
+            case 2: msg = juce::MidiMessage::pitchWheel(channel, value * 128); break;
+            case 3: msg = juce::MidiMessage::channelPressureChange(channel, value); break;
+            case 4: msg = juce::MidiMessage::controllerEvent(channel, 74, value); break;
+            default: msg = juce::MidiMessage::controllerEvent(channel, 1, value); break;
+        }
+
+        send(tracker, msg);
+        reference.process(msg);
+    }
+
+    ASSERT_EQ(tracker.getNumActiveNotes(), static_cast<int>(reference.notes.size()));
+    for (const auto& expected : reference.notes) {
+        const auto* state = tracker.getNoteState(expected.midiNote, expected.midiChannel);
+        ASSERT_NE(state, nullptr);
+        EXPECT_EQ(state->velocity, expected.velocity);
+        EXPECT_EQ(state->pitchBend, expected.pitchBend);
+        EXPECT_EQ(state->pressure, expected.pressure);
+        EXPECT_EQ(state->timbre, expected.timbre);
+    }
+}
+
+TEST_F(MPENoteTrackerTests, Benchmark15ChannelExpressionStream) {
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 48;   // 1 ms, one expression update per note per block
+    constexpr int numBlocks = 10000;
+
+    MPENoteTracker tracker;
+
+    std::vector<juce::MidiMessage> block;
+    double seconds = 0.0;
+    long messages = 0;
+
+    for (int b = 0; b < numBlocks; ++b) {
+        block.clear();
+        for (int channel = 2; channel <= 16; ++channel) {
+            const int note = 40 + channel * 2;
+
+            // Each channel replays its note every 500 ms
+            if (b % 500 == 0)
+                block.push_back(juce::MidiMessage::noteOn(channel, note, (juce::uint8) 100));
+            else if (b % 500 == 499)
+                block.push_back(juce::MidiMessage::noteOff(channel, note));
+
+            block.push_back(juce::MidiMessage::pitchWheel(channel, (b * 37 + channel * 512) % 16384));
+            block.push_back(juce::MidiMessage::channelPressureChange(channel, (b + channel) % 128));
+            block.push_back(juce::MidiMessage::controllerEvent(channel, 74, (b * 3 + channel) % 128));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& msg : block)
+            tracker.processMIDI(msg, zones);
+        tracker.updateSmoothing(sampleRate, blockSize);
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        messages += static_cast<long>(block.size());
+    }
+
+    EXPECT_EQ(tracker.getNumActiveNotes(), 0);
+
+    std::printf("\n=== MPENoteTracker, 15 channels x 1 kHz expression ===\n");
+    std::printf("  %.1f ns/message, %.3f%% of real time\n",
+                1e9 * seconds / static_cast<double>(messages),
+                100.0 * seconds / (numBlocks * blockSize / sampleRate));
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "../../include/dsp/MicrotonalTuning.h"
+
+/**
+ * MicrotonalFrequencyTable / MicrotonalTuningManager table tests
+ *
+ * Checks the compiled tables against MicrotonalTuning::midiToFrequency, the
+ * fractional-pitch path against closed-form equal temperament, and that
+ * retuning while the audio thread reads never exposes a half-written table.
+ */
+class MicrotonalTuningTableTests : public ::testing::Test {
+protected:
+    static double centsBetween(double a, double b) {
+        return 1200.0 * std::log2(a / b);
+    }
+
+    static MicrotonalTuning makeEqualTemperament(int divisions) {
+        MicrotonalTuning tuning;
+        tuning.system = TuningSystem::EqualTemperament;
+        tuning.divisions = divisions;
+        return tuning;
+    }
+
+    static std::vector<MicrotonalTuning> builtInTunings() {
+        return {
+            makeEqualTemperament(12),
+            makeEqualTemperament(31),
+            ScalaFileLoader::get12TET().toMicrotonalTuning(),
+            ScalaFileLoader::get19TET().toMicrotonalTuning(),
+            ScalaFileLoader::getJustIntonation5Limit().toMicrotonalTuning(),
+            ScalaFileLoader::getWerckmeisterIII().toMicrotonalTuning(),
+            ScalaFileLoader::getSlendro().toMicrotonalTuning(),
+        };
+    }
+};
+
+TEST_F(MicrotonalTuningTableTests, IntegerNotesMatchDirectEvaluation) {
+    MicrotonalFrequencyTable table;
+
+    for (const auto& tuning : builtInTunings()) {
+        table.compile(tuning);
+
+        for (int note = 0; note < MicrotonalFrequencyTable::numNotes; ++note) {
+            EXPECT_EQ(table.getFrequency(note), tuning.midiToFrequency(note)) << "note " << note;
+        }
+    }
+}
+
+TEST_F(MicrotonalTuningTableTests, FractionalPitchIsExactForEqualTemperament) {
+    for (int divisions : { 12, 19, 31, 53 }) {
+        const auto tuning = makeEqualTemperament(divisions);
+        MicrotonalFrequencyTable table;
+        table.compile(tuning);
+
+        double worstCents = 0.0;
+        for (float pitch = 0.0f; pitch < 127.0f; pitch += 0.037f) {
+            const double expected = tuning.rootFrequency
+                                  * std::pow(2.0, (pitch - tuning.rootNote) / divisions);
+            worstCents = std::max(worstCents, std::abs(centsBetween(table.getFrequency(pitch), expected)));
+        }
+
+        EXPECT_LT(worstCents, 0.01) << divisions << "-TET";
+    }
+}
+
+TEST_F(MicrotonalTuningTableTests, FractionalPitchStaysBetweenNeighbours) {
+    MicrotonalFrequencyTable table;
+    table.compile(ScalaFileLoader::getJustIntonation5Limit().toMicrotonalTuning());
+
+    for (int note = 20; note < 100; ++note) {
+        const float low = table.getFrequency(note);
+        const float high = table.getFrequency(note + 1);
+        const float mid = table.getFrequency(note + 0.5f);
+
+        EXPECT_GE(mid, std::min(low, high));
+        EXPECT_LE(mid, std::max(low, high));
+        EXPECT_NEAR(std::log2(mid), table.getLog2Frequency(note + 0.5f), 1.0e-5);
+    }
+}
+
+TEST_F(MicrotonalTuningTableTests, OutOfRangePitchesClamp) {
+    MicrotonalFrequencyTable table;
+    table.compile(makeEqualTemperament(12));
+
+    EXPECT_EQ(table.getFrequency(-5), table.frequency[0]);
+    EXPECT_EQ(table.getFrequency(200), table.frequency[127]);
+    EXPECT_EQ(table.getFrequency(-0.5f), table.frequency[0]);
+    EXPECT_EQ(table.getFrequency(130.0f), table.frequency[127]);
+    EXPECT_EQ(table.getFrequency(std::nanf("")), table.frequency[0]);
+}
+
+TEST_F(MicrotonalTuningTableTests, ManagerPublishesNewTables) {
+    MicrotonalTuningManager manager;
+    const auto initial = manager.getTuning();
+    EXPECT_EQ(manager.getFrequencyTable().getFrequency(60), initial.midiToFrequency(60));
+
+    const auto tuning = makeEqualTemperament(19);
+    manager.setTuning(tuning);
+    EXPECT_EQ(manager.getFrequencyTable().getFrequency(60), tuning.midiToFrequency(60));
+
+    // Invalid tunings are ignored and leave the published table alone
+    auto invalid = makeEqualTemperament(0);
+    manager.setTuning(invalid);
+    EXPECT_EQ(manager.getFrequencyTable().getFrequency(60), tuning.midiToFrequency(60));
+}
+
+TEST_F(MicrotonalTuningTableTests, RetuningNeverTearsTheReadersTable) {
+    MicrotonalTuningManager manager;
+    const auto tuningA = makeEqualTemperament(12);
+    const auto tuningB = makeEqualTemperament(31);
+    manager.setTuning(tuningA);
+
+    MicrotonalFrequencyTable expectedA, expectedB;
+    expectedA.compile(tuningA);
+    expectedB.compile(tuningB);
+
+    std::atomic<bool> running { true };
+    std::thread writer([&] {
+        for (int i = 0; i < 2000; ++i)
+            manager.setTuning((i & 1) ? tuningA : tuningB);
+        running.store(false);
+    });
+
+    int torn = 0;
+    int reads = 0;
+    while (running.load() || reads < 1000) {
+        const auto& table = manager.getFrequencyTable();
+        const auto& reference = table.frequency[0] == expectedA.frequency[0] ? expectedA : expectedB;
+
+        for (int note = 0; note < MicrotonalFrequencyTable::numNotes; ++note) {
+            if (table.frequency[note] != reference.frequency[note]) {
+                ++torn;
+                break;
+            }
+        }
+        ++reads;
+    }
+
+    writer.join();
+    EXPECT_EQ(torn, 0);
+    EXPECT_EQ(manager.getFrequencyTable().getFrequency(60), tuningA.midiToFrequency(60));
+}
+
+TEST_F(MicrotonalTuningTableTests, BenchmarkTableAgainstDirectEvaluation) {
+    constexpr int iterations = 200000;
+    const auto tuning = ScalaFileLoader::getJustIntonation5Limit().toMicrotonalTuning();
+
+    MicrotonalFrequencyTable table;
+    table.compile(tuning);
+
+    float directSum = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        directSum += tuning.midiToFrequency(i & 127);
+    const double directSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    float tableSum = 0.0f;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        tableSum += table.getFrequency(static_cast<float>(i & 127) + 0.25f);
+    const double tableSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_GT(directSum + tableSum, 0.0f);
+
+    std::printf("\n=== Microtonal lookup (%d calls) ===\n", iterations);
+    std::printf("  midiToFrequency (integer)       : %6.1f ns/call\n", 1e9 * directSeconds / iterations);
+    std::printf("  table.getFrequency (fractional) : %6.1f ns/call\n", 1e9 * tableSeconds / iterations);
+
+    EXPECT_LT(tableSeconds, directSeconds);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+#include "../../dsp_test_harness/include/dsp_test/RealFft.h"
+#include "../../dsp_test_harness/include/dsp_test/DspOfflineHost.h"
+
+using namespace DspTest;
+
+/**
+ * RealFft and golden-file lag search tests
+ *
+ * Checks the real FFT against a direct DFT and its inverse round trip at
+ * several power-of-two sizes, and that the FFT cross-correlation lag search
+ * picks the same lag as a direct search over every candidate lag.
+ */
+class RealFftTests : public ::testing::Test {
+protected:
+    static constexpr double pi = 3.14159265358979323846;
+
+    static std::vector<double> makeNoise(int size, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        std::vector<double> samples(static_cast<size_t>(size));
+        for (auto& s : samples) s = dist(rng);
+        return samples;
+    }
+
+    // Bins 0..N/2 of sum x[n] e^{-2 pi i k n / N}
+    static std::vector<std::complex<double>> naiveDft(const std::vector<double>& input) {
+        const int n = static_cast<int>(input.size());
+        std::vector<std::complex<double>> spectrum(static_cast<size_t>(n / 2 + 1));
+        for (int k = 0; k <= n / 2; ++k) {
+            std::complex<double> sum;
+            for (int i = 0; i < n; ++i)
+                sum += input[static_cast<size_t>(i)] * std::polar(1.0, -2.0 * pi * k * i / n);
+            spectrum[static_cast<size_t>(k)] = sum;
+        }
+        return spectrum;
+    }
+};
+
+TEST_F(RealFftTests, ForwardMatchesNaiveDft) {
+    for (int size : { 2, 4, 8, 16, 64, 256, 1024 }) {
+        const RealFft fft(size);
+        ASSERT_EQ(fft.getNumBins(), size / 2 + 1);
+
+        const auto input = makeNoise(size, static_cast<unsigned>(size));
+        const auto expected = naiveDft(input);
+
+        std::vector<std::complex<double>> spectrum(static_cast<size_t>(fft.getNumBins()));
+        fft.forward(input.data(), spectrum.data());
+
+        double maxError = 0.0;
+        for (size_t k = 0; k < spectrum.size(); ++k)
+            maxError = std::max(maxError, std::abs(spectrum[k] - expected[k]));
+        EXPECT_LT(maxError, 1e-9 * size) << "size " << size;
+    }
+}
+
+TEST_F(RealFftTests, InverseRoundTrips) {
+    for (int size : { 2, 8, 128, 4096 }) {
+        const auto fft = RealFft::forSize(size);
+        const auto input = makeNoise(size, 7u);
+
+        std::vector<std::complex<double>> spectrum(static_cast<size_t>(fft->getNumBins()));
+        std::vector<double> output(static_cast<size_t>(size));
+        fft->forward(input.data(), spectrum.data());
+        fft->inverse(spectrum.data(), output.data());
+
+        double maxError = 0.0;
+        for (size_t i = 0; i < output.size(); ++i)
+            maxError = std::max(maxError, std::abs(output[i] - input[i]));
+        EXPECT_LT(maxError, 1e-12) << "size " << size;
+    }
+}
+
+TEST_F(RealFftTests, SharesInstancesPerSize) {
+    EXPECT_EQ(RealFft::forSize(512), RealFft::forSize(512));
+    EXPECT_NE(RealFft::forSize(512), RealFft::forSize(1024));
+
+    EXPECT_EQ(RealFft::nextPowerOfTwo(0), 2);
+    EXPECT_EQ(RealFft::nextPowerOfTwo(2), 2);
+    EXPECT_EQ(RealFft::nextPowerOfTwo(3), 4);
+    EXPECT_EQ(RealFft::nextPowerOfTwo(1025), 2048);
+}
+
+//==============================================================================
+// Lag search
+//==============================================================================
+
+namespace {
+
+// Direct search: corr[lag] = sum a[i] * b[i + lag] over the overlap, first maximum wins
+int bruteForceLag(const std::vector<float>& a, const std::vector<float>& b, int maxLag) {
+    const int frames = static_cast<int>(a.size());
+    int bestLag = 0;
+    double bestCorr = -1e30;
+
+    for (int lag = -maxLag; lag <= maxLag; ++lag) {
+        double corr = 0.0;
+        int count = 0;
+        for (int i = 0; i < frames; ++i) {
+            const int j = i + lag;
+            if (j < 0 || j >= frames)
+                continue;
+            corr += double(a[static_cast<size_t>(i)]) * double(b[static_cast<size_t>(j)]);
+            ++count;
+        }
+        if (count > 0 && corr > bestCorr) {
+            bestCorr = corr;
+            bestLag = lag;
+        }
+    }
+    return bestLag;
+}
+
+} // namespace
+
+TEST(GoldenComparatorLagTests, FftLagMatchesDirectSearchOnShiftedSignal) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    const std::pair<int, int> cases[] = { { 4096, 512 }, { 1000, 64 }, { 300, 2048 } };
+
+    for (const auto& [frames, maxLag] : cases) {
+        std::vector<float> golden(static_cast<size_t>(frames));
+        for (auto& s : golden) s = dist(rng);
+
+        for (int shift : { -37, -1, 0, 5, 50 }) {
+            // candidate[i] = golden[i - shift], so the best lag is -shift
+            std::vector<float> candidate(golden.size(), 0.0f);
+            for (int i = 0; i < frames; ++i) {
+                const int j = i - shift;
+                if (j >= 0 && j < frames)
+                    candidate[static_cast<size_t>(i)] = golden[static_cast<size_t>(j)];
+            }
+
+            const auto result = GoldenComparator::compare(candidate.data(), golden.data(), frames, 1, maxLag);
+            const int expected = bruteForceLag(candidate, golden, std::min(maxLag, frames - 1));
+
+            EXPECT_EQ(result.lagSamples, expected) << frames << " frames, shift " << shift;
+            EXPECT_EQ(result.lagSamples, -shift) << frames << " frames, shift " << shift;
+        }
+    }
+}
@@ -0,0 +1,30 @@
+//
+//  sch_instrument_manager_stub.cpp
+//  White Room JUCE Instrument FFI Bridge Tests
+//
+//  Link-time stand-in for InstrumentManager, so the instrument FFI can be
+//  built without the plugin hosting stack InstrumentManager.cpp pulls in.
+//  The real-time path under test never goes through the manager; every
+//  catalogue query reports no instruments.
+//
+
+#include "engine/instruments/InstrumentManager.h"
+#include "engine/instruments/InstrumentInstance.h"
+
+namespace SchillingerEcosystem::Instrument {
+
+class PluginManager {};
+
+InstrumentManager::InstrumentManager() {}
+InstrumentManager::~InstrumentManager() {}
+
+std::vector<InstrumentInfo> InstrumentManager::getAvailableInstruments() const { return {}; }
+std::vector<InstrumentInfo> InstrumentManager::getInstrumentsByCategory(const juce::String&) const { return {}; }
+std::vector<InstrumentInfo> InstrumentManager::searchInstruments(const juce::String&) const { return {}; }
+std::shared_ptr<InstrumentInfo> InstrumentManager::getInstrumentInfo(const juce::String&) const { return {}; }
+std::unique_ptr<InstrumentInstance> InstrumentManager::createInstance(const juce::String&) { return {}; }
+bool InstrumentManager::isInstrumentAvailable(const juce::String&) const { return false; }
+
+AIAgentInterface::~AIAgentInterface() {}
+
+} // namespace SchillingerEcosystem::Instrument
@@ -0,0 +1,183 @@
+//
+//  test_sch_engine_command_benchmark.cpp
+//  White Room JUCE FFI Bridge Tests
+//
+//  Stress benchmark for the FFI command queue
+//  Measures commands/second for single vs batched submission and the
+//  worst-case audio-thread drain time while a producer streams dense
+//  MPE-style traffic. Timings are reported, never asserted; the benchmark
+//  is built but not registered with ctest.
+//
+
+#include <gtest/gtest.h>
+#include "ffi/sch_engine_ffi.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t kBlockSize = 128;
+constexpr uint32_t kBatchSize = 64;
+
+sch_timed_command_t makeNoteCommand(uint32_t sampleOffset, int note, bool on) {
+    sch_timed_command_t timed{};
+    timed.sample_offset = sampleOffset;
+    timed.command.type = on ? SCH_CMD_NOTE_ON : SCH_CMD_NOTE_OFF;
+    timed.command.data.note_on.channel = note % 16;
+    timed.command.data.note_on.note = note % 128;
+    timed.command.data.note_on.velocity = 0.8f;
+    return timed;
+}
+
+} // namespace
+
+//==============================================================================
+// Test Fixture
+//==============================================================================
+
+class SchEngineCommandBenchmark : public ::testing::Test {
+protected:
+    sch_engine_handle engine = nullptr;
+    float left[kBlockSize];
+    float right[kBlockSize];
+    float* channels[2] = { left, right };
+
+    void SetUp() override {
+        ASSERT_EQ(sch_engine_create(&engine), SCH_OK);
+
+        // Mark the engine as host-driven so producers never drain the queue
+        ASSERT_EQ(sch_engine_process_block(engine, channels, 2, kBlockSize), SCH_OK);
+    }
+
+    void TearDown() override {
+        if (engine) {
+            sch_engine_destroy(engine);
+            engine = nullptr;
+        }
+    }
+
+    // Producer-side cost only: fill the queue, drain it untimed, repeat.
+    // Returns commands submitted per second of time spent inside push calls.
+    double measureSubmitRate(uint32_t totalCommands, bool batched) {
+        std::vector<sch_timed_command_t> batch(kBatchSize);
+        for (uint32_t i = 0; i < kBatchSize; ++i) {
+            batch[i] = makeNoteCommand(i, static_cast<int>(i), (i & 1) == 0);
+        }
+
+        const uint32_t perFill = (SCH_COMMAND_QUEUE_CAPACITY - 1) / kBatchSize * kBatchSize;
+        double pushSeconds = 0.0;
+        uint32_t sent = 0;
+
+        while (sent < totalCommands) {
+            const uint32_t fill = std::min(perFill, totalCommands - sent);
+            const auto start = Clock::now();
+
+            if (batched) {
+                for (uint32_t i = 0; i < fill; i += kBatchSize) {
+                    sch_engine_push_commands(engine, batch.data(), kBatchSize);
+                }
+            } else {
+                for (uint32_t i = 0; i < fill; ++i) {
+                    sch_engine_push_command(engine, &batch[i % kBatchSize].command);
+                }
+            }
+
+            pushSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+            sent += fill;
+
+            sch_engine_process_block(engine, channels, 2, kBlockSize);
+        }
+
+        return totalCommands / pushSeconds;
+    }
+
+    // Stream batches from a producer thread while this thread plays the audio
+    // callback. Returns the worst-case block time in seconds.
+    double measureWorstDrain(uint32_t totalCommands) {
+        std::atomic<bool> producerDone{false};
+
+        std::thread producer([&] {
+            std::vector<sch_timed_command_t> batch(kBatchSize);
+            uint32_t sent = 0;
+
+            while (sent < totalCommands) {
+                for (uint32_t i = 0; i < kBatchSize; ++i) {
+                    batch[i] = makeNoteCommand((kBatchSize - i) % kBlockSize,
+                                               static_cast<int>(sent + i), (i & 1) == 0);
+                }
+                if (sch_engine_push_commands(engine, batch.data(), kBatchSize) == SCH_OK) {
+                    sent += kBatchSize;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+
+            producerDone.store(true, std::memory_order_release);
+        });
+
+        double worstBlock = 0.0;
+        while (!producerDone.load(std::memory_order_acquire)) {
+            const auto blockStart = Clock::now();
+            sch_engine_process_block(engine, channels, 2, kBlockSize);
+            worstBlock = std::max(worstBlock,
+                std::chrono::duration<double>(Clock::now() - blockStart).count());
+        }
+
+        producer.join();
+        return worstBlock;
+    }
+};
+
+//==============================================================================
+// Benchmarks
+//==============================================================================
+
+TEST_F(SchEngineCommandBenchmark, SingleVsBatchedSubmitRate) {
+    constexpr uint32_t kCommands = 1000000;
+
+    const double single = measureSubmitRate(kCommands, false);
+    const double batched = measureSubmitRate(kCommands, true);
+
+    std::printf("\n=== FFI Command Submission (%u commands) ===\n", kCommands);
+    std::printf("  single push  : %14.0f cmds/s\n", single);
+    std::printf("  batched (%2u) : %14.0f cmds/s (%.1fx)\n",
+                kBatchSize, batched, batched / single);
+
+    EXPECT_GT(single, 0.0);
+    EXPECT_GT(batched, 0.0);
+}
+
+TEST_F(SchEngineCommandBenchmark, StreamingWorstCaseDrain) {
+    const double worst = measureWorstDrain(1000000);
+
+    std::printf("\n  streaming worst-case block (drain + publish): %.2f us\n", worst * 1e6);
+}
+
+TEST_F(SchEngineCommandBenchmark, FullQueueDrainsInOneBlock) {
+    // Fill the queue completely, then time the single block that drains it
+    std::vector<sch_timed_command_t> batch;
+    for (uint32_t i = 0; i < SCH_COMMAND_QUEUE_CAPACITY - 1; ++i) {
+        batch.push_back(makeNoteCommand(i % kBlockSize, static_cast<int>(i), (i & 1) == 0));
+    }
+    ASSERT_EQ(sch_engine_push_commands(engine, batch.data(),
+                                       static_cast<uint32_t>(batch.size())), SCH_OK);
+
+    const auto start = Clock::now();
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 2, kBlockSize), SCH_OK);
+    const double drainSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const double blockBudget = kBlockSize / 48000.0;
+    std::printf("\n  full-queue drain (%u cmds): %.2f us (%.1f%% of the %.2f us block budget)\n",
+                SCH_COMMAND_QUEUE_CAPACITY - 1, drainSeconds * 1e6,
+                100.0 * drainSeconds / blockBudget, blockBudget * 1e6);
+
+    // Every queued command must have been consumed by that one block
+    ASSERT_EQ(sch_engine_push_commands(engine, batch.data(),
+                                       static_cast<uint32_t>(batch.size())), SCH_OK);
+}
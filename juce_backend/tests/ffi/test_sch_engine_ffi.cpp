@@ -10,6 +10,7 @@
 #include "ffi/sch_engine_ffi.h"
 #include "ffi/sch_engine_ffi.h"
 #include <cstring>
+#include <vector>
 
 //==============================================================================
 // Test Fixture
@@ -247,6 +248,32 @@ TEST_F(SchEngineFFITest, SetPosition_InvalidPosition_ReturnsInvalidArg) {
     EXPECT_EQ(result, SCH_ERR_INVALID_ARG);
 }
 
+TEST_F(SchEngineFFITest, SetPosition_WhilePlaying_TransportAdvancesFromIt) {
+    float buffer[480];
+    float* channels[] = { buffer };
+    sch_performance_state_t state;
+
+    // 480 frames at the default 48 kHz advance the transport by 10 ms
+    ASSERT_EQ(sch_engine_set_transport(engine, SCH_TRANSPORT_PLAYING), SCH_OK);
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 480), SCH_OK);
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+    EXPECT_NEAR(state.position, 0.01, 1e-9);
+
+    ASSERT_EQ(sch_engine_set_position(engine, 2.0), SCH_OK);
+    ASSERT_EQ(sch_engine_set_tempo(engine, 90.0), SCH_OK);
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 480), SCH_OK);
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+    EXPECT_NEAR(state.position, 2.01, 1e-9);
+    EXPECT_DOUBLE_EQ(state.tempo, 90.0);
+    EXPECT_TRUE(state.is_playing);
+
+    ASSERT_EQ(sch_engine_set_transport(engine, SCH_TRANSPORT_STOPPED), SCH_OK);
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 480), SCH_OK);
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+    EXPECT_DOUBLE_EQ(state.position, 0.0);
+    EXPECT_FALSE(state.is_playing);
+}
+
 //==============================================================================
 // MIDI Event Tests
 //==============================================================================
@@ -299,6 +326,178 @@ TEST_F(SchEngineFFITest, SetPerformanceBlend_InvalidUUIDs_ReturnsInvalidArg) {
     EXPECT_EQ(result, SCH_ERR_INVALID_ARG);
 }
 
+//==============================================================================
+// Telemetry Tests
+//==============================================================================
+
+TEST_F(SchEngineFFITest, GetPerformanceState_ReflectsBlendWhileIdle) {
+    const char* perf_a = "00000000-0000-0000-0000-000000000001";
+    const char* perf_b = "00000000-0000-0000-0000-000000000002";
+    ASSERT_EQ(sch_engine_set_performance_blend(engine, perf_a, perf_b, 0.25), SCH_OK);
+
+    sch_performance_state_t state;
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+
+    EXPECT_DOUBLE_EQ(state.blend_value, 0.25);
+    EXPECT_STREQ(state.performance_a_id, perf_a);
+    EXPECT_STREQ(state.performance_b_id, perf_b);
+}
+
+TEST_F(SchEngineFFITest, TelemetryRegion_HasExpectedLayout) {
+    const sch_telemetry_region_t* region = nullptr;
+    ASSERT_EQ(sch_engine_get_telemetry_region(engine, &region), SCH_OK);
+    ASSERT_NE(region, nullptr);
+
+    EXPECT_EQ(region->magic, SCH_TELEMETRY_MAGIC);
+    EXPECT_EQ(region->layout_version, SCH_TELEMETRY_LAYOUT_VERSION);
+    EXPECT_EQ(region->ring_capacity, SCH_TELEMETRY_RING_CAPACITY);
+    EXPECT_EQ(region->max_channels, SCH_TELEMETRY_MAX_CHANNELS);
+}
+
+TEST_F(SchEngineFFITest, ProcessBlock_PublishesSnapshotAndRing) {
+    const sch_telemetry_region_t* region = nullptr;
+    ASSERT_EQ(sch_engine_get_telemetry_region(engine, &region), SCH_OK);
+
+    float left[64];
+    float right[64];
+    float* channels[] = { left, right };
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(sch_engine_process_block(engine, channels, 2, 64), SCH_OK);
+    }
+
+    sch_performance_snapshot_t snapshot;
+    ASSERT_EQ(sch_performance_snapshot_read(&region->snapshot, &snapshot), SCH_OK);
+    EXPECT_EQ(snapshot.sequence % 2, 0u);
+    EXPECT_EQ(snapshot.block_index, 3u);
+    EXPECT_EQ(snapshot.sample_position, 192u);
+
+    uint64_t cursor = 0;
+    sch_telemetry_block_t blocks[8];
+    uint32_t count = 0;
+    ASSERT_EQ(sch_telemetry_ring_read(region, &cursor, blocks, 8, &count), SCH_OK);
+
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(cursor, 3u);
+    for (uint32_t i = 0; i < count; ++i) {
+        EXPECT_EQ(blocks[i].block_index, i);
+        EXPECT_EQ(blocks[i].num_frames, 64u);
+        EXPECT_EQ(blocks[i].channel_count, 2u);
+    }
+}
+
+TEST_F(SchEngineFFITest, TelemetryRing_SlowReaderSkipsToOldestRecord) {
+    const sch_telemetry_region_t* region = nullptr;
+    ASSERT_EQ(sch_engine_get_telemetry_region(engine, &region), SCH_OK);
+
+    for (uint32_t i = 0; i < SCH_TELEMETRY_RING_CAPACITY + 10; ++i) {
+        ASSERT_EQ(sch_engine_process_block(engine, nullptr, 0, 32), SCH_OK);
+    }
+
+    uint64_t cursor = 0;
+    sch_telemetry_block_t block;
+    uint32_t count = 0;
+    ASSERT_EQ(sch_telemetry_ring_read(region, &cursor, &block, 1, &count), SCH_OK);
+
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(block.block_index, 10u);
+    EXPECT_EQ(cursor, 11u);
+}
+
+//==============================================================================
+// Batched Command Tests
+//==============================================================================
+
+namespace {
+
+sch_timed_command_t makeTempoCommand(uint32_t sampleOffset, double tempo) {
+    sch_timed_command_t timed{};
+    timed.sample_offset = sampleOffset;
+    timed.command.type = SCH_CMD_SET_TEMPO;
+    timed.command.data.set_tempo.tempo = tempo;
+    return timed;
+}
+
+} // namespace
+
+TEST_F(SchEngineFFITest, PushCommands_NullCommands_ReturnsInvalidArg) {
+    EXPECT_EQ(sch_engine_push_commands(engine, nullptr, 4), SCH_ERR_INVALID_ARG);
+    EXPECT_EQ(sch_engine_push_commands(nullptr, nullptr, 0), SCH_ERR_INVALID_ARG);
+}
+
+TEST_F(SchEngineFFITest, PushCommands_OversizedBatch_RejectedAtomically) {
+    std::vector<sch_timed_command_t> batch(SCH_COMMAND_QUEUE_CAPACITY,
+                                          makeTempoCommand(0, 90.0));
+
+    EXPECT_EQ(sch_engine_push_commands(engine, batch.data(),
+                                       static_cast<uint32_t>(batch.size())),
+              SCH_ERR_REJECTED);
+
+    // Nothing from the rejected batch may have been applied
+    sch_performance_state_t state;
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+    EXPECT_DOUBLE_EQ(state.tempo, 120.0);
+}
+
+TEST_F(SchEngineFFITest, PushCommands_AppliedInTimestampOrder) {
+    float buffer[64];
+    float* channels[] = { buffer };
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 64), SCH_OK);
+
+    // Submitted out of order; the latest offset must win
+    const sch_timed_command_t batch[] = {
+        makeTempoCommand(48, 140.0),
+        makeTempoCommand(0, 100.0),
+        makeTempoCommand(16, 110.0),
+    };
+    ASSERT_EQ(sch_engine_push_commands(engine, batch, 3), SCH_OK);
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 64), SCH_OK);
+
+    sch_performance_state_t state;
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+    EXPECT_DOUBLE_EQ(state.tempo, 140.0);
+}
+
+TEST_F(SchEngineFFITest, PushCommands_OffsetPastBlock_CarriesOver) {
+    float buffer[64];
+    float* channels[] = { buffer };
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 64), SCH_OK);
+
+    const sch_timed_command_t command = makeTempoCommand(100, 150.0);
+    ASSERT_EQ(sch_engine_push_commands(engine, &command, 1), SCH_OK);
+
+    sch_performance_state_t state;
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 64), SCH_OK);
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+    EXPECT_DOUBLE_EQ(state.tempo, 120.0);
+
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 64), SCH_OK);
+    ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+    EXPECT_DOUBLE_EQ(state.tempo, 150.0);
+}
+
+TEST_F(SchEngineFFITest, PushCommands_OutOfOrderRemainder_CarriesOverIntact) {
+    float buffer[64];
+    float* channels[] = { buffer };
+    ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 64), SCH_OK);
+
+    // Slots 0 and 2 both carry over, in the opposite order to their slots
+    const sch_timed_command_t batch[] = {
+        makeTempoCommand(200, 150.0),
+        makeTempoCommand(10, 100.0),
+        makeTempoCommand(100, 130.0),
+    };
+    ASSERT_EQ(sch_engine_push_commands(engine, batch, 3), SCH_OK);
+
+    const double expectedTempo[] = { 100.0, 130.0, 130.0, 150.0, 150.0 };
+    for (double expected : expectedTempo) {
+        sch_performance_state_t state;
+        ASSERT_EQ(sch_engine_process_block(engine, channels, 1, 64), SCH_OK);
+        ASSERT_EQ(sch_engine_get_performance_state(engine, &state), SCH_OK);
+        EXPECT_DOUBLE_EQ(state.tempo, expected);
+    }
+}
+
 //==============================================================================
 // Memory Management Tests
 //==============================================================================
@@ -0,0 +1,328 @@
+//
+//  test_sch_instrument_process_benchmark.cpp
+//  White Room JUCE Instrument FFI Bridge Tests
+//
+//  Real-time path of the instrument FFI: caller-owned planar buffers,
+//  sample-offset MIDI, pre-resolved parameter handles. The benchmark
+//  measures what sch_instrument_process costs on top of calling the
+//  instrument's processBlock directly.
+//
+
+#include <gtest/gtest.h>
+#include "ffi/sch_instrument_ffi.h"
+#include "engine/instruments/InstrumentInstance.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using SchillingerEcosystem::Instrument::InstrumentInstance;
+
+constexpr int kBlockSize = 256;
+constexpr double kSampleRate = 48000.0;
+
+// Writes `gain` on every sample and a 1.0 impulse at each note-on position,
+// so tests can read back where MIDI landed and what the parameters were
+class ImpulseInstrument : public InstrumentInstance {
+public:
+    ImpulseInstrument() : InstrumentInstance("test.impulse", "Impulse") {}
+
+    std::vector<int> noteOnPositions;
+    std::vector<int> controllerNumbers;
+
+    bool initialize(double sampleRate, int bufferSize) override {
+        prepareToPlay(sampleRate, bufferSize);
+        return true;
+    }
+
+    void prepareToPlay(double sampleRate, int) override {
+        prepareParameterRamps(sampleRate);
+        noteOnPositions.reserve(4096);
+        controllerNumbers.reserve(4096);
+    }
+
+    void releaseResources() override {}
+
+    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override {
+        adoptPendingParameterRamps();
+        applyParameterRamps(buffer.getNumSamples());
+
+        const float gain = values[0].load(std::memory_order_relaxed);
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+            std::fill_n(buffer.getWritePointer(ch), buffer.getNumSamples(), gain);
+        }
+
+        for (const auto metadata : midiMessages) {
+            const auto* data = metadata.data;
+            if ((data[0] & 0xf0) == 0x90 && noteOnPositions.size() < noteOnPositions.capacity()) {
+                noteOnPositions.push_back(metadata.samplePosition);
+            }
+            if ((data[0] & 0xf0) == 0xb0 && controllerNumbers.size() < controllerNumbers.capacity()) {
+                controllerNumbers.push_back(data[1]);
+            }
+            if ((data[0] & 0xf0) == 0x90) {
+                for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+                    buffer.setSample(ch, metadata.samplePosition, 1.0f);
+                }
+            }
+        }
+    }
+
+    int getLatencySamples() const override { return 0; }
+    double getTailLengthSeconds() const override { return 0.0; }
+    bool acceptsMidi() const override { return true; }
+    bool producesMidi() const override { return false; }
+
+    std::vector<ParameterInfo> getAllParameters() const override {
+        return { parameters[0], parameters[1] };
+    }
+
+    const ParameterInfo* getParameterInfo(const juce::String& address) const override {
+        const int index = resolveParameterIndex(address);
+        return index >= 0 ? &parameters[static_cast<size_t>(index)] : nullptr;
+    }
+
+    float getParameterValue(const juce::String& address) const override {
+        return getParameterValueByIndex(resolveParameterIndex(address));
+    }
+
+    void setParameterValue(const juce::String& address, float value) override {
+        setParameterValueByIndex(resolveParameterIndex(address), value);
+    }
+
+    int resolveParameterIndex(const juce::String& address) const override {
+        for (size_t i = 0; i < parameters.size(); ++i) {
+            if (parameters[i].address == address) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    float getParameterValueByIndex(int parameterIndex) const override {
+        return parameterIndex >= 0 && parameterIndex < 2 ? values[static_cast<size_t>(parameterIndex)].load() : 0.0f;
+    }
+
+    void setParameterValueByIndex(int parameterIndex, float value) override {
+        if (parameterIndex >= 0 && parameterIndex < 2) {
+            values[static_cast<size_t>(parameterIndex)].store(value, std::memory_order_relaxed);
+        }
+    }
+
+    juce::MemoryBlock getStateInformation() const override { return {}; }
+    void setStateInformation(const void*, int) override {}
+    bool loadPreset(const juce::MemoryBlock&) override { return false; }
+    juce::MemoryBlock savePreset(const juce::String&) const override { return {}; }
+    bool hasCustomUI() const override { return false; }
+    juce::String getCustomUIClassName() const override { return {}; }
+    std::unique_ptr<juce::Component> createCustomUI() override { return nullptr; }
+    juce::String getType() const override { return "test"; }
+    juce::String getVersion() const override { return "1.0"; }
+    AudioFormat getAudioFormat() const override { return {}; }
+
+private:
+    std::array<ParameterInfo, 2> parameters{{
+        { "gain", "Gain", "", 0.0f, 1.0f, 0.5f, 0.5f, true, false, 0, "", "" },
+        { "tone", "Tone", "", 0.0f, 1.0f, 0.0f, 0.0f, true, false, 0, "", "" },
+    }};
+    std::array<std::atomic<float>, 2> values{{ 0.5f, 0.0f }};
+};
+
+sch_midi_event_t makeNoteOn(uint32_t sampleOffset, uint8_t note) {
+    sch_midi_event_t event{};
+    event.sample_offset = sampleOffset;
+    event.size = 3;
+    event.data[0] = 0x90;
+    event.data[1] = note;
+    event.data[2] = 100;
+    return event;
+}
+
+} // namespace
+
+//==============================================================================
+// Test Fixture
+//==============================================================================
+
+class SchInstrumentProcessTest : public ::testing::Test {
+protected:
+    ImpulseInstrument* impulse = nullptr;
+    sch_instrument_handle instrument = nullptr;
+    std::array<float, kBlockSize> left{};
+    std::array<float, kBlockSize> right{};
+    float* channels[2] = { left.data(), right.data() };
+
+    void SetUp() override {
+        auto owned = std::make_unique<ImpulseInstrument>();
+        impulse = owned.get();
+        instrument = sch_instrument_adopt_instance(std::move(owned));
+        ASSERT_NE(instrument, nullptr);
+        ASSERT_EQ(sch_instrument_prepare(instrument, kSampleRate, kBlockSize), SCH_OK);
+    }
+
+    void TearDown() override {
+        if (instrument) {
+            sch_instrument_destroy(instrument);
+            instrument = nullptr;
+        }
+    }
+};
+
+TEST_F(SchInstrumentProcessTest, ProcessRequiresPrepare) {
+    sch_instrument_handle unprepared = sch_instrument_adopt_instance(std::make_unique<ImpulseInstrument>());
+    EXPECT_EQ(sch_instrument_process(unprepared, channels, 2, kBlockSize, nullptr, 0), SCH_ERR_INVALID_STATE);
+    sch_instrument_destroy(unprepared);
+
+    EXPECT_EQ(sch_instrument_process(instrument, channels, 2, kBlockSize + 1, nullptr, 0), SCH_ERR_INVALID_ARG);
+    EXPECT_EQ(sch_instrument_process(instrument, nullptr, 2, kBlockSize, nullptr, 0), SCH_ERR_INVALID_ARG);
+}
+
+TEST_F(SchInstrumentProcessTest, RendersInPlaceAtMidiSampleOffsets) {
+    const std::array<sch_midi_event_t, 3> events{ makeNoteOn(0, 60), makeNoteOn(17, 62), makeNoteOn(200, 64) };
+
+    ASSERT_EQ(sch_instrument_process(instrument, channels, 2, kBlockSize, events.data(),
+                                     static_cast<int>(events.size())), SCH_OK);
+
+    EXPECT_EQ(impulse->noteOnPositions, (std::vector<int>{ 0, 17, 200 }));
+    EXPECT_FLOAT_EQ(left[17], 1.0f);
+    EXPECT_FLOAT_EQ(right[200], 1.0f);
+    EXPECT_FLOAT_EQ(left[18], 0.5f);
+}
+
+TEST_F(SchInstrumentProcessTest, OffsetsPastBlockClampToLastFrame) {
+    const auto late = makeNoteOn(10000, 60);
+    ASSERT_EQ(sch_instrument_process(instrument, channels, 2, 64, &late, 1), SCH_OK);
+
+    ASSERT_EQ(impulse->noteOnPositions.size(), 1u);
+    EXPECT_EQ(impulse->noteOnPositions[0], 63);
+}
+
+TEST_F(SchInstrumentProcessTest, LiveMidiArrivesAtStartOfNextBlock) {
+    EXPECT_EQ(sch_instrument_note_on(instrument, 60, 0.8f, 0), SCH_OK);
+    EXPECT_EQ(sch_instrument_all_notes_off(instrument, -1), SCH_OK);
+    EXPECT_TRUE(impulse->noteOnPositions.empty());
+
+    const auto blockEvent = makeNoteOn(32, 67);
+    ASSERT_EQ(sch_instrument_process(instrument, channels, 2, kBlockSize, &blockEvent, 1), SCH_OK);
+
+    EXPECT_EQ(impulse->noteOnPositions, (std::vector<int>{ 0, 32 }));
+    EXPECT_EQ(impulse->controllerNumbers.size(), 16u);
+}
+
+TEST_F(SchInstrumentProcessTest, ParameterHandlesResolveOnce) {
+    sch_parameter_handle_t gain = SCH_PARAMETER_HANDLE_INVALID;
+    sch_parameter_handle_t again = SCH_PARAMETER_HANDLE_INVALID;
+    ASSERT_EQ(sch_instrument_resolve_parameter(instrument, "gain", &gain), SCH_OK);
+    ASSERT_EQ(sch_instrument_resolve_parameter(instrument, "gain", &again), SCH_OK);
+    EXPECT_EQ(gain, again);
+
+    sch_parameter_handle_t missing = SCH_PARAMETER_HANDLE_INVALID;
+    EXPECT_EQ(sch_instrument_resolve_parameter(instrument, "nope", &missing), SCH_ERR_NOT_FOUND);
+    EXPECT_EQ(sch_instrument_set_parameter_by_handle(instrument, 42, 0.1f), SCH_ERR_INVALID_ARG);
+
+    // Jumps apply at the start of the next block, in order with queued ramps
+    ASSERT_EQ(sch_instrument_set_parameter_by_handle(instrument, gain, 0.25f), SCH_OK);
+    ASSERT_EQ(sch_instrument_process(instrument, channels, 2, kBlockSize, nullptr, 0), SCH_OK);
+    EXPECT_FLOAT_EQ(left[kBlockSize - 1], 0.25f);
+
+    float value = 0.0f;
+    ASSERT_EQ(sch_instrument_get_parameter_by_handle(instrument, gain, &value), SCH_OK);
+    EXPECT_FLOAT_EQ(value, 0.25f);
+
+    // A 20 ms ramp lands on its target within a few blocks
+    ASSERT_EQ(sch_instrument_set_parameter_smooth_by_handle(instrument, gain, 1.0f, 20.0), SCH_OK);
+    for (int block = 0; block < 8; ++block) {
+        ASSERT_EQ(sch_instrument_process(instrument, channels, 2, kBlockSize, nullptr, 0), SCH_OK);
+    }
+    EXPECT_FLOAT_EQ(left[0], 1.0f);
+}
+
+TEST_F(SchInstrumentProcessTest, CapturesInterleavedOutputForGetAudio) {
+    for (int block = 0; block < 6; ++block) {
+        ASSERT_EQ(sch_instrument_process(instrument, channels, 2, kBlockSize, nullptr, 0), SCH_OK);
+    }
+
+    // The ring holds four blocks; later blocks are dropped until it is read
+    std::vector<float> interleaved(2 * 8 * kBlockSize);
+    int frames = 0;
+    ASSERT_EQ(sch_instrument_get_audio(instrument, interleaved.data(), 8 * kBlockSize, &frames), SCH_OK);
+    EXPECT_EQ(frames, 4 * kBlockSize);
+    EXPECT_FLOAT_EQ(interleaved[0], 0.5f);
+    EXPECT_FLOAT_EQ(interleaved[2 * frames - 1], 0.5f);
+}
+
+//==============================================================================
+// Benchmark
+//==============================================================================
+
+TEST_F(SchInstrumentProcessTest, Benchmark) {
+    constexpr int kIterations = 20000;
+    constexpr int kEventsPerBlock = 8;
+    constexpr int kParameterSetsPerBlock = 2;
+
+    std::array<sch_midi_event_t, kEventsPerBlock> events{};
+    juce::MidiBuffer directMidi;
+    for (int i = 0; i < kEventsPerBlock; ++i) {
+        events[static_cast<size_t>(i)] = makeNoteOn(static_cast<uint32_t>(i * kBlockSize / kEventsPerBlock), 60);
+        directMidi.addEvent(events[static_cast<size_t>(i)].data, 3, static_cast<int>(events[static_cast<size_t>(i)].sample_offset));
+    }
+
+    sch_parameter_handle_t gain = SCH_PARAMETER_HANDLE_INVALID;
+    sch_parameter_handle_t tone = SCH_PARAMETER_HANDLE_INVALID;
+    ASSERT_EQ(sch_instrument_resolve_parameter(instrument, "gain", &gain), SCH_OK);
+    ASSERT_EQ(sch_instrument_resolve_parameter(instrument, "tone", &tone), SCH_OK);
+
+    std::vector<float> interleaved(2 * kBlockSize);
+    int frames = 0;
+
+    // Best of several runs: the FFI overhead is small against scheduler noise
+    auto bestOf = [](auto&& run) {
+        double best = 1.0e9;
+        for (int pass = 0; pass < 5; ++pass) {
+            best = std::min(best, run());
+        }
+        return best;
+    };
+
+    // Direct: host already holds a JUCE buffer and MidiBuffer
+    juce::AudioBuffer<float> directBuffer(channels, 2, kBlockSize);
+    const double directNs = bestOf([&] {
+        impulse->noteOnPositions.clear();
+        const auto start = Clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            impulse->setParameterValueByIndex(0, 0.5f);
+            impulse->setParameterValueByIndex(1, 0.25f);
+            impulse->processBlock(directBuffer, directMidi);
+        }
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kIterations;
+    });
+
+    // FFI: the same block through handles, packed MIDI and caller-owned channels.
+    // Draining the capture ring is timed too, so this is an upper bound.
+    const double ffiNs = bestOf([&] {
+        impulse->noteOnPositions.clear();
+        const auto start = Clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            sch_instrument_set_parameter_by_handle(instrument, gain, 0.5f);
+            sch_instrument_set_parameter_by_handle(instrument, tone, 0.25f);
+            sch_instrument_process(instrument, channels, 2, kBlockSize, events.data(), kEventsPerBlock);
+            sch_instrument_get_audio(instrument, interleaved.data(), kBlockSize, &frames);
+        }
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kIterations;
+    });
+
+    const double overheadNs = ffiNs - directNs;
+
+    printf("\n=== sch_instrument_process Benchmark ===\n");
+    printf("Block: %d samples, %d MIDI events, %d parameter sets\n", kBlockSize, kEventsPerBlock, kParameterSetsPerBlock);
+    printf("Direct processBlock: %.1f ns/block\n", directNs);
+    printf("FFI process:         %.1f ns/block\n", ffiNs);
+    printf("Overhead:            %.1f ns/block\n", overheadNs);
+
+    EXPECT_LT(overheadNs, 1000.0);
+}
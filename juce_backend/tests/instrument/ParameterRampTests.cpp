@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+#include "engine/instruments/InstrumentInstance.h"
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace SchillingerEcosystem::Instrument;
+
+/**
+ * Parameter ramp tests
+ *
+ * Posts ramps through InstrumentInstance's queue and renders them through
+ * PluginInstrumentInstance::processBlock, checking that a ramp lands exactly
+ * on its target at the requested sample and that MIDI keeps its sample
+ * offsets while the block is split into sub-blocks for the plugin.
+ */
+
+namespace
+{
+
+constexpr double kSampleRate = 48000.0;
+constexpr int kBlockSize = 1024;
+
+// Writes its gain parameter to every sample it is given, and records the size
+// of each processBlock call and the note-on offsets it saw within it
+class RampRecordingPlugin : public juce::AudioPluginInstance
+{
+public:
+    struct Call
+    {
+        int numSamples = 0;
+        std::vector<int> noteOnPositions;
+    };
+
+    RampRecordingPlugin()
+    {
+        addParameter(gain = new juce::AudioParameterFloat("gain", "Gain", 0.0f, 1.0f, 0.5f));
+        addParameter(new juce::AudioParameterFloat("tone", "Tone", 0.0f, 1.0f, 0.0f));
+    }
+
+    std::vector<Call> calls;
+
+    void fillInPluginDescription(juce::PluginDescription& description) const override
+    {
+        description.name = getName();
+        description.pluginFormatName = "Test";
+    }
+
+    const juce::String getName() const override { return "Ramp Recorder"; }
+
+    void prepareToPlay(double, int) override {}
+    void releaseResources() override {}
+
+    using juce::AudioPluginInstance::processBlock;
+
+    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override
+    {
+        Call call;
+        call.numSamples = buffer.getNumSamples();
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            std::fill_n(buffer.getWritePointer(ch), buffer.getNumSamples(), gain->get());
+
+        for (const auto metadata : midiMessages)
+        {
+            if ((metadata.data[0] & 0xf0) == 0x90)
+                call.noteOnPositions.push_back(metadata.samplePosition);
+        }
+
+        calls.push_back(std::move(call));
+    }
+
+    double getTailLengthSeconds() const override { return 0.0; }
+    bool acceptsMidi() const override { return true; }
+    bool producesMidi() const override { return false; }
+
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+    bool hasEditor() const override { return false; }
+
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const juce::String getProgramName(int) override { return {}; }
+    void changeProgramName(int, const juce::String&) override {}
+
+    void getStateInformation(juce::MemoryBlock&) override {}
+    void setStateInformation(const void*, int) override {}
+
+private:
+    juce::AudioParameterFloat* gain = nullptr;
+};
+
+// Exposes per-sample ramp values, as a natively rendering instrument would pull them
+class RampedPluginInstance : public PluginInstrumentInstance
+{
+public:
+    using PluginInstrumentInstance::PluginInstrumentInstance;
+
+    bool fillRamp(int parameterIndex, float* destination, int numSamples)
+    {
+        adoptPendingParameterRamps();
+        return fillParameterRamp(parameterIndex, destination, numSamples);
+    }
+};
+
+} // namespace
+
+//==============================================================================
+// Test Fixture
+//==============================================================================
+
+class ParameterRampTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        auto owned = std::make_unique<RampRecordingPlugin>();
+        plugin = owned.get();
+        instrument = std::make_unique<RampedPluginInstance>("test.ramp", std::move(owned));
+        ASSERT_TRUE(instrument->initialize(kSampleRate, kBlockSize));
+    }
+
+    // Renders one mono block and returns what the plugin wrote
+    std::vector<float> render(juce::MidiBuffer& midi)
+    {
+        juce::AudioBuffer<float> buffer(1, kBlockSize);
+        instrument->processBlock(buffer, midi);
+
+        const float* samples = buffer.getWritePointer(0);
+        return std::vector<float>(samples, samples + kBlockSize);
+    }
+
+    std::vector<float> render()
+    {
+        juce::MidiBuffer midi;
+        return render(midi);
+    }
+
+    static juce::MidiBuffer makeNoteOns(const std::vector<int>& positions)
+    {
+        juce::MidiBuffer midi;
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            const juce::uint8 noteOn[] = { 0x90, static_cast<juce::uint8>(60 + i), 100 };
+            midi.addEvent(noteOn, 3, positions[i]);
+        }
+        return midi;
+    }
+
+    RampRecordingPlugin* plugin = nullptr;
+    std::unique_ptr<RampedPluginInstance> instrument;
+};
+
+TEST_F(ParameterRampTests, RampReachesTargetAtRequestedOffset)
+{
+    // 10 ms at 48 kHz is 480 samples, a whole number of 32-sample sub-blocks
+    instrument->setParameterRampResolution(32);
+    ASSERT_TRUE(instrument->postParameterRamp(0, 1.0f, 10.0));
+    auto gain = render();
+
+    EXPECT_EQ(gain[0], 0.5f);
+    EXPECT_LT(gain[479], 1.0f);
+    EXPECT_EQ(gain[480], 1.0f);
+    EXPECT_EQ(gain.back(), 1.0f);
+    EXPECT_TRUE(std::is_sorted(gain.begin(), gain.end()));
+    EXPECT_EQ(instrument->getNumActiveParameterRamps(), 0);
+
+    // Per-sample resolution lands on offsets between sub-block boundaries
+    instrument->setParameterRampResolution(1);
+    ASSERT_TRUE(instrument->postParameterRamp(0, 0.0f, 500.0 / 48.0));
+    gain = render();
+
+    EXPECT_GT(gain[499], 0.0f);
+    EXPECT_EQ(gain[500], 0.0f);
+    EXPECT_EQ(gain.back(), 0.0f);
+
+    // Native rendering sees the same arrival sample
+    std::vector<float> tone(kBlockSize);
+    ASSERT_TRUE(instrument->postParameterRamp(1, 1.0f, 500.0 / 48.0));
+    ASSERT_TRUE(instrument->fillRamp(1, tone.data(), static_cast<int>(tone.size())));
+
+    EXPECT_EQ(tone[0], 0.0f);
+    EXPECT_LT(tone[499], 1.0f);
+    EXPECT_EQ(tone[500], 1.0f);
+    EXPECT_EQ(tone.back(), 1.0f);
+}
+
+TEST_F(ParameterRampTests, ProcessBlockKeepsMidiOffsetsAcrossSubBlocks)
+{
+    // Notes on, either side of and between sub-block boundaries, before and after the ramp ends
+    const std::vector<int> notePositions = { 0, 31, 32, 33, 100, 479, 480, 700, 1023 };
+    auto midi = makeNoteOns(notePositions);
+
+    instrument->setParameterRampResolution(32);
+    ASSERT_TRUE(instrument->postParameterRamp(0, 1.0f, 10.0));
+    const auto gain = render(midi);
+
+    // Sub-blocks of 32 up to and including the one that lands the ramp at 480,
+    // then the rest of the block in one call
+    ASSERT_EQ(plugin->calls.size(), 17u);
+    for (size_t i = 0; i + 1 < plugin->calls.size(); ++i)
+        EXPECT_EQ(plugin->calls[i].numSamples, 32) << "sub-block " << i;
+    EXPECT_EQ(plugin->calls.back().numSamples, kBlockSize - 512);
+
+    // Each note arrives once, in the sub-block that covers it, at the same block offset
+    std::vector<int> seenPositions;
+    int subBlockStart = 0;
+    for (const auto& call : plugin->calls)
+    {
+        for (int position : call.noteOnPositions)
+        {
+            EXPECT_GE(position, 0);
+            EXPECT_LT(position, call.numSamples);
+            seenPositions.push_back(subBlockStart + position);
+        }
+        subBlockStart += call.numSamples;
+    }
+    EXPECT_EQ(subBlockStart, kBlockSize);
+    EXPECT_EQ(seenPositions, notePositions);
+
+    // MIDI handed back to the caller is in block coordinates again
+    std::vector<int> returnedPositions;
+    for (const auto metadata : midi)
+        returnedPositions.push_back(metadata.samplePosition);
+    EXPECT_EQ(returnedPositions, notePositions);
+
+    // The parameter the plugin sees reaches the target on the requested sample
+    EXPECT_EQ(gain[0], 0.5f);
+    EXPECT_LT(gain[479], 1.0f);
+    EXPECT_EQ(gain[480], 1.0f);
+    EXPECT_EQ(gain.back(), 1.0f);
+    EXPECT_TRUE(std::is_sorted(gain.begin(), gain.end()));
+
+    // With no ramp running the next block reaches the plugin whole
+    plugin->calls.clear();
+    auto nextMidi = makeNoteOns({ 5, 900 });
+    render(nextMidi);
+
+    ASSERT_EQ(plugin->calls.size(), 1u);
+    EXPECT_EQ(plugin->calls[0].numSamples, kBlockSize);
+    EXPECT_EQ(plugin->calls[0].noteOnPositions, (std::vector<int>{ 5, 900 }));
+}
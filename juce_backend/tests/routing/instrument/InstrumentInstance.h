@@ -0,0 +1,24 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace schill {
+namespace midi {
+
+/**
+ * Test double for the instrument instance MidiRoutingEngine delivers to.
+ * Counts the blocks and events it receives.
+ */
+class InstrumentInstance {
+public:
+    void processMidi(const juce::MidiBuffer& buffer) {
+        ++blocksReceived;
+        eventsReceived += buffer.getNumEvents();
+    }
+
+    int blocksReceived = 0;
+    int eventsReceived = 0;
+};
+
+} // namespace midi
+} // namespace schill
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "instrument/InstrumentInstance.h"
+
+namespace schill {
+namespace midi {
+
+/**
+ * Test double for the named-instance lookup MidiRoutingEngine binds its
+ * destinations against.
+ */
+class InstrumentManager {
+public:
+    std::shared_ptr<InstrumentInstance> addInstance(const std::string& name) {
+        auto instance = std::make_shared<InstrumentInstance>();
+        instances[name] = instance;
+        return instance;
+    }
+
+    void removeInstance(const std::string& name) { instances.erase(name); }
+
+    std::shared_ptr<InstrumentInstance> getInstance(const std::string& name) const {
+        auto it = instances.find(name);
+        return it != instances.end() ? it->second : nullptr;
+    }
+
+    std::vector<std::shared_ptr<InstrumentInstance>> getAllInstances() const {
+        std::vector<std::shared_ptr<InstrumentInstance>> all;
+        for (const auto& [name, instance] : instances) {
+            all.push_back(instance);
+        }
+        return all;
+    }
+
+private:
+    std::map<std::string, std::shared_ptr<InstrumentInstance>> instances;
+};
+
+} // namespace midi
+} // namespace schill
@@ -0,0 +1,363 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "src/frontend/telemetry/ParameterTelemetryRecorder.h"
+
+/**
+ * ParameterTelemetryRecorder tests
+ *
+ * Checks that parameter changes become fixed-size events with interned
+ * parameter indices and sequence IDs, that the JSONL flush and the columnar
+ * log both reproduce them exactly, that the log survives truncation, and
+ * reports the recording cost per event and the log size per event.
+ */
+class ParameterTelemetryRecorderTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        logFile = juce::File::createTempFile(".ptlog");
+    }
+
+    void TearDown() override {
+        logFile.deleteFile();
+    }
+
+    // Automation-like sweeps: each parameter moves in small steps, never
+    // repeating a value (the empty callback blocker would skip it)
+    static float automationValue(int parameter, int step) {
+        return std::fmod(0.05f + 0.37f * static_cast<float>(parameter) + 0.0007f * static_cast<float>(step), 1.0f);
+    }
+
+    juce::File logFile;
+};
+
+//==============================================================================
+// Interning
+//==============================================================================
+
+TEST_F(ParameterTelemetryRecorderTests, InternsParameterIDs) {
+    ParameterTelemetryRecorder recorder(256);
+
+    EXPECT_EQ(recorder.registerParameter("op1_ratio"), 0);
+    EXPECT_EQ(recorder.registerParameter("masterVolume"), 1);
+    EXPECT_EQ(recorder.registerParameter("op1_ratio"), 0);
+    EXPECT_EQ(recorder.getNumParameters(), 2);
+
+    EXPECT_EQ(recorder.getParameterIndex("masterVolume"), 1);
+    EXPECT_EQ(recorder.getParameterIndex("unknown"), -1);
+    EXPECT_EQ(recorder.getParameterID(0), "op1_ratio");
+    EXPECT_TRUE(recorder.getParameterID(5).isEmpty());
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(recorder.registerParameter("param_" + juce::String(i)), i + 2);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(recorder.getParameterIndex("param_" + juce::String(i)), i + 2);
+    }
+}
+
+TEST_F(ParameterTelemetryRecorderTests, UnregisteredParametersAreDropped) {
+    ParameterTelemetryRecorder recorder(256);
+    recorder.registerParameter("cutoff");
+
+    recorder.parameterChanged("resonance", 0.7f);
+    EXPECT_EQ(recorder.getNumQueuedEvents(), 0);
+    EXPECT_EQ(recorder.getNumDroppedEvents(), 1u);
+}
+
+//==============================================================================
+// Recording
+//==============================================================================
+
+TEST_F(ParameterTelemetryRecorderTests, RecordsPreviousValueAndSequence) {
+    ParameterTelemetryRecorder recorder(256);
+    recorder.registerParameter("cutoff", 0.25f);
+    recorder.registerParameter("resonance");
+
+    recorder.parameterChanged("cutoff", 0.5f);
+    recorder.parameterChanged("resonance", 0.1f);
+    recorder.parameterChanged("cutoff", 0.75f);
+
+    // Empty callback blocker: no event when nothing changed
+    recorder.parameterChanged("cutoff", 0.75f);
+
+    ParameterChangeEvent events[8];
+    ASSERT_EQ(recorder.drainEvents(events, 8), 3);
+
+    EXPECT_EQ(events[0].sequence, 0u);
+    EXPECT_EQ(events[0].parameterIndex, 0);
+    EXPECT_FLOAT_EQ(events[0].previousValue, 0.25f);
+    EXPECT_FLOAT_EQ(events[0].newValue, 0.5f);
+    EXPECT_FLOAT_EQ(events[0].getDelta(), 0.25f);
+
+    EXPECT_EQ(events[1].sequence, 1u);
+    EXPECT_EQ(events[1].parameterIndex, 1);
+    EXPECT_FLOAT_EQ(events[1].previousValue, 0.0f);
+
+    EXPECT_EQ(events[2].sequence, 2u);
+    EXPECT_FLOAT_EQ(events[2].previousValue, 0.5f);
+    EXPECT_FLOAT_EQ(events[2].newValue, 0.75f);
+    EXPECT_GT(events[2].timestampMs, 0);
+}
+
+TEST_F(ParameterTelemetryRecorderTests, FullQueueDropsAndCounts) {
+    ParameterTelemetryRecorder recorder(16);
+    const int index = recorder.registerParameter("cutoff");
+
+    int queued = 0;
+    for (int i = 1; i <= 40; ++i) {
+        queued += recorder.recordChange(index, static_cast<float>(i)) ? 1 : 0;
+    }
+
+    EXPECT_EQ(queued, recorder.getNumQueuedEvents());
+    EXPECT_EQ(static_cast<uint64_t>(40 - queued), recorder.getNumDroppedEvents());
+}
+
+TEST_F(ParameterTelemetryRecorderTests, FlushEventsWritesJSONL) {
+    ParameterTelemetryRecorder recorder(256);
+    recorder.registerParameter("masterVolume");
+    recorder.parameterChanged("masterVolume", 0.8f);
+    recorder.recordChange(0, 0.6f, true);
+
+    const auto jsonl = recorder.flushEvents();
+    juce::StringArray lines;
+    lines.addLines(jsonl.trim());
+    ASSERT_EQ(lines.size(), 2);
+
+    const auto first = juce::JSON::parse(lines[0]);
+    EXPECT_EQ(first["event_type"].toString(), "parameter_change");
+    EXPECT_EQ(first["event_id"].toString(), recorder.getSessionID() + "-0");
+    EXPECT_EQ(first["parameter_id"].toString(), "masterVolume");
+    EXPECT_NEAR(static_cast<double>(first["new_value"]), 0.8, 1e-6);
+    EXPECT_FALSE(static_cast<bool>(first["is_undo"]));
+
+    const auto second = juce::JSON::parse(lines[1]);
+    EXPECT_EQ(second["event_id"].toString(), recorder.getSessionID() + "-1");
+    EXPECT_NEAR(static_cast<double>(second["previous_value"]), 0.8, 1e-6);
+    EXPECT_NEAR(static_cast<double>(second["delta"]), 0.2, 1e-6);
+    EXPECT_TRUE(static_cast<bool>(second["is_undo"]));
+
+    EXPECT_TRUE(recorder.flushEvents().isEmpty());
+}
+
+//==============================================================================
+// Columnar log
+//==============================================================================
+
+TEST_F(ParameterTelemetryRecorderTests, ColumnsRoundTripExactly) {
+    std::vector<ParameterChangeEvent> events;
+    for (int i = 0; i < 500; ++i) {
+        ParameterChangeEvent event;
+        event.sequence = static_cast<uint64_t>(i * 3);
+        event.timestampMs = 1700000000000LL + i / 7;
+        event.parameterIndex = static_cast<uint16_t>(i % 5 == 0 ? 300 : i % 3);
+        event.previousValue = (i % 11 == 0) ? -1.5f : automationValue(event.parameterIndex, i - 1);
+        event.newValue = automationValue(event.parameterIndex, i);
+        event.durationMs = i % 13;
+        event.isUndo = static_cast<uint8_t>(i % 17 == 0);
+        events.push_back(event);
+    }
+
+    juce::MemoryOutputStream columns;
+    ParameterTelemetryLog::encodeColumns(events.data(), static_cast<int>(events.size()), columns);
+
+    std::vector<ParameterChangeEvent> decoded;
+    ASSERT_TRUE(ParameterTelemetryLog::decodeColumns(columns.getData(), columns.getDataSize(),
+                                                     static_cast<int>(events.size()), decoded));
+    ASSERT_EQ(decoded.size(), events.size());
+    EXPECT_EQ(std::memcmp(decoded.data(), events.data(), events.size() * sizeof(ParameterChangeEvent)), 0);
+
+    // A short buffer is rejected rather than half-decoded
+    std::vector<ParameterChangeEvent> truncated;
+    EXPECT_FALSE(ParameterTelemetryLog::decodeColumns(columns.getData(), columns.getDataSize() - 1,
+                                                      static_cast<int>(events.size()), truncated));
+    EXPECT_TRUE(truncated.empty());
+}
+
+TEST_F(ParameterTelemetryRecorderTests, BackgroundWriterLogReplays) {
+    ParameterTelemetryRecorder recorder(4096);
+    for (int p = 0; p < 4; ++p) {
+        recorder.registerParameter("param_" + juce::String(p));
+    }
+
+    ASSERT_TRUE(recorder.startWriting(logFile, 5).wasOk());
+    EXPECT_TRUE(recorder.isWriting());
+
+    std::vector<float> recorded;
+    for (int step = 0; step < 20000; ++step) {
+        const int p = step % 4;
+        const float value = automationValue(p, step);
+
+        // Stay within one ring's worth of the writer so nothing is dropped
+        while (recorder.getNumQueuedEvents() > 2048) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_TRUE(recorder.recordChange(p, value));
+        recorded.push_back(value);
+
+        // Parameters registered mid-session reach the log dictionary too
+        if (step == 10000) {
+            recorder.registerParameter("late_param");
+            ASSERT_TRUE(recorder.recordChange(4, 0.5f));
+            recorded.push_back(0.5f);
+        }
+    }
+
+    recorder.stopWriting();
+    EXPECT_FALSE(recorder.isWriting());
+
+    ParameterTelemetryLog::Contents contents;
+    ASSERT_TRUE(ParameterTelemetryLog::read(logFile, contents).wasOk());
+
+    EXPECT_EQ(contents.sessionID, recorder.getSessionID());
+    ASSERT_EQ(contents.parameterIDs.size(), 5);
+    EXPECT_EQ(contents.parameterIDs[4], "late_param");
+    ASSERT_EQ(contents.events.size(), recorded.size());
+
+    for (size_t i = 0; i < recorded.size(); ++i) {
+        ASSERT_EQ(contents.events[i].sequence, i);
+        ASSERT_EQ(contents.events[i].newValue, recorded[i]);
+    }
+    EXPECT_EQ(contents.events[10001].parameterIndex, 4);
+}
+
+TEST_F(ParameterTelemetryRecorderTests, TruncatedLogKeepsCompleteBlocks) {
+    std::vector<ParameterChangeEvent> events(100);
+    for (size_t i = 0; i < events.size(); ++i) {
+        events[i].sequence = i;
+        events[i].newValue = static_cast<float>(i);
+    }
+
+    {
+        juce::FileOutputStream out(logFile);
+        ASSERT_TRUE(out.openedOk());
+        out.truncate();
+        ASSERT_TRUE(ParameterTelemetryLog::writeHeader(out, "session"));
+        ASSERT_TRUE(ParameterTelemetryLog::writeDictionaryBlock(out, juce::StringArray("cutoff"), 0));
+        ASSERT_TRUE(ParameterTelemetryLog::writeEventBlock(out, events.data(), 60));
+        ASSERT_TRUE(ParameterTelemetryLog::writeEventBlock(out, events.data() + 60, 40));
+    }
+
+    // Cut the last block in half, as if the process died mid-write
+    juce::MemoryBlock data;
+    ASSERT_TRUE(logFile.loadFileAsData(data));
+    ASSERT_TRUE(logFile.replaceWithData(data.getData(), data.getSize() - 10));
+
+    ParameterTelemetryLog::Contents contents;
+    ASSERT_TRUE(ParameterTelemetryLog::read(logFile, contents).wasOk());
+    EXPECT_EQ(contents.sessionID, "session");
+    EXPECT_EQ(contents.parameterIDs[0], "cutoff");
+    ASSERT_EQ(contents.events.size(), 60u);
+    EXPECT_EQ(contents.events[59].newValue, 59.0f);
+
+    // Not a telemetry log at all
+    ASSERT_TRUE(logFile.replaceWithText("{\"event_type\":\"parameter_change\"}"));
+    EXPECT_TRUE(ParameterTelemetryLog::read(logFile, contents).failed());
+}
+
+//==============================================================================
+// Concurrency
+//==============================================================================
+
+TEST_F(ParameterTelemetryRecorderTests, ConcurrentProducerAndWriterLoseNothingSilently) {
+    ParameterTelemetryRecorder recorder(1024);
+    recorder.registerParameter("a");
+    recorder.registerParameter("b");
+    ASSERT_TRUE(recorder.startWriting(logFile, 1).wasOk());
+
+    constexpr int numChanges = 50000;
+    std::atomic<int> queued{0};
+
+    // Two non-message threads share the audio ring; collisions drop and count
+    auto produce = [&](int parameter) {
+        for (int i = 0; i < numChanges; ++i) {
+            if (recorder.recordChange(parameter, static_cast<float>(i + 1))) {
+                queued.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    std::thread first(produce, 0);
+    std::thread second(produce, 1);
+    first.join();
+    second.join();
+    recorder.stopWriting();
+
+    ParameterTelemetryLog::Contents contents;
+    ASSERT_TRUE(ParameterTelemetryLog::read(logFile, contents).wasOk());
+
+    EXPECT_EQ(contents.events.size(), static_cast<size_t>(queued.load()));
+    EXPECT_EQ(static_cast<uint64_t>(queued.load()) + recorder.getNumDroppedEvents(), 2u * numChanges);
+
+    for (size_t i = 1; i < contents.events.size(); ++i) {
+        ASSERT_GT(contents.events[i].sequence, contents.events[i - 1].sequence);
+    }
+}
+
+//==============================================================================
+// Benchmark
+//==============================================================================
+
+TEST_F(ParameterTelemetryRecorderTests, BenchmarkRecordingAndLogSize) {
+    constexpr int numParameters = 8;
+    constexpr int numChanges = 200000;
+
+    ParameterTelemetryRecorder recorder(65536);
+    juce::StringArray ids;
+    for (int p = 0; p < numParameters; ++p) {
+        ids.add("synth_param_" + juce::String(p));
+        recorder.registerParameter(ids[p]);
+    }
+
+    std::vector<ParameterChangeEvent> drained(65536);
+    std::vector<ParameterChangeEvent> all;
+    all.reserve(numChanges);
+
+    double recordSeconds = 0.0;
+    int step = 0;
+    while (step < numChanges) {
+        const int batch = std::min(60000, numChanges - step);
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < batch; ++i, ++step) {
+            const int p = step % numParameters;
+            recorder.parameterChanged(ids[p], automationValue(p, step / numParameters));
+        }
+        recordSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const int n = recorder.drainEvents(drained.data(), static_cast<int>(drained.size()));
+        all.insert(all.end(), drained.begin(), drained.begin() + n);
+    }
+
+    ASSERT_EQ(all.size(), static_cast<size_t>(numChanges));
+    EXPECT_EQ(recorder.getNumDroppedEvents(), 0u);
+
+    {
+        juce::FileOutputStream out(logFile);
+        ASSERT_TRUE(out.openedOk());
+        out.truncate();
+        ParameterTelemetryLog::writeHeader(out, recorder.getSessionID());
+        ParameterTelemetryLog::writeDictionaryBlock(out, ids, 0);
+        for (size_t i = 0; i < all.size(); i += ParameterTelemetryLog::blockSize) {
+            const int n = static_cast<int>(std::min<size_t>(ParameterTelemetryLog::blockSize, all.size() - i));
+            ParameterTelemetryLog::writeEventBlock(out, all.data() + i, n);
+        }
+    }
+
+    // What the previous JSONL format would have cost for the same session
+    juce::MemoryOutputStream jsonl;
+    for (const auto& event : all) {
+        event.writeJSON(jsonl, recorder.getSessionID(), ids[event.parameterIndex]);
+        jsonl << "\n";
+    }
+
+    const double bytesPerEvent = static_cast<double>(logFile.getSize()) / numChanges;
+    printf("\n=== ParameterTelemetryRecorder: %d automation changes, %d parameters ===\n", numChanges, numParameters);
+    printf("  parameterChanged:      %8.1f ns/event\n", 1e9 * recordSeconds / numChanges);
+    printf("  columnar log:          %8.2f bytes/event\n", bytesPerEvent);
+    printf("  JSONL:                 %8.2f bytes/event\n", static_cast<double>(jsonl.getDataSize()) / numChanges);
+
+    EXPECT_LT(bytesPerEvent, 12.0);
+}
@@ -187,6 +187,35 @@ TEST(AudioEngineUndoTest, ComputeDiffDetectsInstrumentChanges)
     EXPECT_GT(diff.instrumentChanges.size(), 0);
 }
 
+TEST(AudioEngineUndoTest, ComputeDiffReportsOnlyEditedElements)
+{
+    SongState before;
+    before.id = "test-song";
+    for (int i = 0; i < 4096; ++i)
+    {
+        before.instrumentIds.add("inst_" + juce::String(i));
+        before.mixGains.add(1.0);
+    }
+
+    // Unedited copies share storage and diff to nothing
+    SongState after = before;
+    EXPECT_FALSE(AudioEngineUndo::computeDiff(before, after).hasChanges());
+
+    after.instrumentIds.set(3000, "drums");
+    after.mixGains.set(17, 0.25);
+
+    auto diff = AudioEngineUndo::computeDiff(before, after);
+
+    ASSERT_EQ(diff.instrumentChanges.size(), 1);
+    EXPECT_EQ(diff.instrumentChanges[0].role, "role_3000");
+    EXPECT_EQ(diff.instrumentChanges[0].oldInstrumentId, "inst_3000");
+    EXPECT_EQ(diff.instrumentChanges[0].newInstrumentId, "drums");
+
+    ASSERT_EQ(diff.parameterChanges.size(), 1);
+    EXPECT_EQ(diff.parameterChanges[0].parameterPath, "mix.gains.17");
+    EXPECT_DOUBLE_EQ(diff.parameterChanges[0].newValue, 0.25);
+}
+
 TEST(AudioEngineUndoTest, SmoothTransitionGeneratesCorrectValues)
 {
     double oldValue = 0.0;
@@ -7,6 +7,8 @@
 #include <thread>
 #include <vector>
 #include <chrono>
+#include <cstdio>
+#include <unordered_set>
 
 // ============================================================================
 // SongState Tests
@@ -296,6 +298,120 @@ TEST(UndoStateTest, SnapshotIsThreadSafe)
     }
 }
 
+// ============================================================================
+// Structural Sharing Tests
+// ============================================================================
+
+TEST(SongStateTest, EditCopiesOnlyTouchedPath)
+{
+    SongState original;
+    for (int i = 0; i < 5000; ++i)
+    {
+        original.instrumentIds.add("inst_" + juce::String(i));
+        original.mixGains.add(1.0);
+    }
+
+    auto edited = original.clone();
+    EXPECT_TRUE(edited->instrumentIds.sharesStorageWith(original.instrumentIds));
+
+    edited->instrumentIds.set(1234, "replaced");
+    edited->mixGains.add(0.5);
+
+    // The original is untouched and the copy sees its own edits
+    EXPECT_EQ(original.instrumentIds[1234], "inst_1234");
+    EXPECT_EQ(edited->instrumentIds[1234], "replaced");
+    EXPECT_EQ(original.mixGains.size(), 5000);
+    EXPECT_EQ(edited->mixGains.size(), 5001);
+    EXPECT_EQ(edited->instrumentIds[4999], "inst_4999");
+
+    // Only the edited paths are new storage: a few nodes, not 5000 elements
+    std::unordered_set<const void*> visited;
+    const size_t originalBytes = original.addUniqueStorageBytes(visited);
+    const size_t editBytes = edited->addUniqueStorageBytes(visited);
+    EXPECT_LT(editBytes * 20, originalBytes);
+}
+
+TEST(SongStateTest, UndoHistoryMemoryFollowsEdits)
+{
+    auto state = std::make_shared<SongState>();
+    for (int i = 0; i < 10000; ++i)
+    {
+        state->instrumentIds.add("inst_" + juce::String(i));
+        state->mixGains.add(0.0);
+        state->mixPans.add(0.0);
+    }
+
+    std::vector<std::shared_ptr<SongState>> history { state };
+    for (int step = 0; step < 2000; ++step)
+    {
+        auto next = history.back()->clone();
+        next->mixGains.set((step * 7919) % 10000, step * 0.001);
+        history.push_back(next);
+    }
+
+    std::unordered_set<const void*> visited;
+    const size_t baseBytes = history.front()->addUniqueStorageBytes(visited);
+    size_t historyBytes = 0;
+    for (size_t i = 1; i < history.size(); ++i)
+    {
+        historyBytes += history[i]->addUniqueStorageBytes(visited);
+    }
+
+    // A deep copy per step would be 2000 full songs
+    const size_t perStep = historyBytes / 2000;
+    EXPECT_LT(perStep * 10, baseBytes);
+
+    printf("\n=== Undo history, 10k-instrument song, 2000 single-gain edits ===\n");
+    printf("  song: %zu KB, history: %zu KB (%zu bytes/step, deep copies would be %zu MB)\n",
+           baseBytes / 1024, historyBytes / 1024, perStep, baseBytes * 2000 / (1024 * 1024));
+}
+
+TEST(UndoStateTest, ScopedReadSeesPublishedState)
+{
+    UndoState undoState;
+
+    auto state = std::make_shared<SongState>();
+    state->id = "test-song";
+    state->activePerformanceId = "piano";
+    undoState.setCurrentState(state);
+
+    {
+        UndoState::ScopedRead current(undoState);
+        EXPECT_EQ(current->id, "test-song");
+        EXPECT_EQ(&*current, state.get());
+    }
+
+    // Superseded versions are released once no reader holds them
+    std::weak_ptr<SongState> weak = state;
+    state.reset();
+    undoState.setCurrentState(std::make_shared<SongState>());
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(UndoStateTest, RetiredStateOutlivesActiveReader)
+{
+    UndoState undoState;
+
+    auto first = std::make_shared<SongState>();
+    first->id = "first";
+    first->activePerformanceId = "piano";
+    undoState.setCurrentState(first);
+    std::weak_ptr<SongState> weak = first;
+    first.reset();
+
+    UndoState::ScopedRead pinned(undoState);
+
+    auto second = std::make_shared<SongState>();
+    second->id = "second";
+    second->activePerformanceId = "techno";
+    undoState.setCurrentState(second);
+
+    // The reader that entered before the swap keeps its version alive
+    EXPECT_FALSE(weak.expired());
+    EXPECT_EQ(pinned->id, "first");
+    EXPECT_EQ(undoState.getCurrentState()->id, "second");
+}
+
 // ============================================================================
 // Performance Tests
 // ============================================================================
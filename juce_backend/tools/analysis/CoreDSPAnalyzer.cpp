@@ -1,186 +1,481 @@
-#include "../include/audio/CoreDSPAnalyzer.h"
+#include "../../include/audio/CoreDSPAnalyzer.h"
+#include <juce_audio_formats/juce_audio_formats.h>
 #include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(__aarch64__)
+    #include <arm_neon.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr float kRolloffThreshold = 0.85f;   // 85% of spectral energy below the rolloff
+constexpr float kMagnitudeFloor = 1.0e-10f;  // Keeps log() finite for silent bins
+constexpr int kMinFrameSize = 8;
+constexpr int kMaxFrameSize = 65536;
+
+//==============================================================================
+// Four-bin SIMD lanes for the spectrum passes
+//==============================================================================
+
+// log2 approximation: exponent bits plus a quartic in the mantissa
+// (about 1e-4 absolute error, plenty for spectral flatness)
+constexpr float kLog2C0 = -1.7417939f;
+constexpr float kLog2C1 = 2.8212026f;
+constexpr float kLog2C2 = -1.4699568f;
+constexpr float kLog2C3 = 0.44717955f;
+constexpr float kLog2C4 = -0.056570851f;
+
+#if defined(__aarch64__)
+
+struct SpectrumLanes {
+    using Vec = float32x4_t;
+
+    static Vec zero() { return vdupq_n_f32(0.0f); }
+    static Vec broadcast(float x) { return vdupq_n_f32(x); }
+    static Vec ramp() { const float r[4] = { 0.0f, 1.0f, 2.0f, 3.0f }; return vld1q_f32(r); }
+    static Vec load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Vec v) { vst1q_f32(p, v); }
+    static void loadComplex(const float* p, Vec& re, Vec& im) { float32x4x2_t v = vld2q_f32(p); re = v.val[0]; im = v.val[1]; }
+    static Vec add(Vec x, Vec y) { return vaddq_f32(x, y); }
+    static Vec sub(Vec x, Vec y) { return vsubq_f32(x, y); }
+    static Vec mul(Vec x, Vec y) { return vmulq_f32(x, y); }
+    static Vec max(Vec x, Vec y) { return vmaxq_f32(x, y); }
+    static Vec sqrt(Vec x) { return vsqrtq_f32(x); }
+    static float sum(Vec v) { return vaddvq_f32(v); }
+
+    static Vec log2(Vec x) {
+        const uint32x4_t bits = vreinterpretq_u32_f32(x);
+        const Vec exponent = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+        const Vec m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007fffff)), vdupq_n_u32(0x3f800000)));
+        Vec p = vmlaq_f32(broadcast(kLog2C3), m, broadcast(kLog2C4));
+        p = vmlaq_f32(broadcast(kLog2C2), m, p);
+        p = vmlaq_f32(broadcast(kLog2C1), m, p);
+        p = vmlaq_f32(broadcast(kLog2C0), m, p);
+        return vaddq_f32(exponent, p);
+    }
+};
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+struct SpectrumLanes {
+    using Vec = __m128;
+
+    static Vec zero() { return _mm_setzero_ps(); }
+    static Vec broadcast(float x) { return _mm_set1_ps(x); }
+    static Vec ramp() { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+    static Vec load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+    static void loadComplex(const float* p, Vec& re, Vec& im) {
+        const Vec a = _mm_loadu_ps(p);
+        const Vec b = _mm_loadu_ps(p + 4);
+        re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+    static Vec add(Vec x, Vec y) { return _mm_add_ps(x, y); }
+    static Vec sub(Vec x, Vec y) { return _mm_sub_ps(x, y); }
+    static Vec mul(Vec x, Vec y) { return _mm_mul_ps(x, y); }
+    static Vec max(Vec x, Vec y) { return _mm_max_ps(x, y); }
+    static Vec sqrt(Vec x) { return _mm_sqrt_ps(x); }
+    static float sum(Vec v) {
+        const Vec pairs = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    static Vec log2(Vec x) {
+        const __m128i bits = _mm_castps_si128(x);
+        const Vec exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+        const Vec m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)));
+        Vec p = add(mul(m, broadcast(kLog2C4)), broadcast(kLog2C3));
+        p = add(mul(m, p), broadcast(kLog2C2));
+        p = add(mul(m, p), broadcast(kLog2C1));
+        p = add(mul(m, p), broadcast(kLog2C0));
+        return add(exponent, p);
+    }
+};
+
+#else
+
+struct SpectrumLanes {
+    struct Vec { float v[4]; };
+
+    template <typename Op>
+    static Vec map(Vec x, Op op) { return { { op(x.v[0]), op(x.v[1]), op(x.v[2]), op(x.v[3]) } }; }
+    template <typename Op>
+    static Vec map(Vec x, Vec y, Op op) { return { { op(x.v[0], y.v[0]), op(x.v[1], y.v[1]), op(x.v[2], y.v[2]), op(x.v[3], y.v[3]) } }; }
+
+    static Vec zero() { return broadcast(0.0f); }
+    static Vec broadcast(float x) { return { { x, x, x, x } }; }
+    static Vec ramp() { return { { 0.0f, 1.0f, 2.0f, 3.0f } }; }
+    static Vec load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+    static void store(float* p, Vec v) { std::memcpy(p, v.v, sizeof(v.v)); }
+    static void loadComplex(const float* p, Vec& re, Vec& im) {
+        re = { { p[0], p[2], p[4], p[6] } };
+        im = { { p[1], p[3], p[5], p[7] } };
+    }
+    static Vec add(Vec x, Vec y) { return map(x, y, [](float a, float b) { return a + b; }); }
+    static Vec sub(Vec x, Vec y) { return map(x, y, [](float a, float b) { return a - b; }); }
+    static Vec mul(Vec x, Vec y) { return map(x, y, [](float a, float b) { return a * b; }); }
+    static Vec max(Vec x, Vec y) { return map(x, y, [](float a, float b) { return std::max(a, b); }); }
+    static Vec sqrt(Vec x) { return map(x, [](float a) { return std::sqrt(a); }); }
+    static float sum(Vec v) { return (v.v[0] + v.v[1]) + (v.v[2] + v.v[3]); }
+
+    static Vec log2(Vec x) {
+        return map(x, [](float a) {
+            uint32_t bits;
+            std::memcpy(&bits, &a, sizeof(bits));
+            const float exponent = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+            bits = (bits & 0x007fffffu) | 0x3f800000u;
+            float m;
+            std::memcpy(&m, &bits, sizeof(m));
+            return exponent + (((kLog2C4 * m + kLog2C3) * m + kLog2C2) * m + kLog2C1) * m + kLog2C0;
+        });
+    }
+};
+
+#endif
+
+float sumRange(const float* data, int begin, int end) {
+    using L = SpectrumLanes;
+    L::Vec acc = L::zero();
+    int i = begin;
+    for (; i + 4 <= end; i += 4)
+        acc = L::add(acc, L::load(data + i));
+
+    float total = L::sum(acc);
+    for (; i < end; ++i)
+        total += data[i];
+    return total;
+}
+
+juce::var descriptorsToVar(const CoreDSPAnalyzer::FrameDescriptors& frame) {
+    juce::DynamicObject::Ptr object = new juce::DynamicObject();
+    object->setProperty("spectralCentroid", frame.spectralCentroid);
+    object->setProperty("spectralFlux", frame.spectralFlux);
+    object->setProperty("spectralFlatness", frame.spectralFlatness);
+    object->setProperty("spectralRolloff", frame.spectralRolloff);
+
+    juce::Array<juce::var> bandEnergies;
+    for (float energy : frame.bandEnergies) {
+        bandEnergies.add(energy);
+    }
+    object->setProperty("bandEnergies", bandEnergies);
 
-CoreDSPAnalyzer::CoreDSPAnalyzer() {
-    // Initialize window function (Hann window for good frequency resolution)
-    generateWindowFunction();
+    return juce::var(object.get());
 }
 
+} // namespace
+
+CoreDSPAnalyzer::CoreDSPAnalyzer() = default;
+
 CoreDSPAnalyzer::~CoreDSPAnalyzer() = default;
 
 bool CoreDSPAnalyzer::initialize(double sampleRate, int bufferSize) {
-    this->sampleRate = sampleRate;
-    this->bufferSize = bufferSize;
+    return initialize(sampleRate, std::vector<int>{ bufferSize }, 2);
+}
 
-    // Validate buffer size is power of 2 for FFT
-    if (!juce::isPowerOfTwo(bufferSize)) {
+bool CoreDSPAnalyzer::initialize(double sampleRate, const std::vector<int>& frameSizes, int overlap) {
+    if (sampleRate <= 0.0 || frameSizes.empty() || overlap < 1) {
         return false;
     }
 
-    // Initialize FFT
-    fftOrder = juce::roundToInt(std::log2(bufferSize));
-    fft = std::make_unique<juce::dsp::FFT>(fftOrder);
+    // Validate frame sizes are powers of 2 for FFT
+    for (int frameSize : frameSizes) {
+        if (frameSize < kMinFrameSize || frameSize > kMaxFrameSize ||
+            !juce::isPowerOfTwo(frameSize) || frameSize % overlap != 0) {
+            return false;
+        }
+    }
 
-    // Prepare working buffers
-    fftData.resize(bufferSize * 2, 0.0f);
-    magnitudeSpectrum.resize(bufferSize / 2 + 1, 0.0f);
-    windowFunction.resize(bufferSize, 0.0f);
+    this->sampleRate = sampleRate;
+    this->bufferSize = frameSizes.front();
 
-    // Generate Hann window
-    for (int i = 0; i < bufferSize; ++i) {
-        windowFunction[i] = 0.5f * (1.0f - std::cos(2.0f * juce::MathConstants<float>::pi * i / (bufferSize - 1)));
-    }
+    resolutions.clear();
+    resolutions.resize(frameSizes.size());
+
+    for (size_t r = 0; r < frameSizes.size(); ++r) {
+        auto& resolution = resolutions[r];
+        const int frameSize = frameSizes[r];
 
-    // Initialize frequency bins
-    frequencyBins.resize(bufferSize / 2 + 1);
-    for (int i = 0; i <= bufferSize / 2; ++i) {
-        frequencyBins[i] = i * sampleRate / bufferSize;
+        resolution.frameSize = frameSize;
+        resolution.hopSize = frameSize / overlap;
+        resolution.numBins = frameSize / 2 + 1;
+        resolution.fft = std::make_unique<juce::dsp::FFT>(juce::roundToInt(std::log2(frameSize)));
+
+        // Periodic Hann window (sums to a constant at 50% or 75% overlap)
+        resolution.window.resize(static_cast<size_t>(frameSize));
+        for (int i = 0; i < frameSize; ++i) {
+            resolution.window[static_cast<size_t>(i)] =
+                0.5f * (1.0f - std::cos(2.0f * juce::MathConstants<float>::pi * i / frameSize));
+        }
+
+        resolution.fftData.assign(static_cast<size_t>(frameSize) * 2, 0.0f);
+        resolution.power.assign(static_cast<size_t>(resolution.numBins), 0.0f);
+        resolution.magnitude.assign(static_cast<size_t>(resolution.numBins), 0.0f);
+        resolution.previousMagnitude.assign(static_cast<size_t>(resolution.numBins), 0.0f);
+
+        // Frequency bands: 10 equal runs of bins
+        const int binsPerBand = resolution.numBins / kNumBands;
+        for (int band = 0; band <= kNumBands; ++band) {
+            resolution.bandEdges[static_cast<size_t>(band)] = band * binsPerBand;
+        }
     }
 
+    const int largestFrame = *std::max_element(frameSizes.begin(), frameSizes.end());
+    history.assign(static_cast<size_t>(largestFrame), 0.0f);
+    historyMask = largestFrame - 1;
+
     initialized = true;
+    reset();
     return true;
 }
 
 void CoreDSPAnalyzer::processBlock(juce::AudioBuffer<float>& buffer) {
-    if (!initialized || buffer.getNumSamples() == 0) {
+    process(buffer.getArrayOfReadPointers(), buffer.getNumChannels(), buffer.getNumSamples());
+}
+
+void CoreDSPAnalyzer::process(const float* const* channels, int numChannels, int numSamples) {
+    if (!initialized || numChannels <= 0 || numSamples <= 0) {
         return;
     }
 
-    // Convert to mono by averaging all channels
-    int numChannels = buffer.getNumChannels();
-    int numSamples = std::min(buffer.getNumSamples(), bufferSize);
+    numInputChannels = numChannels;
+    const float channelGain = 1.0f / numChannels; // Average channels
+    const int historySize = static_cast<int>(history.size());
+
+    int offset = 0;
+    while (offset < numSamples) {
+        // Advance to the next frame boundary of any resolution
+        int step = numSamples - offset;
+        for (const auto& resolution : resolutions) {
+            step = std::min(step, resolution.samplesUntilFrame);
+        }
+
+        // Mix to mono into the history ring
+        for (int done = 0; done < step;) {
+            const int run = std::min(step - done, historySize - historyWrite);
+            float* dest = history.data() + historyWrite;
 
-    // Clear FFT data
-    std::fill(fftData.begin(), fftData.end(), 0.0f);
+            juce::FloatVectorOperations::copyWithMultiply(dest, channels[0] + offset + done, channelGain, run);
+            for (int channel = 1; channel < numChannels; ++channel) {
+                juce::FloatVectorOperations::addWithMultiply(dest, channels[channel] + offset + done, channelGain, run);
+            }
 
-    // Mix channels and apply window
-    for (int sample = 0; sample < numSamples; ++sample) {
-        float monoSample = 0.0f;
-        for (int channel = 0; channel < numChannels; ++channel) {
-            monoSample += buffer.getSample(channel, sample);
+            historyWrite = (historyWrite + run) & historyMask;
+            done += run;
         }
-        monoSample /= numChannels; // Average channels
-        fftData[sample] = monoSample * windowFunction[sample];
-    }
 
-    // Zero-pad if necessary
-    for (int i = numSamples; i < bufferSize; ++i) {
-        fftData[i] = 0.0f;
-    }
+        offset += step;
+        samplesProcessed += step;
 
-    // Perform FFT
-    fft->performRealOnlyForwardTransform(fftData.data());
+        for (size_t r = 0; r < resolutions.size(); ++r) {
+            auto& resolution = resolutions[r];
+            resolution.samplesUntilFrame -= step;
+            if (resolution.samplesUntilFrame == 0) {
+                analyzeFrame(resolution);
+                resolution.samplesUntilFrame = resolution.hopSize;
 
-    // Calculate magnitude spectrum
-    for (int i = 0; i <= bufferSize / 2; ++i) {
-        float real = fftData[i];
-        float imag = (i == 0 || i == bufferSize / 2) ? 0.0f : fftData[bufferSize - i];
-        magnitudeSpectrum[i] = std::sqrt(real * real + imag * imag);
+                if (frameCallback) {
+                    frameCallback(static_cast<int>(r), resolution.latest);
+                }
+            }
+        }
     }
-
-    // Calculate spectral descriptors
-    calculateSpectralDescriptors();
 }
 
-void CoreDSPAnalyzer::calculateSpectralDescriptors() {
-    float weightedSum = 0.0f;
-    float magnitudeSum = 0.0f;
-    float fluxSum = 0.0f;
-    float flatnessProduct = 1.0f;
-    float rolloffSum = 0.0f;
+void CoreDSPAnalyzer::analyzeFrame(Resolution& resolution) {
+    using L = SpectrumLanes;
 
-    const float nyquist = sampleRate / 2.0f;
-    const float rolloffThreshold = 0.85f; // 85% of spectral energy below this frequency
+    const int frameSize = resolution.frameSize;
+    const int historySize = static_cast<int>(history.size());
+    const int start = (historyWrite - frameSize) & historyMask;
+    const int firstRun = std::min(frameSize, historySize - start);
 
-    for (int i = 0; i < magnitudeSpectrum.size(); ++i) {
-        float frequency = frequencyBins[i];
-        float magnitude = magnitudeSpectrum[i];
+    // Window the most recent frameSize samples (ring may wrap once)
+    float* fftData = resolution.fftData.data();
+    juce::FloatVectorOperations::multiply(fftData, history.data() + start, resolution.window.data(), firstRun);
+    if (firstRun < frameSize) {
+        juce::FloatVectorOperations::multiply(fftData + firstRun, history.data(),
+                                              resolution.window.data() + firstRun, frameSize - firstRun);
+    }
 
-        // Spectral centroid
-        weightedSum += frequency * magnitude;
-        magnitudeSum += magnitude;
+    // Interleaved complex output for bins 0 .. frameSize / 2
+    resolution.fft->performRealOnlyForwardTransform(fftData, true);
 
-        // Spectral flux (change from previous frame)
-        if (!previousMagnitudeSpectrum.empty() && i < previousMagnitudeSpectrum.size()) {
-            float diff = magnitude - previousMagnitudeSpectrum[i];
-            fluxSum += diff * diff;
-        }
+    // Power and magnitude spectrum, four bins at a time; Nyquist bin last
+    const int half = frameSize / 2;
+    float* power = resolution.power.data();
+    float* magnitude = resolution.magnitude.data();
 
-        // Spectral flatness (for geometric mean calculation)
-        if (magnitude > 0.0f) {
-            flatnessProduct *= magnitude;
-        }
+    for (int i = 0; i < half; i += 4) {
+        L::Vec re, im;
+        L::loadComplex(fftData + 2 * i, re, im);
+        const L::Vec binPower = L::add(L::mul(re, re), L::mul(im, im));
+        L::store(power + i, binPower);
+        L::store(magnitude + i, L::sqrt(binPower));
+    }
+
+    const float nyquistReal = fftData[2 * half];
+    const float nyquistImag = fftData[2 * half + 1];
+    power[half] = nyquistReal * nyquistReal + nyquistImag * nyquistImag;
+    magnitude[half] = std::sqrt(power[half]);
 
-        // Spectral rolloff
-        rolloffSum += magnitude;
+    calculateSpectralDescriptors(resolution);
+    accumulate(resolution);
+
+    std::swap(resolution.magnitude, resolution.previousMagnitude);
+    resolution.hasPreviousFrame = true;
+}
+
+void CoreDSPAnalyzer::calculateSpectralDescriptors(Resolution& resolution) {
+    using L = SpectrumLanes;
+
+    const int numBins = resolution.numBins;
+    const int half = numBins - 1;
+    const float* power = resolution.power.data();
+    const float* magnitude = resolution.magnitude.data();
+    const float* previous = resolution.previousMagnitude.data();
+    const float binWidth = static_cast<float>(sampleRate / resolution.frameSize);
+
+    // One vectorised pass for the centroid, flux, flatness and total energy sums
+    L::Vec magnitudeAcc = L::zero();
+    L::Vec weightedAcc = L::zero();
+    L::Vec fluxAcc = L::zero();
+    L::Vec logAcc = L::zero();
+    L::Vec powerAcc = L::zero();
+    L::Vec binIndex = L::ramp();
+    const L::Vec four = L::broadcast(4.0f);
+    const L::Vec floor = L::broadcast(kMagnitudeFloor);
+
+    for (int i = 0; i < half; i += 4) {
+        const L::Vec m = L::load(magnitude + i);
+        const L::Vec diff = L::sub(m, L::load(previous + i));
+
+        magnitudeAcc = L::add(magnitudeAcc, m);
+        weightedAcc = L::add(weightedAcc, L::mul(binIndex, m));
+        fluxAcc = L::add(fluxAcc, L::mul(diff, diff));
+        logAcc = L::add(logAcc, L::log2(L::max(m, floor)));
+        powerAcc = L::add(powerAcc, L::load(power + i));
+        binIndex = L::add(binIndex, four);
     }
 
-    // Calculate final descriptors
-    lastResults.spectralCentroid = (magnitudeSum > 0.0f) ? (weightedSum / magnitudeSum) : 0.0f;
-    lastResults.spectralFlux = fluxSum;
+    const float nyquistMagnitude = magnitude[half];
+    const float nyquistDiff = nyquistMagnitude - previous[half];
+    const float magnitudeSum = L::sum(magnitudeAcc) + nyquistMagnitude;
+    const float weightedSum = L::sum(weightedAcc) + half * nyquistMagnitude;
+    const float fluxSum = L::sum(fluxAcc) + nyquistDiff * nyquistDiff;
+    const float logSum = L::sum(logAcc) + std::log2(std::max(nyquistMagnitude, kMagnitudeFloor));
+    const float totalPower = L::sum(powerAcc) + power[half];
+
+    FrameDescriptors& frame = resolution.latest;
+    frame.time = (samplesProcessed - resolution.frameSize / 2) / sampleRate;
+
+    // Spectral centroid
+    frame.spectralCentroid = (magnitudeSum > 0.0f) ? binWidth * weightedSum / magnitudeSum : 0.0f;
+
+    // Spectral flux (change from previous frame)
+    frame.spectralFlux = resolution.hasPreviousFrame ? fluxSum : 0.0f;
 
     // Spectral flatness (geometric mean / arithmetic mean)
-    if (magnitudeSum > 0.0f && flatnessProduct > 0.0f) {
-        float geometricMean = std::pow(flatnessProduct, 1.0f / magnitudeSpectrum.size());
-        float arithmeticMean = magnitudeSum / magnitudeSpectrum.size();
-        lastResults.spectralFlatness = geometricMean / arithmeticMean;
+    if (magnitudeSum > 0.0f) {
+        const float geometricMean = std::exp2(logSum / numBins);
+        const float arithmeticMean = magnitudeSum / numBins;
+        frame.spectralFlatness = std::min(1.0f, geometricMean / arithmeticMean);
     } else {
-        lastResults.spectralFlatness = 0.0f;
+        frame.spectralFlatness = 0.0f;
     }
 
-    // Spectral rolloff (frequency below which 85% of energy is contained)
+    // Spectral rolloff (frequency below which 85% of energy is contained);
+    // whole four-bin groups are skipped until the threshold is near
+    const float threshold = kRolloffThreshold * totalPower;
     float cumulativeEnergy = 0.0f;
-    lastResults.spectralRolloff = 0.0f;
-    for (int i = 0; i < magnitudeSpectrum.size(); ++i) {
-        cumulativeEnergy += magnitudeSpectrum[i] * magnitudeSpectrum[i];
-        if (cumulativeEnergy >= rolloffThreshold * rolloffSum && lastResults.spectralRolloff == 0.0f) {
-            lastResults.spectralRolloff = frequencyBins[i];
+    int bin = 0;
+    while (bin + 4 <= numBins) {
+        const float groupEnergy = L::sum(L::load(power + bin));
+        if (cumulativeEnergy + groupEnergy >= threshold) {
+            break;
+        }
+        cumulativeEnergy += groupEnergy;
+        bin += 4;
+    }
+    for (; bin < numBins; ++bin) {
+        cumulativeEnergy += power[bin];
+        if (cumulativeEnergy >= threshold) {
+            break;
         }
     }
+    frame.spectralRolloff = std::min(bin, half) * binWidth;
+
+    // Frequency band energies from the precomputed band-to-bin map
+    for (int band = 0; band < kNumBands; ++band) {
+        const float bandEnergy = sumRange(power, resolution.bandEdges[static_cast<size_t>(band)],
+                                          resolution.bandEdges[static_cast<size_t>(band) + 1]);
+        frame.bandEnergies[static_cast<size_t>(band)] = std::sqrt(bandEnergy);
+    }
+}
 
-    // Frequency band energies
-    lastResults.bandEnergies.resize(10); // 10 frequency bands
-    int samplesPerBand = magnitudeSpectrum.size() / 10;
+void CoreDSPAnalyzer::accumulate(Resolution& resolution) {
+    const FrameDescriptors& frame = resolution.latest;
+    AggregateDescriptors& aggregate = resolution.aggregate;
 
-    for (int band = 0; band < 10; ++band) {
-        float bandEnergy = 0.0f;
-        int startSample = band * samplesPerBand;
-        int endSample = std::min((band + 1) * samplesPerBand, (int)magnitudeSpectrum.size());
+    const float values[] = { frame.spectralCentroid, frame.spectralFlux,
+                             frame.spectralFlatness, frame.spectralRolloff };
+    float* peaks[] = { &aggregate.peak.spectralCentroid, &aggregate.peak.spectralFlux,
+                       &aggregate.peak.spectralFlatness, &aggregate.peak.spectralRolloff };
+    float* means[] = { &aggregate.mean.spectralCentroid, &aggregate.mean.spectralFlux,
+                       &aggregate.mean.spectralFlatness, &aggregate.mean.spectralRolloff };
 
-        for (int i = startSample; i < endSample; ++i) {
-            bandEnergy += magnitudeSpectrum[i] * magnitudeSpectrum[i];
-        }
+    ++aggregate.numFrames;
+    const double count = static_cast<double>(aggregate.numFrames);
 
-        lastResults.bandEnergies[band] = std::sqrt(bandEnergy);
+    for (size_t i = 0; i < 4; ++i) {
+        resolution.sums[i] += values[i];
+        *means[i] = static_cast<float>(resolution.sums[i] / count);
+        *peaks[i] = std::max(*peaks[i], values[i]);
     }
 
-    // Store current magnitude spectrum for next flux calculation
-    previousMagnitudeSpectrum = magnitudeSpectrum;
+    for (size_t band = 0; band < static_cast<size_t>(kNumBands); ++band) {
+        resolution.sums[4 + band] += frame.bandEnergies[band];
+        aggregate.mean.bandEnergies[band] = static_cast<float>(resolution.sums[4 + band] / count);
+        aggregate.peak.bandEnergies[band] = std::max(aggregate.peak.bandEnergies[band], frame.bandEnergies[band]);
+    }
+
+    aggregate.mean.time = aggregate.peak.time = frame.time;
 }
 
 juce::String CoreDSPAnalyzer::getResultsAsJson() const {
     juce::DynamicObject::Ptr json = new juce::DynamicObject();
 
     json->setProperty("type", "core_analysis");
+    json->setProperty("analysisType", getAnalysisType());
     json->setProperty("timestamp", juce::Time::getCurrentTime().toISO8601(true));
-
-    // Add spectral descriptors
-    juce::DynamicObject::Ptr spectralData = new juce::DynamicObject();
-    spectralData->setProperty("spectralCentroid", lastResults.spectralCentroid);
-    spectralData->setProperty("spectralFlux", lastResults.spectralFlux);
-    spectralData->setProperty("spectralFlatness", lastResults.spectralFlatness);
-    spectralData->setProperty("spectralRolloff", lastResults.spectralRolloff);
-
-    // Add frequency band energies
-    juce::Array<juce::var> bandEnergies;
-    for (float energy : lastResults.bandEnergies) {
-        bandEnergies.add(energy);
+    json->setProperty("sampleRate", sampleRate);
+    json->setProperty("bufferSize", bufferSize);
+    json->setProperty("channels", numInputChannels);
+
+    // Latest frame of the primary resolution
+    json->setProperty("spectralData", descriptorsToVar(resolutions.empty() ? FrameDescriptors{} : resolutions.front().latest));
+
+    // Aggregates per resolution
+    juce::Array<juce::var> stft;
+    for (const auto& resolution : resolutions) {
+        juce::DynamicObject::Ptr entry = new juce::DynamicObject();
+        entry->setProperty("frameSize", resolution.frameSize);
+        entry->setProperty("hopSize", resolution.hopSize);
+        entry->setProperty("frames", static_cast<juce::int64>(resolution.aggregate.numFrames));
+        entry->setProperty("mean", descriptorsToVar(resolution.aggregate.mean));
+        entry->setProperty("peak", descriptorsToVar(resolution.aggregate.peak));
+        stft.add(juce::var(entry.get()));
     }
-    spectralData->setProperty("bandEnergies", bandEnergies);
+    json->setProperty("stft", stft);
 
-    json->setProperty("spectralData", spectralData.get());
-
-    return juce::JSON::toString(json);
+    return juce::JSON::toString(juce::var(json.get()));
 }
 
 bool CoreDSPAnalyzer::isReady() const {
@@ -189,10 +484,19 @@ bool CoreDSPAnalyzer::isReady() const {
 
 void CoreDSPAnalyzer::reset() {
     if (initialized) {
-        std::fill(fftData.begin(), fftData.end(), 0.0f);
-        std::fill(magnitudeSpectrum.begin(), magnitudeSpectrum.end(), 0.0f);
-        previousMagnitudeSpectrum.clear();
-        lastResults = SpectralResults{};
+        std::fill(history.begin(), history.end(), 0.0f);
+        historyWrite = 0;
+        samplesProcessed = 0;
+
+        for (auto& resolution : resolutions) {
+            // First frame once a full window of audio has arrived
+            resolution.samplesUntilFrame = resolution.frameSize;
+            resolution.hasPreviousFrame = false;
+            std::fill(resolution.previousMagnitude.begin(), resolution.previousMagnitude.end(), 0.0f);
+            resolution.latest = FrameDescriptors{};
+            resolution.aggregate = AggregateDescriptors{};
+            resolution.sums.fill(0.0);
+        }
     }
 }
 
@@ -200,6 +504,56 @@ juce::String CoreDSPAnalyzer::getAnalysisType() const {
     return "core_dsp_analysis";
 }
 
-void CoreDSPAnalyzer::generateWindowFunction() {
-    // Window function is generated in initialize() based on buffer size
-}
\ No newline at end of file
+juce::StringArray CoreDSPAnalyzer::analyzeFiles(const juce::Array<juce::File>& files,
+                                                const std::vector<int>& frameSizes,
+                                                int numThreads) {
+    constexpr int chunkSize = 65536;
+
+    std::vector<juce::String> results(static_cast<size_t>(files.size()));
+    std::atomic<int> nextFile{ 0 };
+
+    // Each worker pulls the next unclaimed file until none are left
+    auto worker = [&]() {
+        juce::AudioFormatManager formatManager;
+        formatManager.registerBasicFormats();
+
+        for (int index = nextFile++; index < files.size(); index = nextFile++) {
+            std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(files[index]));
+            if (reader == nullptr || reader->numChannels == 0) {
+                continue;
+            }
+
+            CoreDSPAnalyzer analyzer;
+            if (!analyzer.initialize(reader->sampleRate, frameSizes)) {
+                continue;
+            }
+
+            const int numChannels = static_cast<int>(reader->numChannels);
+            juce::AudioBuffer<float> chunk(numChannels, chunkSize);
+
+            for (juce::int64 position = 0; position < reader->lengthInSamples; position += chunkSize) {
+                const int numSamples = static_cast<int>(std::min<juce::int64>(chunkSize, reader->lengthInSamples - position));
+                reader->read(chunk.getArrayOfWritePointers(), numChannels, position, numSamples);
+                analyzer.process(chunk.getArrayOfReadPointers(), numChannels, numSamples);
+            }
+
+            results[static_cast<size_t>(index)] = analyzer.getResultsAsJson();
+        }
+    };
+
+    const int numWorkers = juce::jlimit(1, std::max(1, files.size()), numThreads);
+    std::vector<std::thread> threads;
+    for (int i = 1; i < numWorkers; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    juce::StringArray output;
+    for (const auto& result : results) {
+        output.add(result);
+    }
+    return output;
+}
@@ -16,6 +16,11 @@
 #include "RhythmAPI.h"
 #include <juce_core/juce_core.h>
 #include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <vector>
 
 namespace Schillinger
 {
@@ -94,20 +99,76 @@ namespace Schillinger
     };
 
     //==============================================================================
-    /** Rhythmic Field class for advanced spatial rhythm generation */
+    /**
+        Rhythmic Field class for advanced spatial rhythm generation.
+
+        Intensities are stored as one dense grid of resolution^dimensions floats rather
+        than as a list of points: grid index i on every axis sits at i / (resolution - 1),
+        so coordinates are implicit and the grid can be filled a row at a time with
+        vector operations. The point structs above remain the JSON exchange format.
+    */
     struct RhythmicField
     {
         bool is3D = false;  // Whether this is a 3D field
         int dimensions = 2; // Field dimensions (2 or 3)
         int resolution = 16; // Grid resolution for the field
-        juce::Array<RhythmicFieldPoint2D> points2D;  // 2D field points
-        juce::Array<RhythmicFieldPoint3D> points3D;  // 3D field points
+
+        /** Dense intensity grid, index (x * resolution + y) * resolution + z (z only in 3D) */
+        std::vector<float> intensities;
 
         // Field parameters for interference calculation
         double frequencyRatio = 1.5;  // Frequency ratio for interference
         double phaseOffset = 0.0;     // Phase offset for patterns
         double modulationDepth = 0.5; // Modulation depth
 
+        /** Normalised coordinate (0.0-1.0) of a grid index */
+        static float gridCoordinate(int index, int resolution)
+        {
+            return resolution > 1 ? static_cast<float>(index) / static_cast<float>(resolution - 1) : 0.0f;
+        }
+
+        /** Number of grid points the field should hold for its resolution and dimensions */
+        int getExpectedNumPoints() const
+        {
+            return is3D ? resolution * resolution * resolution : resolution * resolution;
+        }
+
+        int getNumPoints() const { return static_cast<int>(intensities.size()); }
+
+        /** Resize the grid for the current resolution and dimensions, zero filled */
+        void allocateGrid()
+        {
+            intensities.assign(static_cast<size_t>(juce::jmax(0, getExpectedNumPoints())), 0.0f);
+        }
+
+        float getIntensity(int x, int y, int z = 0) const
+        {
+            return intensities[static_cast<size_t>((x * resolution + y) * (is3D ? resolution : 1) + z)];
+        }
+
+        /** Grid point at a flat index, as a 2D point */
+        RhythmicFieldPoint2D getPoint2D(int index) const
+        {
+            RhythmicFieldPoint2D point;
+            point.x = gridCoordinate(index / resolution, resolution);
+            point.y = gridCoordinate(index % resolution, resolution);
+            point.intensity = intensities[static_cast<size_t>(index)];
+            point.subdivision = resolution;
+            return point;
+        }
+
+        /** Grid point at a flat index, as a 3D point */
+        RhythmicFieldPoint3D getPoint3D(int index) const
+        {
+            RhythmicFieldPoint3D point;
+            point.x = gridCoordinate(index / (resolution * resolution), resolution);
+            point.y = gridCoordinate((index / resolution) % resolution, resolution);
+            point.z = gridCoordinate(index % resolution, resolution);
+            point.intensity = intensities[static_cast<size_t>(index)];
+            point.subdivision = resolution;
+            return point;
+        }
+
         /** Convert to JSON representation */
         juce::var toJson() const
         {
@@ -121,19 +182,26 @@ namespace Schillinger
 
             // Convert points
             auto points2DArray = new juce::Array<juce::var>();
-            for (const auto& point : points2D)
-                points2DArray->add(point.toJson());
-            json->setProperty("points2D", juce::var(points2DArray));
-
             auto points3DArray = new juce::Array<juce::var>();
-            for (const auto& point : points3D)
-                points3DArray->add(point.toJson());
+
+            for (int i = 0; i < getNumPoints(); ++i)
+            {
+                if (is3D)
+                    points3DArray->add(getPoint3D(i).toJson());
+                else
+                    points2DArray->add(getPoint2D(i).toJson());
+            }
+
+            json->setProperty("points2D", juce::var(points2DArray));
             json->setProperty("points3D", juce::var(points3DArray));
 
             return juce::var(json);
         }
 
-        /** Create from JSON representation */
+        /**
+            Create from JSON representation. A full grid of points is read in order;
+            any other point list is snapped to the nearest grid cells.
+        */
         static RhythmicField fromJson(const juce::var& json)
         {
             RhythmicField field;
@@ -144,25 +212,40 @@ namespace Schillinger
             field.phaseOffset = json.getProperty("phaseOffset", 0.0);
             field.modulationDepth = json.getProperty("modulationDepth", 0.5);
 
-            // Parse 2D points
-            if (json.hasProperty("points2D"))
+            if (field.resolution <= 0 || field.resolution > 256)
+                return field; // Rejected by validate()
+
+            auto pointsArray = json[field.is3D ? "points3D" : "points2D"].getArray();
+            if (pointsArray == nullptr || pointsArray->isEmpty())
+                return field;
+
+            field.allocateGrid();
+            const bool fullGrid = pointsArray->size() == field.getExpectedNumPoints();
+
+            const auto cell = [&field](float coordinate)
             {
-                auto points2DArray = json["points2D"].getArray();
-                if (points2DArray != nullptr)
-                {
-                    for (const auto& pointJson : *points2DArray)
-                        field.points2D.add(RhythmicFieldPoint2D::fromJson(pointJson));
-                }
-            }
+                return juce::jlimit(0, field.resolution - 1,
+                                    juce::roundToInt(coordinate * static_cast<float>(field.resolution - 1)));
+            };
 
-            // Parse 3D points
-            if (json.hasProperty("points3D"))
+            for (int i = 0; i < pointsArray->size(); ++i)
             {
-                auto points3DArray = json["points3D"].getArray();
-                if (points3DArray != nullptr)
+                const auto& pointJson = pointsArray->getReference(i);
+                int index = i;
+
+                if (field.is3D)
                 {
-                    for (const auto& pointJson : *points3DArray)
-                        field.points3D.add(RhythmicFieldPoint3D::fromJson(pointJson));
+                    auto point = RhythmicFieldPoint3D::fromJson(pointJson);
+                    if (!fullGrid)
+                        index = (cell(point.x) * field.resolution + cell(point.y)) * field.resolution + cell(point.z);
+                    field.intensities[static_cast<size_t>(index)] = point.intensity;
+                }
+                else
+                {
+                    auto point = RhythmicFieldPoint2D::fromJson(pointJson);
+                    if (!fullGrid)
+                        index = cell(point.x) * field.resolution + cell(point.y);
+                    field.intensities[static_cast<size_t>(index)] = point.intensity;
                 }
             }
 
@@ -184,16 +267,214 @@ namespace Schillinger
             if (modulationDepth < 0.0 || modulationDepth > 1.0)
                 return juce::Result::fail("Modulation depth must be between 0.0 and 1.0");
 
-            if (is3D && points3D.isEmpty())
-                return juce::Result::fail("3D field must have at least one 3D point");
+            if (intensities.empty())
+                return juce::Result::fail(is3D ? "3D field must have at least one 3D point"
+                                               : "2D field must have at least one 2D point");
 
-            if (!is3D && points2D.isEmpty())
-                return juce::Result::fail("2D field must have at least one 2D point");
+            if (getNumPoints() != getExpectedNumPoints())
+                return juce::Result::fail("Field grid does not match its resolution");
 
             return juce::Result::ok();
         }
     };
 
+    //==============================================================================
+    /**
+        The merged attack points of several generators over one full cycle
+        (Schillinger's resultant of interference), enumerated lazily.
+
+        Each generator g attacks at every multiple of g; the cycle is the LCM of the
+        generators. Rather than expanding the cycle into LCM steps, iteration merges
+        the generators' arithmetic progressions, so it costs O(generators) per attack
+        and O(1) memory. For two generators a and b the cycle holds (a + b) / gcd - 1
+        attacks however long it is, which keeps coprime sets like 17:19:23 cheap.
+    */
+    class InterferenceCycle
+    {
+    public:
+        static constexpr int maxGenerators = 8;
+
+        /** One attack: where it falls in the cycle, the duration until the next attack
+            (or the end of the cycle), and which generators coincide on it. */
+        struct Attack
+        {
+            int64_t position = 0;
+            int64_t duration = 0;
+            uint32_t generatorMask = 0;
+
+            int getNumCoincident() const
+            {
+                int count = 0;
+                for (uint32_t mask = generatorMask; mask != 0; mask &= mask - 1)
+                    ++count;
+                return count;
+            }
+        };
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Attack;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Attack*;
+            using reference = const Attack&;
+
+            const Attack& operator*() const { return current; }
+            const Attack* operator->() const { return &current; }
+
+            Iterator& operator++()
+            {
+                advance();
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const { return current.position == other.current.position; }
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        private:
+            friend class InterferenceCycle;
+
+            const InterferenceCycle* cycle = nullptr;
+            std::array<int64_t, maxGenerators> nextMultiple {};
+            int64_t nextPosition = 0;
+            Attack current;
+
+            Iterator(const InterferenceCycle& owner, bool atEnd) : cycle(&owner)
+            {
+                if (atEnd || owner.numGenerators == 0)
+                {
+                    current.position = owner.cycleLength;
+                    return;
+                }
+
+                nextMultiple.fill(0);
+                nextPosition = 0;
+                advance();
+            }
+
+            void advance()
+            {
+                current.position = nextPosition;
+
+                if (current.position >= cycle->cycleLength)
+                {
+                    current.position = cycle->cycleLength;
+                    return;
+                }
+
+                current.generatorMask = 0;
+                int64_t following = cycle->cycleLength;
+
+                for (int i = 0; i < cycle->numGenerators; ++i)
+                {
+                    if (nextMultiple[static_cast<size_t>(i)] == current.position)
+                    {
+                        current.generatorMask |= (1u << i);
+                        nextMultiple[static_cast<size_t>(i)] += cycle->generators[static_cast<size_t>(i)];
+                    }
+
+                    following = std::min(following, nextMultiple[static_cast<size_t>(i)]);
+                }
+
+                current.duration = following - current.position;
+                nextPosition = following;
+            }
+        };
+
+        /** Generators must be positive; at most maxGenerators are used. */
+        InterferenceCycle(std::initializer_list<int> generatorList)
+        {
+            for (int generator : generatorList)
+                addGenerator(generator);
+        }
+
+        explicit InterferenceCycle(const juce::Array<int>& generatorList)
+        {
+            for (int generator : generatorList)
+                addGenerator(generator);
+        }
+
+        /** False if a generator was not positive, there were too many, or the LCM overflowed */
+        bool isValid() const { return valid && numGenerators > 0; }
+
+        int getNumGenerators() const { return numGenerators; }
+        int getGenerator(int index) const { return static_cast<int>(generators[static_cast<size_t>(index)]); }
+
+        /** Length of the full cycle in steps (the LCM of the generators) */
+        int64_t getCycleLength() const { return cycleLength; }
+
+        /** Number of attacks in one cycle, by inclusion-exclusion over the generators */
+        int64_t getNumAttacks() const
+        {
+            if (!isValid())
+                return 0;
+
+            int64_t total = 0;
+            for (uint32_t subset = 1; subset < (1u << numGenerators); ++subset)
+            {
+                int64_t subsetLcm = 1;
+                int bits = 0;
+                for (int i = 0; i < numGenerators; ++i)
+                {
+                    if ((subset & (1u << i)) != 0)
+                    {
+                        subsetLcm = std::lcm(subsetLcm, generators[static_cast<size_t>(i)]);
+                        ++bits;
+                    }
+                }
+
+                total += ((bits & 1) != 0 ? 1 : -1) * (cycleLength / subsetLcm);
+            }
+
+            return total;
+        }
+
+        Iterator begin() const { return Iterator(*this, !isValid()); }
+        Iterator end() const { return Iterator(*this, true); }
+
+        /** Durations between consecutive attacks over one cycle (the resultant rhythm) */
+        juce::Array<int> getResultantDurations() const
+        {
+            juce::Array<int> durations;
+            durations.ensureStorageAllocated(static_cast<int>(juce::jmin<int64_t>(getNumAttacks(), 1 << 20)));
+
+            for (const auto& attack : *this)
+                durations.add(static_cast<int>(attack.duration));
+
+            return durations;
+        }
+
+    private:
+        // Cycle lengths beyond this are refused rather than risking overflow in the merge
+        static constexpr int64_t maxCycleLength = int64_t(1) << 53;
+
+        std::array<int64_t, maxGenerators> generators {};
+        int numGenerators = 0;
+        int64_t cycleLength = 0;
+        bool valid = true;
+
+        void addGenerator(int generator)
+        {
+            if (generator <= 0 || numGenerators == maxGenerators)
+            {
+                valid = false;
+                return;
+            }
+
+            const int64_t current = numGenerators == 0 ? 1 : cycleLength;
+            const int64_t reduced = current / std::gcd(current, int64_t(generator));
+            if (reduced > maxCycleLength / generator)
+            {
+                valid = false;
+                return;
+            }
+
+            generators[static_cast<size_t>(numGenerators++)] = generator;
+            cycleLength = reduced * generator;
+        }
+    };
+
     //==============================================================================
     /** Resultant pattern from interference calculation */
     struct InterferencePattern
@@ -10,7 +10,10 @@ namespace performance {
 // CrossModuleManager Implementation
 // ============================================================================
 
-CrossModuleManager::CrossModuleManager() {
+CrossModuleManager::CrossModuleManager()
+    : wizardCache(defaultMaxCacheSize / 3),
+      harmonyCache(defaultMaxCacheSize / 3),
+      orchestrationCache(defaultMaxCacheSize / 3) {
     // Initialize core components
     wizard = std::make_unique<wizard::SchillingerWizard>();
     harmony = std::make_unique<harmony::AdvancedHarmonyAPI>();
@@ -41,6 +44,8 @@ void CrossModuleManager::initialize(OptimizationLevel level) {
             break;
     }
 
+    applyCacheBudget();
+
     // Initialize core components
     wizard->initialize();
     harmony->initialize();
@@ -124,13 +129,10 @@ void CrossModuleManager::preloadWizardContent(wizard::SkillLevel level) {
 }
 
 juce::Result CrossModuleManager::cacheWizardModule(const wizard::LearningModule& module) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
     std::string key = "wizard_module_" + std::to_string(module.id);
     auto result = serializeAndCache(module, key, wizardCache);
 
     if (result.wasOk()) {
-        currentCacheSize += wizardCache[key].size;
         updateMemoryStats();
     }
 
@@ -138,20 +140,8 @@ juce::Result CrossModuleManager::cacheWizardModule(const wizard::LearningModule&
 }
 
 wizard::LearningModule CrossModuleManager::getCachedWizardModule(int moduleId) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
     std::string key = "wizard_module_" + std::to_string(moduleId);
-    auto it = wizardCache.find(key);
-
-    if (it != wizardCache.end()) {
-        it->second.lastAccess = std::chrono::steady_clock::now();
-        it->second.accessCount++;
-        cacheHits++;
-        return deserializeFromCache<wizard::LearningModule>(key, wizardCache);
-    }
-
-    cacheMisses++;
-    return wizard::LearningModule{}; // Return empty module if not found
+    return deserializeFromCache<wizard::LearningModule>(key, wizardCache); // Empty module if not found
 }
 
 void CrossModuleManager::preloadHarmonyData(const harmony::MusicalContext& context) {
@@ -166,13 +156,10 @@ void CrossModuleManager::preloadHarmonyData(const harmony::MusicalContext& conte
 }
 
 juce::Result CrossModuleManager::cacheHarmonyData(const std::string& key, const harmony::ChordProgression& progression) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
     std::string fullKey = "harmony_" + key;
     auto result = serializeAndCache(progression, fullKey, harmonyCache);
 
     if (result.wasOk()) {
-        currentCacheSize += harmonyCache[fullKey].size;
         updateMemoryStats();
     }
 
@@ -180,20 +167,8 @@ juce::Result CrossModuleManager::cacheHarmonyData(const std::string& key, const
 }
 
 harmony::ChordProgression CrossModuleManager::getCachedHarmonyData(const std::string& key) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
     std::string fullKey = "harmony_" + key;
-    auto it = harmonyCache.find(fullKey);
-
-    if (it != harmonyCache.end()) {
-        it->second.lastAccess = std::chrono::steady_clock::now();
-        it->second.accessCount++;
-        cacheHits++;
-        return deserializeFromCache<harmony::ChordProgression>(fullKey, harmonyCache);
-    }
-
-    cacheMisses++;
-    return harmony::ChordProgression{}; // Return empty progression if not found
+    return deserializeFromCache<harmony::ChordProgression>(fullKey, harmonyCache); // Empty progression if not found
 }
 
 void CrossModuleManager::preloadOrchestrationData(const orchestration::Ensemble& ensemble) {
@@ -208,13 +183,10 @@ void CrossModuleManager::preloadOrchestrationData(const orchestration::Ensemble&
 }
 
 juce::Result CrossModuleManager::cacheOrchestrationData(const std::string& key, const orchestration::Instrumentation& instrumentation) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
     std::string fullKey = "orchestration_" + key;
     auto result = serializeAndCache(instrumentation, fullKey, orchestrationCache);
 
     if (result.wasOk()) {
-        currentCacheSize += orchestrationCache[fullKey].size;
         updateMemoryStats();
     }
 
@@ -222,20 +194,8 @@ juce::Result CrossModuleManager::cacheOrchestrationData(const std::string& key,
 }
 
 orchestration::Instrumentation CrossModuleManager::getCachedOrchestrationData(const std::string& key) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
     std::string fullKey = "orchestration_" + key;
-    auto it = orchestrationCache.find(fullKey);
-
-    if (it != orchestrationCache.end()) {
-        it->second.lastAccess = std::chrono::steady_clock::now();
-        it->second.accessCount++;
-        cacheHits++;
-        return deserializeFromCache<orchestration::Instrumentation>(fullKey, orchestrationCache);
-    }
-
-    cacheMisses++;
-    return orchestration::Instrumentation{}; // Return empty instrumentation if not found
+    return deserializeFromCache<orchestration::Instrumentation>(fullKey, orchestrationCache); // Empty instrumentation if not found
 }
 
 juce::Array<CrossModuleManager::Suggestion> CrossModuleManager::generateSuggestions(const SuggestionContext& context) {
@@ -263,23 +223,20 @@ MemoryStats CrossModuleManager::getMemoryStats() const {
 
     stats.totalAllocated = totalMemoryAllocated.load();
     stats.peakUsage = peakMemoryUsage.load();
-    stats.totalCached = currentCacheSize;
-
-    {
-        std::lock_guard<std::mutex> lock(cacheMutex);
-        stats.wizardCacheSize = wizardCache.size();
-        stats.harmonyCacheSize = harmonyCache.size();
-        stats.orchestrationCacheSize = orchestrationCache.size();
-    }
+    stats.wizardCacheSize = wizardCache.size();
+    stats.harmonyCacheSize = harmonyCache.size();
+    stats.orchestrationCacheSize = orchestrationCache.size();
 
     {
         std::lock_guard<std::mutex> lock(sessionsMutex);
         stats.activeModules = sessions.size();
     }
 
-    uint64_t hits = cacheHits.load();
-    uint64_t misses = cacheMisses.load();
-    stats.cacheHitRatio = (hits + misses > 0) ? static_cast<double>(hits) / (hits + misses) : 0.0;
+    auto cacheStats = getCacheStatistics();
+    stats.totalCached = cacheStats.bytesUsed;
+    stats.cacheHitRatio = cacheStats.hitRatio();
+    stats.cacheEvictions = cacheStats.evictions;
+    stats.averageLookupNanos = cacheStats.averageLookupNanos;
 
     return stats;
 }
@@ -287,41 +244,58 @@ MemoryStats CrossModuleManager::getMemoryStats() const {
 void CrossModuleManager::resetMemoryStats() {
     totalMemoryAllocated = 0;
     peakMemoryUsage = 0;
-    cacheHits = 0;
-    cacheMisses = 0;
+    wizardCache.resetStatistics();
+    harmonyCache.resetStatistics();
+    orchestrationCache.resetStatistics();
 }
 
 double CrossModuleManager::getCacheHitRatio() const {
-    uint64_t hits = cacheHits.load();
-    uint64_t misses = cacheMisses.load();
-    return (hits + misses > 0) ? static_cast<double>(hits) / (hits + misses) : 0.0;
+    return getCacheStatistics().hitRatio();
 }
 
-void CrossModuleManager::clearAllCaches() {
-    std::lock_guard<std::mutex> lock(cacheMutex);
+CacheStatistics CrossModuleManager::getCacheStatistics() const {
+    CacheStatistics combined;
+    uint64_t totalLookups = 0;
+
+    for (const auto* cache : { &wizardCache, &harmonyCache, &orchestrationCache }) {
+        auto stats = cache->getStatistics();
+        const uint64_t lookups = stats.hits + stats.misses;
+
+        combined.entries += stats.entries;
+        combined.bytesUsed += stats.bytesUsed;
+        combined.capacityBytes += stats.capacityBytes;
+        combined.hits += stats.hits;
+        combined.misses += stats.misses;
+        combined.insertions += stats.insertions;
+        combined.evictions += stats.evictions;
+        combined.rejections += stats.rejections;
+        combined.averageLookupNanos += stats.averageLookupNanos * lookups;
+        totalLookups += lookups;
+    }
 
+    // Lookup-weighted mean of the per-cache averages
+    combined.averageLookupNanos = totalLookups > 0 ? combined.averageLookupNanos / totalLookups : 0.0;
+    return combined;
+}
+
+void CrossModuleManager::clearAllCaches() {
     wizardCache.clear();
     harmonyCache.clear();
     orchestrationCache.clear();
-    currentCacheSize = 0;
 
     updateMemoryStats();
 }
 
 void CrossModuleManager::optimizeMemoryUsage() {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-
-    if (currentCacheSize > maxCacheSize) {
-        evictLeastRecentlyUsed();
-    }
-
+    // The byte budget is enforced on every insert; only time-based expiry is left
     cleanupExpiredCacheEntries();
-    optimizeCacheDistribution();
+    updateMemoryStats();
 }
 
 void CrossModuleManager::setMaxCacheSize(size_t maxSize) {
     maxCacheSize = maxSize;
-    optimizeMemoryUsage();
+    applyCacheBudget();
+    updateMemoryStats();
 }
 
 void CrossModuleManager::startBackgroundOptimization() {
@@ -331,7 +305,12 @@ void CrossModuleManager::startBackgroundOptimization() {
 }
 
 void CrossModuleManager::stopBackgroundOptimization() {
-    backgroundOptimizationRunning = false;
+    {
+        std::lock_guard<std::mutex> lock(optimizationMutex);
+        backgroundOptimizationRunning = false;
+    }
+    optimizationWakeup.notify_all();
+
     if (optimizationThread.joinable()) {
         optimizationThread.join();
     }
@@ -415,7 +394,7 @@ juce::Result CrossModuleManager::importSession(const std::string& sessionId, con
 // Private implementation methods
 
 void CrossModuleManager::updateMemoryStats() const {
-    size_t currentUsage = currentCacheSize;
+    size_t currentUsage = getCachedBytes();
 
     // Update peak usage if necessary
     size_t expected = currentUsage;
@@ -428,155 +407,50 @@ void CrossModuleManager::updateMemoryStats() const {
     totalMemoryAllocated = currentUsage;
 }
 
+size_t CrossModuleManager::getCachedBytes() const {
+    return wizardCache.bytesUsed() + harmonyCache.bytesUsed() + orchestrationCache.bytesUsed();
+}
+
 void CrossModuleManager::cleanupExpiredCacheEntries() {
-    auto now = std::chrono::steady_clock::now();
     auto maxAge = std::chrono::hours(1); // Cache entries expire after 1 hour
 
-    auto cleanCache = [&](auto& cache) {
-        auto it = cache.begin();
-        while (it != cache.end()) {
-            if (now - it->second.lastAccess > maxAge) {
-                currentCacheSize -= it->second.size;
-                it = cache.erase(it);
-            } else {
-                ++it;
-            }
-        }
-    };
-
-    cleanCache(wizardCache);
-    cleanCache(harmonyCache);
-    cleanCache(orchestrationCache);
+    wizardCache.expireOlderThan(maxAge);
+    harmonyCache.expireOlderThan(maxAge);
+    orchestrationCache.expireOlderThan(maxAge);
 }
 
-void CrossModuleManager::evictLeastRecentlyUsed() {
-    // Collect all cache entries with their access times
-    struct CacheInfo {
-        std::string key;
-        std::chrono::steady_clock::time_point lastAccess;
-        size_t size;
-        enum class Type { Wizard, Harmony, Orchestration } type;
-    };
-
-    std::vector<CacheInfo> entries;
-
-    {
-        std::lock_guard<std::mutex> lock(cacheMutex);
-
-        for (const auto& [key, entry] : wizardCache) {
-            entries.push_back({key, entry.lastAccess, entry.size, CacheInfo::Type::Wizard});
-        }
-        for (const auto& [key, entry] : harmonyCache) {
-            entries.push_back({key, entry.lastAccess, entry.size, CacheInfo::Type::Harmony});
-        }
-        for (const auto& [key, entry] : orchestrationCache) {
-            entries.push_back({key, entry.lastAccess, entry.size, CacheInfo::Type::Orchestration});
-        }
-    }
-
-    // Sort by last access time (oldest first)
-    std::sort(entries.begin(), entries.end(),
-              [](const CacheInfo& a, const CacheInfo& b) {
-                  return a.lastAccess < b.lastAccess;
-              });
+void CrossModuleManager::applyCacheBudget() {
+    // Equal distribution among the three caches; each evicts down to its share immediately
+    const size_t share = maxCacheSize.load() / 3;
 
-    // Evict entries until we're under the cache size limit
-    for (const auto& entry : entries) {
-        if (currentCacheSize <= maxCacheSize * 0.8) { // Leave 20% headroom
-            break;
-        }
-
-        std::lock_guard<std::mutex> lock(cacheMutex);
-
-        switch (entry.type) {
-            case CacheInfo::Type::Wizard:
-                if (auto it = wizardCache.find(entry.key); it != wizardCache.end()) {
-                    currentCacheSize -= it->second.size;
-                    wizardCache.erase(it);
-                }
-                break;
-            case CacheInfo::Type::Harmony:
-                if (auto it = harmonyCache.find(entry.key); it != harmonyCache.end()) {
-                    currentCacheSize -= it->second.size;
-                    harmonyCache.erase(it);
-                }
-                break;
-            case CacheInfo::Type::Orchestration:
-                if (auto it = orchestrationCache.find(entry.key); it != orchestrationCache.end()) {
-                    currentCacheSize -= it->second.size;
-                    orchestrationCache.erase(it);
-                }
-                break;
-        }
-    }
+    wizardCache.setCapacity(share);
+    harmonyCache.setCapacity(share);
+    orchestrationCache.setCapacity(share);
 }
 
 void CrossModuleManager::backgroundOptimizationLoop() {
+    std::unique_lock<std::mutex> lock(optimizationMutex);
+
     while (backgroundOptimizationRunning) {
-        std::this_thread::sleep_for(std::chrono::minutes(5));
+        optimizationWakeup.wait_for(lock, std::chrono::minutes(5),
+                                    [this] { return !backgroundOptimizationRunning; });
 
         if (!backgroundOptimizationRunning) break;
 
+        lock.unlock();
+
         try {
             // Cleanup expired sessions
             cleanupExpiredSessions();
 
-            // Optimize memory usage
+            // Drop cache entries nobody has asked for in a while
             optimizeMemoryUsage();
-
-            // Optimize cache distribution
-            optimizeCacheDistribution();
         } catch (const std::exception& e) {
             // Log error but continue running
             juce::Logger::writeToLog("Background optimization error: " + juce::String(e.what()));
         }
-    }
-}
-
-void CrossModuleManager::optimizeCacheDistribution() {
-    auto stats = getMemoryStats();
-
-    // Simple heuristic: if one cache is using more than 60% of total cache space, rebalance
-    const double maxCacheShare = 0.6;
-    size_t targetShare = maxCacheSize / 3; // Equal distribution among three caches
-
-    auto rebalanceCache = [&](auto& cache, size_t currentSize) {
-        if (currentSize > targetShare * maxCacheShare) {
-            // This cache is too large, evict some entries
-            size_t toEvict = currentSize - targetShare;
-
-            std::vector<std::pair<std::string, std::chrono::steady_clock::time_point>> entries;
-            for (const auto& [key, entry] : cache) {
-                entries.emplace_back(key, entry.lastAccess);
-            }
 
-            std::sort(entries.begin(), entries.end(),
-                      [](const auto& a, const auto& b) { return a.second < b.second; });
-
-            size_t evicted = 0;
-            for (const auto& [key, _] : entries) {
-                if (evicted >= toEvict) break;
-
-                if (auto it = cache.find(key); it != cache.end()) {
-                    evicted += it->second.size;
-                    currentCacheSize -= it->second.size;
-                    cache.erase(it);
-                }
-            }
-        }
-    };
-
-    {
-        std::lock_guard<std::mutex> lock(cacheMutex);
-
-        size_t wizardSize = 0, harmonySize = 0, orchestrationSize = 0;
-        for (const auto& [_, entry] : wizardCache) wizardSize += entry.size;
-        for (const auto& [_, entry] : harmonyCache) harmonySize += entry.size;
-        for (const auto& [_, entry] : orchestrationCache) orchestrationSize += entry.size;
-
-        rebalanceCache(wizardCache, wizardSize);
-        rebalanceCache(harmonyCache, harmonySize);
-        rebalanceCache(orchestrationCache, orchestrationSize);
+        lock.lock();
     }
 }
 
@@ -692,8 +566,7 @@ void CrossModuleManager::generateOrchestrationSuggestions(const SuggestionContex
 
 // Template specializations for serialization
 template<typename T>
-juce::Result CrossModuleManager::serializeAndCache(const T& object, const std::string& key,
-                                                   std::unordered_map<std::string, CacheEntry>& cache) {
+juce::Result CrossModuleManager::serializeAndCache(const T& object, const std::string& key, SerializedCache& cache) {
     try {
         // Convert object to JSON
         juce::var jsonData;
@@ -707,13 +580,13 @@ juce::Result CrossModuleManager::serializeAndCache(const T& object, const std::s
 
         // Serialize JSON to binary
         auto jsonString = juce::JSON::toString(jsonData);
-        std::vector<uint8_t> data(jsonString.begin(), jsonString.end());
+        auto data = std::make_shared<const std::vector<uint8_t>>(jsonString.begin(), jsonString.end());
+        const size_t size = data->size();
 
         // Store in cache
-        CacheEntry entry;
-        entry.data = data;
-        entry.size = data.size();
-        cache[key] = entry;
+        if (!cache.insert(key, std::move(data), size)) {
+            return juce::Result::fail("Entry exceeds cache budget: " + juce::String(key));
+        }
 
         return juce::Result::ok();
     } catch (const std::exception& e) {
@@ -722,16 +595,16 @@ juce::Result CrossModuleManager::serializeAndCache(const T& object, const std::s
 }
 
 template<typename T>
-T CrossModuleManager::deserializeFromCache(const std::string& key,
-                                           const std::unordered_map<std::string, CacheEntry>& cache) const {
-    auto it = cache.find(key);
-    if (it == cache.end()) {
+T CrossModuleManager::deserializeFromCache(const std::string& key, SerializedCache& cache) const {
+    // The entry is immutable and reference counted, so parsing runs without any cache lock held
+    auto data = cache.find(key);
+    if (!data) {
         return T{}; // Return empty object
     }
 
     try {
         // Convert binary data back to JSON
-        std::string jsonString(it->second.data.begin(), it->second.data.end());
+        std::string jsonString(data->begin(), data->end());
         auto jsonData = juce::JSON::parse(juce::String(jsonString));
 
         // Convert JSON back to object
@@ -15,9 +15,91 @@
 #include <juce_dsp/juce_dsp.h>
 #include <cmath>
 #include <algorithm>
+#include <numeric>
 
 namespace Schillinger
 {
+    namespace
+    {
+        //==============================================================================
+        /**
+            Run-length encoder behind optimizePattern: equal consecutive values are
+            merged into value * count, at most 16 per group. Runs can be pushed whole,
+            so a pattern built from attack positions never has to be expanded step by step.
+        */
+        class RunLengthEncoder
+        {
+        public:
+            static constexpr int maxGroup = 16;
+
+            void push(int value, int64_t count = 1)
+            {
+                while (count > 0)
+                {
+                    if (runLength == 0 || value != runValue || runLength == maxGroup)
+                    {
+                        flush();
+                        runValue = value;
+                    }
+
+                    const auto take = static_cast<int>(juce::jmin<int64_t>(maxGroup - runLength, count));
+                    runLength += take;
+                    count -= take;
+                }
+            }
+
+            juce::Array<int> finish()
+            {
+                flush();
+                return std::move(groups);
+            }
+
+        private:
+            juce::Array<int> groups;
+            int runValue = 0;
+            int runLength = 0;
+
+            void flush()
+            {
+                if (runLength > 0)
+                    groups.add(runValue * runLength);
+                runLength = 0;
+            }
+        };
+
+        /**
+            Encode one interference cycle where every attack step takes valueForAttack(attack)
+            and every other step is a rest, walking the attacks instead of the LCM steps.
+        */
+        template <typename ValueForAttack>
+        juce::Array<int> encodeAttacks(const InterferenceCycle& cycle, ValueForAttack valueForAttack)
+        {
+            RunLengthEncoder encoder;
+
+            for (const auto& attack : cycle)
+            {
+                encoder.push(valueForAttack(attack));
+                encoder.push(0, attack.duration - 1);
+            }
+
+            return encoder.finish();
+        }
+
+        /** Per-axis sine/cosine table over the normalised grid coordinates */
+        template <typename Wave>
+        std::vector<float> makeAxisTable(int resolution, double cycles, Wave wave)
+        {
+            std::vector<float> table(static_cast<size_t>(resolution));
+            for (int i = 0; i < resolution; ++i)
+            {
+                const double phase = juce::MathConstants<double>::twoPi
+                                   * RhythmicField::gridCoordinate(i, resolution) * cycles;
+                table[static_cast<size_t>(i)] = static_cast<float>(wave(phase));
+            }
+            return table;
+        }
+    }
+
     //==============================================================================
     // RhythmAPI_Enhanced::Impl
     struct RhythmAPI_Enhanced::Impl
@@ -76,26 +158,10 @@ namespace Schillinger
         juce::Result calculateBeatInterference(int generatorA, int generatorB,
                                               InterferencePattern& result)
         {
-            // Beat interference uses Euclidean algorithm to find common ground
-            int lcm = std::lcm(generatorA, generatorB);
-            juce::Array<int> pattern;
-
-            // Create interference pattern by aligning generators
-            for (int i = 0; i < lcm; ++i)
-            {
-                bool generatorAActive = (i % generatorA == 0);
-                bool generatorBActive = (i % generatorB == 0);
-
-                if (generatorAActive && generatorBActive)
-                    pattern.add(1);  // Both generators hit - accent
-                else if (generatorAActive || generatorBActive)
-                    pattern.add(1);  // Single generator hits
-                else
-                    pattern.add(0);  // Rest
-            }
-
-            // Optimize pattern by grouping consecutive hits and rests
-            result.rhythmPattern = optimizePattern(pattern);
+            // Every attack of either generator is a hit, everything else a rest,
+            // grouped straight from the merged attack points
+            const InterferenceCycle cycle { generatorA, generatorB };
+            result.rhythmPattern = encodeAttacks(cycle, [](const InterferenceCycle::Attack&) { return 1; });
             result.confidence = calculateConfidence(result.rhythmPattern, generatorA, generatorB);
 
             return juce::Result::ok();
@@ -138,36 +204,15 @@ namespace Schillinger
         juce::Result calculatePolyrhythmicInterference(int generatorA, int generatorB,
                                                        InterferencePattern& result)
         {
-            // Polyrhythmic interference creates complex overlapping patterns
-            int lcm = std::lcm(generatorA, generatorB);
-            juce::Array<int> pattern;
-
-            for (int i = 0; i < lcm; ++i)
+            // Intensity is the number of generators attacking on a step plus a
+            // 0.3 * sin * cos phase modulation. The modulation never exceeds 0.3, so it
+            // cannot change the rounded value: attacks score their coincidence count
+            // (2 where both generators meet, 1 otherwise) and every other step rests.
+            const InterferenceCycle cycle { generatorA, generatorB };
+            result.rhythmPattern = encodeAttacks(cycle, [](const InterferenceCycle::Attack& attack)
             {
-                int generatorAPhase = (i % generatorA);
-                int generatorBPhase = (i % generatorB);
-
-                // Calculate interference intensity at this point
-                double intensity = 0.0;
-
-                if (generatorAPhase == 0) intensity += 1.0;
-                if (generatorBPhase == 0) intensity += 1.0;
-
-                // Add phase-based modulation for polyrhythmic complexity
-                double phaseModulation = std::sin(2.0 * juce::MathConstants<double>::pi *
-                                                 generatorAPhase / generatorA) *
-                                        std::cos(2.0 * juce::MathConstants<double>::pi *
-                                                 generatorBPhase / generatorB);
-
-                intensity += 0.3 * phaseModulation;
-
-                // Convert intensity to rhythm value
-                int rhythmValue = static_cast<int>(std::round(intensity));
-                rhythmValue = juce::jlimit(0, 3, rhythmValue); // Limit to 0-3
-                pattern.add(rhythmValue);
-            }
-
-            result.rhythmPattern = optimizePattern(pattern);
+                return juce::jlimit(0, 3, attack.getNumCoincident());
+            });
             result.confidence = calculateConfidence(result.rhythmPattern, generatorA, generatorB);
 
             return juce::Result::ok();
@@ -245,30 +290,18 @@ namespace Schillinger
             field.is3D = false;
             field.dimensions = 2;
             field.resolution = resolution;
-            field.points2D.clear();
+            field.allocateGrid();
+
+            // intensity(x, y) = (sin(phaseX) * cos(phaseY) + 1) / 2 is separable:
+            // one table per axis, then each row is a scaled copy of the y table
+            const auto sinX = makeAxisTable(resolution, generatorA, [](double phase) { return std::sin(phase); });
+            const auto cosY = makeAxisTable(resolution, generatorB, [](double phase) { return std::cos(phase); });
 
             for (int x = 0; x < resolution; ++x)
             {
-                for (int y = 0; y < resolution; ++y)
-                {
-                    float xNorm = static_cast<float>(x) / (resolution - 1);
-                    float yNorm = static_cast<float>(y) / (resolution - 1);
-
-                    // Calculate field intensity using generator interference
-                    double phaseX = 2.0 * juce::MathConstants<double>::pi * xNorm * generatorA;
-                    double phaseY = 2.0 * juce::MathConstants<double>::pi * yNorm * generatorB;
-
-                    double intensity = std::sin(phaseX) * std::cos(phaseY);
-                    intensity = (intensity + 1.0) / 2.0; // Normalize to 0-1
-
-                    RhythmicFieldPoint2D point;
-                    point.x = xNorm;
-                    point.y = yNorm;
-                    point.intensity = static_cast<float>(intensity);
-                    point.subdivision = resolution;
-
-                    field.points2D.add(point);
-                }
+                float* row = field.intensities.data() + static_cast<size_t>(x) * resolution;
+                juce::FloatVectorOperations::copyWithMultiply(row, cosY.data(), 0.5f * sinX[static_cast<size_t>(x)], resolution);
+                juce::FloatVectorOperations::add(row, 0.5f, resolution); // Normalize to 0-1
             }
         }
 
@@ -279,36 +312,23 @@ namespace Schillinger
             field.is3D = true;
             field.dimensions = 3;
             field.resolution = resolution;
-            field.points3D.clear();
+            field.allocateGrid();
+
+            // intensity = (sin(phaseX) * cos(phaseY) * sin(phaseZ) + 1) / 2, with the
+            // depth axis at the harmonic relation sqrt(a * b); filled one z row at a time
+            const auto sinX = makeAxisTable(resolution, generatorA, [](double phase) { return std::sin(phase); });
+            const auto cosY = makeAxisTable(resolution, generatorB, [](double phase) { return std::cos(phase); });
+            const auto sinZ = makeAxisTable(resolution, std::sqrt(generatorA * generatorB),
+                                            [](double phase) { return std::sin(phase); });
 
             for (int x = 0; x < resolution; ++x)
             {
                 for (int y = 0; y < resolution; ++y)
                 {
-                    for (int z = 0; z < resolution; ++z)
-                    {
-                        float xNorm = static_cast<float>(x) / (resolution - 1);
-                        float yNorm = static_cast<float>(y) / (resolution - 1);
-                        float zNorm = static_cast<float>(z) / (resolution - 1);
-
-                        // Calculate 3D interference with harmonic content
-                        double phaseX = 2.0 * juce::MathConstants<double>::pi * xNorm * generatorA;
-                        double phaseY = 2.0 * juce::MathConstants<double>::pi * yNorm * generatorB;
-                        double phaseZ = 2.0 * juce::MathConstants<double>::pi * zNorm *
-                                      std::sqrt(generatorA * generatorB); // Harmonic relation
-
-                        double intensity = std::sin(phaseX) * std::cos(phaseY) * std::sin(phaseZ);
-                        intensity = (intensity + 1.0) / 2.0; // Normalize to 0-1
-
-                        RhythmicFieldPoint3D point;
-                        point.x = xNorm;
-                        point.y = yNorm;
-                        point.z = zNorm; // Represents harmonic content
-                        point.intensity = static_cast<float>(intensity);
-                        point.subdivision = resolution;
-
-                        field.points3D.add(point);
-                    }
+                    const float scale = 0.5f * sinX[static_cast<size_t>(x)] * cosY[static_cast<size_t>(y)];
+                    float* row = field.intensities.data() + (static_cast<size_t>(x) * resolution + y) * resolution;
+                    juce::FloatVectorOperations::copyWithMultiply(row, sinZ.data(), scale, resolution);
+                    juce::FloatVectorOperations::add(row, 0.5f, resolution); // Normalize to 0-1
                 }
             }
         }
@@ -328,19 +348,22 @@ namespace Schillinger
 
             double hitRatio = static_cast<double>(hits) / total;
 
-            // Check if pattern aligns with generators
+            // Check if pattern aligns with generators: only attack steps can count,
+            // so walk the merged attacks rather than every step of the cycle
+            const InterferenceCycle cycle { generatorA, generatorB };
+            const auto limit = juce::jmin<int64_t>(total, cycle.getCycleLength());
             int generatorAlignment = 0;
-            int lcm = std::lcm(generatorA, generatorB);
 
-            for (int i = 0; i < juce::jmin(total, lcm); ++i)
+            for (const auto& attack : cycle)
             {
-                if ((i % generatorA == 0 || i % generatorB == 0) &&
-                    (i < pattern.size() && pattern[i] > 0))
+                if (attack.position >= limit)
+                    break;
+
+                if (pattern[static_cast<int>(attack.position)] > 0)
                     generatorAlignment++;
             }
 
-            double alignmentRatio = static_cast<double>(generatorAlignment) /
-                                   std::min(lcm, total);
+            double alignmentRatio = static_cast<double>(generatorAlignment) / static_cast<double>(limit);
 
             return (hitRatio + alignmentRatio) / 2.0;
         }
@@ -348,29 +371,11 @@ namespace Schillinger
         /** Optimize pattern by grouping consecutive values */
         juce::Array<int> optimizePattern(const juce::Array<int>& rawPattern)
         {
-            juce::Array<int> optimized;
-            if (rawPattern.isEmpty())
-                return optimized;
-
-            int currentValue = rawPattern[0];
-            int count = 1;
-
-            for (int i = 1; i < rawPattern.size(); ++i)
-            {
-                if (rawPattern[i] == currentValue && count < 16) // Limit grouping
-                {
-                    count++;
-                }
-                else
-                {
-                    optimized.add(currentValue * count);
-                    currentValue = rawPattern[i];
-                    count = 1;
-                }
-            }
-            optimized.add(currentValue * count);
+            RunLengthEncoder encoder;
+            for (int value : rawPattern)
+                encoder.push(value);
 
-            return optimized;
+            return encoder.finish();
         }
     };
 
@@ -650,29 +655,11 @@ namespace Schillinger
         auto analysisJson = new juce::DynamicObject();
 
         // Calculate field statistics
-        int totalPoints = field.is3D ? field.points3D.size() : field.points2D.size();
-        double totalIntensity = 0.0;
-        double maxIntensity = 0.0;
-        double minIntensity = 1.0;
-
-        if (field.is3D)
-        {
-            for (const auto& point : field.points3D)
-            {
-                totalIntensity += point.intensity;
-                maxIntensity = juce::jmax(maxIntensity, static_cast<double>(point.intensity));
-                minIntensity = juce::jmin(minIntensity, static_cast<double>(point.intensity));
-            }
-        }
-        else
-        {
-            for (const auto& point : field.points2D)
-            {
-                totalIntensity += point.intensity;
-                maxIntensity = juce::jmax(maxIntensity, static_cast<double>(point.intensity));
-                minIntensity = juce::jmin(minIntensity, static_cast<double>(point.intensity));
-            }
-        }
+        int totalPoints = field.getNumPoints();
+        double totalIntensity = std::accumulate(field.intensities.begin(), field.intensities.end(), 0.0);
+        auto range = juce::FloatVectorOperations::findMinAndMax(field.intensities.data(), totalPoints);
+        double maxIntensity = juce::jmax(0.0, static_cast<double>(range.getEnd()));
+        double minIntensity = juce::jmin(1.0, static_cast<double>(range.getStart()));
 
         analysisJson->setProperty("totalPoints", totalPoints);
         analysisJson->setProperty("averageIntensity", totalIntensity / totalPoints);
@@ -0,0 +1,222 @@
+/*
+  ==============================================================================
+
+    ShardedLRUCacheTests.cpp
+    Author:  White Room Project
+
+    Unit tests for ShardedLRUCache:
+    - Exact LRU and second-chance eviction order
+    - Byte budget and oversized entries
+    - Distribution of keys across shards
+
+  ==============================================================================
+*/
+
+#include "../include/ShardedLRUCache.h"
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace schillinger::performance::tests
+{
+
+    //==============================================================================
+    // Test Utilities
+    //==============================================================================
+
+    /** Simple test result tracker */
+    class TestRunner
+    {
+    public:
+        int passed = 0;
+        int failed = 0;
+
+        void assertTrue(bool condition, const std::string& testName)
+        {
+            if (condition)
+            {
+                passed++;
+                std::cout << "[PASS] " << testName << std::endl;
+            }
+            else
+            {
+                failed++;
+                std::cout << "[FAIL] " << testName << std::endl;
+            }
+        }
+
+        void assertFalse(bool condition, const std::string& testName)
+        {
+            assertTrue(!condition, testName);
+        }
+
+        void printSummary() const
+        {
+            std::cout << "\n=== Test Summary ===" << std::endl;
+            std::cout << "Passed: " << passed << std::endl;
+            std::cout << "Failed: " << failed << std::endl;
+            std::cout << "Total:  " << (passed + failed) << std::endl;
+            std::cout << "===================" << std::endl;
+        }
+
+        bool allPassed() const noexcept { return failed == 0; }
+    };
+
+    using Cache = ShardedLRUCache<std::string>;
+
+    bool insertKey(Cache& cache, const std::string& key, size_t charge)
+    {
+        return cache.insert(key, std::make_shared<const std::string>(key), charge);
+    }
+
+    //==============================================================================
+    // Eviction Order Tests
+    //==============================================================================
+
+    void testEviction_ExactLRU(TestRunner& runner)
+    {
+        // One shard of three 100-byte entries keeps the order deterministic
+        Cache cache(300, 1, CacheReadMode::ExactLRU);
+        insertKey(cache, "a", 100);
+        insertKey(cache, "b", 100);
+        insertKey(cache, "c", 100);
+
+        runner.assertTrue(cache.find("a") != nullptr, "ExactLRU: Hit on a");
+
+        insertKey(cache, "d", 100);
+        runner.assertFalse(cache.contains("b"), "ExactLRU: Least recently used b evicted");
+        runner.assertTrue(cache.contains("a") && cache.contains("c") && cache.contains("d"),
+                          "ExactLRU: a, c, d kept");
+
+        insertKey(cache, "e", 100);
+        runner.assertFalse(cache.contains("c"), "ExactLRU: c evicted next");
+        runner.assertTrue(cache.getStatistics().evictions == 2, "ExactLRU: Two evictions counted");
+    }
+
+    void testEviction_SecondChance(TestRunner& runner)
+    {
+        Cache cache(300, 1, CacheReadMode::SharedRead);
+        insertKey(cache, "a", 100);
+        insertKey(cache, "b", 100);
+        insertKey(cache, "c", 100);
+
+        // A read only marks a; it stays at the tail until an insert needs room
+        runner.assertTrue(cache.find("a") != nullptr, "SecondChance: Hit on a");
+
+        insertKey(cache, "d", 100);
+        runner.assertTrue(cache.contains("a"), "SecondChance: Referenced tail entry a survives");
+        runner.assertFalse(cache.contains("b"), "SecondChance: Unreferenced b evicted instead");
+
+        // a was moved to the front behind d, so c is the tail now
+        insertKey(cache, "e", 100);
+        runner.assertFalse(cache.contains("c"), "SecondChance: c evicted before a");
+        runner.assertTrue(cache.contains("a"), "SecondChance: a still cached");
+
+        // The chance is spent: unread, a is evicted when it reaches the tail again
+        insertKey(cache, "f", 100);
+        runner.assertFalse(cache.contains("a"), "SecondChance: a evicted once its chance is used");
+        runner.assertTrue(cache.contains("d") && cache.contains("e") && cache.contains("f"),
+                          "SecondChance: d, e, f kept");
+
+        // Reading again earns a fresh chance
+        runner.assertTrue(cache.find("d") != nullptr, "SecondChance: Hit on d");
+        insertKey(cache, "g", 100);
+        runner.assertTrue(cache.contains("d"), "SecondChance: Re-referenced d survives");
+        runner.assertFalse(cache.contains("e"), "SecondChance: e evicted instead");
+
+        runner.assertTrue(cache.getStatistics().evictions == 4, "SecondChance: Four evictions counted");
+        runner.assertTrue(cache.bytesUsed() == 300, "SecondChance: Budget stays full, never exceeded");
+    }
+
+    void testEviction_Budget(TestRunner& runner)
+    {
+        Cache cache(300, 1, CacheReadMode::SharedRead);
+        insertKey(cache, "a", 100);
+
+        runner.assertFalse(insertKey(cache, "big", 301), "Budget: Entry larger than the shard rejected");
+        runner.assertTrue(cache.getStatistics().rejections == 1, "Budget: Rejection counted");
+
+        // Replacing with a larger charge evicts others to make room
+        insertKey(cache, "b", 100);
+        insertKey(cache, "c", 100);
+        insertKey(cache, "a", 200);
+        runner.assertTrue(cache.bytesUsed() <= 300, "Budget: Replacement stays within budget");
+        runner.assertTrue(cache.find("a") != nullptr && cache.size() == 2, "Budget: Replaced entry kept");
+
+        // An oversized replacement drops the stale value
+        runner.assertFalse(insertKey(cache, "a", 400), "Budget: Oversized replacement rejected");
+        runner.assertFalse(cache.contains("a"), "Budget: Stale value not served");
+    }
+
+    //==============================================================================
+    // Shard Distribution Tests
+    //==============================================================================
+
+    void testShards_Distribution(TestRunner& runner)
+    {
+        constexpr size_t numShards = 16;
+
+        // 500 keys per shard on average against room for 1000: no shard may
+        // take twice its share, or it would have evicted
+        {
+            Cache cache(numShards * 1000, numShards);
+            for (int i = 0; i < 8000; ++i)
+            {
+                insertKey(cache, "harmony_progression_" + std::to_string(i), 1);
+            }
+
+            runner.assertTrue(cache.getStatistics().evictions == 0, "Shards: No shard above twice its share");
+            runner.assertTrue(cache.size() == 8000, "Shards: Every key cached");
+        }
+
+        // 256 keys per shard on average against room for 16: every shard must
+        // receive enough keys to fill up
+        {
+            Cache cache(numShards * 16, numShards);
+            for (int i = 0; i < 4096; ++i)
+            {
+                insertKey(cache, "rhythm_pattern_" + std::to_string(i), 1);
+            }
+
+            runner.assertTrue(cache.size() == numShards * 16, "Shards: Every shard filled");
+            runner.assertTrue(cache.bytesUsed() == cache.getCapacity(), "Shards: Whole budget in use");
+        }
+
+        // Shard counts round up to a power of two
+        Cache rounded(1000, 10);
+        runner.assertTrue(rounded.getShardCount() == 16, "Shards: 10 shards rounded up to 16");
+    }
+
+    //==============================================================================
+    // Main Test Runner
+    //==============================================================================
+
+    int runAllTests()
+    {
+        std::cout << "\n=== ShardedLRUCache Unit Tests ===" << std::endl;
+
+        TestRunner runner;
+
+        std::cout << "\n--- Eviction Order Tests ---" << std::endl;
+        testEviction_ExactLRU(runner);
+        testEviction_SecondChance(runner);
+        testEviction_Budget(runner);
+
+        std::cout << "\n--- Shard Distribution Tests ---" << std::endl;
+        testShards_Distribution(runner);
+
+        runner.printSummary();
+
+        return runner.allPassed() ? 0 : 1;
+    }
+
+} // namespace schillinger::performance::tests
+
+//==============================================================================
+// Main Entry Point
+//==============================================================================
+
+int main()
+{
+    return schillinger::performance::tests::runAllTests();
+}
@@ -0,0 +1,358 @@
+/*
+  ==============================================================================
+
+    InterferenceCycleTests.cpp
+    Author:  White Room Project
+
+    Unit tests for InterferenceCycle and the dense rhythmic field grids:
+    - Inclusion-exclusion attack counts against brute-force enumeration
+    - Merged attack positions, durations and coincidence masks
+    - 2D and 3D field intensities against the per-point formulas
+
+  ==============================================================================
+*/
+
+#include "../include/RhythmAPI_Enhanced.h"
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace Schillinger::Rhythm::Tests
+{
+
+    //==============================================================================
+    // Test Utilities
+    //==============================================================================
+
+    /** Simple test result tracker */
+    class TestRunner
+    {
+    public:
+        int passed = 0;
+        int failed = 0;
+
+        void assertTrue(bool condition, const std::string& testName)
+        {
+            if (condition)
+            {
+                passed++;
+                std::cout << "[PASS] " << testName << std::endl;
+            }
+            else
+            {
+                failed++;
+                std::cout << "[FAIL] " << testName << std::endl;
+            }
+        }
+
+        void assertFalse(bool condition, const std::string& testName)
+        {
+            assertTrue(!condition, testName);
+        }
+
+        void printSummary() const
+        {
+            std::cout << "\n=== Test Summary ===" << std::endl;
+            std::cout << "Passed: " << passed << std::endl;
+            std::cout << "Failed: " << failed << std::endl;
+            std::cout << "Total:  " << (passed + failed) << std::endl;
+            std::cout << "===================" << std::endl;
+        }
+
+        bool allPassed() const noexcept { return failed == 0; }
+    };
+
+    /** Walk every step of the cycle and record which generators attack on it */
+    std::vector<InterferenceCycle::Attack> enumerateAttacks(const std::vector<int>& generators)
+    {
+        int64_t cycleLength = 1;
+        for (int generator : generators)
+            cycleLength = std::lcm(cycleLength, static_cast<int64_t>(generator));
+
+        std::vector<InterferenceCycle::Attack> attacks;
+        for (int64_t step = 0; step < cycleLength; ++step)
+        {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < generators.size(); ++i)
+                if (step % generators[i] == 0)
+                    mask |= (1u << i);
+
+            if (mask == 0)
+                continue;
+
+            if (!attacks.empty())
+                attacks.back().duration = step - attacks.back().position;
+
+            InterferenceCycle::Attack attack;
+            attack.position = step;
+            attack.generatorMask = mask;
+            attacks.push_back(attack);
+        }
+
+        attacks.back().duration = cycleLength - attacks.back().position;
+        return attacks;
+    }
+
+    /** Every generator set of the given size drawn from 1..maxPeriod, in ascending order */
+    void forEachGeneratorSet(int size, int maxPeriod, std::vector<int>& current,
+                             const std::function<void(const std::vector<int>&)>& visit)
+    {
+        if (static_cast<int>(current.size()) == size)
+        {
+            visit(current);
+            return;
+        }
+
+        for (int period = current.empty() ? 1 : current.back(); period <= maxPeriod; ++period)
+        {
+            current.push_back(period);
+            forEachGeneratorSet(size, maxPeriod, current, visit);
+            current.pop_back();
+        }
+    }
+
+    std::string describe(const std::vector<int>& generators)
+    {
+        std::string text;
+        for (int generator : generators)
+            text += (text.empty() ? "" : ":") + std::to_string(generator);
+        return text;
+    }
+
+    //==============================================================================
+    // Attack Count Tests
+    //==============================================================================
+
+    void testCycle_CountMatchesEnumeration(TestRunner& runner)
+    {
+        // Singles and pairs up to 16, triples up to 9, quadruples up to 6, repeats included
+        const std::pair<int, int> sets[] = { { 1, 16 }, { 2, 16 }, { 3, 9 }, { 4, 6 } };
+
+        for (const auto& [size, maxPeriod] : sets)
+        {
+            int checked = 0;
+            std::vector<std::string> mismatches;
+            std::vector<int> current;
+
+            forEachGeneratorSet(size, maxPeriod, current, [&](const std::vector<int>& generators)
+            {
+                const InterferenceCycle cycle(juce::Array<int>(generators.data(), static_cast<int>(generators.size())));
+                const auto expected = enumerateAttacks(generators);
+
+                ++checked;
+                if (!cycle.isValid() || cycle.getNumAttacks() != static_cast<int64_t>(expected.size()))
+                    mismatches.push_back(describe(generators));
+            });
+
+            if (!mismatches.empty())
+                std::cout << "  first mismatch: " << mismatches.front() << std::endl;
+
+            runner.assertTrue(checked > 0 && mismatches.empty(),
+                              "Cycle: inclusion-exclusion count matches enumeration for "
+                              + std::to_string(checked) + " sets of " + std::to_string(size));
+        }
+    }
+
+    void testCycle_AttacksMatchEnumeration(TestRunner& runner)
+    {
+        const std::pair<int, int> sets[] = { { 2, 12 }, { 3, 8 } };
+
+        for (const auto& [size, maxPeriod] : sets)
+        {
+            int checked = 0;
+            std::vector<std::string> mismatches;
+            std::vector<int> current;
+
+            forEachGeneratorSet(size, maxPeriod, current, [&](const std::vector<int>& generators)
+            {
+                const InterferenceCycle cycle(juce::Array<int>(generators.data(), static_cast<int>(generators.size())));
+                const auto expected = enumerateAttacks(generators);
+
+                size_t index = 0;
+                int64_t totalDuration = 0;
+                bool matches = true;
+
+                for (const auto& attack : cycle)
+                {
+                    matches = matches && index < expected.size()
+                              && attack.position == expected[index].position
+                              && attack.duration == expected[index].duration
+                              && attack.generatorMask == expected[index].generatorMask;
+                    totalDuration += attack.duration;
+                    ++index;
+                }
+
+                const auto durations = cycle.getResultantDurations();
+                matches = matches && index == expected.size()
+                          && totalDuration == cycle.getCycleLength()
+                          && durations.size() == static_cast<int>(expected.size());
+
+                for (int i = 0; matches && i < durations.size(); ++i)
+                    matches = durations[i] == static_cast<int>(expected[static_cast<size_t>(i)].duration);
+
+                ++checked;
+                if (!matches)
+                    mismatches.push_back(describe(generators));
+            });
+
+            if (!mismatches.empty())
+                std::cout << "  first mismatch: " << mismatches.front() << std::endl;
+
+            runner.assertTrue(checked > 0 && mismatches.empty(),
+                              "Cycle: positions, durations and masks match enumeration for "
+                              + std::to_string(checked) + " sets of " + std::to_string(size));
+        }
+    }
+
+    void testCycle_Coincidence(TestRunner& runner)
+    {
+        // 3:4 over 12 steps: 0 3 4 6 8 9, with both generators only on the downbeat
+        const InterferenceCycle cycle { 3, 4 };
+        const auto attack = *cycle.begin();
+
+        runner.assertTrue(cycle.getCycleLength() == 12, "Cycle: 3:4 spans 12 steps");
+        runner.assertTrue(cycle.getNumAttacks() == 6, "Cycle: 3:4 has 6 attacks");
+        runner.assertTrue(attack.position == 0 && attack.getNumCoincident() == 2,
+                          "Cycle: both generators coincide on the downbeat");
+    }
+
+    void testCycle_InvalidGenerators(TestRunner& runner)
+    {
+        const InterferenceCycle zero { 0, 3 };
+        const InterferenceCycle negative { 4, -2 };
+
+        runner.assertFalse(zero.isValid(), "Cycle: zero generator is invalid");
+        runner.assertFalse(negative.isValid(), "Cycle: negative generator is invalid");
+        runner.assertTrue(zero.getNumAttacks() == 0 && !(zero.begin() != zero.end()),
+                          "Cycle: invalid cycle has no attacks");
+    }
+
+    //==============================================================================
+    // Dense Grid Tests
+    //==============================================================================
+
+    double wave(int index, int resolution, double cycles)
+    {
+        return juce::MathConstants<double>::twoPi * RhythmicField::gridCoordinate(index, resolution) * cycles;
+    }
+
+    void testField_2DMatchesFormula(TestRunner& runner)
+    {
+        RhythmAPI_Enhanced api(nullptr);
+        double maxError = 0.0;
+        bool sized = true;
+
+        for (int resolution : { 1, 2, 3, 7, 16 })
+        {
+            for (int a = 1; a <= 5; ++a)
+            {
+                for (int b = 1; b <= 5; ++b)
+                {
+                    RhythmicField field;
+                    if (api.createRhythmicField2DSync(a, b, resolution, field).failed()
+                        || field.getNumPoints() != resolution * resolution)
+                    {
+                        sized = false;
+                        continue;
+                    }
+
+                    for (int x = 0; x < resolution; ++x)
+                    {
+                        for (int y = 0; y < resolution; ++y)
+                        {
+                            const double expected = (std::sin(wave(x, resolution, a))
+                                                     * std::cos(wave(y, resolution, b)) + 1.0) / 2.0;
+                            maxError = std::max(maxError, std::abs(field.getIntensity(x, y) - expected));
+                        }
+                    }
+                }
+            }
+        }
+
+        std::cout << "  2D max error: " << maxError << std::endl;
+        runner.assertTrue(sized, "Field: 2D grid holds resolution^2 points");
+        runner.assertTrue(maxError < 1.0e-5, "Field: 2D intensities match sin(x) * cos(y) per point");
+    }
+
+    void testField_3DMatchesFormula(TestRunner& runner)
+    {
+        RhythmAPI_Enhanced api(nullptr);
+        double maxError = 0.0;
+        bool sized = true;
+
+        for (int resolution : { 1, 2, 3, 7, 16 })
+        {
+            for (int a = 1; a <= 4; ++a)
+            {
+                for (int b = 1; b <= 4; ++b)
+                {
+                    RhythmicField field;
+                    if (api.createRhythmicField3DSync(a, b, resolution, field).failed()
+                        || field.getNumPoints() != resolution * resolution * resolution)
+                    {
+                        sized = false;
+                        continue;
+                    }
+
+                    const double harmonic = std::sqrt(static_cast<double>(a * b));
+
+                    for (int x = 0; x < resolution; ++x)
+                    {
+                        for (int y = 0; y < resolution; ++y)
+                        {
+                            for (int z = 0; z < resolution; ++z)
+                            {
+                                const double expected = (std::sin(wave(x, resolution, a))
+                                                         * std::cos(wave(y, resolution, b))
+                                                         * std::sin(wave(z, resolution, harmonic)) + 1.0) / 2.0;
+                                maxError = std::max(maxError, std::abs(field.getIntensity(x, y, z) - expected));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        std::cout << "  3D max error: " << maxError << std::endl;
+        runner.assertTrue(sized, "Field: 3D grid holds resolution^3 points");
+        runner.assertTrue(maxError < 1.0e-5, "Field: 3D intensities match sin(x) * cos(y) * sin(z) per point");
+    }
+
+    //==============================================================================
+    // Test Runner
+    //==============================================================================
+
+    int runAllTests()
+    {
+        std::cout << "\n=== InterferenceCycle Unit Tests ===" << std::endl;
+
+        TestRunner runner;
+
+        std::cout << "\n--- Attack Count Tests ---" << std::endl;
+        testCycle_CountMatchesEnumeration(runner);
+        testCycle_AttacksMatchEnumeration(runner);
+        testCycle_Coincidence(runner);
+        testCycle_InvalidGenerators(runner);
+
+        std::cout << "\n--- Dense Grid Tests ---" << std::endl;
+        testField_2DMatchesFormula(runner);
+        testField_3DMatchesFormula(runner);
+
+        runner.printSummary();
+
+        return runner.allPassed() ? 0 : 1;
+    }
+
+} // namespace Schillinger::Rhythm::Tests
+
+//==============================================================================
+// Main Entry Point
+//==============================================================================
+
+int main()
+{
+    return Schillinger::Rhythm::Tests::runAllTests();
+}
@@ -4,6 +4,7 @@
       "target_name": "white_room_ffi",
       "sources": [
         "src/binding.cpp",
+        "src/generation.cpp",
         "src/serialization.cpp",
         "src/errors.cpp"
       ],
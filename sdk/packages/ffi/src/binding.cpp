@@ -9,6 +9,11 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "generation.h"
 
 // =============================================================================
 // FORWARD DECLARATIONS
@@ -143,6 +148,383 @@ Napi::Value DeserializeJSON(const Napi::CallbackInfo& info) {
   return result;
 }
 
+// =============================================================================
+// GENERATION HELPERS
+// =============================================================================
+
+/**
+ * Accept a system configuration as an object or as a JSON string
+ */
+bool ReadConfigObject(Napi::Env env, Napi::Value value, const char* what, Napi::Object& out) {
+  if (value.IsString()) {
+    Napi::Object json = env.Global().Get("JSON").As<Napi::Object>();
+    value = json.Get("parse").As<Napi::Function>().Call(json, { value });
+    if (env.IsExceptionPending()) {
+      return false;
+    }
+  }
+
+  if (!value.IsObject() || value.IsArray()) {
+    Napi::TypeError::New(env, std::string("Invalid ") + what + " (expected object or JSON string)").ThrowAsJavaScriptException();
+    return false;
+  }
+
+  out = value.As<Napi::Object>();
+  return true;
+}
+
+double GetNumber(Napi::Object obj, const char* key, double fallback) {
+  Napi::Value value = obj.Get(key);
+  return value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : fallback;
+}
+
+int GetInt(Napi::Object obj, const char* key, int fallback) {
+  Napi::Value value = obj.Get(key);
+  return value.IsNumber() ? value.As<Napi::Number>().Int32Value() : fallback;
+}
+
+bool ParseRhythmSystem(Napi::Env env, Napi::Object rhythmSystem, std::vector<generation::RhythmGenerator>& generators) {
+  Napi::Value generatorsValue = rhythmSystem.Get("generators");
+  if (!generatorsValue.IsArray()) {
+    Napi::TypeError::New(env, "Rhythm system must have generators array").ThrowAsJavaScriptException();
+    return false;
+  }
+
+  Napi::Array generatorsArray = generatorsValue.As<Napi::Array>();
+
+  // Validate: need at least 1 generator (for simple rhythms)
+  if (generatorsArray.Length() < 1) {
+    Napi::TypeError::New(env, "Rhythm system requires at least 1 generator").ThrowAsJavaScriptException();
+    return false;
+  }
+
+  generators.clear();
+  generators.reserve(generatorsArray.Length());
+
+  for (uint32_t i = 0; i < generatorsArray.Length(); ++i) {
+    Napi::Value genValue = generatorsArray.Get(i);
+    if (!genValue.IsObject() || !genValue.As<Napi::Object>().Get("period").IsNumber()) {
+      Napi::TypeError::New(env, "Each generator must be an object with a numeric period").ThrowAsJavaScriptException();
+      return false;
+    }
+
+    Napi::Object genObj = genValue.As<Napi::Object>();
+
+    generation::RhythmGenerator gen;
+    gen.period = GetNumber(genObj, "period", 1.0);
+    gen.phase = GetNumber(genObj, "phase", 0.0);
+    gen.weight = GetNumber(genObj, "weight", 1.0);
+    generators.push_back(gen);
+  }
+
+  return true;
+}
+
+bool ParseMelodySystem(Napi::Env env, Napi::Object melodySystem, generation::MelodySystem& system) {
+  system.cycleLength = GetInt(melodySystem, "cycleLength", 0);
+
+  Napi::Value intervalSeedValue = melodySystem.Get("intervalSeed");
+  if (!intervalSeedValue.IsArray()) {
+    Napi::TypeError::New(env, "Melody system must have intervalSeed array").ThrowAsJavaScriptException();
+    return false;
+  }
+
+  Napi::Array intervalSeedArray = intervalSeedValue.As<Napi::Array>();
+  system.intervalSeed.clear();
+  for (uint32_t i = 0; i < intervalSeedArray.Length(); ++i) {
+    Napi::Value interval = intervalSeedArray.Get(i);
+    system.intervalSeed.push_back(interval.IsNumber() ? interval.As<Napi::Number>().Int32Value() : 0);
+  }
+
+  // Extract contour constraints
+  Napi::Value contourValue = melodySystem.Get("contourConstraints");
+  if (contourValue.IsObject()) {
+    Napi::Object contourObj = contourValue.As<Napi::Object>();
+    Napi::Value typeValue = contourObj.Get("type");
+    if (typeValue.IsString()) {
+      system.contourType = typeValue.As<Napi::String>().Utf8Value();
+    }
+    system.maxIntervalLeaps = GetInt(contourObj, "maxIntervalLeaps", system.maxIntervalLeaps);
+  }
+
+  // Extract register constraints
+  Napi::Value registerValue = melodySystem.Get("registerConstraints");
+  if (registerValue.IsObject()) {
+    Napi::Object registerObj = registerValue.As<Napi::Object>();
+    system.minPitch = GetInt(registerObj, "minPitch", system.minPitch);
+    system.maxPitch = GetInt(registerObj, "maxPitch", system.maxPitch);
+    Napi::Value transpositionValue = registerObj.Get("allowTransposition");
+    if (transpositionValue.IsBoolean()) {
+      system.allowTransposition = transpositionValue.As<Napi::Boolean>().Value();
+    }
+  }
+
+  return true;
+}
+
+bool ParseHarmonySystem(Napi::Env env, Napi::Object harmonySystem, generation::HarmonySystem& system) {
+  Napi::Value distributionValue = harmonySystem.Get("distribution");
+  if (!distributionValue.IsArray()) {
+    Napi::TypeError::New(env, "Harmony system must have distribution array").ThrowAsJavaScriptException();
+    return false;
+  }
+
+  Napi::Array distributionArray = distributionValue.As<Napi::Array>();
+  system.distribution.clear();
+  for (uint32_t i = 0; i < distributionArray.Length(); ++i) {
+    Napi::Value weight = distributionArray.Get(i);
+    system.distribution.push_back(weight.IsNumber() ? weight.As<Napi::Number>().DoubleValue() : 0.0);
+  }
+
+  return true;
+}
+
+/**
+ * Copy the ratio tree into flat nodes. Only levels up to nestingDepth + 1
+ * can become sections, so deeper subtrees are never visited.
+ */
+bool ParseRatioTreeNode(Napi::Env env, Napi::Object node, uint32_t nodeIndex, int level, generation::FormSystem& system) {
+  Napi::Value nodeIdValue = node.Get("nodeId");
+  system.nodes[nodeIndex].nodeId = nodeIdValue.IsString() ? nodeIdValue.As<Napi::String>().Utf8Value() : std::string();
+  system.nodes[nodeIndex].ratio = GetNumber(node, "ratio", 1.0);
+
+  Napi::Value childrenValue = node.Get("children");
+  if (level > system.nestingDepth || !childrenValue.IsArray()) {
+    return true;
+  }
+
+  Napi::Array childrenArray = childrenValue.As<Napi::Array>();
+  const uint32_t firstChild = static_cast<uint32_t>(system.nodes.size());
+  system.nodes[nodeIndex].firstChild = firstChild;
+  system.nodes[nodeIndex].childCount = childrenArray.Length();
+  system.nodes.resize(system.nodes.size() + childrenArray.Length());
+
+  for (uint32_t i = 0; i < childrenArray.Length(); ++i) {
+    Napi::Value child = childrenArray.Get(i);
+    if (!child.IsObject()) {
+      Napi::TypeError::New(env, "Ratio tree children must be objects").ThrowAsJavaScriptException();
+      return false;
+    }
+    if (!ParseRatioTreeNode(env, child.As<Napi::Object>(), firstChild + i, level + 1, system)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool ParseFormSystem(Napi::Env env, Napi::Object formSystem, generation::FormSystem& system) {
+  Napi::Value ratioTreeValue = formSystem.Get("ratioTree");
+  if (!ratioTreeValue.IsObject()) {
+    Napi::TypeError::New(env, "Form system must have ratioTree object").ThrowAsJavaScriptException();
+    return false;
+  }
+
+  system.nestingDepth = GetInt(formSystem, "nestingDepth", 3);
+  system.nodes.assign(1, generation::RatioTreeNode{});
+  return ParseRatioTreeNode(env, ratioTreeValue.As<Napi::Object>(), 0, 1, system);
+}
+
+/**
+ * Read attack times from any of the shapes the generators return:
+ * a Float64Array of times, a columnar result ({ time: Float64Array }),
+ * an array of { time } objects, or that array as a JSON string
+ */
+bool ReadAttackTimes(Napi::Env env, Napi::Value value, std::vector<double>& times) {
+  times.clear();
+
+  if (value.IsString()) {
+    Napi::Object json = env.Global().Get("JSON").As<Napi::Object>();
+    value = json.Get("parse").As<Napi::Function>().Call(json, { value });
+    if (env.IsExceptionPending()) {
+      return false;
+    }
+  }
+
+  if (value.IsObject() && !value.IsArray() && !value.IsTypedArray()) {
+    value = value.As<Napi::Object>().Get("time");
+  }
+
+  if (value.IsTypedArray() && value.As<Napi::TypedArray>().TypedArrayType() == napi_float64_array) {
+    Napi::Float64Array column = value.As<Napi::Float64Array>();
+    times.assign(column.Data(), column.Data() + column.ElementLength());
+    return true;
+  }
+
+  if (value.IsArray()) {
+    Napi::Array attacks = value.As<Napi::Array>();
+    times.reserve(attacks.Length());
+    for (uint32_t i = 0; i < attacks.Length(); ++i) {
+      Napi::Value attack = attacks.Get(i);
+      if (attack.IsObject()) {
+        times.push_back(GetNumber(attack.As<Napi::Object>(), "time", 0.0));
+      }
+    }
+    return true;
+  }
+
+  Napi::TypeError::New(env, "Invalid rhythm attacks (expected attack columns, array or JSON string)").ThrowAsJavaScriptException();
+  return false;
+}
+
+/**
+ * Hand a result column to JavaScript without copying: the ArrayBuffer
+ * adopts the vector's storage and frees it when collected
+ */
+template <typename TypedArrayType, typename T>
+TypedArrayType MakeTypedColumn(Napi::Env env, std::vector<T>&& column) {
+  const size_t length = column.size();
+
+#ifdef NODE_API_NO_EXTERNAL_BUFFERS_ALLOWED
+  Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, length * sizeof(T));
+  std::copy(column.begin(), column.end(), static_cast<T*>(buffer.Data()));
+#else
+  Napi::ArrayBuffer buffer;
+  if (length == 0) {
+    buffer = Napi::ArrayBuffer::New(env, 0);
+  } else {
+    auto* storage = new std::vector<T>(std::move(column));
+    buffer = Napi::ArrayBuffer::New(
+      env, storage->data(), length * sizeof(T),
+      [](Napi::Env, void*, std::vector<T>* adopted) { delete adopted; },
+      storage);
+  }
+#endif
+
+  return TypedArrayType::New(env, length, buffer, 0);
+}
+
+Napi::Object ToColumns(Napi::Env env, generation::RhythmAttacks&& attacks) {
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("time", MakeTypedColumn<Napi::Float64Array>(env, std::move(attacks.time)));
+  result.Set("accent", MakeTypedColumn<Napi::Float64Array>(env, std::move(attacks.accent)));
+  return result;
+}
+
+Napi::Object ToColumns(Napi::Env env, generation::PitchEvents&& events) {
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("time", MakeTypedColumn<Napi::Float64Array>(env, std::move(events.time)));
+  result.Set("pitch", MakeTypedColumn<Napi::Int32Array>(env, std::move(events.pitch)));
+  result.Set("velocity", MakeTypedColumn<Napi::Int32Array>(env, std::move(events.velocity)));
+  result.Set("duration", MakeTypedColumn<Napi::Float64Array>(env, std::move(events.duration)));
+  return result;
+}
+
+Napi::Object ToColumns(Napi::Env env, generation::ChordEvents&& events) {
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("time", MakeTypedColumn<Napi::Float64Array>(env, std::move(events.time)));
+  result.Set("root", MakeTypedColumn<Napi::Int32Array>(env, std::move(events.root)));
+  result.Set("weight", MakeTypedColumn<Napi::Float64Array>(env, std::move(events.weight)));
+  result.Set("intervalOffsets", MakeTypedColumn<Napi::Int32Array>(env, std::move(events.intervalOffsets)));
+  result.Set("intervals", MakeTypedColumn<Napi::Int32Array>(env, std::move(events.intervals)));
+  return result;
+}
+
+Napi::Object ToColumns(Napi::Env env, generation::FormSections&& sections) {
+  Napi::Array sectionIds = Napi::Array::New(env, sections.size());
+  for (size_t i = 0; i < sections.size(); ++i) {
+    sectionIds.Set(static_cast<uint32_t>(i), Napi::String::New(env, sections.sectionId[i]));
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("sectionId", sectionIds);
+  result.Set("startTime", MakeTypedColumn<Napi::Float64Array>(env, std::move(sections.startTime)));
+  result.Set("duration", MakeTypedColumn<Napi::Float64Array>(env, std::move(sections.duration)));
+  return result;
+}
+
+/**
+ * Minimal JSON array-of-objects writer for the synchronous string API.
+ * Numbers use 17 significant digits, so JSON.parse recovers the exact doubles.
+ */
+class JSONArrayWriter {
+public:
+  explicit JSONArrayWriter(size_t expectedItems) { out_.reserve(2 + expectedItems * 48); out_ += '['; }
+
+  void BeginObject() { out_ += out_.size() > 1 ? ",{" : "{"; firstField_ = true; }
+  void EndObject() { out_ += '}'; }
+
+  void Field(const char* key, double value) {
+    Key(key);
+    if (!std::isfinite(value)) {
+      out_ += "null";
+      return;
+    }
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    out_ += buffer;
+  }
+
+  void Field(const char* key, const int32_t* values, size_t count) {
+    Key(key);
+    out_ += '[';
+    for (size_t i = 0; i < count; ++i) {
+      if (i > 0) out_ += ',';
+      out_ += std::to_string(values[i]);
+    }
+    out_ += ']';
+  }
+
+  void Field(const char* key, const std::string& value) {
+    Key(key);
+    out_ += '"';
+    for (char c : value) {
+      switch (c) {
+        case '"': out_ += "\\\""; break;
+        case '\\': out_ += "\\\\"; break;
+        case '\n': out_ += "\\n"; break;
+        case '\r': out_ += "\\r"; break;
+        case '\t': out_ += "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out_ += escaped;
+          } else {
+            out_ += c;
+          }
+      }
+    }
+    out_ += '"';
+  }
+
+  Napi::String Finish(Napi::Env env) { out_ += ']'; return Napi::String::New(env, out_); }
+
+private:
+  void Key(const char* key) {
+    if (!firstField_) out_ += ',';
+    firstField_ = false;
+    out_ += '"';
+    out_ += key;
+    out_ += "\":";
+  }
+
+  std::string out_;
+  bool firstField_ = true;
+};
+
+/**
+ * Base for the Promise-returning generators: inputs are parsed on the main
+ * thread, Execute() runs the generation core on the libuv pool, and OnOK()
+ * resolves with typed-array columns
+ */
+class GenerationWorker : public Napi::AsyncWorker {
+public:
+  explicit GenerationWorker(Napi::Env env)
+    : Napi::AsyncWorker(env, "WhiteRoomGeneration"), deferred_(Napi::Promise::Deferred::New(env)) {}
+
+  Napi::Promise GetPromise() const { return deferred_.Promise(); }
+
+protected:
+  void OnError(const Napi::Error& error) override {
+    deferred_.Reject(error.Value());
+  }
+
+  void Fail(const std::string& message) { SetError(message); }
+
+  Napi::Promise::Deferred deferred_;
+};
+
 // =============================================================================
 // RHYTHM GENERATION (Book I Integration)
 // =============================================================================
@@ -154,6 +536,9 @@ Napi::Value DeserializeJSON(const Napi::CallbackInfo& info) {
  * - Takes rhythm system configuration (generators, resultants, etc.)
  * - Returns array of attack points (time, accent level)
  *
+ * Attacks are exact: generator g attacks at every t >= 0 where
+ * (t + phase) is a multiple of period; coincident attacks sum their weights.
+ *
  * @param rhythmSystemJSON - JSON string with RhythmSystem configuration
  * @param duration - Duration in beats to generate
  * @param measureLength - Length of one measure in beats (default 4)
@@ -178,109 +563,78 @@ Napi::Value GenerateRhythmAttacks(const Napi::CallbackInfo& info) {
     return env.Undefined();
   }
 
-  // Parse rhythm system JSON
-  Napi::Object global = env.Global();
-  Napi::Object json = global.Get("JSON").As<Napi::Object>();
-  Napi::Function parse = json.Get("parse").As<Napi::Function>();
-  Napi::Value rhythmSystemValue = parse.Call(json, { info[0] });
-
-  if (!rhythmSystemValue.IsObject()) {
-    Napi::TypeError::New(env, "Invalid rhythm system JSON").ThrowAsJavaScriptException();
+  Napi::Object rhythmSystem;
+  std::vector<generation::RhythmGenerator> generators;
+  if (!ReadConfigObject(env, info[0], "rhythm system JSON", rhythmSystem) ||
+      !ParseRhythmSystem(env, rhythmSystem, generators)) {
     return env.Undefined();
   }
 
-  Napi::Object rhythmSystem = rhythmSystemValue.As<Napi::Object>();
-
-  // Extract parameters
-  double duration = info[1].As<Napi::Number>().DoubleValue();
-  // double measureLength = 4.0;  // Default 4/4 time (unused in current implementation)
-
-  // if (info.Length() >= 3 && info[2].IsNumber()) {
-  //   measureLength = info[2].As<Napi::Number>().DoubleValue();
-  // }
-
-  // Suppress unused variable warning
-  (void)duration;  // Will be used in future enhancements
-
-  // Extract generators
-  Napi::Value generatorsValue = rhythmSystem.Get("generators");
-  if (!generatorsValue.IsArray()) {
-    Napi::TypeError::New(env, "Rhythm system must have generators array").ThrowAsJavaScriptException();
+  generation::RhythmAttacks attacks;
+  std::string error;
+  if (!generation::generateRhythmAttacks(generators, info[1].As<Napi::Number>().DoubleValue(), attacks, error)) {
+    Napi::RangeError::New(env, error).ThrowAsJavaScriptException();
     return env.Undefined();
   }
 
-  Napi::Array generatorsArray = generatorsValue.As<Napi::Array>();
-
-  // Validate: need at least 1 generator (for simple rhythms)
-  if (generatorsArray.Length() < 1) {
-    Napi::TypeError::New(env, "Rhythm system requires at least 1 generator").ThrowAsJavaScriptException();
-    return env.Undefined();
+  JSONArrayWriter writer(attacks.size());
+  for (size_t i = 0; i < attacks.size(); ++i) {
+    writer.BeginObject();
+    writer.Field("time", attacks.time[i]);
+    writer.Field("accent", attacks.accent[i]);
+    writer.EndObject();
   }
+  return writer.Finish(env);
+}
 
-  // Parse generators
-  struct Generator {
-    double period;
-    double phase;
-    double weight;
-  };
-  std::vector<Generator> generators;
+class RhythmWorker : public GenerationWorker {
+public:
+  RhythmWorker(Napi::Env env, std::vector<generation::RhythmGenerator>&& generators, double duration)
+    : GenerationWorker(env), generators_(std::move(generators)), duration_(duration) {}
 
-  for (uint32_t i = 0; i < generatorsArray.Length(); ++i) {
-    Napi::Value genValue = generatorsArray.Get(i);
-    if (!genValue.IsObject()) {
-      Napi::TypeError::New(env, "Each generator must be an object").ThrowAsJavaScriptException();
-      return env.Undefined();
+  void Execute() override {
+    std::string error;
+    if (!generation::generateRhythmAttacks(generators_, duration_, attacks_, error)) {
+      Fail(error);
     }
-
-    Napi::Object genObj = genValue.As<Napi::Object>();
-
-    Generator gen;
-    gen.period = genObj.Get("period").As<Napi::Number>().DoubleValue();
-    gen.phase = genObj.Get("phase").As<Napi::Number>().DoubleValue();
-    gen.weight = genObj.Has("weight") ? genObj.Get("weight").As<Napi::Number>().DoubleValue() : 1.0;
-
-    generators.push_back(gen);
   }
 
-  // Generate attacks using interference pattern
-  std::vector<std::pair<double, double>> attacks;  // (time, accent)
-
-  for (double t = 0; t < duration; t += 0.0625) {  // 1/16 note resolution
-    double totalAccent = 0.0;
-
-    // Check each generator for attack at this time
-    for (const auto& gen : generators) {
-      // Calculate phase-adjusted time
-      double adjustedTime = t + gen.phase;
+  void OnOK() override {
+    deferred_.Resolve(ToColumns(Env(), std::move(attacks_)));
+  }
 
-      // Check if this is an attack point (periodic pulse)
-      double phasePosition = fmod(adjustedTime, gen.period);
+private:
+  std::vector<generation::RhythmGenerator> generators_;
+  double duration_;
+  generation::RhythmAttacks attacks_;
+};
 
-      // Attack occurs at phase = 0 (within small epsilon)
-      if (phasePosition < 0.03125 || phasePosition > gen.period - 0.03125) {
-        totalAccent += gen.weight;
-      }
-    }
+/**
+ * Asynchronous, columnar variant of generateRhythmAttacks
+ *
+ * @param rhythmSystem - RhythmSystem object (or JSON string)
+ * @param duration - Duration in beats to generate
+ * @returns Promise<{ time: Float64Array, accent: Float64Array }>
+ */
+Napi::Value GenerateRhythmAttacksAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-    // If total accent > 0, we have an attack
-    if (totalAccent > 0.0) {
-      attacks.push_back({t, totalAccent});
-    }
+  if (info.Length() < 2 || !info[1].IsNumber()) {
+    Napi::TypeError::New(env, "Expected (rhythmSystem, duration: number)").ThrowAsJavaScriptException();
+    return env.Undefined();
   }
 
-  // Build result array
-  Napi::Array result = Napi::Array::New(env, attacks.size());
-
-  for (size_t i = 0; i < attacks.size(); ++i) {
-    Napi::Object attack = Napi::Object::New(env);
-    attack.Set("time", Napi::Number::New(env, attacks[i].first));
-    attack.Set("accent", Napi::Number::New(env, attacks[i].second));
-    result.Set(i, attack);
+  Napi::Object rhythmSystem;
+  std::vector<generation::RhythmGenerator> generators;
+  if (!ReadConfigObject(env, info[0], "rhythm system", rhythmSystem) ||
+      !ParseRhythmSystem(env, rhythmSystem, generators)) {
+    return env.Undefined();
   }
 
-  // Return as JSON string for consistency
-  Napi::Function stringify = json.Get("stringify").As<Napi::Function>();
-  return stringify.Call(json, { result });
+  auto* worker = new RhythmWorker(env, std::move(generators), info[1].As<Napi::Number>().DoubleValue());
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
 }
 
 // =============================================================================
@@ -325,177 +679,96 @@ Napi::Value GenerateMelody(const Napi::CallbackInfo& info) {
     return env.Undefined();
   }
 
-  // Parse melody system JSON
-  Napi::Object global = env.Global();
-  Napi::Object json = global.Get("JSON").As<Napi::Object>();
-  Napi::Function parse = json.Get("parse").As<Napi::Function>();
-  Napi::Value melodySystemValue = parse.Call(json, { info[0] });
-
-  if (!melodySystemValue.IsObject()) {
-    Napi::TypeError::New(env, "Invalid melody system JSON").ThrowAsJavaScriptException();
+  Napi::Object melodySystem;
+  generation::MelodySystem system;
+  std::vector<double> attackTimes;
+  if (!ReadConfigObject(env, info[0], "melody system JSON", melodySystem) ||
+      !ParseMelodySystem(env, melodySystem, system) ||
+      !ReadAttackTimes(env, info[1], attackTimes)) {
     return env.Undefined();
   }
 
-  Napi::Object melodySystem = melodySystemValue.As<Napi::Object>();
+  const int rootPitch = info.Length() >= 4 && info[3].IsNumber() ? info[3].As<Napi::Number>().Int32Value() : 60;
 
-  // Parse rhythm attacks JSON
-  Napi::Value rhythmAttacksValue = parse.Call(json, { info[1] });
-  if (!rhythmAttacksValue.IsArray()) {
-    Napi::TypeError::New(env, "Invalid rhythm attacks JSON").ThrowAsJavaScriptException();
+  generation::PitchEvents events;
+  std::string error;
+  if (!generation::generateMelody(system, attackTimes, info[2].As<Napi::Number>().DoubleValue(), rootPitch, events, error)) {
+    Napi::TypeError::New(env, error).ThrowAsJavaScriptException();
     return env.Undefined();
   }
 
-  Napi::Array rhythmAttacksArray = rhythmAttacksValue.As<Napi::Array>();
-
-  // Extract parameters
-  double duration = info[2].As<Napi::Number>().DoubleValue();
-  int rootPitch = 60;  // Default C4
-
-  if (info.Length() >= 4 && info[3].IsNumber()) {
-    rootPitch = info[3].As<Napi::Number>().Int32Value();
+  JSONArrayWriter writer(events.size());
+  for (size_t i = 0; i < events.size(); ++i) {
+    writer.BeginObject();
+    writer.Field("time", events.time[i]);
+    writer.Field("pitch", events.pitch[i]);
+    writer.Field("velocity", events.velocity[i]);
+    writer.Field("duration", events.duration[i]);
+    writer.EndObject();
   }
+  return writer.Finish(env);
+}
 
-  // Extract melody system properties
-  int cycleLength = melodySystem.Get("cycleLength").As<Napi::Number>().Int32Value();
-
-  Napi::Value intervalSeedValue = melodySystem.Get("intervalSeed");
-  if (!intervalSeedValue.IsArray()) {
-    Napi::TypeError::New(env, "Melody system must have intervalSeed array").ThrowAsJavaScriptException();
-    return env.Undefined();
-  }
-
-  Napi::Array intervalSeedArray = intervalSeedValue.As<Napi::Array>();
-  std::vector<int> intervalSeed;
-
-  for (uint32_t i = 0; i < intervalSeedArray.Length(); ++i) {
-    intervalSeed.push_back(intervalSeedArray.Get(i).As<Napi::Number>().Int32Value());
-  }
-
-  // Extract contour constraints
-  Napi::Value contourValue = melodySystem.Get("contourConstraints");
-  std::string contourType = "oscillating";
-  int maxIntervalLeaps = 12;
-
-  if (contourValue.IsObject()) {
-    Napi::Object contourObj = contourValue.As<Napi::Object>();
-    if (contourObj.Has("type")) {
-      contourType = contourObj.Get("type").As<Napi::String>().Utf8Value();
-    }
-    if (contourObj.Has("maxIntervalLeaps")) {
-      maxIntervalLeaps = contourObj.Get("maxIntervalLeaps").As<Napi::Number>().Int32Value();
+class MelodyWorker : public GenerationWorker {
+public:
+  MelodyWorker(Napi::Env env, generation::MelodySystem&& system, std::vector<double>&& attackTimes,
+               double duration, int rootPitch)
+    : GenerationWorker(env), system_(std::move(system)), attackTimes_(std::move(attackTimes)),
+      duration_(duration), rootPitch_(rootPitch) {}
+
+  void Execute() override {
+    std::string error;
+    if (!generation::generateMelody(system_, attackTimes_, duration_, rootPitch_, events_, error)) {
+      Fail(error);
     }
   }
 
-  // Extract register constraints
-  int minPitch = 48;
-  int maxPitch = 84;
-  bool allowTransposition = true;
-
-  Napi::Value registerValue = melodySystem.Get("registerConstraints");
-  if (registerValue.IsObject()) {
-    Napi::Object registerObj = registerValue.As<Napi::Object>();
-    if (registerObj.Has("minPitch")) {
-      minPitch = registerObj.Get("minPitch").As<Napi::Number>().Int32Value();
-    }
-    if (registerObj.Has("maxPitch")) {
-      maxPitch = registerObj.Get("maxPitch").As<Napi::Number>().Int32Value();
-    }
-    if (registerObj.Has("allowTransposition")) {
-      allowTransposition = registerObj.Get("allowTransposition").As<Napi::Boolean>().Value();
-    }
+  void OnOK() override {
+    deferred_.Resolve(ToColumns(Env(), std::move(events_)));
   }
 
-  // Generate melody from rhythm attacks
-  struct PitchEvent {
-    double time;
-    int pitch;
-    int velocity;
-    double duration;
-  };
-
-  std::vector<PitchEvent> pitchEvents;
-  int currentPitch = rootPitch;
-  int previousPitch = rootPitch;
-
-  for (uint32_t i = 0; i < rhythmAttacksArray.Length(); ++i) {
-    Napi::Value attackValue = rhythmAttacksArray.Get(i);
-    if (!attackValue.IsObject()) continue;
-
-    Napi::Object attackObj = attackValue.As<Napi::Object>();
-    double time = attackObj.Get("time").As<Napi::Number>().DoubleValue();
-
-    if (time >= duration) break;
-
-    // Calculate pitch using interval cycle
-    if (i > 0) {
-      int intervalIndex = (static_cast<int>(i) - 1) % cycleLength;
-      int interval = intervalSeed[intervalIndex];
-      currentPitch += interval;
-    }
-
-    // Apply contour constraints
-    int constrainedPitch = currentPitch;
-
-    if (contourType == "ascending" && i > 0) {
-      if (constrainedPitch <= previousPitch) {
-        constrainedPitch = previousPitch + 1;
-      }
-    } else if (contourType == "descending" && i > 0) {
-      if (constrainedPitch >= previousPitch) {
-        constrainedPitch = previousPitch - 1;
-      }
-    }
-
-    // Apply max interval leaps
-    if (i > 0) {
-      int interval = constrainedPitch - previousPitch;
-      if (abs(interval) > maxIntervalLeaps) {
-        constrainedPitch = previousPitch + (interval > 0 ? maxIntervalLeaps : -maxIntervalLeaps);
-      }
-    }
-
-    // Apply register constraints
-    if (allowTransposition) {
-      while (constrainedPitch < minPitch) constrainedPitch += 12;
-      while (constrainedPitch > maxPitch) constrainedPitch -= 12;
-    } else {
-      constrainedPitch = std::max(minPitch, std::min(maxPitch, constrainedPitch));
-    }
-
-    // Ensure MIDI range
-    constrainedPitch = std::max(0, std::min(127, constrainedPitch));
-
-    // Calculate velocity based on contour
-    int interval = constrainedPitch - previousPitch;
-    int velocity = 80 + (interval * 2);
-    velocity = std::max(0, std::min(127, velocity));
-
-    // Calculate duration
-    double nextTime = (i < rhythmAttacksArray.Length() - 1)
-      ? rhythmAttacksArray.Get(i + 1).As<Napi::Object>().Get("time").As<Napi::Number>().DoubleValue()
-      : duration;
-    double noteDuration = std::max(0.25, nextTime - time);
+private:
+  generation::MelodySystem system_;
+  std::vector<double> attackTimes_;
+  double duration_;
+  int rootPitch_;
+  generation::PitchEvents events_;
+};
 
-    pitchEvents.push_back({time, constrainedPitch, velocity, noteDuration});
+/**
+ * Asynchronous, columnar variant of generateMelody
+ *
+ * @param melodySystem - MelodySystem object (or JSON string)
+ * @param rhythmAttacks - Attack columns from generateRhythmAttacksAsync, a
+ *                        Float64Array of times, or an array of {time}
+ * @param duration - Duration in beats to generate
+ * @param rootPitch - Root MIDI note number (default 60)
+ * @returns Promise<{ time: Float64Array, pitch: Int32Array, velocity: Int32Array, duration: Float64Array }>
+ */
+Napi::Value GenerateMelodyAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-    previousPitch = constrainedPitch;
+  if (info.Length() < 3 || !info[2].IsNumber()) {
+    Napi::TypeError::New(env, "Expected (melodySystem, rhythmAttacks, duration: number, rootPitch?: number)").ThrowAsJavaScriptException();
+    return env.Undefined();
   }
 
-  // Build result array
-  Napi::Array result = Napi::Array::New(env, pitchEvents.size());
-
-  for (size_t i = 0; i < pitchEvents.size(); ++i) {
-    Napi::Object event = Napi::Object::New(env);
-    event.Set("time", Napi::Number::New(env, pitchEvents[i].time));
-    event.Set("pitch", Napi::Number::New(env, pitchEvents[i].pitch));
-    event.Set("velocity", Napi::Number::New(env, pitchEvents[i].velocity));
-    event.Set("duration", Napi::Number::New(env, pitchEvents[i].duration));
-    result.Set(i, event);
+  Napi::Object melodySystem;
+  generation::MelodySystem system;
+  std::vector<double> attackTimes;
+  if (!ReadConfigObject(env, info[0], "melody system", melodySystem) ||
+      !ParseMelodySystem(env, melodySystem, system) ||
+      !ReadAttackTimes(env, info[1], attackTimes)) {
+    return env.Undefined();
   }
 
-  // Return as JSON string
-  Napi::Function stringify = json.Get("stringify").As<Napi::Function>();
-  return stringify.Call(json, { result });
+  const int rootPitch = info.Length() >= 4 && info[3].IsNumber() ? info[3].As<Napi::Number>().Int32Value() : 60;
+
+  auto* worker = new MelodyWorker(env, std::move(system), std::move(attackTimes),
+                                  info[2].As<Napi::Number>().DoubleValue(), rootPitch);
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
 }
 
 // =============================================================================
@@ -540,121 +813,99 @@ Napi::Value GenerateHarmony(const Napi::CallbackInfo& info) {
     return env.Undefined();
   }
 
-  // Parse harmony system JSON
-  Napi::Object global = env.Global();
-  Napi::Object json = global.Get("JSON").As<Napi::Object>();
-  Napi::Function parse = json.Get("parse").As<Napi::Function>();
-  Napi::Value harmonySystemValue = parse.Call(json, { info[0] });
-
-  if (!harmonySystemValue.IsObject()) {
-    Napi::TypeError::New(env, "Invalid harmony system JSON").ThrowAsJavaScriptException();
+  Napi::Object harmonySystem;
+  generation::HarmonySystem system;
+  std::vector<double> attackTimes;
+  if (!ReadConfigObject(env, info[0], "harmony system JSON", harmonySystem) ||
+      !ParseHarmonySystem(env, harmonySystem, system) ||
+      !ReadAttackTimes(env, info[1], attackTimes)) {
     return env.Undefined();
   }
 
-  Napi::Object harmonySystem = harmonySystemValue.As<Napi::Object>();
+  const int rootPitch = info.Length() >= 4 && info[3].IsNumber() ? info[3].As<Napi::Number>().Int32Value() : 60;
 
-  // Parse rhythm attacks JSON
-  Napi::Value rhythmAttacksValue = parse.Call(json, { info[1] });
-  if (!rhythmAttacksValue.IsArray()) {
-    Napi::TypeError::New(env, "Invalid rhythm attacks JSON").ThrowAsJavaScriptException();
+  generation::ChordEvents events;
+  std::string error;
+  if (!generation::generateHarmony(system, attackTimes, info[2].As<Napi::Number>().DoubleValue(), rootPitch, events, error)) {
+    Napi::TypeError::New(env, error).ThrowAsJavaScriptException();
     return env.Undefined();
   }
 
-  Napi::Array rhythmAttacksArray = rhythmAttacksValue.As<Napi::Array>();
-
-  // Extract parameters
-  double duration = info[2].As<Napi::Number>().DoubleValue();
-  int rootPitch = 60;  // Default C4
-
-  if (info.Length() >= 4 && info[3].IsNumber()) {
-    rootPitch = info[3].As<Napi::Number>().Int32Value();
+  JSONArrayWriter writer(events.size());
+  for (size_t i = 0; i < events.size(); ++i) {
+    const int32_t first = events.intervalOffsets[i];
+    writer.BeginObject();
+    writer.Field("time", events.time[i]);
+    writer.Field("root", events.root[i]);
+    writer.Field("intervals", events.intervals.data() + first,
+                 static_cast<size_t>(events.intervalOffsets[i + 1] - first));
+    writer.Field("weight", events.weight[i]);
+    writer.EndObject();
   }
+  return writer.Finish(env);
+}
 
-  // Extract distribution
-  Napi::Value distributionValue = harmonySystem.Get("distribution");
-  if (!distributionValue.IsArray()) {
-    Napi::TypeError::New(env, "Harmony system must have distribution array").ThrowAsJavaScriptException();
-    return env.Undefined();
+class HarmonyWorker : public GenerationWorker {
+public:
+  HarmonyWorker(Napi::Env env, generation::HarmonySystem&& system, std::vector<double>&& attackTimes,
+                double duration, int rootPitch)
+    : GenerationWorker(env), system_(std::move(system)), attackTimes_(std::move(attackTimes)),
+      duration_(duration), rootPitch_(rootPitch) {}
+
+  void Execute() override {
+    std::string error;
+    if (!generation::generateHarmony(system_, attackTimes_, duration_, rootPitch_, events_, error)) {
+      Fail(error);
+    }
   }
 
-  Napi::Array distributionArray = distributionValue.As<Napi::Array>();
-  std::vector<double> distribution;
-
-  for (uint32_t i = 0; i < distributionArray.Length(); ++i) {
-    distribution.push_back(distributionArray.Get(i).As<Napi::Number>().DoubleValue());
+  void OnOK() override {
+    deferred_.Resolve(ToColumns(Env(), std::move(events_)));
   }
 
-  // Generate harmony from rhythm attacks
-  struct ChordEvent {
-    double time;
-    int root;
-    std::vector<int> intervals;
-    double weight;
-  };
-
-  std::vector<ChordEvent> chordEvents;
-  int currentRoot = rootPitch;
-
-  for (uint32_t i = 0; i < rhythmAttacksArray.Length(); ++i) {
-    Napi::Value attackValue = rhythmAttacksArray.Get(i);
-    if (!attackValue.IsObject()) continue;
-
-    Napi::Object attackObj = attackValue.As<Napi::Object>();
-    double time = attackObj.Get("time").As<Napi::Number>().DoubleValue();
-
-    if (time >= duration) break;
-
-    // Generate chord intervals from distribution
-    std::vector<int> intervals;
-
-    // Select intervals based on distribution weights
-    int numVoices = 3 + (i % 3);  // 3-5 voices
-    for (int j = 0; j < numVoices; ++j) {
-      int intervalIndex = (static_cast<int>(i) + j) % 12;
-      if (distribution[intervalIndex] > 0.1) {
-        intervals.push_back(intervalIndex + 1);  // 1-based intervals
-      }
-    }
-
-    // Remove duplicates and sort
-    std::sort(intervals.begin(), intervals.end());
-    intervals.erase(std::unique(intervals.begin(), intervals.end()), intervals.end());
-
-    // Ensure at least a triad
-    if (intervals.size() < 3) {
-      intervals = {3, 5, 7};  // Major triad
-    }
-
-    // Calculate weight (first and last chords are more important)
-    double weight = (i == 0 || i == rhythmAttacksArray.Length() - 1) ? 1.0 : 0.7;
+private:
+  generation::HarmonySystem system_;
+  std::vector<double> attackTimes_;
+  double duration_;
+  int rootPitch_;
+  generation::ChordEvents events_;
+};
 
-    chordEvents.push_back({time, currentRoot, intervals, weight});
+/**
+ * Asynchronous, columnar variant of generateHarmony
+ *
+ * Chord i's intervals are intervals.subarray(intervalOffsets[i], intervalOffsets[i + 1]).
+ *
+ * @param harmonySystem - HarmonySystem object (or JSON string)
+ * @param rhythmAttacks - Attack columns, a Float64Array of times, or an array of {time}
+ * @param duration - Duration in beats to generate
+ * @param rootPitch - Root MIDI note number (default 60)
+ * @returns Promise<{ time, root, weight, intervalOffsets, intervals }> typed-array columns
+ */
+Napi::Value GenerateHarmonyAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-    // Transition root (simple stepwise motion)
-    int step = (i % 4 < 2) ? 2 : -2;  // Mix of ascending and descending
-    currentRoot += step;
+  if (info.Length() < 3 || !info[2].IsNumber()) {
+    Napi::TypeError::New(env, "Expected (harmonySystem, rhythmAttacks, duration: number, rootPitch?: number)").ThrowAsJavaScriptException();
+    return env.Undefined();
   }
 
-  // Build result array
-  Napi::Array result = Napi::Array::New(env, chordEvents.size());
-
-  for (size_t i = 0; i < chordEvents.size(); ++i) {
-    Napi::Object event = Napi::Object::New(env);
-    event.Set("time", Napi::Number::New(env, chordEvents[i].time));
-    event.Set("root", Napi::Number::New(env, chordEvents[i].root));
-
-    Napi::Array intervalsArray = Napi::Array::New(env, chordEvents[i].intervals.size());
-    for (size_t j = 0; j < chordEvents[i].intervals.size(); ++j) {
-      intervalsArray.Set(j, Napi::Number::New(env, chordEvents[i].intervals[j]));
-    }
-    event.Set("intervals", intervalsArray);
-    event.Set("weight", Napi::Number::New(env, chordEvents[i].weight));
-    result.Set(i, event);
+  Napi::Object harmonySystem;
+  generation::HarmonySystem system;
+  std::vector<double> attackTimes;
+  if (!ReadConfigObject(env, info[0], "harmony system", harmonySystem) ||
+      !ParseHarmonySystem(env, harmonySystem, system) ||
+      !ReadAttackTimes(env, info[1], attackTimes)) {
+    return env.Undefined();
   }
 
-  // Return as JSON string
-  Napi::Function stringify = json.Get("stringify").As<Napi::Function>();
-  return stringify.Call(json, { result });
+  const int rootPitch = info.Length() >= 4 && info[3].IsNumber() ? info[3].As<Napi::Number>().Int32Value() : 60;
+
+  auto* worker = new HarmonyWorker(env, std::move(system), std::move(attackTimes),
+                                   info[2].As<Napi::Number>().DoubleValue(), rootPitch);
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
 }
 
 // =============================================================================
@@ -691,114 +942,79 @@ Napi::Value GenerateForm(const Napi::CallbackInfo& info) {
     return env.Undefined();
   }
 
-  // Parse form system JSON
-  Napi::Object global = env.Global();
-  Napi::Object json = global.Get("JSON").As<Napi::Object>();
-  Napi::Function parse = json.Get("parse").As<Napi::Function>();
-  Napi::Value formSystemValue = parse.Call(json, { info[0] });
-
-  if (!formSystemValue.IsObject()) {
-    Napi::TypeError::New(env, "Invalid form system JSON").ThrowAsJavaScriptException();
+  Napi::Object formSystem;
+  generation::FormSystem system;
+  if (!ReadConfigObject(env, info[0], "form system JSON", formSystem) ||
+      !ParseFormSystem(env, formSystem, system)) {
     return env.Undefined();
   }
 
-  Napi::Object formSystem = formSystemValue.As<Napi::Object>();
-
-  // Extract parameters
-  double totalDuration = info[1].As<Napi::Number>().DoubleValue();
-
-  // Extract ratio tree
-  Napi::Value ratioTreeValue = formSystem.Get("ratioTree");
-  if (!ratioTreeValue.IsObject()) {
-    Napi::TypeError::New(env, "Form system must have ratioTree object").ThrowAsJavaScriptException();
+  generation::FormSections sections;
+  std::string error;
+  if (!generation::generateForm(system, info[1].As<Napi::Number>().DoubleValue(), sections, error)) {
+    Napi::TypeError::New(env, error).ThrowAsJavaScriptException();
     return env.Undefined();
   }
 
-  Napi::Object ratioTree = ratioTreeValue.As<Napi::Object>();
+  JSONArrayWriter writer(sections.size());
+  for (size_t i = 0; i < sections.size(); ++i) {
+    writer.BeginObject();
+    writer.Field("sectionId", sections.sectionId[i]);
+    writer.Field("startTime", sections.startTime[i]);
+    writer.Field("duration", sections.duration[i]);
+    writer.EndObject();
+  }
+  return writer.Finish(env);
+}
 
-  // Extract section definitions (optional)
-  std::vector<std::string> sectionIds;
-  Napi::Value sectionsValue = formSystem.Get("sectionDefinitions");
+class FormWorker : public GenerationWorker {
+public:
+  FormWorker(Napi::Env env, generation::FormSystem&& system, double totalDuration)
+    : GenerationWorker(env), system_(std::move(system)), totalDuration_(totalDuration) {}
 
-  if (sectionsValue.IsArray()) {
-    Napi::Array sectionsArray = sectionsValue.As<Napi::Array>();
-    for (uint32_t i = 0; i < sectionsArray.Length(); ++i) {
-      Napi::Value sectionValue = sectionsArray.Get(i);
-      if (sectionValue.IsObject()) {
-        Napi::Object sectionObj = sectionValue.As<Napi::Object>();
-        Napi::Value sectionIdValue = sectionObj.Get("sectionId");
-        if (sectionIdValue.IsString()) {
-          sectionIds.push_back(sectionIdValue.As<Napi::String>().Utf8Value());
-        }
-      }
+  void Execute() override {
+    std::string error;
+    if (!generation::generateForm(system_, totalDuration_, sections_, error)) {
+      Fail(error);
     }
   }
 
-  // Extract nesting depth
-  int nestingDepth = 3;
-  if (formSystem.Has("nestingDepth")) {
-    nestingDepth = formSystem.Get("nestingDepth").As<Napi::Number>().Int32Value();
+  void OnOK() override {
+    deferred_.Resolve(ToColumns(Env(), std::move(sections_)));
   }
 
-  // Flatten ratio tree into sections
-  struct FormSection {
-    std::string sectionId;
-    double startTime;
-    double duration;
-  };
-
-  std::vector<FormSection> formSections;
-
-  // Helper function to flatten tree
-  std::function<void(Napi::Object, double, double, int)> flattenTree =
-    [&](Napi::Object node, double offset, double remainingDuration, int level) {
-      // Check if leaf node or exceeded max depth
-      Napi::Value childrenValue = node.Get("children");
-      bool hasChildren = childrenValue.IsArray() && childrenValue.As<Napi::Array>().Length() > 0;
-
-      if (!hasChildren || level > nestingDepth) {
-        // Leaf node - create section
-        std::string sectionId = node.Get("nodeId").As<Napi::String>().Utf8Value();
-        formSections.push_back({sectionId, offset, remainingDuration});
-        return;
-      }
-
-      // Distribute duration among children based on ratios
-      Napi::Array childrenArray = childrenValue.As<Napi::Array>();
-      double totalRatio = 0.0;
-
-      for (uint32_t i = 0; i < childrenArray.Length(); ++i) {
-        Napi::Object child = childrenArray.Get(i).As<Napi::Object>();
-        totalRatio += child.Get("ratio").As<Napi::Number>().DoubleValue();
-      }
-
-      double currentOffset = offset;
-      for (uint32_t i = 0; i < childrenArray.Length(); ++i) {
-        Napi::Object child = childrenArray.Get(i).As<Napi::Object>();
-        double ratio = child.Get("ratio").As<Napi::Number>().DoubleValue();
-        double childDuration = (ratio / totalRatio) * remainingDuration;
-        flattenTree(child, currentOffset, childDuration, level + 1);
-        currentOffset += childDuration;
-      }
-    };
+private:
+  generation::FormSystem system_;
+  double totalDuration_;
+  generation::FormSections sections_;
+};
 
-  // Start flattening from root
-  flattenTree(ratioTree, 0.0, totalDuration, 1);
+/**
+ * Asynchronous, columnar variant of generateForm
+ *
+ * @param formSystem - FormSystem object (or JSON string)
+ * @param totalDuration - Total duration in beats
+ * @returns Promise<{ sectionId: string[], startTime: Float64Array, duration: Float64Array }>
+ */
+Napi::Value GenerateFormAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-  // Build result array
-  Napi::Array result = Napi::Array::New(env, formSections.size());
+  if (info.Length() < 2 || !info[1].IsNumber()) {
+    Napi::TypeError::New(env, "Expected (formSystem, totalDuration: number)").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
 
-  for (size_t i = 0; i < formSections.size(); ++i) {
-    Napi::Object section = Napi::Object::New(env);
-    section.Set("sectionId", Napi::String::New(env, formSections[i].sectionId));
-    section.Set("startTime", Napi::Number::New(env, formSections[i].startTime));
-    section.Set("duration", Napi::Number::New(env, formSections[i].duration));
-    result.Set(i, section);
+  Napi::Object formSystem;
+  generation::FormSystem system;
+  if (!ReadConfigObject(env, info[0], "form system", formSystem) ||
+      !ParseFormSystem(env, formSystem, system)) {
+    return env.Undefined();
   }
 
-  // Return as JSON string
-  Napi::Function stringify = json.Get("stringify").As<Napi::Function>();
-  return stringify.Call(json, { result });
+  auto* worker = new FormWorker(env, std::move(system), info[1].As<Napi::Number>().DoubleValue());
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
 }
 
 // =============================================================================
@@ -856,6 +1072,27 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     Napi::Function::New(env, GenerateForm)
   );
 
+  // Register Promise-returning, columnar generation functions
+  exports.Set(
+    Napi::String::New(env, "generateRhythmAttacksAsync"),
+    Napi::Function::New(env, GenerateRhythmAttacksAsync)
+  );
+
+  exports.Set(
+    Napi::String::New(env, "generateMelodyAsync"),
+    Napi::Function::New(env, GenerateMelodyAsync)
+  );
+
+  exports.Set(
+    Napi::String::New(env, "generateHarmonyAsync"),
+    Napi::Function::New(env, GenerateHarmonyAsync)
+  );
+
+  exports.Set(
+    Napi::String::New(env, "generateFormAsync"),
+    Napi::Function::New(env, GenerateFormAsync)
+  );
+
   return exports;
 }
 
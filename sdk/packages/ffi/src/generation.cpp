@@ -0,0 +1,314 @@
+/**
+ * White Room FFI - Schillinger Generation Core
+ *
+ * See generation.h. Pure C++; safe to call off the JavaScript thread.
+ */
+
+#include "generation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <queue>
+
+namespace generation {
+
+// =============================================================================
+// BOOK I - RHYTHM
+// =============================================================================
+
+bool generateRhythmAttacks(const std::vector<RhythmGenerator>& generators,
+                           double duration,
+                           RhythmAttacks& out,
+                           std::string& error) {
+  out.time.clear();
+  out.accent.clear();
+
+  if (!std::isfinite(duration)) {
+    error = "Duration must be a finite number";
+    return false;
+  }
+
+  // First attack of each generator: smallest t >= 0 with (t + phase) % period == 0
+  struct Cursor {
+    double first;
+    double period;
+    double weight;
+    uint64_t index;
+
+    double time() const { return first + static_cast<double>(index) * period; }
+  };
+
+  std::vector<Cursor> cursors;
+  cursors.reserve(generators.size());
+  double expectedEvents = 0.0;
+
+  for (const auto& gen : generators) {
+    if (!(gen.period > 0.0) || !std::isfinite(gen.period) || !std::isfinite(gen.phase)) {
+      error = "Generator period must be a positive number and phase must be finite";
+      return false;
+    }
+
+    double offset = std::fmod(gen.phase, gen.period);
+    if (offset < 0.0) offset += gen.period;
+    const double first = offset == 0.0 ? 0.0 : gen.period - offset;
+
+    if (first < duration) {
+      cursors.push_back({first, gen.period, gen.weight, 0});
+      expectedEvents += std::ceil((duration - first) / gen.period);
+    }
+  }
+
+  if (expectedEvents > static_cast<double>(kMaxEvents)) {
+    error = "Rhythm would produce more than " + std::to_string(kMaxEvents) + " attacks";
+    return false;
+  }
+
+  out.time.reserve(static_cast<size_t>(expectedEvents));
+  out.accent.reserve(static_cast<size_t>(expectedEvents));
+
+  // K-way merge: always advance the generator with the earliest next attack
+  auto later = [&cursors](size_t a, size_t b) { return cursors[a].time() > cursors[b].time(); };
+  std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heap(later);
+  for (size_t i = 0; i < cursors.size(); ++i) {
+    heap.push(i);
+  }
+
+  while (!heap.empty()) {
+    const size_t next = heap.top();
+    heap.pop();
+
+    Cursor& cursor = cursors[next];
+    const double t = cursor.time();
+
+    // Generators whose attacks coincide (up to rounding) share one accent
+    const double tolerance = 1e-9 * std::max(1.0, std::fabs(t));
+    if (!out.time.empty() && t - out.time.back() <= tolerance) {
+      out.accent.back() += cursor.weight;
+    } else {
+      out.time.push_back(t);
+      out.accent.push_back(cursor.weight);
+    }
+
+    ++cursor.index;
+    if (cursor.time() < duration) {
+      heap.push(next);
+    }
+  }
+
+  return true;
+}
+
+// =============================================================================
+// BOOK II - MELODY
+// =============================================================================
+
+bool generateMelody(const MelodySystem& system,
+                    const std::vector<double>& attackTimes,
+                    double duration,
+                    int rootPitch,
+                    PitchEvents& out,
+                    std::string& error) {
+  out = PitchEvents{};
+
+  if (system.cycleLength <= 0) {
+    error = "Melody system cycleLength must be positive";
+    return false;
+  }
+
+  if (system.intervalSeed.empty()) {
+    error = "Melody system intervalSeed must not be empty";
+    return false;
+  }
+
+  const bool ascending = system.contourType == "ascending";
+  const bool descending = system.contourType == "descending";
+  const size_t numAttacks = attackTimes.size();
+
+  int currentPitch = rootPitch;
+  int previousPitch = rootPitch;
+
+  for (size_t i = 0; i < numAttacks; ++i) {
+    const double time = attackTimes[i];
+    if (time >= duration) break;
+
+    // Calculate pitch using interval cycle
+    if (i > 0) {
+      const size_t intervalIndex = (i - 1) % static_cast<size_t>(system.cycleLength);
+      currentPitch += system.intervalSeed[intervalIndex % system.intervalSeed.size()];
+    }
+
+    // Apply contour constraints
+    int constrainedPitch = currentPitch;
+
+    if (ascending && i > 0 && constrainedPitch <= previousPitch) {
+      constrainedPitch = previousPitch + 1;
+    } else if (descending && i > 0 && constrainedPitch >= previousPitch) {
+      constrainedPitch = previousPitch - 1;
+    }
+
+    // Apply max interval leaps
+    if (i > 0) {
+      const int interval = constrainedPitch - previousPitch;
+      if (std::abs(interval) > system.maxIntervalLeaps) {
+        constrainedPitch = previousPitch + (interval > 0 ? system.maxIntervalLeaps : -system.maxIntervalLeaps);
+      }
+    }
+
+    // Apply register constraints
+    if (system.allowTransposition && system.maxPitch - system.minPitch >= 11) {
+      while (constrainedPitch < system.minPitch) constrainedPitch += 12;
+      while (constrainedPitch > system.maxPitch) constrainedPitch -= 12;
+    } else {
+      constrainedPitch = std::max(system.minPitch, std::min(system.maxPitch, constrainedPitch));
+    }
+
+    // Ensure MIDI range
+    constrainedPitch = std::max(0, std::min(127, constrainedPitch));
+
+    // Calculate velocity based on contour
+    const int velocity = std::max(0, std::min(127, 80 + (constrainedPitch - previousPitch) * 2));
+
+    // Calculate duration
+    const double nextTime = i + 1 < numAttacks ? attackTimes[i + 1] : duration;
+    const double noteDuration = std::max(0.25, nextTime - time);
+
+    out.time.push_back(time);
+    out.pitch.push_back(constrainedPitch);
+    out.velocity.push_back(velocity);
+    out.duration.push_back(noteDuration);
+
+    previousPitch = constrainedPitch;
+  }
+
+  return true;
+}
+
+// =============================================================================
+// BOOK III - HARMONY
+// =============================================================================
+
+bool generateHarmony(const HarmonySystem& system,
+                     const std::vector<double>& attackTimes,
+                     double duration,
+                     int rootPitch,
+                     ChordEvents& out,
+                     std::string& error) {
+  out = ChordEvents{};
+  (void)error;
+
+  auto weightOf = [&system](int intervalIndex) {
+    return static_cast<size_t>(intervalIndex) < system.distribution.size()
+      ? system.distribution[static_cast<size_t>(intervalIndex)]
+      : 0.0;
+  };
+
+  const size_t numAttacks = attackTimes.size();
+  int currentRoot = rootPitch;
+  int intervals[5];
+
+  for (size_t i = 0; i < numAttacks; ++i) {
+    const double time = attackTimes[i];
+    if (time >= duration) break;
+
+    // Select intervals based on distribution weights (3-5 voices). The
+    // window (i + j) % 12 never repeats an index, so scanning 0-11 and
+    // keeping the indices inside it yields them sorted and unique.
+    const int numVoices = 3 + static_cast<int>(i % 3);
+    const int windowStart = static_cast<int>(i % 12);
+    int numIntervals = 0;
+    for (int intervalIndex = 0; intervalIndex < 12; ++intervalIndex) {
+      const int offsetInWindow = (intervalIndex - windowStart + 12) % 12;
+      if (offsetInWindow < numVoices && weightOf(intervalIndex) > 0.1) {
+        intervals[numIntervals++] = intervalIndex + 1;  // 1-based intervals
+      }
+    }
+
+    // Ensure at least a triad
+    if (numIntervals < 3) {
+      intervals[0] = 3;  // Major triad
+      intervals[1] = 5;
+      intervals[2] = 7;
+      numIntervals = 3;
+    }
+
+    // Calculate weight (first and last chords are more important)
+    const double weight = (i == 0 || i == numAttacks - 1) ? 1.0 : 0.7;
+
+    out.time.push_back(time);
+    out.root.push_back(currentRoot);
+    out.weight.push_back(weight);
+    out.intervals.insert(out.intervals.end(), intervals, intervals + numIntervals);
+    out.intervalOffsets.push_back(static_cast<int32_t>(out.intervals.size()));
+
+    // Transition root (simple stepwise motion)
+    currentRoot += (i % 4 < 2) ? 2 : -2;  // Mix of ascending and descending
+  }
+
+  return true;
+}
+
+// =============================================================================
+// BOOK IV - FORM
+// =============================================================================
+
+namespace {
+
+bool flattenTree(const FormSystem& system,
+                 uint32_t nodeIndex,
+                 double offset,
+                 double remainingDuration,
+                 int level,
+                 FormSections& out,
+                 std::string& error) {
+  const RatioTreeNode& node = system.nodes[nodeIndex];
+
+  if (node.childCount == 0 || level > system.nestingDepth) {
+    // Leaf node - create section
+    out.sectionId.push_back(node.nodeId);
+    out.startTime.push_back(offset);
+    out.duration.push_back(remainingDuration);
+    return true;
+  }
+
+  // Distribute duration among children based on ratios
+  double totalRatio = 0.0;
+  for (uint32_t i = 0; i < node.childCount; ++i) {
+    totalRatio += system.nodes[node.firstChild + i].ratio;
+  }
+
+  if (!(totalRatio > 0.0)) {
+    error = "Ratio tree node '" + node.nodeId + "' has children whose ratios do not sum to a positive value";
+    return false;
+  }
+
+  double currentOffset = offset;
+  for (uint32_t i = 0; i < node.childCount; ++i) {
+    const uint32_t child = node.firstChild + i;
+    const double childDuration = (system.nodes[child].ratio / totalRatio) * remainingDuration;
+    if (!flattenTree(system, child, currentOffset, childDuration, level + 1, out, error)) {
+      return false;
+    }
+    currentOffset += childDuration;
+  }
+
+  return true;
+}
+
+} // namespace
+
+bool generateForm(const FormSystem& system,
+                  double totalDuration,
+                  FormSections& out,
+                  std::string& error) {
+  out = FormSections{};
+
+  if (system.nodes.empty()) {
+    error = "Form system must have a ratioTree";
+    return false;
+  }
+
+  return flattenTree(system, 0, 0.0, totalDuration, 1, out, error);
+}
+
+} // namespace generation
@@ -0,0 +1,154 @@
+/**
+ * White Room FFI - Schillinger Generation Core
+ *
+ * Plain C++ implementations of the Book I-IV generators behind the NAPI
+ * bindings. Nothing here touches JavaScript values, so the same code runs
+ * synchronously on the main thread and inside Napi::AsyncWorker::Execute.
+ *
+ * Results are columnar (one vector per field) so the bindings can hand each
+ * column to JavaScript as a typed array without building per-event objects.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace generation {
+
+// =============================================================================
+// LIMITS
+// =============================================================================
+
+// Upper bound on events per call, so a tiny period over a long duration
+// fails fast instead of exhausting memory
+constexpr size_t kMaxEvents = size_t(1) << 24;
+
+// =============================================================================
+// BOOK I - RHYTHM
+// =============================================================================
+
+struct RhythmGenerator {
+  double period = 1.0;
+  double phase = 0.0;
+  double weight = 1.0;
+};
+
+struct RhythmAttacks {
+  std::vector<double> time;
+  std::vector<double> accent;
+
+  size_t size() const { return time.size(); }
+};
+
+/**
+ * Interference of periodic generators, computed event-exactly
+ *
+ * Generator g attacks wherever (t + phase) is a multiple of period. Each
+ * generator's attacks are enumerated directly and k-way merged by time;
+ * coincident attacks (within a relative 1e-9) sum their weights into one
+ * accent. Cost is O(N log G) for N attacks and G generators, independent
+ * of any grid resolution.
+ *
+ * @returns false with `error` set on invalid input or too many events
+ */
+bool generateRhythmAttacks(const std::vector<RhythmGenerator>& generators,
+                           double duration,
+                           RhythmAttacks& out,
+                           std::string& error);
+
+// =============================================================================
+// BOOK II - MELODY
+// =============================================================================
+
+struct MelodySystem {
+  int cycleLength = 1;
+  std::vector<int> intervalSeed;
+  std::string contourType = "oscillating";
+  int maxIntervalLeaps = 12;
+  int minPitch = 48;
+  int maxPitch = 84;
+  bool allowTransposition = true;
+};
+
+struct PitchEvents {
+  std::vector<double> time;
+  std::vector<int32_t> pitch;
+  std::vector<int32_t> velocity;
+  std::vector<double> duration;
+
+  size_t size() const { return time.size(); }
+};
+
+bool generateMelody(const MelodySystem& system,
+                    const std::vector<double>& attackTimes,
+                    double duration,
+                    int rootPitch,
+                    PitchEvents& out,
+                    std::string& error);
+
+// =============================================================================
+// BOOK III - HARMONY
+// =============================================================================
+
+struct HarmonySystem {
+  std::vector<double> distribution;  // Interval weights, indexed 0-11
+};
+
+/**
+ * Chord events; chord i's intervals are
+ * intervals[intervalOffsets[i] .. intervalOffsets[i + 1])
+ */
+struct ChordEvents {
+  std::vector<double> time;
+  std::vector<int32_t> root;
+  std::vector<double> weight;
+  std::vector<int32_t> intervalOffsets{0};
+  std::vector<int32_t> intervals;
+
+  size_t size() const { return time.size(); }
+};
+
+bool generateHarmony(const HarmonySystem& system,
+                     const std::vector<double>& attackTimes,
+                     double duration,
+                     int rootPitch,
+                     ChordEvents& out,
+                     std::string& error);
+
+// =============================================================================
+// BOOK IV - FORM
+// =============================================================================
+
+/**
+ * Ratio tree node in a flat array; each node's children are stored
+ * contiguously, `childCount` nodes starting at `firstChild`
+ */
+struct RatioTreeNode {
+  std::string nodeId;
+  double ratio = 1.0;
+  uint32_t firstChild = 0;
+  uint32_t childCount = 0;
+};
+
+struct FormSystem {
+  std::vector<RatioTreeNode> nodes;  // nodes[0] is the root
+  int nestingDepth = 3;
+};
+
+struct FormSections {
+  std::vector<std::string> sectionId;
+  std::vector<double> startTime;
+  std::vector<double> duration;
+
+  size_t size() const { return startTime.size(); }
+};
+
+bool generateForm(const FormSystem& system,
+                  double totalDuration,
+                  FormSections& out,
+                  std::string& error);
+
+} // namespace generation
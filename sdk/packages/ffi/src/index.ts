@@ -19,6 +19,10 @@ export interface FFIBindings {
   generateMelody(melodySystemJSON: string, rhythmAttacksJSON: string, duration: number, rootPitch?: number): string;
   generateHarmony(harmonySystemJSON: string, rhythmAttacksJSON: string, duration: number, rootPitch?: number): string;
   generateForm(formSystemJSON: string, totalDuration: number): string;
+  generateRhythmAttacksAsync(rhythmSystem: RhythmSystemConfig | string, duration: number): Promise<RhythmAttackColumns>;
+  generateMelodyAsync(melodySystem: MelodySystemConfig | string, rhythmAttacks: RhythmAttackInput, duration: number, rootPitch?: number): Promise<PitchEventColumns>;
+  generateHarmonyAsync(harmonySystem: HarmonySystemConfig | string, rhythmAttacks: RhythmAttackInput, duration: number, rootPitch?: number): Promise<ChordEventColumns>;
+  generateFormAsync(formSystem: FormSystemConfig | string, totalDuration: number): Promise<FormSectionColumns>;
 }
 
 /**
@@ -170,6 +174,54 @@ export interface FormSystemConfig {
   nestingDepth: number;  // Maximum nesting level (1-10)
 }
 
+// =============================================================================
+// COLUMNAR RESULTS
+// =============================================================================
+
+/**
+ * Rhythm attacks as parallel columns; attack i is (time[i], accent[i])
+ */
+export interface RhythmAttackColumns {
+  time: Float64Array;
+  accent: Float64Array;
+}
+
+/**
+ * Attack times accepted by the async melody and harmony generators
+ */
+export type RhythmAttackInput = RhythmAttackColumns | Float64Array | RhythmAttack[];
+
+/**
+ * Pitch events as parallel columns
+ */
+export interface PitchEventColumns {
+  time: Float64Array;
+  pitch: Int32Array;
+  velocity: Int32Array;
+  duration: Float64Array;
+}
+
+/**
+ * Chord events as parallel columns; chord i's intervals are
+ * intervals.subarray(intervalOffsets[i], intervalOffsets[i + 1])
+ */
+export interface ChordEventColumns {
+  time: Float64Array;
+  root: Int32Array;
+  weight: Float64Array;
+  intervalOffsets: Int32Array;  // length = chord count + 1
+  intervals: Int32Array;
+}
+
+/**
+ * Form sections as parallel columns
+ */
+export interface FormSectionColumns {
+  sectionId: string[];
+  startTime: Float64Array;
+  duration: Float64Array;
+}
+
 // =============================================================================
 // WRAPPER
 // =============================================================================
@@ -391,5 +443,64 @@ export function generateForm(
   return form;
 }
 
+// =============================================================================
+// ASYNC COLUMNAR GENERATION
+// =============================================================================
+
+/**
+ * Generate rhythm attacks off the JavaScript thread
+ *
+ * Same attacks as generateRhythmAttacks, returned as typed-array columns
+ * that share memory with the native result (no per-event objects or JSON).
+ *
+ * @example
+ * ```typescript
+ * const { time, accent } = await generateRhythmAttacksAsync(rhythmSystem, 8);
+ * ```
+ */
+export function generateRhythmAttacksAsync(
+  rhythmSystem: RhythmSystemConfig,
+  duration: number
+): Promise<RhythmAttackColumns> {
+  return getFFI().generateRhythmAttacksAsync(rhythmSystem, duration);
+}
+
+/**
+ * Generate melody off the JavaScript thread
+ *
+ * @param rhythmAttacks - Columns from generateRhythmAttacksAsync (passed
+ *                        through without copying to JavaScript objects)
+ */
+export function generateMelodyAsync(
+  melodySystem: MelodySystemConfig,
+  rhythmAttacks: RhythmAttackInput,
+  duration: number,
+  rootPitch: number = 60
+): Promise<PitchEventColumns> {
+  return getFFI().generateMelodyAsync(melodySystem, rhythmAttacks, duration, rootPitch);
+}
+
+/**
+ * Generate harmony off the JavaScript thread
+ */
+export function generateHarmonyAsync(
+  harmonySystem: HarmonySystemConfig,
+  rhythmAttacks: RhythmAttackInput,
+  duration: number,
+  rootPitch: number = 60
+): Promise<ChordEventColumns> {
+  return getFFI().generateHarmonyAsync(harmonySystem, rhythmAttacks, duration, rootPitch);
+}
+
+/**
+ * Generate form structure off the JavaScript thread
+ */
+export function generateFormAsync(
+  formSystem: FormSystemConfig,
+  totalDuration: number
+): Promise<FormSectionColumns> {
+  return getFFI().generateFormAsync(formSystem, totalDuration);
+}
+
 // Re-export all bindings for direct access
 export { bindings };
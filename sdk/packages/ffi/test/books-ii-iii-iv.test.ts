@@ -10,6 +10,10 @@ import {
   generateHarmony,
   generateForm,
   generateRhythmAttacks,
+  generateRhythmAttacksAsync,
+  generateMelodyAsync,
+  generateHarmonyAsync,
+  generateFormAsync,
   type MelodySystemConfig,
   type HarmonySystemConfig,
   type FormSystemConfig,
@@ -402,3 +406,86 @@ describe("Integration Tests - Complete Pipeline", () => {
     console.log(`   - Form: ${form.length} sections`);
   });
 });
+
+describe("Async Columnar Generation", () => {
+  const rhythmSystem: RhythmSystemConfig = {
+    systemId: "rhythm-async",
+    systemType: "rhythm",
+    generators: [
+      { period: 3, phase: 0, weight: 1.0 },
+      { period: 4, phase: 0, weight: 1.0 },
+    ],
+    resultantSelection: { method: "interference" },
+  };
+
+  it("should compute 3-against-4 interference event-exactly", async () => {
+    const { time, accent } = await generateRhythmAttacksAsync(rhythmSystem, 12);
+
+    expect(time).toBeInstanceOf(Float64Array);
+    expect(Array.from(time)).toEqual([0, 3, 4, 6, 8, 9]);
+    expect(Array.from(accent)).toEqual([2, 1, 1, 1, 1, 1]);
+  });
+
+  it("should match the synchronous JSON results", async () => {
+    const melodySystem: MelodySystemConfig = {
+      systemId: "melody-async",
+      systemType: "melody",
+      cycleLength: 7,
+      intervalSeed: [2, 2, 1, 2, 2, 2, 1],
+      rhythmBinding: "rhythm-async",
+    };
+    const harmonySystem: HarmonySystemConfig = {
+      systemId: "harmony-async",
+      systemType: "harmony",
+      distribution: [0.1, 0.3, 0.8, 1.0, 0.6, 0.1, 0.9, 0.4, 0.7, 0.5, 0.2, 0.0],
+      harmonicRhythmBinding: "rhythm-async",
+    };
+
+    const attacks = generateRhythmAttacks(rhythmSystem, 16);
+    const columns = await generateRhythmAttacksAsync(rhythmSystem, 16);
+    expect(Array.from(columns.time)).toEqual(attacks.map((a) => a.time));
+
+    const melody = generateMelody(melodySystem, attacks, 16, 60);
+    const melodyColumns = await generateMelodyAsync(melodySystem, columns, 16, 60);
+    expect(Array.from(melodyColumns.pitch)).toEqual(melody.map((e) => e.pitch));
+    expect(Array.from(melodyColumns.duration)).toEqual(melody.map((e) => e.duration));
+
+    const harmony = generateHarmony(harmonySystem, attacks, 16, 60);
+    const chords = await generateHarmonyAsync(harmonySystem, columns, 16, 60);
+    expect(chords.intervalOffsets.length).toBe(harmony.length + 1);
+    harmony.forEach((chord, i) => {
+      const intervals = chords.intervals.subarray(chords.intervalOffsets[i], chords.intervalOffsets[i + 1]);
+      expect(Array.from(intervals)).toEqual(chord.intervals);
+    });
+  });
+
+  it("should return form sections as columns", async () => {
+    const formSystem: FormSystemConfig = {
+      systemId: "form-async",
+      systemType: "form",
+      ratioTree: {
+        nodeId: "root",
+        ratio: 1,
+        children: [
+          { nodeId: "A", ratio: 1 },
+          { nodeId: "B", ratio: 3 },
+        ],
+      },
+      nestingDepth: 3,
+    };
+
+    const form = await generateFormAsync(formSystem, 16);
+    expect(form.sectionId).toEqual(["A", "B"]);
+    expect(Array.from(form.startTime)).toEqual([0, 4]);
+    expect(Array.from(form.duration)).toEqual([4, 12]);
+  });
+
+  it("should reject instead of hanging on runaway rhythms", async () => {
+    const dense: RhythmSystemConfig = {
+      ...rhythmSystem,
+      generators: [{ period: 1e-6, phase: 0 }],
+    };
+
+    await expect(generateRhythmAttacksAsync(dense, 1e6)).rejects.toThrow(/more than/);
+  });
+});
@@ -4,7 +4,9 @@
 #include "SchillingerWizard.h"
 #include "AdvancedHarmonyAPI.h"
 #include "OrchestrationAPI.h"
+#include "ShardedLRUCache.h"
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <memory>
 #include <unordered_map>
@@ -33,6 +35,8 @@ struct MemoryStats {
     size_t harmonyCacheSize{0};
     size_t orchestrationCacheSize{0};
     double cacheHitRatio{0.0};
+    uint64_t cacheEvictions{0};
+    double averageLookupNanos{0.0};
     int activeModules{0};
 
     juce::var toJSON() const {
@@ -44,6 +48,8 @@ struct MemoryStats {
         obj->setProperty("harmonyCacheSize", (int64)harmonyCacheSize);
         obj->setProperty("orchestrationCacheSize", (int64)orchestrationCacheSize);
         obj->setProperty("cacheHitRatio", cacheHitRatio);
+        obj->setProperty("cacheEvictions", (int64)cacheEvictions);
+        obj->setProperty("averageLookupNanos", averageLookupNanos);
         obj->setProperty("activeModules", activeModules);
         return obj.get();
     }
@@ -138,6 +144,7 @@ public:
     MemoryStats getMemoryStats() const;
     void resetMemoryStats();
     double getCacheHitRatio() const;
+    CacheStatistics getCacheStatistics() const;
 
     // Memory management
     void clearAllCaches();
@@ -162,52 +169,44 @@ private:
     std::unordered_map<std::string, std::unique_ptr<IntegratedSession>> sessions;
     mutable std::mutex sessionsMutex;
 
-    // Caching systems
-    struct CacheEntry {
-        std::vector<uint8_t> data;
-        std::chrono::steady_clock::time_point lastAccess;
-        size_t accessCount{0};
-        size_t size{0};
+    // Caching systems: serialized JSON per entry, immutable once cached.
+    // Each cache is sharded with its own O(1) LRU list and gets a third of maxCacheSize.
+    using SerializedCache = ShardedLRUCache<std::vector<uint8_t>>;
 
-        CacheEntry() : lastAccess(std::chrono::steady_clock::now()) {}
-    };
-
-    std::unordered_map<std::string, CacheEntry> wizardCache;
-    std::unordered_map<std::string, CacheEntry> harmonyCache;
-    std::unordered_map<std::string, CacheEntry> orchestrationCache;
-    mutable std::mutex cacheMutex;
+    SerializedCache wizardCache;
+    SerializedCache harmonyCache;
+    SerializedCache orchestrationCache;
 
     // Performance configuration
+    static constexpr size_t defaultMaxCacheSize = 64 * 1024 * 1024; // 64MB
     OptimizationLevel currentOptimizationLevel{OptimizationLevel::Standard};
-    size_t maxCacheSize{64 * 1024 * 1024}; // 64MB default
-    size_t currentCacheSize{0};
+    std::atomic<size_t> maxCacheSize{defaultMaxCacheSize};
 
     // Performance monitoring
     mutable std::atomic<size_t> totalMemoryAllocated{0};
     mutable std::atomic<size_t> peakMemoryUsage{0};
-    mutable std::atomic<uint64_t> cacheHits{0};
-    mutable std::atomic<uint64_t> cacheMisses{0};
 
-    // Background optimization
+    // Background optimization: expires stale sessions and cache entries; the cache
+    // budget itself is enforced on insert
     std::atomic<bool> backgroundOptimizationRunning{false};
     std::thread optimizationThread;
+    std::mutex optimizationMutex;
+    std::condition_variable optimizationWakeup;
 
     // Internal methods
     void updateMemoryStats() const;
     void cleanupExpiredCacheEntries();
-    void evictLeastRecentlyUsed();
+    void applyCacheBudget();
+    size_t getCachedBytes() const;
 
     template<typename T>
-    juce::Result serializeAndCache(const T& object, const std::string& key,
-                                   std::unordered_map<std::string, CacheEntry>& cache);
+    juce::Result serializeAndCache(const T& object, const std::string& key, SerializedCache& cache);
 
     template<typename T>
-    T deserializeFromCache(const std::string& key,
-                          const std::unordered_map<std::string, CacheEntry>& cache) const;
+    T deserializeFromCache(const std::string& key, SerializedCache& cache) const;
 
     // Background optimization thread
     void backgroundOptimizationLoop();
-    void optimizeCacheDistribution();
 
     // Suggestion generation helpers
     void generateWizardSuggestions(const SuggestionContext& context, juce::Array<Suggestion>& suggestions);
@@ -0,0 +1,439 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace schillinger {
+namespace performance {
+
+/**
+ * Counters reported by ShardedLRUCache
+ */
+struct CacheStatistics {
+    size_t entries{0};
+    size_t bytesUsed{0};
+    size_t capacityBytes{0};
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t insertions{0};
+    uint64_t evictions{0};
+    uint64_t rejections{0};         // Entries larger than a whole shard's budget
+    double averageLookupNanos{0.0}; // Sampled, one lookup in 64 per shard is timed
+
+    double hitRatio() const {
+        const uint64_t lookups = hits + misses;
+        return lookups > 0 ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+    }
+};
+
+/**
+ * How lookups interact with the recency order
+ */
+enum class CacheReadMode : uint8_t {
+    ExactLRU = 0,   // Lookups take the shard lock exclusively and move the entry to the front
+    SharedRead = 1  // Lookups take the shard lock shared and only mark the entry; eviction
+                    // gives marked entries a second chance instead of evicting them
+};
+
+/**
+ * Byte-budgeted LRU cache of immutable values, split into independently locked shards.
+ *
+ * Each shard owns a hash map whose nodes are threaded onto an intrusive doubly linked
+ * recency list, so lookup, insert, touch and evict are all O(1) regardless of how many
+ * entries are cached. Values are handed out as shared_ptr<const Value>, so a caller can
+ * keep using an entry after it has been evicted and never holds a lock while doing so.
+ *
+ * The byte budget is split evenly across shards and enforced on insert; there is no
+ * background eviction.
+ */
+template <typename Value>
+class ShardedLRUCache {
+public:
+    using ValuePtr = std::shared_ptr<const Value>;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t defaultShardCount = 16;
+
+    explicit ShardedLRUCache(size_t capacityBytes,
+                             size_t shardCount = defaultShardCount,
+                             CacheReadMode readMode = CacheReadMode::SharedRead)
+        : numShards(roundUpToPowerOfTwo(shardCount)),
+          shardBits(log2(numShards)),
+          mode(readMode),
+          shards(new Shard[numShards]) {
+        setCapacity(capacityBytes);
+    }
+
+    ShardedLRUCache(const ShardedLRUCache&) = delete;
+    ShardedLRUCache& operator=(const ShardedLRUCache&) = delete;
+
+    /**
+     * Insert or replace an entry, charging it `charge` bytes against the budget.
+     * Returns false if the entry is larger than a shard's budget; any previous
+     * value for the key is dropped in that case so it cannot be served stale.
+     */
+    bool insert(const std::string& key, ValuePtr value, size_t charge) {
+        Shard& shard = shardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+        auto existing = shard.entries.find(key);
+        if (existing != shard.entries.end()) {
+            removeNode(shard, existing);
+        }
+
+        if (charge > shard.capacity) {
+            shard.rejections.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        evictUntilFits(shard, charge);
+
+        auto it = shard.entries.try_emplace(key).first;
+        Node& node = it->second;
+        node.key = &it->first;
+        node.value = std::move(value);
+        node.charge = charge;
+        node.lastAccessTicks.store(refreshClock(), std::memory_order_relaxed);
+        linkAtFront(shard, node);
+
+        shard.bytesUsed.store(shard.bytesUsed.load(std::memory_order_relaxed) + charge, std::memory_order_relaxed);
+        shard.count.store(shard.entries.size(), std::memory_order_relaxed);
+        shard.insertions.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** Returns the cached value, or nullptr on a miss. Counts towards hit/miss statistics. */
+    ValuePtr find(const std::string& key) {
+        Shard& shard = shardFor(key);
+
+        const bool timed = (shard.lookups.fetch_add(1, std::memory_order_relaxed) & 63) == 0;
+        const auto start = timed ? Clock::now() : Clock::time_point{};
+        if (timed) {
+            coarseTicks.store(start.time_since_epoch().count(), std::memory_order_relaxed);
+        }
+
+        ValuePtr result = mode == CacheReadMode::ExactLRU ? findExclusive(shard, key)
+                                                          : findShared(shard, key);
+
+        if (timed) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+            shard.timedLookups.fetch_add(1, std::memory_order_relaxed);
+            shard.timedLookupNanos.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+        }
+
+        if (!result) {
+            shard.misses.fetch_add(1, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /** Membership test; does not touch recency or statistics. */
+    bool contains(const std::string& key) const {
+        const Shard& shard = shardFor(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.entries.find(key) != shard.entries.end();
+    }
+
+    bool erase(const std::string& key) {
+        Shard& shard = shardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+        auto it = shard.entries.find(key);
+        if (it == shard.entries.end()) {
+            return false;
+        }
+
+        removeNode(shard, it);
+        return true;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < numShards; ++i) {
+            Shard& shard = shards[i];
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            shard.entries.clear();
+            shard.head.prev = shard.head.next = &shard.head;
+            shard.bytesUsed.store(0, std::memory_order_relaxed);
+            shard.count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Drop entries that have not been looked up for maxAge. Walks each shard from its
+     * least recently used end and stops at the first entry that is still fresh, so the
+     * cost is proportional to the number of entries expired, not the cache size.
+     *
+     * Lookups stamp entries from a coarse clock that inserts, sampled lookups and this
+     * call refresh, so an entry looked up since the previous call is never expired as
+     * long as calls are less than maxAge apart.
+     */
+    size_t expireOlderThan(Clock::duration maxAge) {
+        const auto cutoff = refreshClock() - maxAge.count();
+        size_t expired = 0;
+
+        for (size_t i = 0; i < numShards; ++i) {
+            Shard& shard = shards[i];
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+            size_t remainingChecks = shard.entries.size();
+            while (remainingChecks-- > 0 && shard.head.prev != &shard.head) {
+                Node* oldest = shard.head.prev;
+
+                if (oldest->referenced.exchange(false, std::memory_order_relaxed)) {
+                    moveToFront(shard, *oldest);
+                    continue;
+                }
+
+                if (oldest->lastAccessTicks.load(std::memory_order_relaxed) >= cutoff) {
+                    break;
+                }
+
+                removeNode(shard, shard.entries.find(*oldest->key));
+                ++expired;
+            }
+        }
+
+        return expired;
+    }
+
+    /** Change the total byte budget; shards over their new share evict immediately. */
+    void setCapacity(size_t capacityBytes) {
+        totalCapacity.store(capacityBytes, std::memory_order_relaxed);
+
+        for (size_t i = 0; i < numShards; ++i) {
+            Shard& shard = shards[i];
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            shard.capacity = capacityBytes / numShards;
+            evictUntilFits(shard, 0);
+        }
+    }
+
+    size_t getCapacity() const { return totalCapacity.load(std::memory_order_relaxed); }
+    size_t getShardCount() const { return numShards; }
+    CacheReadMode getReadMode() const { return mode; }
+
+    size_t size() const {
+        size_t total = 0;
+        for (size_t i = 0; i < numShards; ++i) {
+            total += shards[i].count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    size_t bytesUsed() const {
+        size_t total = 0;
+        for (size_t i = 0; i < numShards; ++i) {
+            total += shards[i].bytesUsed.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    CacheStatistics getStatistics() const {
+        CacheStatistics stats;
+        stats.capacityBytes = getCapacity();
+
+        uint64_t timedLookups = 0;
+        uint64_t timedNanos = 0;
+
+        for (size_t i = 0; i < numShards; ++i) {
+            const Shard& shard = shards[i];
+            stats.entries += shard.count.load(std::memory_order_relaxed);
+            stats.bytesUsed += shard.bytesUsed.load(std::memory_order_relaxed);
+            const uint64_t misses = shard.misses.load(std::memory_order_relaxed);
+            stats.hits += shard.lookups.load(std::memory_order_relaxed) - misses;
+            stats.misses += misses;
+            stats.insertions += shard.insertions.load(std::memory_order_relaxed);
+            stats.evictions += shard.evictions.load(std::memory_order_relaxed);
+            stats.rejections += shard.rejections.load(std::memory_order_relaxed);
+            timedLookups += shard.timedLookups.load(std::memory_order_relaxed);
+            timedNanos += shard.timedLookupNanos.load(std::memory_order_relaxed);
+        }
+
+        stats.averageLookupNanos = timedLookups > 0 ? static_cast<double>(timedNanos) / timedLookups : 0.0;
+        return stats;
+    }
+
+    void resetStatistics() {
+        for (size_t i = 0; i < numShards; ++i) {
+            Shard& shard = shards[i];
+            shard.lookups.store(0, std::memory_order_relaxed);
+            shard.misses.store(0, std::memory_order_relaxed);
+            shard.insertions.store(0, std::memory_order_relaxed);
+            shard.evictions.store(0, std::memory_order_relaxed);
+            shard.rejections.store(0, std::memory_order_relaxed);
+            shard.timedLookups.store(0, std::memory_order_relaxed);
+            shard.timedLookupNanos.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    // Map node doubling as a recency list link; unordered_map nodes never move,
+    // so the list can point straight at them
+    struct Node {
+        ValuePtr value;
+        size_t charge{0};
+        const std::string* key{nullptr};
+        Node* prev{nullptr};
+        Node* next{nullptr};
+        std::atomic<int64_t> lastAccessTicks{0};
+        std::atomic<bool> referenced{false};
+    };
+
+    using Map = std::unordered_map<std::string, Node>;
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        Map entries;
+        Node head;          // Sentinel: head.next is most recent, head.prev least recent
+        size_t capacity{0};
+
+        // Written under the exclusive lock, read without it for statistics
+        std::atomic<size_t> bytesUsed{0};
+        std::atomic<size_t> count{0};
+
+        std::atomic<uint64_t> lookups{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> insertions{0};
+        std::atomic<uint64_t> evictions{0};
+        std::atomic<uint64_t> rejections{0};
+        std::atomic<uint64_t> timedLookups{0};
+        std::atomic<uint64_t> timedLookupNanos{0};
+
+        Shard() { head.prev = head.next = &head; }
+    };
+
+    const size_t numShards;
+    const unsigned shardBits;
+    const CacheReadMode mode;
+    std::unique_ptr<Shard[]> shards;
+    std::atomic<size_t> totalCapacity{0};
+    std::atomic<int64_t> coarseTicks{Clock::now().time_since_epoch().count()};
+
+    static size_t roundUpToPowerOfTwo(size_t n) {
+        size_t result = 1;
+        while (result < n) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static unsigned log2(size_t powerOfTwo) {
+        unsigned bits = 0;
+        while ((size_t{1} << bits) < powerOfTwo) {
+            ++bits;
+        }
+        return bits;
+    }
+
+    // Fibonacci hashing on the top bits, so shard choice is independent of the
+    // low bits each shard's own hash table buckets on
+    size_t shardIndex(const std::string& key) const {
+        if (shardBits == 0) {
+            return 0;
+        }
+        const uint64_t hash = static_cast<uint64_t>(std::hash<std::string>{}(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> (64 - shardBits));
+    }
+
+    int64_t refreshClock() {
+        const int64_t now = Clock::now().time_since_epoch().count();
+        coarseTicks.store(now, std::memory_order_relaxed);
+        return now;
+    }
+
+    // Only store when the value changes, so concurrent readers of a hot entry
+    // do not keep invalidating each other's copy of its cache line
+    static void touch(Node& node, int64_t ticks) {
+        if (node.lastAccessTicks.load(std::memory_order_relaxed) != ticks) {
+            node.lastAccessTicks.store(ticks, std::memory_order_relaxed);
+        }
+    }
+
+    Shard& shardFor(const std::string& key) { return shards[shardIndex(key)]; }
+    const Shard& shardFor(const std::string& key) const { return shards[shardIndex(key)]; }
+
+    ValuePtr findExclusive(Shard& shard, const std::string& key) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+        auto it = shard.entries.find(key);
+        if (it == shard.entries.end()) {
+            return nullptr;
+        }
+
+        Node& node = it->second;
+        moveToFront(shard, node);
+        touch(node, coarseTicks.load(std::memory_order_relaxed));
+        return node.value;
+    }
+
+    ValuePtr findShared(Shard& shard, const std::string& key) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+        auto it = shard.entries.find(key);
+        if (it == shard.entries.end()) {
+            return nullptr;
+        }
+
+        Node& node = it->second;
+        if (!node.referenced.load(std::memory_order_relaxed)) {
+            node.referenced.store(true, std::memory_order_relaxed);
+        }
+        touch(node, coarseTicks.load(std::memory_order_relaxed));
+        return node.value;
+    }
+
+    static void linkAtFront(Shard& shard, Node& node) {
+        node.prev = &shard.head;
+        node.next = shard.head.next;
+        shard.head.next->prev = &node;
+        shard.head.next = &node;
+    }
+
+    static void unlink(Node& node) {
+        node.prev->next = node.next;
+        node.next->prev = node.prev;
+    }
+
+    static void moveToFront(Shard& shard, Node& node) {
+        if (shard.head.next != &node) {
+            unlink(node);
+            linkAtFront(shard, node);
+        }
+    }
+
+    static void removeNode(Shard& shard, typename Map::iterator it) {
+        unlink(it->second);
+        shard.bytesUsed.store(shard.bytesUsed.load(std::memory_order_relaxed) - it->second.charge,
+                              std::memory_order_relaxed);
+        shard.entries.erase(it);
+        shard.count.store(shard.entries.size(), std::memory_order_relaxed);
+    }
+
+    // Second-chance LRU: an entry read under a shared lock since it last reached the
+    // tail moves back to the front once instead of being evicted
+    static void evictUntilFits(Shard& shard, size_t incoming) {
+        while (shard.bytesUsed.load(std::memory_order_relaxed) + incoming > shard.capacity
+               && shard.head.prev != &shard.head) {
+            Node* victim = shard.head.prev;
+
+            if (victim->referenced.exchange(false, std::memory_order_relaxed)) {
+                moveToFront(shard, *victim);
+                continue;
+            }
+
+            removeNode(shard, shard.entries.find(*victim->key));
+            shard.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace performance
+} // namespace schillinger